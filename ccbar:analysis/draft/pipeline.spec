@@ -0,0 +1,24 @@
+# version: 1.2
+# Spec for bin/pipeline: 4-point chain of 4pt-analysis.ipynb (Coulomb gauge)
+#   bin/pipeline -j 8 draft/pipeline.spec
+
+xyzSize = 32
+t = 0-31
+bins = 18
+input = /Volumes/X6/data/ccbar/gfix_C/4pt/trev/{ch}.{t}.gfix_C.{bin}
+
+# F_KS (fks-ti) and V0, Vs (v-ti); mc comes from the fit of F_KS
+mdiff = 0.0483
+mps = 1.3665
+mv = 1.4148
+# mc = <MC>
+
+# Jackknife mean and error, binary and cart2sphr text
+fks = result/Coulomb/fks/fks.ti.{t}
+fksSphr = result/Coulomb/fks/sphr.fks.ti.{t}.txt
+# v0Sphr = result/Coulomb/v-ti/sphr.v0.{t}.txt
+# vsSphr = result/Coulomb/v-ti/sphr.vs.{t}.txt
+
+# Intermediates (uncomment to keep them, e.g. for fks-td)
+# jksamp = /Volumes/X6/data/ccbar/gfix_C/4pt/jksamp.ens#{ch}.{t}.gfix_C.{bin}
+# prev = /Volumes/X6/data/ccbar/gfix_C/4pt/prev.ens#{ch}.{t}.gfix_C.{bin}
@@ -59,8 +59,16 @@ para = {
 A_arr, M_arr, chisq_arr = [], [], []
 file_index = 0
 
+
+# Skip the 128-byte header written by the C++ tools with -H (if any)
+def loadBin(ifname):
+    with open(ifname, "rb") as f:
+        offset = 128 if f.read(8) == b"CCBARBIN" else 0
+    return np.fromfile(ifname, dtype=np.float64, offset=offset)
+
+
 for ifname in args.ifname:
-    rawdata = np.fromfile(ifname, dtype=np.float64)
+    rawdata = loadBin(ifname)
     assert rawdata.size == t_size * 2
     rawdata = rawdata.reshape(t_size, 2)
 
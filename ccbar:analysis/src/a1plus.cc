@@ -14,32 +14,51 @@
 
 #include <complex>
 #include <valarray>
+#include <vector>
 
-#include "arr2corr.h"
+#include "buffer.h"
 #include "dataio.h"
+#include "lattice.h"
 #include "misc.h"
+#include "threadpool.h"
 
 void usage(char* name) {
   fprintf(stderr, "A1+ projection for 4-point correlators\n");
   fprintf(stderr,
           "USAGE: \n"
-          "    %s [OPTIONS] ifname1 [ifname2 ...]\n",
+          "    %s [OPTIONS] ifname1 [ifname2 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -n <XYZSIZE>:   Spacial size of lattice\n"
-          "    -d <OFDIR>:     Directory of output files\n"
+          "    -n <XYZSIZE>:   Spacial size of lattice (default: from file header)\n"
+          "    -d <OFDIR>:     Directory (or ensemble container *.ens) of output files\n"
+          "    [-j <THREADS>]: Number of threads (default: 1)\n"
+          "    [-r]:           Write only the O_h orbit representatives x <= y <= z <= L/2\n"
+          "                    ((L/2+1)(L/2+2)(L/2+3)/6 numbers, in cart2sphr order)\n"
+          "    [-q <DEPTH>]:   Read up to DEPTH files ahead and write in the background\n"
+          "    [-m <MBYTES>]:  Memory budget of each background queue (default: unlimited)\n"
+          "    [-e <ENC>]:     Encoding of output files: f64 (default), f32 or bf16\n"
+          "    [-z]:           Compress output files (lossless: byte shuffle and LZ)\n"
+          "    [-H]:           Write self-describing header to output files\n"
           "    [-h, --help]:   Print help\n");
 }
 
 // Custom function declaration
-void a1plus(char* rawDataList[], char* a1list[], int xyzSize, int fileCountTotal);
+void a1plus(char* rawDataList[], char* a1list[], int xyzSize, int fileCountTotal, int threadCount, bool isReduced);
 
 // Main function
 int main(int argc, char* argv[]) {
   // Global variables
   int xyzSize = 0;
   static const char* ofDir = NULL;
+  int threadCount = 1;
+  bool isReduced = false;
+  int queueDepth = 0;  // 0: synchronous I/O
+  long long budgetBytes = -1;
+  BinEncoding encoding = BIN_ENC_F64;
+  bool isHeader = false;
+  bool isCompress = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -77,17 +96,102 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -r: orbit representatives only
+    if (strcmp(argv[0], "-r") == 0) {
+      isReduced = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -q: queue depth of asynchronous I/O
+    if (strcmp(argv[0], "-q") == 0) {
+      if (argv[1] == NULL || atoi(argv[1]) < 1) {
+        usage(programName);
+        exit(1);
+      }
+      queueDepth = atoi(argv[1]);
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -m: memory budget (MB) of asynchronous I/O
+    if (strcmp(argv[0], "-m") == 0) {
+      if (argv[1] == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      budgetBytes = atoll(argv[1]) * 1024 * 1024;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -e: encoding of output files
+    if (strcmp(argv[0], "-e") == 0) {
+      if (!parseBinEncoding(argv[1], encoding)) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -z: compress output files
+    if (strcmp(argv[0], "-z") == 0) {
+      isCompress = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
   }
 
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
   const int fileCountTotal = argc;
   if (fileCountTotal < 1) {
     usage(programName);
     exit(1);
   }
 
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !xyzSize) xyzSize = header.xyzSize;
+  if (!xyzSize) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, xyzSize, 0);
+  setBinEncoding(encoding);
+  setBinCompression(isCompress ? BIN_COMP_LZ : BIN_COMP_NONE, threadCount);
+
   // Create an array to store ofnames
   char* ofnameArr[fileCountTotal];
 
@@ -96,8 +200,10 @@ int main(int argc, char* argv[]) {
     changePath(argv[i], ofDir, ofnameArr[i]);
   }
 
-  // Main part for calculation
-  a1plus(argv, ofnameArr, xyzSize, fileCountTotal);
+  // Main part for calculation (files are handed out in order, so they can be read ahead)
+  prefetchBin(argv, fileCountTotal, queueDepth, budgetBytes);
+  a1plus(argv, ofnameArr, xyzSize, fileCountTotal, threadCount, isReduced);
+  syncBin();
 
   // Finalization for the ofname array
   for (int i = 0; i < fileCountTotal; i++) {
@@ -108,39 +214,31 @@ int main(int argc, char* argv[]) {
 }
 
 // Custom function definition
-inline COMPLX naiveSym(COMPLX* data, int x, int y, int z, int xyzSize) {
-  return (CORR(data, x, y, z, xyzSize) + CORR(data, y, z, x, xyzSize) + CORR(data, z, x, y, xyzSize) +
-          CORR(data, x, z, y, xyzSize) + CORR(data, z, y, x, xyzSize) + CORR(data, y, x, z, xyzSize)) /
-         6.0;
-}
-
-inline COMPLX a1Sym(COMPLX* data, int x, int y, int z, int xyzSize) {
-  return (naiveSym(data, x, y, z, xyzSize) + naiveSym(data, x, y, xyzSize - z, xyzSize) +
-          naiveSym(data, x, xyzSize - y, z, xyzSize) + naiveSym(data, x, xyzSize - y, xyzSize - z, xyzSize) +
-          naiveSym(data, xyzSize - x, y, z, xyzSize) + naiveSym(data, xyzSize - x, y, xyzSize - z, xyzSize) +
-          naiveSym(data, xyzSize - x, xyzSize - y, z, xyzSize) +
-          naiveSym(data, xyzSize - x, xyzSize - y, xyzSize - z, xyzSize)) /
-         8.0;
-}
-
-void a1plus(char* rawDataList[], char* a1list[], int xyzSize, int fileCountTotal) {
+void a1plus(char* rawDataList[], char* a1list[], int xyzSize, int fileCountTotal, int threadCount, bool isReduced) {
   int arrayLength = int(pow(xyzSize, 3));
 
-  for (int i = 0; i < fileCountTotal; i++) {
-    COMPLX tmp[arrayLength], result[arrayLength];
-    for (int j = 0; j < arrayLength; j++)  // Initialize the empty arrays
-    {
-      tmp[j] = result[j] = 0.0;
+  // Orbits are enumerated once; each orbit is averaged once per file
+  Lattice lat;
+  latticeInit(lat, xyzSize);
+
+  parallelFor(fileCountTotal, threadCount, [&](int i) {
+    const COMPLX* tmp;
+    COMPLX* result;
+    BinMap inMap, outMap;
+
+    mapBin(rawDataList[i], arrayLength, tmp, inMap);
+
+    if (isReduced) {
+      mapBinOut(a1list[i], lat.orbitCount, result, outMap);
+      latticeOrbitMean(lat, tmp, result);
+    } else {
+      COMPLX* orbitMean = bufferScratch<COMPLX>(0, lat.orbitCount);
+      mapBinOut(a1list[i], arrayLength, result, outMap);
+      latticeOrbitMean(lat, tmp, orbitMean);
+      latticeOrbitScatter(lat, orbitMean, result);
     }
 
-    readBin(rawDataList[i], arrayLength, tmp);
-
-    for (int ix = 0; ix < xyzSize; ix++)
-      for (int iy = 0; iy < xyzSize; iy++)
-        for (int iz = 0; iz < xyzSize; iz++) {
-          CORR(result, ix, iy, iz, xyzSize) = a1Sym(tmp, ix, iy, iz, xyzSize);
-        }
-
-    writeBin(a1list[i], arrayLength, result);
-  }
+    unmapBin(inMap);
+    unmapBin(outMap);
+  });
 }
@@ -0,0 +1,57 @@
+/**
+ * @file accum.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "accum.h"
+
+#include <math.h>
+
+#include <complex>
+#include <valarray>
+
+#include "alias.h"
+
+void welfordInit(Welford& acc, int arrayLength) {
+  acc.count = 0;
+  acc.mean.resize(arrayLength, 0.0);
+  acc.m2.resize(arrayLength, 0.0);
+  acc.mean = acc.m2 = 0.0;
+}
+
+void welfordPush(Welford& acc, const DOUBLE* data) {
+  const int arrayLength = acc.mean.size();
+  const DOUBLE invCount = 1.0 / ++acc.count;
+
+  for (int i = 0; i < arrayLength; i++) {
+    DOUBLE delta = data[i] - acc.mean[i];
+    acc.mean[i] += delta * invCount;
+    acc.m2[i] += delta * (data[i] - acc.mean[i]);
+  }
+}
+
+void welfordPush(Welford& acc, const COMPLX* data) {
+  const int arrayLength = acc.mean.size();
+  const DOUBLE invCount = 1.0 / ++acc.count;
+
+  for (int i = 0; i < arrayLength; i++) {
+    DOUBLE x = data[i].real();
+    // DOUBLE x = abs(data[i]);
+    DOUBLE delta = x - acc.mean[i];
+    acc.mean[i] += delta * invCount;
+    acc.m2[i] += delta * (x - acc.mean[i]);
+  }
+}
+
+void welfordJackknife(const Welford& acc, COMPLX* out) {
+  const int arrayLength = acc.mean.size();
+
+  // Jackknife error: sqrt((N - 1)/N * sum((x - mean)^2))
+  for (int i = 0; i < arrayLength; i++) {
+    out[i] = COMPLX(acc.mean[i], sqrt(acc.m2[i] * DOUBLE(acc.count - 1) / DOUBLE(acc.count)));
+  }
+}
@@ -0,0 +1,56 @@
+/**
+ * @file accum.h
+ * @author Tianchen Zhang
+ * @brief Single-pass (Welford) accumulator for mean and jackknife error.
+ *        Provide 3 functions:
+ *        void welfordInit(): Reset an accumulator for arrays of given length;
+ *        void welfordPush(): Add one sample (the real part for complex data);
+ *        void welfordJackknife(): Jackknife mean and error of all samples
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_ACCUM_H_
+#define CCBAR_SRC_ACCUM_H_
+
+#include <complex>
+#include <valarray>
+
+#include "alias.h"
+
+/**
+ * @brief Running mean and sum of squared deviations of a set of arrays
+ */
+struct Welford {
+  int count = 0;  // # of samples pushed
+  DVARRAY mean;   // Running mean
+  DVARRAY m2;     // Running sum of (x - mean)^2
+};
+
+/**
+ * @brief Reset an accumulator for arrays of given length
+ *
+ * @param acc The accumulator
+ * @param arrayLength Total of double numbers per sample
+ */
+void welfordInit(Welford& acc, int arrayLength);
+
+/**
+ * @brief Add one sample to the accumulator
+ *
+ * @param acc The accumulator
+ * @param data The sample (for complex data, only the real part is used)
+ */
+void welfordPush(Welford& acc, const DOUBLE* data);
+void welfordPush(Welford& acc, const COMPLX* data);
+
+/**
+ * @brief Jackknife mean and error of the samples pushed so far
+ *
+ * @param acc The accumulator
+ * @param out Mean as the real part, jackknife error as the imaginary part
+ */
+void welfordJackknife(const Welford& acc, COMPLX* out);
+
+#endif
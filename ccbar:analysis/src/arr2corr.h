@@ -31,6 +31,22 @@ inline COMPLX& CORR(COMPLX* data, int x, int y, int z, int xyzSize) {
   return corrReturn;
 }
 
+inline const DOUBLE& CORR(const DOUBLE* data, int x, int y, int z, int xyzSize) {
+  x = (x + xyzSize) % xyzSize;
+  y = (y + xyzSize) % xyzSize;
+  z = (z + xyzSize) % xyzSize;
+  const DOUBLE& corrReturn = data[x + xyzSize * (y + xyzSize * z)];
+  return corrReturn;
+}
+
+inline const COMPLX& CORR(const COMPLX* data, int x, int y, int z, int xyzSize) {
+  x = (x + xyzSize) % xyzSize;
+  y = (y + xyzSize) % xyzSize;
+  z = (z + xyzSize) % xyzSize;
+  const COMPLX& corrReturn = data[x + xyzSize * (y + xyzSize * z)];
+  return corrReturn;
+}
+
 inline DOUBLE& CORR(DVARRAY& data, int x, int y, int z, int xyzSize) {
   x = (x + xyzSize) % xyzSize;
   y = (y + xyzSize) % xyzSize;
@@ -0,0 +1,166 @@
+/**
+ * @file bench-codec.cc
+ * @author Tianchen Zhang
+ * @brief Benchmark of the compression of binary files: ratio and MB/s of
+ *        the byte-shuffle + LZ codec on C(r, t)-like data, in every encoding
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include <libgen.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <complex>
+#include <vector>
+
+#include "alias.h"
+#include "codec.h"
+#include "convert.h"
+#include "dataio.h"
+
+void usage(char* name) {
+  fprintf(stderr, "Benchmark of the compression of binary files\n");
+  fprintf(stderr,
+          "USAGE: \n"
+          "    %s [OPTIONS] [XYZSIZE1 XYZSIZE2 ...]\n",
+          name);
+  fprintf(stderr,
+          "OPTIONS: \n"
+          "    [-r <REPEAT>]:    Repetitions per measurement (default: 5)\n"
+          "    [-j <THREADS>]:   Number of threads (default: 1)\n"
+          "    [-h, --help]:     Print help\n");
+}
+
+// Best time (seconds) of 'repeat' runs of kernel()
+template <typename F>
+double bestOf(int repeat, F kernel) {
+  double best = 1e300;
+  for (int r = 0; r < repeat; r++) {
+    auto start = std::chrono::steady_clock::now();
+    kernel();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+// Main function
+int main(int argc, char* argv[]) {
+  int repeat = 5;
+  int threadCount = 1;
+  char programName[128];
+  strncpy(programName, basename(argv[0]), 127);
+  argc--;
+  argv++;
+
+  while (argc > 0 && argv[0][0] == '-') {
+    if (strcmp(argv[0], "-h") == 0 || strcmp(argv[0], "--help") == 0) {
+      usage(programName);
+      exit(0);
+    }
+
+    if (strcmp(argv[0], "-r") == 0) {
+      repeat = atoi(argv[1]);
+      if (repeat < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
+    usage(programName);
+    exit(1);
+  }
+
+  std::vector<int> sizes = {16, 32, 48, 64};
+  if (argc > 0) {
+    sizes.clear();
+    for (int i = 0; i < argc; i++) sizes.push_back(atoi(argv[i]));
+  }
+
+  const BinEncoding encodings[] = {BIN_ENC_F64, BIN_ENC_F32, BIN_ENC_BF16};
+  const char* encodingNames[] = {"f64", "f32", "bf16"};
+  const size_t chunkBytes = CODEC_MAX_CHUNK;
+
+  // Ratio: double data over compressed data; MB/s: of the double data
+  printf("%6s %-5s %10s %10s %8s %12s %12s %10s\n", "L", "enc", "raw (MB)", "out (MB)", "ratio", "comp MB/s",
+         "decomp MB/s", "chunk (us)");
+  for (int xyzSize : sizes) {
+    const int arrayLength = xyzSize * xyzSize * xyzSize;
+
+    // C(r, t) of one time slice: ground and excited state wave functions,
+    // smooth in r, with 1e-3 relative noise and a small imaginary part
+    std::vector<COMPLX> data(arrayLength);
+    srand48(xyzSize);
+    for (int z = 0; z < xyzSize; z++) {
+      for (int y = 0; y < xyzSize; y++) {
+        for (int x = 0; x < xyzSize; x++) {
+          const int dx = std::min(x, xyzSize - x), dy = std::min(y, xyzSize - y), dz = std::min(z, xyzSize - z);
+          const DOUBLE r = sqrt(DOUBLE(dx * dx + dy * dy + dz * dz));
+          const DOUBLE value = 2.5e-3 * exp(-r / 3.0) + 4.0e-4 * exp(-r / 1.2) * cos(0.6 * r);
+          data[x + xyzSize * (y + xyzSize * z)] =
+              COMPLX(value * (1.0 + 1e-3 * (drand48() - 0.5)), value * 1e-3 * (drand48() - 0.5));
+        }
+      }
+    }
+    const size_t count = 2 * size_t(arrayLength);  // Doubles
+    const size_t doubleBytes = count * sizeof(DOUBLE);
+
+    for (int e = 0; e < 3; e++) {
+      const size_t typeSize = convertSize(encodings[e]);
+      const size_t rawBytes = count * typeSize;
+      std::vector<char> encoded(rawBytes), packed(codecBound(rawBytes, chunkBytes)), back(rawBytes);
+      std::vector<DOUBLE> widened(count);
+      convertNarrow((const DOUBLE*)data.data(), encoded.data(), count, encodings[e]);
+
+      // Both ways as writeBin() and readBin() do it: encoding included
+      size_t packedBytes = 0;
+      double compSeconds = bestOf(repeat, [&] {
+        convertNarrow((const DOUBLE*)data.data(), encoded.data(), count, encodings[e]);
+        packedBytes = codecCompress(encoded.data(), rawBytes, typeSize, chunkBytes, packed.data(), threadCount);
+      });
+      bool isGood = true;
+      double decompSeconds = bestOf(repeat, [&] {
+        isGood &= codecDecompress(packed.data(), back.data(), rawBytes, typeSize, chunkBytes, threadCount);
+        convertWiden(back.data(), widened.data(), count, encodings[e]);
+      });
+      if (!isGood || memcmp(encoded.data(), back.data(), rawBytes) != 0) {
+        fprintf(stderr, "Error: L = %d, %s: round trip failed\n", xyzSize, encodingNames[e]);
+        exit(1);
+      }
+
+      // Random access: the first chunk alone
+      uint64_t firstEnd;
+      memcpy(&firstEnd, packed.data(), sizeof(firstEnd));
+      const size_t tableBytes = codecChunkCount(rawBytes, chunkBytes) * sizeof(uint64_t);
+      double chunkSeconds = bestOf(repeat, [&] {
+        codecDecodeChunk(packed.data() + tableBytes, firstEnd, back.data(), std::min(chunkBytes, rawBytes), typeSize);
+      });
+
+      printf("%6d %-5s %10.3f %10.3f %8.2f %12.1f %12.1f %10.1f\n", xyzSize, encodingNames[e], doubleBytes * 1e-6,
+             packedBytes * 1e-6, double(doubleBytes) / packedBytes, doubleBytes / compSeconds * 1e-6,
+             doubleBytes / decompSeconds * 1e-6, chunkSeconds * 1e6);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file bench-fused.cc
+ * @author Tianchen Zhang
+ * @brief Benchmark of the fused fks-td and v-td kernels against the
+ *        std::valarray expressions they replace (GB/s and sites/s)
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <complex>
+#include <valarray>
+#include <vector>
+
+#include "alias.h"
+#include "fused.h"
+#include "stencil.h"
+
+void usage(char* name) {
+  fprintf(stderr, "Benchmark of the fused fks-td and v-td kernels\n");
+  fprintf(stderr,
+          "USAGE: \n"
+          "    %s [OPTIONS] [XYZSIZE1 XYZSIZE2 ...]\n",
+          name);
+  fprintf(stderr,
+          "OPTIONS: \n"
+          "    [-r <REPEAT>]:    Repetitions per measurement (default: 5)\n"
+          "    [-h, --help]:     Print help\n");
+}
+
+// Best time (seconds) of 'repeat' runs of kernel()
+template <typename F>
+double bestOf(int repeat, F kernel) {
+  double best = 1e300;
+  for (int r = 0; r < repeat; r++) {
+    auto start = std::chrono::steady_clock::now();
+    kernel();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+// Main function
+int main(int argc, char* argv[]) {
+  int repeat = 5;
+  char programName[128];
+  strncpy(programName, basename(argv[0]), 127);
+  argc--;
+  argv++;
+
+  while (argc > 0 && argv[0][0] == '-') {
+    if (strcmp(argv[0], "-h") == 0 || strcmp(argv[0], "--help") == 0) {
+      usage(programName);
+      exit(0);
+    }
+
+    if (strcmp(argv[0], "-r") == 0) {
+      repeat = atoi(argv[1]);
+      if (repeat < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
+    usage(programName);
+    exit(1);
+  }
+
+  std::vector<int> sizes = {16, 32, 48, 64};
+  if (argc > 0) {
+    sizes.clear();
+    for (int i = 0; i < argc; i++) sizes.push_back(atoi(argv[i]));
+  }
+
+  std::vector<StencilIsa> isas = {STENCIL_SCALAR};
+  if (stencilDetect() >= STENCIL_AVX2) isas.push_back(STENCIL_AVX2);
+  if (stencilDetect() >= STENCIL_AVX512) isas.push_back(STENCIL_AVX512);
+
+  const DOUBLE mc = 1.5;
+
+  // Traffic per site: six complex read, one (fks) or two (v) complex written
+  printf("%6s %-6s %-9s %10s %10s %12s %10s\n", "L", "kernel", "isa", "time (ms)", "GB/s", "Msites/s", "max|diff|");
+  for (int xyzSize : sizes) {
+    const int arrayLength = xyzSize * xyzSize * xyzSize;
+
+    // Correlator-like data: C(t-1) > C(t+1) > 0 with small imaginary parts
+    std::vector<CVARRAY> data(6, CVARRAY(arrayLength));
+    srand48(xyzSize);
+    for (int i = 0; i < arrayLength; i++) {
+      for (int k = 0; k < 4; k += 2) {
+        data[k][i] = COMPLX(1.0 + drand48(), 0.01 * (drand48() - 0.5));
+        data[k + 1][i] = data[k][i] * COMPLX(0.2 + 0.1 * drand48(), 0.01 * (drand48() - 0.5));
+      }
+      data[4][i] = COMPLX(-0.5 * drand48(), 0.01 * drand48());
+      data[5][i] = COMPLX(-0.5 * drand48(), 0.01 * drand48());
+    }
+    const COMPLX* const dataList[6] = {&data[0][0], &data[1][0], &data[2][0], &data[3][0], &data[4][0], &data[5][0]};
+
+    CVARRAY refFks(arrayLength), refV0(arrayLength), refVs(arrayLength);
+    std::vector<COMPLX> fks(arrayLength), v0(arrayLength), vs(arrayLength);
+
+    auto report = [&](const char* kernel, const char* isa, double seconds, int arrays, DOUBLE diff) {
+      printf("%6d %-6s %-9s %10.3f %10.2f %12.1f %10.3g\n", xyzSize, kernel, isa, seconds * 1e3,
+             arrays * sizeof(COMPLX) * arrayLength / seconds * 1e-9, arrayLength / seconds * 1e-6, diff);
+    };
+    auto maxDiff = [&](const CVARRAY& ref, const std::vector<COMPLX>& out) {
+      DOUBLE diff = 0.0;
+      for (int i = 0; i < arrayLength; i++) diff = std::max(diff, abs(out[i] - ref[i]) / abs(ref[i]));
+      return diff;
+    };
+
+    // F_KS: the expressions fks-td evaluated before
+    double seconds = bestOf(repeat, [&] {
+      CVARRAY ddt = (log(data[1] / data[3]) - log(data[0] / data[2])) / 2.0;
+      refFks = (data[4] - data[5]) / ddt;
+    });
+    report("fks", "valarray", seconds, 7, 0.0);
+
+    for (StencilIsa isa : isas) {
+      seconds = bestOf(repeat, [&] { fusedFksTd(dataList, fks.data(), arrayLength, isa); });
+      report("fks", stencilIsaName(isa), seconds, 7, maxDiff(refFks, fks));
+    }
+
+    // V_0 and V_s: the expressions v-td evaluated before
+    seconds = bestOf(repeat, [&] {
+      refV0 = 1 / (4.0 * mc) * (3 * data[4] + data[5]) -
+              1 / 4.0 * (3 * (log(data[1]) - log(data[0])) / 2.0 + (log(data[3]) - log(data[2])) / 2.0) - 2 * mc;
+      refVs = 1.0 / mc * (data[4] - data[5]) - (log(data[1] / data[3]) - log(data[0] / data[2])) / 2.0;
+    });
+    report("v", "valarray", seconds, 8, 0.0);
+
+    for (StencilIsa isa : isas) {
+      seconds = bestOf(repeat, [&] { fusedVTd(dataList, mc, v0.data(), vs.data(), arrayLength, isa); });
+      report("v", stencilIsaName(isa), seconds, 8, std::max(maxDiff(refV0, v0), maxDiff(refVs, vs)));
+    }
+  }
+
+  return 0;
+}
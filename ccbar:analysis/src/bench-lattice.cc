@@ -0,0 +1,159 @@
+/**
+ * @file bench-lattice.cc
+ * @author Tianchen Zhang
+ * @brief Micro-benchmark: CORR() accessor vs. lattice index tables for the
+ *        A1+ projection (48 terms per site and once per orbit) and the
+ *        pre-potential stencil
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <complex>
+#include <vector>
+
+#include "arr2corr.h"
+#include "lattice.h"
+
+void usage(char* name) {
+  fprintf(stderr, "Micro-benchmark: CORR() vs. lattice index tables\n");
+  fprintf(stderr,
+          "USAGE: \n"
+          "    %s [OPTIONS] [XYZSIZE1 XYZSIZE2 ...]\n",
+          name);
+  fprintf(stderr,
+          "OPTIONS: \n"
+          "    [-r <REPEAT>]:    Repetitions per measurement (default: 5)\n"
+          "    [-h, --help]:     Print help\n");
+}
+
+// Reference kernels: the CORR()-based loops as they were in a1plus.cc and prev.cc
+inline COMPLX naiveSym(const COMPLX* data, int x, int y, int z, int xyzSize) {
+  return (CORR(data, x, y, z, xyzSize) + CORR(data, y, z, x, xyzSize) + CORR(data, z, x, y, xyzSize) +
+          CORR(data, x, z, y, xyzSize) + CORR(data, z, y, x, xyzSize) + CORR(data, y, x, z, xyzSize)) /
+         6.0;
+}
+
+inline COMPLX a1Sym(const COMPLX* data, int x, int y, int z, int xyzSize) {
+  return (naiveSym(data, x, y, z, xyzSize) + naiveSym(data, x, y, xyzSize - z, xyzSize) +
+          naiveSym(data, x, xyzSize - y, z, xyzSize) + naiveSym(data, x, xyzSize - y, xyzSize - z, xyzSize) +
+          naiveSym(data, xyzSize - x, y, z, xyzSize) + naiveSym(data, xyzSize - x, y, xyzSize - z, xyzSize) +
+          naiveSym(data, xyzSize - x, xyzSize - y, z, xyzSize) +
+          naiveSym(data, xyzSize - x, xyzSize - y, xyzSize - z, xyzSize)) /
+         8.0;
+}
+
+void corrA1Sym(const COMPLX* data, COMPLX* result, int xyzSize) {
+  for (int ix = 0; ix < xyzSize; ix++)
+    for (int iy = 0; iy < xyzSize; iy++)
+      for (int iz = 0; iz < xyzSize; iz++) {
+        CORR(result, ix, iy, iz, xyzSize) = a1Sym(data, ix, iy, iz, xyzSize);
+      }
+}
+
+void corrPrePotential(const COMPLX* tmp, COMPLX* result, int xyzSize) {
+  for (int ix = 0; ix < xyzSize; ix++)
+    for (int iy = 0; iy < xyzSize; iy++)
+      for (int iz = 0; iz < xyzSize; iz++) {
+        // clang-format off
+        CORR(result, ix, iy, iz, xyzSize) = (-6.0 * CORR(tmp, ix, iy, iz, xyzSize)
+        + CORR(tmp, ix + 1, iy, iz, xyzSize) + CORR(tmp, ix - 1, iy, iz, xyzSize)
+        + CORR(tmp, ix, iy + 1, iz, xyzSize) + CORR(tmp, ix, iy - 1, iz, xyzSize)
+        + CORR(tmp, ix, iy, iz + 1, xyzSize) + CORR(tmp, ix, iy, iz - 1, xyzSize)
+        ) / CORR(tmp, ix, iy, iz, xyzSize);
+        // clang-format on
+      }
+}
+
+// Best time (seconds) of 'repeat' runs of kernel()
+template <typename F>
+double bestOf(int repeat, F kernel) {
+  double best = 1e300;
+  for (int r = 0; r < repeat; r++) {
+    auto start = std::chrono::steady_clock::now();
+    kernel();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+double maxDiff(const std::vector<COMPLX>& a, const std::vector<COMPLX>& b) {
+  double diff = 0.0;
+  for (size_t i = 0; i < a.size(); i++) diff = std::max(diff, abs(a[i] - b[i]));
+  return diff;
+}
+
+// Main function
+int main(int argc, char* argv[]) {
+  int repeat = 5;
+  char programName[128];
+  strncpy(programName, basename(argv[0]), 127);
+  argc--;
+  argv++;
+
+  while (argc > 0 && argv[0][0] == '-') {
+    if (strcmp(argv[0], "-h") == 0 || strcmp(argv[0], "--help") == 0) {
+      usage(programName);
+      exit(0);
+    }
+
+    if (strcmp(argv[0], "-r") == 0) {
+      repeat = atoi(argv[1]);
+      if (repeat < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
+    usage(programName);
+    exit(1);
+  }
+
+  std::vector<int> sizes = {16, 32, 48};
+  if (argc > 0) {
+    sizes.clear();
+    for (int i = 0; i < argc; i++) sizes.push_back(atoi(argv[i]));
+  }
+
+  printf("%6s %-8s %12s %12s %9s %10s\n", "L", "kernel", "CORR (ms)", "table (ms)", "speedup", "max|diff|");
+  for (int xyzSize : sizes) {
+    const int arrayLength = xyzSize * xyzSize * xyzSize;
+    std::vector<COMPLX> data(arrayLength), ref(arrayLength), out(arrayLength);
+    srand48(xyzSize);
+    for (auto& c : data) c = COMPLX(1.0 + drand48(), 0.1 * drand48());
+
+    Lattice lat;
+    latticeInit(lat, xyzSize);
+
+    double tCorr = bestOf(repeat, [&] { corrA1Sym(data.data(), ref.data(), xyzSize); });
+    double tTable = bestOf(repeat, [&] { latticeA1Sym(lat, data.data(), out.data()); });
+    printf("%6d %-8s %12.3f %12.3f %8.2fx %10.3g\n", xyzSize, "a1plus", tCorr * 1e3, tTable * 1e3, tCorr / tTable,
+           maxDiff(ref, out));
+
+    std::vector<COMPLX> orbitMean(lat.orbitCount);
+    tTable = bestOf(repeat, [&] {
+      latticeOrbitMean(lat, data.data(), orbitMean.data());
+      latticeOrbitScatter(lat, orbitMean.data(), out.data());
+    });
+    printf("%6d %-8s %12.3f %12.3f %8.2fx %10.3g\n", xyzSize, "a1orbit", tCorr * 1e3, tTable * 1e3, tCorr / tTable,
+           maxDiff(ref, out));
+
+    tCorr = bestOf(repeat, [&] { corrPrePotential(data.data(), ref.data(), xyzSize); });
+    tTable = bestOf(repeat, [&] { latticePrePotential(lat, data.data(), out.data()); });
+    printf("%6d %-8s %12.3f %12.3f %8.2fx %10.3g\n", xyzSize, "prev", tCorr * 1e3, tTable * 1e3, tCorr / tTable,
+           maxDiff(ref, out));
+  }
+
+  return 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file bench-stencil.cc
+ * @author Tianchen Zhang
+ * @brief Benchmark of the pre-potential stencil kernels (GB/s and sites/s)
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <complex>
+#include <vector>
+
+#include "lattice.h"
+#include "stencil.h"
+
+void usage(char* name) {
+  fprintf(stderr, "Benchmark of the pre-potential stencil kernels\n");
+  fprintf(stderr,
+          "USAGE: \n"
+          "    %s [OPTIONS] [XYZSIZE1 XYZSIZE2 ...]\n",
+          name);
+  fprintf(stderr,
+          "OPTIONS: \n"
+          "    [-r <REPEAT>]:    Repetitions per measurement (default: 5)\n"
+          "    [-h, --help]:     Print help\n");
+}
+
+// Best time (seconds) of 'repeat' runs of kernel()
+template <typename F>
+double bestOf(int repeat, F kernel) {
+  double best = 1e300;
+  for (int r = 0; r < repeat; r++) {
+    auto start = std::chrono::steady_clock::now();
+    kernel();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+// Main function
+int main(int argc, char* argv[]) {
+  int repeat = 5;
+  char programName[128];
+  strncpy(programName, basename(argv[0]), 127);
+  argc--;
+  argv++;
+
+  while (argc > 0 && argv[0][0] == '-') {
+    if (strcmp(argv[0], "-h") == 0 || strcmp(argv[0], "--help") == 0) {
+      usage(programName);
+      exit(0);
+    }
+
+    if (strcmp(argv[0], "-r") == 0) {
+      repeat = atoi(argv[1]);
+      if (repeat < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
+    usage(programName);
+    exit(1);
+  }
+
+  std::vector<int> sizes = {16, 32, 48, 64};
+  if (argc > 0) {
+    sizes.clear();
+    for (int i = 0; i < argc; i++) sizes.push_back(atoi(argv[i]));
+  }
+
+  std::vector<StencilIsa> isas = {STENCIL_SCALAR};
+  if (stencilDetect() >= STENCIL_AVX2) isas.push_back(STENCIL_AVX2);
+  if (stencilDetect() >= STENCIL_AVX512) isas.push_back(STENCIL_AVX512);
+
+  // Traffic per site: one complex read and one complex written
+  printf("%6s %-8s %10s %10s %12s %10s\n", "L", "kernel", "time (ms)", "GB/s", "Msites/s", "max|diff|");
+  for (int xyzSize : sizes) {
+    const int arrayLength = xyzSize * xyzSize * xyzSize;
+    std::vector<COMPLX> data(arrayLength), ref(arrayLength), out(arrayLength);
+    srand48(xyzSize);
+    for (auto& c : data) c = COMPLX(1.0 + drand48(), 0.1 * drand48());
+
+    Lattice lat;
+    latticeInit(lat, xyzSize);
+
+    auto report = [&](const char* name, double seconds) {
+      double diff = 0.0;
+      for (int i = 0; i < arrayLength; i++) diff = std::max(diff, abs(out[i] - ref[i]) / abs(ref[i]));
+      printf("%6d %-8s %10.3f %10.2f %12.1f %10.3g\n", xyzSize, name, seconds * 1e3,
+             2.0 * sizeof(COMPLX) * arrayLength / seconds * 1e-9, arrayLength / seconds * 1e-6, diff);
+    };
+
+    double seconds = bestOf(repeat, [&] { latticePrePotential(lat, data.data(), ref.data()); });
+    out = ref;
+    report("table", seconds);
+
+    for (StencilIsa isa : isas) {
+      seconds = bestOf(repeat, [&] { stencilPrePotential(data.data(), out.data(), xyzSize, isa); });
+      report(stencilIsaName(isa), seconds);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file buffer.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "buffer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+#define BUFFER_ALIGN 64
+#define HUGE_PAGE (size_t(2) << 20)
+
+void bufferAlloc(Buffer& buf, size_t bytes) {
+  if (bytes <= buf.bytes) return;
+  bufferFree(buf);
+
+  // Below a huge page the mapping would only waste address space
+  if (bytes >= HUGE_PAGE) {
+    const size_t length = (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+    void* addr = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+      perror("mmap");
+      exit(1);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(addr, length, MADV_HUGEPAGE);  // Advisory only: no THP, no error
+#endif
+    buf.addr = addr;
+    buf.bytes = length;
+    buf.isMapped = true;
+    return;
+  }
+
+  const size_t length = (bytes + BUFFER_ALIGN - 1) / BUFFER_ALIGN * BUFFER_ALIGN;
+  buf.addr = aligned_alloc(BUFFER_ALIGN, length);
+  if (buf.addr == NULL) {
+    perror("aligned_alloc");
+    exit(1);
+  }
+  buf.bytes = length;
+  buf.isMapped = false;
+}
+
+void bufferFree(Buffer& buf) {
+  if (buf.addr == NULL) return;
+  if (buf.isMapped) {
+    munmap(buf.addr, buf.bytes);
+  } else {
+    free(buf.addr);
+  }
+  buf.addr = NULL;
+  buf.bytes = 0;
+  buf.isMapped = false;
+}
+
+namespace {
+
+// Frees the scratch buffers when their thread exits
+struct ScratchSet {
+  Buffer slot[BUFFER_SLOTS];
+  ~ScratchSet() {
+    for (Buffer& buf : slot) bufferFree(buf);
+  }
+};
+
+thread_local ScratchSet scratch;
+
+}  // namespace
+
+void* bufferScratch(int slot, size_t bytes) {
+  if (slot < 0 || slot >= BUFFER_SLOTS) {
+    fprintf(stderr, "Error: Scratch buffer %d out of range\n", slot);
+    exit(1);
+  }
+  // Grow geometrically so a slowly increasing size does not reallocate each time
+  Buffer& buf = scratch.slot[slot];
+  if (bytes > buf.bytes) bufferAlloc(buf, bytes > 2 * buf.bytes ? bytes : 2 * buf.bytes);
+  return buf.addr;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file buffer.h
+ * @author Tianchen Zhang
+ * @brief Aligned work buffers that are allocated once per run and reused for
+ *        every file, instead of per-file stack arrays or vectors. Buffers are
+ *        64-byte aligned; large ones are mapped anonymously and advised to
+ *        use transparent huge pages where the kernel supports them.
+ *        Provide 3 functions:
+ *        void bufferAlloc(): (Re)size a buffer owned by the caller;
+ *        void bufferFree(): Release a buffer owned by the caller;
+ *        T* bufferScratch(): Per-thread scratch buffer, reused by later files
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_BUFFER_H_
+#define CCBAR_SRC_BUFFER_H_
+
+#include <stddef.h>
+
+#define BUFFER_SLOTS 4  // Scratch buffers per thread (slot 2: codec.h)
+
+/**
+ * @brief A 64-byte aligned block of memory
+ */
+struct Buffer {
+  void* addr = NULL;      // Start of the block
+  size_t bytes = 0;       // Usable size (rounded up)
+  bool isMapped = false;  // From mmap() rather than aligned_alloc()
+};
+
+/**
+ * @brief Make buf hold at least 'bytes' bytes. A buffer that is big enough
+ *        already is kept as it is; otherwise it is replaced, and the old
+ *        contents are lost. New memory is not initialized.
+ *
+ * @param buf The buffer
+ * @param bytes Required size in bytes
+ */
+void bufferAlloc(Buffer& buf, size_t bytes);
+
+/**
+ * @brief Release the memory of buf (no-op for an empty buffer)
+ *
+ * @param buf The buffer
+ */
+void bufferFree(Buffer& buf);
+
+/**
+ * @brief Scratch buffer number 'slot' of the calling thread, with room for
+ *        at least 'bytes' bytes. The buffer grows on demand and lives as long
+ *        as the thread, so the workers of parallelFor() allocate only for the
+ *        first file they handle. Contents are not initialized and are
+ *        overwritten by the next call with the same slot on the same thread.
+ *
+ * @param slot Index of the buffer (0 <= slot < BUFFER_SLOTS)
+ * @param bytes Required size in bytes
+ * @return void* 64-byte aligned memory
+ */
+void* bufferScratch(int slot, size_t bytes);
+
+template <typename T>
+T* bufferScratch(int slot, size_t count) {
+  return static_cast<T*>(bufferScratch(slot, count * sizeof(T)));
+}
+
+#endif
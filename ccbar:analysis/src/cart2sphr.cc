@@ -12,30 +12,43 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <charconv>
 #include <complex>
 #include <valarray>
+#include <vector>
 
-#include "arr2corr.h"
+#include "buffer.h"
 #include "dataio.h"
+#include "lattice.h"
 #include "misc.h"
+#include "threadpool.h"
 
 void usage(char* name) {
   fprintf(stderr, "From Cartesian coordinate to Spherical coordinate\n");
   fprintf(stderr,
           "USAGE: \n"
-          "    %s [OPTIONS] ifname1 [ifname2 ...]\n",
+          "    %s [OPTIONS] ifname1 [ifname2 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -n <XYZSIZE>:    Spacial size of lattice\n"
+          "    -n <XYZSIZE>:    Spacial size of lattice (default: from file header)\n"
           "    -d <OFDIR>:      Directory of output files\n"
           "    [-p] <PREFIX>:   Prefix for output files\n"
           "    [-s] <SUFFIX>:   Suffix for output files\n"
+          "    [-j <THREADS>]:  Number of threads (default: 1)\n"
+          "    [-r]:            Input is O_h orbit representatives (a1plus -r)\n"
+          "    [-a]:            One line per distinct r: average of the points at r, weighted\n"
+          "                     by the number of lattice sites they stand for\n"
+          "    [-b]:            Binary output: (r, re, im) records sorted by r\n"
+          "    [-g]:            Text with the shortest round-trip digits instead of %%1.16e\n"
+          "    [-H]:            Write self-describing header to binary output files\n"
           "    [-h, --help]:    Print help\n");
 }
 
 // Custom function declaration
-void cart2sphr(char* rawDataList[], char* sphrList[], int xyzSize, int fileCountTotal);
+void cart2sphr(char* rawDataList[], char* sphrList[], int xyzSize, int fileCountTotal, int threadCount, bool isReduced,
+               bool isAverage, bool isBinary, bool isShortest);
 
 // Main function
 int main(int argc, char* argv[]) {
@@ -46,6 +59,12 @@ int main(int argc, char* argv[]) {
   static const char* ofSuffix = NULL;
   bool isAddPrefix = false;
   bool isAddSuffix = false;
+  int threadCount = 1;
+  bool isReduced = false;
+  bool isAverage = false;
+  bool isBinary = false;
+  bool isShortest = false;
+  bool isHeader = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -101,11 +120,66 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -r: orbit representatives only
+    if (strcmp(argv[0], "-r") == 0) {
+      isReduced = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -a: average over equal r
+    if (strcmp(argv[0], "-a") == 0) {
+      isAverage = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -b: binary output
+    if (strcmp(argv[0], "-b") == 0) {
+      isBinary = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -g: shortest round-trip text
+    if (strcmp(argv[0], "-g") == 0) {
+      isShortest = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
   }
 
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
   // Initialization
   const int fileCountTotal = argc;  // # of data files
   if (fileCountTotal < 1) {
@@ -113,6 +187,16 @@ int main(int argc, char* argv[]) {
     exit(1);
   }
 
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !xyzSize) xyzSize = header.xyzSize;
+  if (!xyzSize) {
+    usage(programName);
+    exit(1);
+  }
+  if (header.layout == BIN_LAYOUT_ORBIT) isReduced = true;
+  setBinOutput(isHeader, programName, xyzSize, 0);
+
   // Create an array to store ofnames
   char* ofnameArr[fileCountTotal];
   if (isAddPrefix || isAddSuffix) {
@@ -140,7 +224,7 @@ int main(int argc, char* argv[]) {
   }
 
   // Main part for calculation
-  cart2sphr(argv, ofnameArr, xyzSize, fileCountTotal);
+  cart2sphr(argv, ofnameArr, xyzSize, fileCountTotal, threadCount, isReduced, isAverage, isBinary, isShortest);
 
   // Finalization for the string arrays
   for (int i = 0; i < fileCountTotal; i++) {
@@ -151,35 +235,92 @@ int main(int argc, char* argv[]) {
 }
 
 // Custom function definition
-void cart2sphr(char* rawDataList[], char* sphrList[], int xyzSize, int fileCountTotal) {
-  int arrayLength = pow(xyzSize, 3);
 
-  for (int i = 0; i < fileCountTotal; i++) {
-    COMPLX tmp[arrayLength];
-    for (int j = 0; j < arrayLength; j++)  // Initialize the empty arrays
-    {
-      tmp[j] = 0.0;
-    }
-    readBin(rawDataList[i], arrayLength, tmp);
+#define SHORTEST_LINE 96  // Longest "r re im\n" line of appendShortest()
 
-    FILE* fp = fopen(sphrList[i], "w");
-    if (fp == NULL) {
-      perror(sphrList[i]);
-      exit(1);
+// Write "r re im\n" at text with the shortest digits that read back to the
+// same doubles, and return the end of the line
+static char* appendShortest(char* text, const DOUBLE record[3]) {
+  for (int k = 0; k < 3; k++) {
+    text = std::to_chars(text, text + SHORTEST_LINE, record[k]).ptr;
+    *text++ = ' ';
+  }
+  text[-1] = '\n';
+  return text;
+}
+
+// One (r, re, im) record per point (i <= j <= k <= L/2): in the loop order of
+// the representatives for text, sorted by r for binary output, or averaged
+// over each shell of equal r with the orbit sizes as weights
+void cart2sphr(char* rawDataList[], char* sphrList[], int xyzSize, int fileCountTotal, int threadCount, bool isReduced,
+               bool isAverage, bool isBinary, bool isShortest) {
+  // The representatives and their shells depend on L only
+  Lattice lat;
+  latticeInit(lat, xyzSize);
+  const int arrayLength = isReduced ? lat.orbitCount : lat.siteCount;
+
+  std::vector<DOUBLE> distance(lat.orbitCount);
+  for (int s = 0; s < lat.radialCount; s++) {
+    for (int k = lat.radialStart[s]; k < lat.radialStart[s + 1]; k++) {
+      distance[lat.radialOrder[k]] = sqrt(DOUBLE(lat.radialR2[s]));
     }
+  }
 
-    for (int i = 0; i < xyzSize / 2 + 1; i++)
-      for (int j = i; j < xyzSize / 2 + 1; j++)
-        for (int k = j; k < xyzSize / 2 + 1; k++) {
-          DOUBLE re, im, distance = 0.0;
+  parallelFor(fileCountTotal, threadCount, [&](int n) {
+    const COMPLX* tmp;
+    BinMap inMap;
+    mapBin(rawDataList[n], arrayLength, tmp, inMap);
 
-          distance = sqrt(pow(DOUBLE(i), 2) + pow(DOUBLE(j), 2) + pow(DOUBLE(k), 2));
-          re = CORR(tmp, i, j, k, xyzSize).real();
-          im = CORR(tmp, i, j, k, xyzSize).imag();
+    // Reduced input is stored in exactly the order of the representatives
+    auto value = [&](int o) { return isReduced ? tmp[o] : tmp[lat.orbitRep[o]]; };
 
-          fprintf(fp, "%1.16e %1.16e %1.16e\n", distance, re, im);
+    // Records and text are built in this thread's buffers, reused for each file
+    const int recordCount = isAverage ? lat.radialCount : lat.orbitCount;
+    DOUBLE* record = bufferScratch<DOUBLE>(0, 3 * recordCount);
+    if (isAverage) {
+      for (int s = 0; s < lat.radialCount; s++) {
+        COMPLX sum = 0.0;
+        int weight = 0;
+        for (int k = lat.radialStart[s]; k < lat.radialStart[s + 1]; k++) {
+          const int o = lat.radialOrder[k];
+          sum += DOUBLE(lat.orbitSize[o]) * value(o);
+          weight += lat.orbitSize[o];
         }
+        sum /= DOUBLE(weight);
+        record[3 * s] = distance[lat.radialOrder[lat.radialStart[s]]];
+        record[3 * s + 1] = sum.real();
+        record[3 * s + 2] = sum.imag();
+      }
+    } else {
+      for (int k = 0; k < lat.orbitCount; k++) {
+        const int o = isBinary ? lat.radialOrder[k] : k;
+        record[3 * k] = distance[o];
+        record[3 * k + 1] = value(o).real();
+        record[3 * k + 2] = value(o).imag();
+      }
+    }
+    unmapBin(inMap);
+
+    if (isBinary) {
+      writeBin(sphrList[n], 3 * recordCount, record);
+      return;
+    }
 
+    FILE* fp = fopen(sphrList[n], "w");
+    if (fp == NULL) {
+      perror(sphrList[n]);
+      exit(1);
+    }
+    if (isShortest) {
+      char* text = bufferScratch<char>(1, size_t(recordCount) * SHORTEST_LINE);
+      char* end = text;
+      for (int k = 0; k < recordCount; k++) end = appendShortest(end, &record[3 * k]);
+      fwrite(text, 1, end - text, fp);
+    } else {
+      for (int k = 0; k < recordCount; k++) {
+        fprintf(fp, "%1.16e %1.16e %1.16e\n", record[3 * k], record[3 * k + 1], record[3 * k + 2]);
+      }
+    }
     fclose(fp);
-  }
+  });
 }
@@ -0,0 +1,321 @@
+/**
+ * @file codec.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "codec.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "buffer.h"
+#include "threadpool.h"
+
+static const int SCRATCH_SLOT = 2;  // bufferScratch() slot of the shuffled chunk
+
+/* ----------------------------------- shuffle ---------------------------------- */
+
+// Byte b of number i goes to out[b * count + i]
+template <size_t S>
+static void shuffleFixed(const uint8_t* in, uint8_t* out, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    for (size_t b = 0; b < S; b++) out[b * count + i] = in[i * S + b];
+  }
+}
+
+template <size_t S>
+static void unshuffleFixed(const uint8_t* in, uint8_t* out, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    for (size_t b = 0; b < S; b++) out[i * S + b] = in[b * count + i];
+  }
+}
+
+static void shuffle(const uint8_t* in, uint8_t* out, size_t bytes, size_t typeSize) {
+  const size_t count = bytes / typeSize;
+  switch (typeSize) {
+    case 2:
+      shuffleFixed<2>(in, out, count);
+      break;
+    case 4:
+      shuffleFixed<4>(in, out, count);
+      break;
+    case 8:
+      shuffleFixed<8>(in, out, count);
+      break;
+    default:
+      for (size_t i = 0; i < count; i++) {
+        for (size_t b = 0; b < typeSize; b++) out[b * count + i] = in[i * typeSize + b];
+      }
+  }
+}
+
+static void unshuffle(const uint8_t* in, uint8_t* out, size_t bytes, size_t typeSize) {
+  const size_t count = bytes / typeSize;
+  switch (typeSize) {
+    case 2:
+      unshuffleFixed<2>(in, out, count);
+      break;
+    case 4:
+      unshuffleFixed<4>(in, out, count);
+      break;
+    case 8:
+      unshuffleFixed<8>(in, out, count);
+      break;
+    default:
+      for (size_t i = 0; i < count; i++) {
+        for (size_t b = 0; b < typeSize; b++) out[i * typeSize + b] = in[b * count + i];
+      }
+  }
+}
+
+/* ------------------------------------- LZ ------------------------------------- */
+
+// Sequences of literals and a match, each starting with a token byte: the
+// literal count (high nibble) and the match length minus LZ_MIN_MATCH (low
+// nibble), 15 meaning that more bytes follow (added up until one is not
+// 255). Then the literals, and the match offset (16 bits, little endian),
+// except in the last sequence, which has literals only.
+static const size_t LZ_MIN_MATCH = 4;
+static const int LZ_HASH_BITS = 13;
+
+static inline uint32_t read32(const uint8_t* p) {
+  uint32_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+static inline uint64_t read64(const uint8_t* p) {
+  uint64_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+static inline uint32_t hash4(uint32_t value) { return (value * 2654435761u) >> (32 - LZ_HASH_BITS); }
+
+static inline uint8_t* putLength(uint8_t* op, size_t length) {
+  for (; length >= 255; length -= 255) *op++ = 255;
+  *op++ = uint8_t(length);
+  return op;
+}
+
+// Bytes of a sequence at most (token, lengths, literals, offset)
+static inline size_t sequenceBound(size_t literalCount, size_t matchLength) {
+  return 1 + literalCount / 255 + 1 + literalCount + 2 + matchLength / 255 + 1;
+}
+
+// Compress n (<= CODEC_MAX_CHUNK) bytes; returns 0 if the result would take
+// more than limit bytes
+static size_t lzCompress(const uint8_t* in, size_t n, uint8_t* out, size_t limit) {
+  uint16_t table[1 << LZ_HASH_BITS];  // Last position of each hash
+  memset(table, 0, sizeof(table));
+
+  const uint8_t* const iend = in + n;
+  const uint8_t* ip = in;
+  const uint8_t* anchor = in;  // Start of the pending literals
+  uint8_t* op = out;
+  uint8_t* const oend = out + limit;
+  size_t misses = 0;
+
+  while (n >= LZ_MIN_MATCH && ip <= iend - LZ_MIN_MATCH) {
+    const uint32_t h = hash4(read32(ip));
+    const uint8_t* ref = in + table[h];
+    table[h] = uint16_t(ip - in);
+    if (ref >= ip || read32(ref) != read32(ip)) {
+      ip += 1 + (misses++ >> 5);  // Skip faster through incompressible bytes
+      continue;
+    }
+    misses = 0;
+
+    // Extend the match backwards into the literals, then forwards
+    while (ip > anchor && ref > in && ip[-1] == ref[-1]) {
+      ip--;
+      ref--;
+    }
+    const uint8_t* mp = ip + LZ_MIN_MATCH;
+    const uint8_t* rp = ref + LZ_MIN_MATCH;
+    bool isEnd = true;  // The match may go on in the last bytes
+    while (mp + 8 <= iend) {
+      const uint64_t diff = read64(mp) ^ read64(rp);
+      if (diff != 0) {
+        mp += __builtin_ctzll(diff) / 8;
+        isEnd = false;
+        break;
+      }
+      mp += 8;
+      rp += 8;
+    }
+    while (isEnd && mp < iend && *mp == *rp) {
+      mp++;
+      rp++;
+    }
+
+    const size_t literalCount = ip - anchor;
+    const size_t matchLength = mp - ip;
+    if (sequenceBound(literalCount, matchLength) > size_t(oend - op)) return 0;
+
+    uint8_t* token = op++;
+    *token = uint8_t(std::min<size_t>(literalCount, 15) << 4 | std::min<size_t>(matchLength - LZ_MIN_MATCH, 15));
+    if (literalCount >= 15) op = putLength(op, literalCount - 15);
+    memcpy(op, anchor, literalCount);
+    op += literalCount;
+    const size_t offset = ip - ref;
+    *op++ = uint8_t(offset);
+    *op++ = uint8_t(offset >> 8);
+    if (matchLength - LZ_MIN_MATCH >= 15) op = putLength(op, matchLength - LZ_MIN_MATCH - 15);
+
+    ip = anchor = mp;
+  }
+
+  const size_t literalCount = iend - anchor;
+  if (sequenceBound(literalCount, 0) - 3 > size_t(oend - op)) return 0;
+  *op++ = uint8_t(std::min<size_t>(literalCount, 15) << 4);
+  if (literalCount >= 15) op = putLength(op, literalCount - 15);
+  memcpy(op, anchor, literalCount);
+  op += literalCount;
+  return op - out;
+}
+
+static inline bool getLength(const uint8_t*& ip, const uint8_t* iend, size_t& length) {
+  uint8_t byte;
+  do {
+    if (ip >= iend) return false;
+    byte = *ip++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+// Decompress exactly n bytes; false on corrupt input
+static bool lzDecompress(const uint8_t* in, size_t inBytes, uint8_t* out, size_t n) {
+  const uint8_t* ip = in;
+  const uint8_t* const iend = in + inBytes;
+  uint8_t* op = out;
+  uint8_t* const oend = out + n;
+
+  while (ip < iend) {
+    const uint8_t token = *ip++;
+    size_t literalCount = token >> 4;
+    if (literalCount == 15 && !getLength(ip, iend, literalCount)) return false;
+    if (literalCount > size_t(iend - ip) || literalCount > size_t(oend - op)) return false;
+    memcpy(op, ip, literalCount);
+    op += literalCount;
+    ip += literalCount;
+    if (ip == iend) break;  // The last sequence
+
+    if (iend - ip < 2) return false;
+    const size_t offset = ip[0] | size_t(ip[1]) << 8;
+    ip += 2;
+    size_t matchLength = token & 15;
+    if (matchLength == 15 && !getLength(ip, iend, matchLength)) return false;
+    matchLength += LZ_MIN_MATCH;
+    if (offset == 0 || offset > size_t(op - out) || matchLength > size_t(oend - op)) return false;
+
+    // The match may overlap the bytes it produces
+    const uint8_t* ref = op - offset;
+    if (offset >= matchLength) {
+      memcpy(op, ref, matchLength);
+    } else if (offset == 1) {
+      memset(op, *ref, matchLength);
+    } else {
+      for (size_t i = 0; i < matchLength; i++) op[i] = ref[i];
+    }
+    op += matchLength;
+  }
+  return op == oend;
+}
+
+/* ----------------------------------- chunks ----------------------------------- */
+
+// Shuffle and compress one chunk into out (room for rawBytes); returns the
+// stored size, rawBytes if stored shuffled only
+static size_t encodeChunk(const uint8_t* in, size_t rawBytes, size_t typeSize, uint8_t* out) {
+  uint8_t* shuffled = bufferScratch<uint8_t>(SCRATCH_SLOT, rawBytes);
+  shuffle(in, shuffled, rawBytes, typeSize);
+  size_t bytes = rawBytes > 1 ? lzCompress(shuffled, rawBytes, out, rawBytes - 1) : 0;
+  if (bytes == 0) {
+    memcpy(out, shuffled, rawBytes);
+    bytes = rawBytes;
+  }
+  return bytes;
+}
+
+bool codecDecodeChunk(const void* in, size_t inBytes, void* out, size_t rawBytes, size_t typeSize) {
+  const uint8_t* shuffled = (const uint8_t*)in;
+  if (inBytes != rawBytes) {
+    uint8_t* work = bufferScratch<uint8_t>(SCRATCH_SLOT, rawBytes);
+    if (inBytes > rawBytes || !lzDecompress((const uint8_t*)in, inBytes, work, rawBytes)) return false;
+    shuffled = work;
+  }
+  unshuffle(shuffled, (uint8_t*)out, rawBytes, typeSize);
+  return true;
+}
+
+size_t codecChunkCount(size_t rawBytes, size_t chunkBytes) { return (rawBytes + chunkBytes - 1) / chunkBytes; }
+
+size_t codecBound(size_t rawBytes, size_t chunkBytes) {
+  return codecChunkCount(rawBytes, chunkBytes) * sizeof(uint64_t) + rawBytes;
+}
+
+size_t codecCompress(const void* in, size_t rawBytes, size_t typeSize, size_t chunkBytes, void* out, int threadCount) {
+  const size_t chunkCount = codecChunkCount(rawBytes, chunkBytes);
+  uint8_t* data = (uint8_t*)out + chunkCount * sizeof(uint64_t);
+
+  // Every chunk is encoded where its raw bytes would go (it never gets
+  // larger), then they are packed
+  std::vector<size_t> stored(chunkCount);
+  parallelFor(chunkCount, threadCount, [&](int c) {
+    const size_t offset = c * chunkBytes;
+    const size_t bytes = std::min(chunkBytes, rawBytes - offset);
+    stored[c] = encodeChunk((const uint8_t*)in + offset, bytes, typeSize, data + offset);
+  });
+
+  uint64_t end = 0;
+  for (size_t c = 0; c < chunkCount; c++) {
+    if (end != c * chunkBytes) memmove(data + end, data + c * chunkBytes, stored[c]);
+    end += stored[c];
+    memcpy((uint64_t*)out + c, &end, sizeof(end));
+  }
+  return chunkCount * sizeof(uint64_t) + end;
+}
+
+size_t codecPayloadBytes(const void* payload, size_t available, size_t rawBytes, size_t chunkBytes) {
+  const size_t chunkCount = codecChunkCount(rawBytes, chunkBytes);
+  const size_t tableBytes = chunkCount * sizeof(uint64_t);
+  if (available < tableBytes) return 0;
+
+  uint64_t start = 0;
+  for (size_t c = 0; c < chunkCount; c++) {
+    uint64_t end;
+    memcpy(&end, (const uint64_t*)payload + c, sizeof(end));
+    if (end <= start || end - start > std::min(chunkBytes, rawBytes - c * chunkBytes)) return 0;
+    start = end;
+  }
+  if (start > available - tableBytes) return 0;
+  return tableBytes + start;
+}
+
+bool codecDecompress(const void* payload, void* out, size_t rawBytes, size_t typeSize, size_t chunkBytes,
+                     int threadCount) {
+  const size_t chunkCount = codecChunkCount(rawBytes, chunkBytes);
+  const uint64_t* table = (const uint64_t*)payload;
+  const uint8_t* data = (const uint8_t*)payload + chunkCount * sizeof(uint64_t);
+
+  std::atomic<bool> isGood(true);
+  parallelFor(chunkCount, threadCount, [&](int c) {
+    uint64_t start = 0, end;
+    if (c > 0) memcpy(&start, table + c - 1, sizeof(start));
+    memcpy(&end, table + c, sizeof(end));
+    const size_t offset = c * chunkBytes;
+    const size_t bytes = std::min(chunkBytes, rawBytes - offset);
+    if (!codecDecodeChunk(data + start, end - start, (uint8_t*)out + offset, bytes, typeSize)) isGood = false;
+  });
+  return isGood;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file codec.h
+ * @author Tianchen Zhang
+ * @brief Lossless compression of binary files: the data is cut into chunks,
+ *        the bytes of each chunk are shuffled (all first bytes of the
+ *        numbers, then all second bytes, ...) and compressed with a small LZ
+ *        codec. Chunks are independent, so they are (de)compressed in
+ *        parallel and a part of the data is read without the rest.
+ *        Compressed data: uint64_t end[chunkCount], the end of each chunk
+ *        counted from the end of this table, then the chunks. A chunk that
+ *        does not get smaller is stored shuffled only (its stored size equals
+ *        its raw size).
+ *        Provide 6 functions:
+ *        size_t codecChunkCount(): Number of chunks of some data;
+ *        size_t codecBound(): Largest size of the compressed data;
+ *        size_t codecCompress(): Compress data;
+ *        size_t codecPayloadBytes(): Check the chunk table of compressed data;
+ *        bool codecDecompress(): Decompress data;
+ *        bool codecDecodeChunk(): Decompress one chunk
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_CODEC_H_
+#define CCBAR_SRC_CODEC_H_
+
+#include <stddef.h>
+
+#define CODEC_MAX_CHUNK 65536  // Largest chunk (LZ offsets are 16 bits)
+
+/**
+ * @brief Number of chunks of rawBytes bytes of data
+ */
+size_t codecChunkCount(size_t rawBytes, size_t chunkBytes);
+
+/**
+ * @brief Largest size of the compressed data (chunk table included)
+ */
+size_t codecBound(size_t rawBytes, size_t chunkBytes);
+
+/**
+ * @brief Compress data
+ *
+ * @param in Raw data
+ * @param rawBytes Size of the raw data (a multiple of typeSize)
+ * @param typeSize Bytes per number, the stride of the shuffle (2, 4 or 8)
+ * @param chunkBytes Raw bytes per chunk (a multiple of 16, at most CODEC_MAX_CHUNK)
+ * @param out Compressed data, room for codecBound() bytes
+ * @param threadCount Number of threads
+ * @return Size of the compressed data
+ */
+size_t codecCompress(const void* in, size_t rawBytes, size_t typeSize, size_t chunkBytes, void* out, int threadCount);
+
+/**
+ * @brief Check the chunk table of compressed data
+ *
+ * @param payload Compressed data
+ * @param available Bytes available at payload
+ * @param rawBytes Size of the raw data
+ * @param chunkBytes Raw bytes per chunk
+ * @return Size of the compressed data, 0 if the table is corrupt or the
+ *         data is truncated
+ */
+size_t codecPayloadBytes(const void* payload, size_t available, size_t rawBytes, size_t chunkBytes);
+
+/**
+ * @brief Decompress data checked by codecPayloadBytes()
+ *
+ * @param payload Compressed data
+ * @param out Raw data, rawBytes bytes
+ * @param rawBytes Size of the raw data
+ * @param typeSize Bytes per number, as compressed
+ * @param chunkBytes Raw bytes per chunk, as compressed
+ * @param threadCount Number of threads
+ * @return false if a chunk is corrupt
+ */
+bool codecDecompress(const void* payload, void* out, size_t rawBytes, size_t typeSize, size_t chunkBytes,
+                     int threadCount);
+
+/**
+ * @brief Decompress one chunk
+ *
+ * @param in Stored chunk
+ * @param inBytes Stored size of the chunk
+ * @param out Raw data of the chunk
+ * @param rawBytes Raw size of the chunk
+ * @param typeSize Bytes per number, as compressed
+ * @return false if the chunk is corrupt
+ */
+bool codecDecodeChunk(const void* in, size_t inBytes, void* out, size_t rawBytes, size_t typeSize);
+
+#endif
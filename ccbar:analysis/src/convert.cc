@@ -0,0 +1,247 @@
+/**
+ * @file convert.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "convert.h"
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "alias.h"
+#include "dataio.h"
+#include "stencil.h"
+
+size_t convertSize(BinEncoding encoding) {
+  return encoding == BIN_ENC_F32 ? sizeof(float) : encoding == BIN_ENC_BF16 ? sizeof(uint16_t) : sizeof(DOUBLE);
+}
+
+/* ----------------------------------- scalar ----------------------------------- */
+
+// Upper half of a float32, rounded to nearest even; NaN is kept quiet
+// instead of being rounded into inf
+static inline uint16_t floatToBf16(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  if ((bits & 0x7fffffff) > 0x7f800000) return (bits >> 16) | 0x40;
+  return (bits + 0x7fff + ((bits >> 16) & 1)) >> 16;
+}
+
+static inline DOUBLE bf16ToDouble(uint16_t half) {
+  uint32_t bits = uint32_t(half) << 16;
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static void narrowScalar(const DOUBLE* in, void* out, size_t from, size_t to, BinEncoding encoding) {
+  if (encoding == BIN_ENC_F32) {
+    for (size_t i = from; i < to; i++) ((float*)out)[i] = float(in[i]);
+  } else {
+    for (size_t i = from; i < to; i++) ((uint16_t*)out)[i] = floatToBf16(float(in[i]));
+  }
+}
+
+static void widenScalar(const void* in, DOUBLE* out, size_t from, size_t to, BinEncoding encoding) {
+  if (encoding == BIN_ENC_F32) {
+    for (size_t i = from; i < to; i++) out[i] = ((const float*)in)[i];
+  } else {
+    for (size_t i = from; i < to; i++) out[i] = bf16ToDouble(((const uint16_t*)in)[i]);
+  }
+}
+
+// Big-endian in, read through memcpy: in may be unaligned (a LIME payload
+// starts anywhere) and, for doubles, the same memory as out
+static void swapScalar(const void* in, DOUBLE* out, size_t from, size_t to, BinEncoding encoding) {
+  const char* bytes = (const char*)in;
+  if (encoding == BIN_ENC_F64) {
+    for (size_t i = from; i < to; i++) {
+      uint64_t bits;
+      memcpy(&bits, bytes + 8 * i, sizeof(bits));
+      bits = __builtin_bswap64(bits);
+      memcpy(out + i, &bits, sizeof(bits));
+    }
+  } else if (encoding == BIN_ENC_F32) {
+    for (size_t i = from; i < to; i++) {
+      uint32_t bits;
+      float value;
+      memcpy(&bits, bytes + 4 * i, sizeof(bits));
+      bits = __builtin_bswap32(bits);
+      memcpy(&value, &bits, sizeof(value));
+      out[i] = value;
+    }
+  } else {
+    for (size_t i = from; i < to; i++) {
+      uint16_t half;
+      memcpy(&half, bytes + 2 * i, sizeof(half));
+      out[i] = bf16ToDouble(__builtin_bswap16(half));
+    }
+  }
+}
+
+/* ------------------------------------ AVX2 ------------------------------------ */
+
+// 8 floats (as bits) -> 8 bfloat16, the same rounding as floatToBf16()
+__attribute__((target("avx2"))) static inline __m128i bf16Avx2(__m256i bits) {
+  const __m256i absBits = _mm256_and_si256(bits, _mm256_set1_epi32(0x7fffffff));
+  const __m256i isNan = _mm256_cmpgt_epi32(absBits, _mm256_set1_epi32(0x7f800000));
+  const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+  __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(_mm256_set1_epi32(0x7fff), odd));
+  rounded = _mm256_blendv_epi8(rounded, _mm256_or_si256(bits, _mm256_set1_epi32(0x400000)), isNan);
+  rounded = _mm256_srli_epi32(rounded, 16);
+  return _mm_packus_epi32(_mm256_castsi256_si128(rounded), _mm256_extracti128_si256(rounded, 1));
+}
+
+__attribute__((target("avx2"))) static void narrowAvx2(const DOUBLE* in, void* out, size_t count,
+                                                        BinEncoding encoding) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256 value = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_loadu_pd(in + i + 4)),
+                                         _mm256_cvtpd_ps(_mm256_loadu_pd(in + i)));
+    if (encoding == BIN_ENC_F32) {
+      _mm256_storeu_ps((float*)out + i, value);
+    } else {
+      _mm_storeu_si128((__m128i*)((uint16_t*)out + i), bf16Avx2(_mm256_castps_si256(value)));
+    }
+  }
+  narrowScalar(in, out, i, count, encoding);
+}
+
+__attribute__((target("avx2"))) static void widenAvx2(const void* in, DOUBLE* out, size_t count,
+                                                       BinEncoding encoding) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 value;
+    if (encoding == BIN_ENC_F32) {
+      value = _mm256_loadu_ps((const float*)in + i);
+    } else {
+      const __m128i half = _mm_loadu_si128((const __m128i*)((const uint16_t*)in + i));
+      value = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(half), 16));
+    }
+    _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm256_castps256_ps128(value)));
+    _mm256_storeu_pd(out + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(value, 1)));
+  }
+  widenScalar(in, out, i, count, encoding);
+}
+
+// Byte reversal within each 8 (double) or 4 (float) bytes of a 128-bit lane;
+// bfloat16 is left to the scalar loop
+__attribute__((target("avx2"))) static void swapAvx2(const void* in, DOUBLE* out, size_t count,
+                                                      BinEncoding encoding) {
+  size_t i = 0;
+  if (encoding == BIN_ENC_F64) {
+    const __m256i order =
+        _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12,
+                         11, 10, 9, 8);
+    for (; i + 4 <= count; i += 4) {
+      const __m256i bits = _mm256_loadu_si256((const __m256i*)((const char*)in + 8 * i));
+      _mm256_storeu_si256((__m256i*)(out + i), _mm256_shuffle_epi8(bits, order));
+    }
+  } else if (encoding == BIN_ENC_F32) {
+    const __m256i order =
+        _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8,
+                         15, 14, 13, 12);
+    for (; i + 8 <= count; i += 8) {
+      const __m256i bits = _mm256_loadu_si256((const __m256i*)((const char*)in + 4 * i));
+      const __m256 value = _mm256_castsi256_ps(_mm256_shuffle_epi8(bits, order));
+      _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm256_castps256_ps128(value)));
+      _mm256_storeu_pd(out + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(value, 1)));
+    }
+  }
+  swapScalar(in, out, i, count, encoding);
+}
+
+/* ----------------------------------- AVX-512 ---------------------------------- */
+
+__attribute__((target("avx512f"))) static void narrowAvx512(const DOUBLE* in, void* out, size_t count,
+                                                             BinEncoding encoding) {
+  const __m512i absMask = _mm512_set1_epi32(0x7fffffff), inf = _mm512_set1_epi32(0x7f800000);
+  const __m512i bias = _mm512_set1_epi32(0x7fff), one = _mm512_set1_epi32(1), quiet = _mm512_set1_epi32(0x400000);
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m256 lo = _mm512_cvtpd_ps(_mm512_loadu_pd(in + i)), hi = _mm512_cvtpd_ps(_mm512_loadu_pd(in + i + 8));
+    const __m512 value =
+        _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(lo)), _mm256_castps_pd(hi), 1));
+    if (encoding == BIN_ENC_F32) {
+      _mm512_storeu_ps((float*)out + i, value);
+      continue;
+    }
+    const __m512i bits = _mm512_castps_si512(value);
+    const __mmask16 isNan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(bits, absMask), inf);
+    const __m512i odd = _mm512_and_si512(_mm512_srli_epi32(bits, 16), one);
+    __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(bias, odd));
+    rounded = _mm512_mask_or_epi32(rounded, isNan, bits, quiet);
+    _mm256_storeu_si256((__m256i*)((uint16_t*)out + i), _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+  }
+  narrowScalar(in, out, i, count, encoding);
+}
+
+__attribute__((target("avx512f"))) static void widenAvx512(const void* in, DOUBLE* out, size_t count,
+                                                            BinEncoding encoding) {
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512 value;
+    if (encoding == BIN_ENC_F32) {
+      value = _mm512_loadu_ps((const float*)in + i);
+    } else {
+      const __m256i half = _mm256_loadu_si256((const __m256i*)((const uint16_t*)in + i));
+      value = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(half), 16));
+    }
+    const __m256 hi = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value), 1));
+    _mm512_storeu_pd(out + i, _mm512_cvtps_pd(_mm512_castps512_ps256(value)));
+    _mm512_storeu_pd(out + i + 8, _mm512_cvtps_pd(hi));
+  }
+  widenScalar(in, out, i, count, encoding);
+}
+
+/* ---------------------------------- dispatch ---------------------------------- */
+
+void convertNarrow(const DOUBLE* in, void* out, size_t count, BinEncoding encoding) {
+  convertNarrow(in, out, count, encoding, stencilDetect());
+}
+
+void convertNarrow(const DOUBLE* in, void* out, size_t count, BinEncoding encoding, StencilIsa isa) {
+  if (encoding == BIN_ENC_F64) {
+    memcpy(out, in, count * sizeof(DOUBLE));
+  } else if (isa == STENCIL_AVX512) {
+    narrowAvx512(in, out, count, encoding);
+  } else if (isa == STENCIL_AVX2) {
+    narrowAvx2(in, out, count, encoding);
+  } else {
+    narrowScalar(in, out, 0, count, encoding);
+  }
+}
+
+void convertWiden(const void* in, DOUBLE* out, size_t count, BinEncoding encoding) {
+  convertWiden(in, out, count, encoding, stencilDetect());
+}
+
+void convertWiden(const void* in, DOUBLE* out, size_t count, BinEncoding encoding, StencilIsa isa) {
+  if (encoding == BIN_ENC_F64) {
+    memcpy(out, in, count * sizeof(DOUBLE));
+  } else if (isa == STENCIL_AVX512) {
+    widenAvx512(in, out, count, encoding);
+  } else if (isa == STENCIL_AVX2) {
+    widenAvx2(in, out, count, encoding);
+  } else {
+    widenScalar(in, out, 0, count, encoding);
+  }
+}
+
+void convertSwapped(const void* in, DOUBLE* out, size_t count, BinEncoding encoding) {
+  convertSwapped(in, out, count, encoding, stencilDetect());
+}
+
+// The byte shuffle of AVX-512 needs AVX512BW on top of AVX512F: AVX2 serves both
+void convertSwapped(const void* in, DOUBLE* out, size_t count, BinEncoding encoding, StencilIsa isa) {
+  if (isa == STENCIL_AVX512 || isa == STENCIL_AVX2) {
+    swapAvx2(in, out, count, encoding);
+  } else {
+    swapScalar(in, out, 0, count, encoding);
+  }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file convert.h
+ * @author Tianchen Zhang
+ * @brief Conversion between double and the reduced-precision encodings of
+ *        binary files (float32 and bfloat16, see BinEncoding), vectorized
+ *        (AVX-512, AVX2 or scalar, chosen at runtime like the stencil).
+ *        Provide 4 functions:
+ *        size_t convertSize(): Bytes per double in an encoding;
+ *        void convertNarrow(): double -> encoding, rounded to nearest even;
+ *        void convertWiden(): encoding -> double (exact);
+ *        void convertSwapped(): big-endian encoding (LIME files) -> double
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_CONVERT_H_
+#define CCBAR_SRC_CONVERT_H_
+
+#include <stddef.h>
+
+#include "alias.h"
+#include "dataio.h"
+#include "stencil.h"
+
+/**
+ * @brief Bytes per double in an encoding (8, 4 or 2)
+ */
+size_t convertSize(BinEncoding encoding);
+
+/**
+ * @brief Encode doubles; float32 rounds to nearest even (out of range: inf),
+ *        bfloat16 keeps the upper half of the float32, again rounded to
+ *        nearest even (NaN stays NaN)
+ *
+ * @param in Input doubles
+ * @param out Output, convertSize(encoding) bytes per double
+ * @param count Number of doubles
+ * @param encoding Target encoding
+ * @param isa Instruction set (default: best available)
+ */
+void convertNarrow(const DOUBLE* in, void* out, size_t count, BinEncoding encoding);
+void convertNarrow(const DOUBLE* in, void* out, size_t count, BinEncoding encoding, StencilIsa isa);
+
+/**
+ * @brief Decode to doubles (every float32 and bfloat16 value is exact in double)
+ *
+ * @param in Encoded input, convertSize(encoding) bytes per double
+ * @param out Output doubles
+ * @param count Number of doubles
+ * @param encoding Source encoding
+ * @param isa Instruction set (default: best available)
+ */
+void convertWiden(const void* in, DOUBLE* out, size_t count, BinEncoding encoding);
+void convertWiden(const void* in, DOUBLE* out, size_t count, BinEncoding encoding, StencilIsa isa);
+
+/**
+ * @brief Decode big-endian data (LIME/ILDG payloads) to doubles: the byte
+ *        swap and the widening in one pass
+ *
+ * @param in Big-endian input, convertSize(encoding) bytes per double
+ * @param out Output doubles; may be in for BIN_ENC_F64 (swapped in place)
+ * @param count Number of doubles
+ * @param encoding Source encoding
+ * @param isa Instruction set (default: best available)
+ */
+void convertSwapped(const void* in, DOUBLE* out, size_t count, BinEncoding encoding);
+void convertSwapped(const void* in, DOUBLE* out, size_t count, BinEncoding encoding, StencilIsa isa);
+
+#endif
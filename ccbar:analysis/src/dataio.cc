@@ -9,91 +9,1652 @@
 
 #include "dataio.h"
 
+#include <dirent.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <libgen.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
 #include <complex>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <valarray>
+#include <vector>
 
 #include "alias.h"
+#include "codec.h"
+#include "convert.h"
+#include "limeio.h"
 
-void readBin(const char* ifname, int arrayLength, DOUBLE* data) {
-  FILE* fp = fopen(ifname, "rb");
+static const char BIN_MAGIC[8] = {'C', 'C', 'B', 'A', 'R', 'B', 'I', 'N'};
+static const uint32_t BIN_VERSION = 1;
+static const uint32_t BIN_VERSION_ENCODED = 2;  // Reduced-precision or compressed data
+static const uint32_t BIN_CHUNK_BYTES = 65536;   // Raw bytes per compressed chunk
+static const uint32_t BIN_BYTE_ORDER = 0x01020304;
+
+// Byte counter behind binBytesRead()
+static std::atomic<long long> bytesReadTotal(0);
+
+// Output settings from setBinOutput()
+static bool isOutHeader = false;
+static char outProvenance[64] = "";
+static int outXyzSize = 0;
+static int outTSize = 0;
+static BinEncoding outEncoding = BIN_ENC_F64;
+static BinCompression outCompression = BIN_COMP_NONE;
+static int codecThreads = 1;
+
+// The background reader and writer (de)compress on their own thread only
+static thread_local bool isBackground = false;
+static int codecThreadCount() { return isBackground ? 1 : codecThreads; }
+
+long long binBytesRead() { return bytesReadTotal.load(); }
+
+void setBinOutput(bool isHeader, const char* provenance, int xyzSize, int tSize) {
+  isOutHeader = isHeader;
+  snprintf(outProvenance, sizeof(outProvenance), "%s", provenance != NULL ? provenance : "");
+  outXyzSize = xyzSize;
+  outTSize = tSize;
+}
+
+void setBinEncoding(BinEncoding encoding) { outEncoding = encoding; }
+
+void setBinCompression(BinCompression compression, int threadCount) {
+  outCompression = compression;
+  codecThreads = threadCount;
+}
+
+bool parseBinEncoding(const char* name, BinEncoding& encoding) {
+  if (name == NULL) return false;
+  if (strcmp(name, "f64") == 0) {
+    encoding = BIN_ENC_F64;
+  } else if (strcmp(name, "f32") == 0) {
+    encoding = BIN_ENC_F32;
+  } else if (strcmp(name, "bf16") == 0) {
+    encoding = BIN_ENC_BF16;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// 64-bit FNV-1a over 8-byte words; a partial last word (reduced-precision
+// data only) is padded with zeros
+static uint64_t checksum(const void* data, size_t bytes) {
+  const uint64_t* word = (const uint64_t*)data;
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < bytes / 8; i++) {
+    hash ^= word[i];
+    hash *= 0x100000001b3ULL;
+  }
+  if (bytes % 8 != 0) {
+    uint64_t last = 0;
+    memcpy(&last, (const char*)data + bytes / 8 * 8, bytes % 8);
+    hash ^= last;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// Output data is not stored as is (always with a header)
+static bool isOutCoded() { return outEncoding != BIN_ENC_F64 || outCompression != BIN_COMP_NONE; }
+
+// Header for an output array of the given type and length
+static void makeHeader(BinHeader& header, uint32_t dtype, int arrayLength) {
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, BIN_MAGIC, sizeof(BIN_MAGIC));
+  header.version = isOutCoded() ? BIN_VERSION_ENCODED : BIN_VERSION;
+  header.byteOrder = BIN_BYTE_ORDER;
+  header.dtype = dtype;
+  header.encoding = outEncoding;
+  header.compression = outCompression;
+  header.chunkBytes = outCompression == BIN_COMP_NONE ? 0 : BIN_CHUNK_BYTES;
+  header.xyzSize = outXyzSize;
+  header.tSize = outTSize;
+  header.arrayLength = arrayLength;
+  memcpy(header.provenance, outProvenance, sizeof(header.provenance));
+
+  const int half = outXyzSize / 2 + 1;
+  if (outXyzSize > 0 && arrayLength == outXyzSize * outXyzSize * outXyzSize) {
+    header.layout = BIN_LAYOUT_XYZ;
+  } else if (outXyzSize > 0 && arrayLength == half * (half + 1) * (half + 2) / 6) {
+    header.layout = BIN_LAYOUT_ORBIT;
+  } else if (outTSize > 0 && arrayLength == outTSize) {
+    header.layout = BIN_LAYOUT_T;
+  } else {
+    header.layout = BIN_LAYOUT_FLAT;
+  }
+}
+
+static bool isHeader(const BinHeader& header) { return memcmp(header.magic, BIN_MAGIC, sizeof(BIN_MAGIC)) == 0; }
+
+// Check a header against what the caller expects; exits on mismatch
+static void checkHeader(const char* ifname, const BinHeader& header, uint32_t dtype, int arrayLength) {
+  if (header.byteOrder != BIN_BYTE_ORDER) {
+    fprintf(stderr, "%s: Byte order differs from this machine\n", ifname);
+    exit(1);
+  }
+  if (header.version != BIN_VERSION && header.version != BIN_VERSION_ENCODED) {
+    fprintf(stderr, "%s: Unsupported format version %u\n", ifname, header.version);
+    exit(1);
+  }
+  if (header.encoding > BIN_ENC_BF16) {
+    fprintf(stderr, "%s: Unsupported encoding %u\n", ifname, header.encoding);
+    exit(1);
+  }
+  if (header.compression > BIN_COMP_LZ ||
+      (header.compression != BIN_COMP_NONE &&
+       (header.chunkBytes == 0 || header.chunkBytes % 16 != 0 || header.chunkBytes > CODEC_MAX_CHUNK))) {
+    fprintf(stderr, "%s: Unsupported compression %u (chunks of %u bytes)\n", ifname, header.compression,
+            header.chunkBytes);
+    exit(1);
+  }
+  if (header.dtype != dtype) {
+    fprintf(stderr, "%s: Stored as %s, read as %s\n", ifname, header.dtype == BIN_COMPLX ? "complex" : "double",
+            dtype == BIN_COMPLX ? "complex" : "double");
+    exit(1);
+  }
+  if (header.arrayLength != arrayLength) {
+    fprintf(stderr, "%s: %lld numbers in file, %d expected\n", ifname, (long long)header.arrayLength, arrayLength);
+    exit(1);
+  }
+}
+
+static void checkData(const char* ifname, const BinHeader& header, const void* data, size_t bytes) {
+  if (checksum(data, bytes) != header.checksum) {
+    fprintf(stderr, "%s: Checksum mismatch\n", ifname);
+    exit(1);
+  }
+}
+
+// Bytes of the data in its encoding, before compression (header: NULL for
+// headerless files)
+static size_t storedBytes(const BinHeader* header, size_t elemSize, int arrayLength) {
+  size_t bytes = elemSize * arrayLength;
+  if (header == NULL || header->encoding == BIN_ENC_F64) return bytes;
+  return bytes / sizeof(DOUBLE) * convertSize(BinEncoding(header->encoding));
+}
+
+// Decode stored data of a reduced-precision file into data
+static void widenData(const BinHeader& header, const void* stored, size_t elemSize, int arrayLength, void* data) {
+  convertWiden(stored, (DOUBLE*)data, elemSize * arrayLength / sizeof(DOUBLE), BinEncoding(header.encoding));
+}
+
+// Packed ensembles: "file.ens#member" names one array inside a container.
+// Layout: EnsHeader, then the members (each a BinHeader followed by its
+// data, 64-byte aligned), then the index (one EnsEntry per member).
+static const char ENS_MAGIC[8] = {'C', 'C', 'B', 'A', 'R', 'E', 'N', 'S'};
+static const uint32_t ENS_VERSION = 1;
+static const int64_t ENS_ALIGN = 64;
+
+struct EnsHeader {
+  char magic[8];        // "CCBARENS"
+  uint32_t version;     // Format version (1)
+  uint32_t byteOrder;   // 0x01020304 in the byte order of the writer
+  int64_t memberCount;  // Entries in the index
+  int64_t indexOffset;  // Start of the index (0: no index written yet)
+  char reserved[32];    // Zero
+};
+static_assert(sizeof(EnsHeader) == 64, "EnsHeader must be 64 bytes");
+
+struct EnsEntry {
+  char name[112];  // Member name (no '/')
+  int64_t offset;  // Start of the member's BinHeader
+  int64_t bytes;   // BinHeader plus data
+};
+static_assert(sizeof(EnsEntry) == 128, "EnsEntry must be 128 bytes");
+
+struct Ensemble {
+  int fd = -1;
+  bool isWritable = false;
+  int64_t end = sizeof(EnsHeader);  // Where the next member goes
+  std::vector<EnsEntry> entries;
+  std::unordered_map<std::string, size_t> index;  // Member name -> entries[]
+  std::mutex mutex;
+};
+
+// Containers opened so far, by path; they stay open until the process exits
+static std::mutex ensRegistryMutex;
+static std::map<std::string, Ensemble*> ensRegistry;
+
+// Split "file.ens#member"; false for plain file names
+static bool splitMember(const char* fname, std::string& container, std::string& member) {
+  const char* mark = strstr(fname, ".ens#");
+  if (mark == NULL) return false;
+  container.assign(fname, mark + 4 - fname);
+  member.assign(mark + 5);
+  return true;
+}
+
+static bool isEnsName(const char* fname) {
+  size_t length = strlen(fname);
+  return length > 4 && strcmp(fname + length - 4, ".ens") == 0;
+}
+
+static void preadAll(const char* fname, int fd, void* buf, size_t bytes, int64_t offset) {
+  char* p = (char*)buf;
+  while (bytes > 0) {
+    ssize_t n = pread(fd, p, bytes, offset);
+    if (n <= 0) {
+      if (n < 0) perror(fname);
+      else fprintf(stderr, "%s: Unexpected end of file\n", fname);
+      exit(1);
+    }
+    p += n;
+    bytes -= n;
+    offset += n;
+  }
+}
+
+static void pwriteAll(const char* fname, int fd, const void* buf, size_t bytes, int64_t offset) {
+  const char* p = (const char*)buf;
+  while (bytes > 0) {
+    ssize_t n = pwrite(fd, p, bytes, offset);
+    if (n < 0) {
+      perror(fname);
+      exit(1);
+    }
+    p += n;
+    bytes -= n;
+    offset += n;
+  }
+}
+
+// Write the index and the final header of every container opened for writing
+static void closeEnsembles() {
+  std::lock_guard<std::mutex> registryLock(ensRegistryMutex);
+  for (auto& item : ensRegistry) {
+    Ensemble* ens = item.second;
+    const char* fname = item.first.c_str();
+    if (!ens->isWritable) continue;
+
+    std::lock_guard<std::mutex> lock(ens->mutex);
+    EnsHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ENS_MAGIC, sizeof(ENS_MAGIC));
+    header.version = ENS_VERSION;
+    header.byteOrder = BIN_BYTE_ORDER;
+    header.memberCount = ens->entries.size();
+    header.indexOffset = ens->end;
+
+    size_t indexBytes = sizeof(EnsEntry) * ens->entries.size();
+    pwriteAll(fname, ens->fd, ens->entries.data(), indexBytes, ens->end);
+    if (ftruncate(ens->fd, ens->end + indexBytes) != 0) {
+      perror(fname);
+      exit(1);
+    }
+    pwriteAll(fname, ens->fd, &header, sizeof(header), 0);
+    close(ens->fd);
+    ens->isWritable = false;
+  }
+}
+
+// Container at path, opened (and its index loaded) on first use. Existing
+// containers opened for writing are appended to; a member written again
+// replaces the old one in the index.
+static Ensemble* openEnsemble(const std::string& path, bool isWrite) {
+  std::lock_guard<std::mutex> registryLock(ensRegistryMutex);
+  auto found = ensRegistry.find(path);
+  if (found != ensRegistry.end()) {
+    if (isWrite && !found->second->isWritable) {
+      fprintf(stderr, "%s: Container is being read, cannot write to it\n", path.c_str());
+      exit(1);
+    }
+    return found->second;
+  }
+
+  const char* fname = path.c_str();
+  int fd = isWrite ? open(fname, O_RDWR | O_CREAT, 0644) : open(fname, O_RDONLY);
+  if (fd < 0) {
+    perror(fname);
+    exit(1);
+  }
+
+  Ensemble* ens = new Ensemble;
+  ens->fd = fd;
+  ens->isWritable = isWrite;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    perror(fname);
+    exit(1);
+  }
+  if (st.st_size > 0) {
+    EnsHeader header;
+    preadAll(fname, fd, &header, sizeof(header), 0);
+    if (memcmp(header.magic, ENS_MAGIC, sizeof(ENS_MAGIC)) != 0) {
+      fprintf(stderr, "%s: Not an ensemble container\n", fname);
+      exit(1);
+    }
+    if (header.byteOrder != BIN_BYTE_ORDER) {
+      fprintf(stderr, "%s: Byte order differs from this machine\n", fname);
+      exit(1);
+    }
+    if (header.version != ENS_VERSION || header.indexOffset == 0) {
+      fprintf(stderr, "%s: Unsupported format version or missing index\n", fname);
+      exit(1);
+    }
+
+    ens->entries.resize(header.memberCount);
+    preadAll(fname, fd, ens->entries.data(), sizeof(EnsEntry) * header.memberCount, header.indexOffset);
+    for (size_t i = 0; i < ens->entries.size(); i++) ens->index[ens->entries[i].name] = i;
+    ens->end = header.indexOffset;  // New members overwrite the old index
+  } else if (!isWrite) {
+    fprintf(stderr, "%s: Empty container\n", fname);
+    exit(1);
+  }
+
+  if (isWrite) {
+    // No index until closeEnsembles() runs: mark the container as incomplete
+    EnsHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ENS_MAGIC, sizeof(ENS_MAGIC));
+    header.version = ENS_VERSION;
+    header.byteOrder = BIN_BYTE_ORDER;
+    pwriteAll(fname, fd, &header, sizeof(header), 0);
+
+    static bool isRegistered = false;
+    if (!isRegistered) atexit(closeEnsembles);
+    isRegistered = true;
+  }
+
+  ensRegistry[path] = ens;
+  return ens;
+}
+
+// Look up member in ens (O(1)); exits when it does not exist
+static EnsEntry findMember(Ensemble* ens, const std::string& member, const char* fname) {
+  std::lock_guard<std::mutex> lock(ens->mutex);
+  auto found = ens->index.find(member);
+  if (found == ens->index.end()) {
+    fprintf(stderr, "%s: No such member\n", fname);
+    exit(1);
+  }
+  return ens->entries[found->second];
+}
+
+// Reserve room for a new member of the given size (BinHeader included)
+static EnsEntry addMember(Ensemble* ens, const std::string& member, int64_t bytes, const char* fname) {
+  if (member.empty() || member.size() >= sizeof(EnsEntry::name) || member.find('/') != std::string::npos) {
+    fprintf(stderr, "%s: Invalid member name\n", fname);
+    exit(1);
+  }
+
+  std::lock_guard<std::mutex> lock(ens->mutex);
+  EnsEntry entry;
+  memset(&entry, 0, sizeof(entry));
+  memcpy(entry.name, member.c_str(), member.size());
+  entry.offset = (ens->end + ENS_ALIGN - 1) / ENS_ALIGN * ENS_ALIGN;
+  entry.bytes = bytes;
+  ens->end = entry.offset + bytes;
+
+  auto found = ens->index.find(member);
+  if (found != ens->index.end()) {
+    ens->entries[found->second] = entry;
+  } else {
+    ens->index[member] = ens->entries.size();
+    ens->entries.push_back(entry);
+  }
+  return entry;
+}
+
+// Buffers behind mappings that are not file mappings (virtual jackknife
+// samples, prefetched files), recycled by unmapBin()
+static std::mutex bufferPoolMutex;
+static std::vector<Buffer> bufferPool;
+
+static Buffer takeBuffer(size_t bytes) {
+  Buffer buf;
+  {
+    std::lock_guard<std::mutex> lock(bufferPoolMutex);
+    if (!bufferPool.empty()) {
+      buf = bufferPool.back();
+      bufferPool.pop_back();
+    }
+  }
+  bufferAlloc(buf, bytes);
+  return buf;
+}
+
+static void releaseBuffer(const Buffer& buf) {
+  std::lock_guard<std::mutex> lock(bufferPoolMutex);
+  bufferPool.push_back(buf);
+}
+
+// Virtual jackknife: "file.jk#member" is (sum - raw) / (N - 1) over the N raw
+// files listed in the manifest file.jk (text, written by writeJk()):
+//   CCBARJK <version>
+//   <N> <arrayLength>
+//   <sum file>
+//   <member>\t<raw file>      (N lines)
+// Paths are absolute. The sum is read once per process; each sample costs one
+// read of its raw file.
+static const char JK_MAGIC[] = "CCBARJK";
+static const int JK_VERSION = 1;
+
+struct JkView {
+  int sampleCount = 0;
+  int arrayLength = 0;
+  Buffer sum;  // COMPLX[arrayLength]
+  std::vector<std::string> members;
+  std::vector<std::string> raws;
+  std::unordered_map<std::string, size_t> index;  // Member name -> members[]
+};
+
+// Manifests opened so far, by path; they stay loaded until the process exits
+static std::mutex jkRegistryMutex;
+static std::map<std::string, JkView*> jkRegistry;
+
+
+// Split "file.jk#member"; false for other names
+static bool splitJk(const char* fname, std::string& manifest, std::string& member) {
+  const char* mark = strstr(fname, ".jk#");
+  if (mark == NULL) return false;
+  manifest.assign(fname, mark + 3 - fname);
+  member.assign(mark + 4);
+  return true;
+}
+
+static bool isJkName(const char* fname) {
+  size_t length = strlen(fname);
+  return length > 3 && strcmp(fname + length - 3, ".jk") == 0;
+}
+
+static void readFile(const char* ifname, uint32_t dtype, size_t elemSize, int arrayLength, void* data);
+static const void* mapFile(const char* ifname, uint32_t dtype, size_t elemSize, int arrayLength, BinMap& map);
+
+// Manifest at path, loaded (with its sum) on first use
+static JkView* openJk(const std::string& path) {
+  std::lock_guard<std::mutex> registryLock(jkRegistryMutex);
+  auto found = jkRegistry.find(path);
+  if (found != jkRegistry.end()) return found->second;
+
+  const char* fname = path.c_str();
+  FILE* fp = fopen(fname, "r");
   if (fp == NULL) {
-    perror(ifname);
+    perror(fname);
     exit(1);
   }
 
-  fread(data, sizeof(DOUBLE), arrayLength, fp);
+  JkView* jk = new JkView;
+  char line[4096], magic[16];
+  int version = 0;
+  if (fgets(line, sizeof(line), fp) == NULL || sscanf(line, "%15s %d", magic, &version) != 2 ||
+      strcmp(magic, JK_MAGIC) != 0) {
+    fprintf(stderr, "%s: Not a virtual jackknife manifest\n", fname);
+    exit(1);
+  }
+  if (version != JK_VERSION) {
+    fprintf(stderr, "%s: Unsupported format version %d\n", fname, version);
+    exit(1);
+  }
+  if (fgets(line, sizeof(line), fp) == NULL || sscanf(line, "%d %d", &jk->sampleCount, &jk->arrayLength) != 2 ||
+      jk->sampleCount < 2 || jk->arrayLength < 1) {
+    fprintf(stderr, "%s: Invalid sample count or array length\n", fname);
+    exit(1);
+  }
+
+  std::string sumName;
+  for (int i = -1; i < jk->sampleCount; i++) {
+    if (fgets(line, sizeof(line), fp) == NULL) {
+      fprintf(stderr, "%s: Unexpected end of file\n", fname);
+      exit(1);
+    }
+    line[strcspn(line, "\n")] = '\0';
+    if (i < 0) {
+      sumName = line;
+      continue;
+    }
+    char* tab = strchr(line, '\t');
+    if (tab == NULL) {
+      fprintf(stderr, "%s: Invalid sample line %d\n", fname, i + 1);
+      exit(1);
+    }
+    *tab = '\0';
+    jk->index[line] = jk->members.size();
+    jk->members.push_back(line);
+    jk->raws.push_back(tab + 1);
+  }
   fclose(fp);
+
+  bufferAlloc(jk->sum, sizeof(COMPLX) * jk->arrayLength);
+  readFile(sumName.c_str(), BIN_COMPLX, sizeof(COMPLX), jk->arrayLength, jk->sum.addr);
+
+  jkRegistry[path] = jk;
+  return jk;
 }
-void readBin(const char* ifname, int arrayLength, COMPLX* data) {
-  FILE* fp = fopen(ifname, "rb");
-  if (fp == NULL) {
-    perror(ifname);
+
+// Look up member in jk; exits when it does not exist or does not fit the request
+static size_t findJk(JkView* jk, const std::string& member, const char* fname, uint32_t dtype, int arrayLength) {
+  auto found = jk->index.find(member);
+  if (found == jk->index.end()) {
+    fprintf(stderr, "%s: No such sample\n", fname);
     exit(1);
   }
+  if (dtype != BIN_COMPLX) {
+    fprintf(stderr, "%s: Stored as complex, read as double\n", fname);
+    exit(1);
+  }
+  if (arrayLength != jk->arrayLength) {
+    fprintf(stderr, "%s: %d numbers in sample, %d expected\n", fname, jk->arrayLength, arrayLength);
+    exit(1);
+  }
+  return found->second;
+}
+
+// Sample i of jk, computed into sample (the expression jre writes out)
+static void jkSample(const JkView* jk, size_t i, COMPLX* sample) {
+  BinMap rawMap;
+  const COMPLX* raw = (const COMPLX*)mapFile(jk->raws[i].c_str(), BIN_COMPLX, sizeof(COMPLX), jk->arrayLength, rawMap);
+  const COMPLX* sum = (const COMPLX*)jk->sum.addr;
+  for (int j = 0; j < jk->arrayLength; j++) sample[j] = (sum[j] - raw[j]) / (jk->sampleCount - 1.0);
+  unmapBin(rawMap);
+}
 
-  fread(data, sizeof(COMPLX), arrayLength, fp);
+static void readJk(const char* ifname, uint32_t dtype, int arrayLength, void* data) {
+  std::string manifest, member;
+  splitJk(ifname, manifest, member);
+  JkView* jk = openJk(manifest);
+  jkSample(jk, findJk(jk, member, ifname, dtype, arrayLength), (COMPLX*)data);
+}
+
+static const void* mapJk(const char* ifname, uint32_t dtype, int arrayLength, BinMap& map) {
+  std::string manifest, member;
+  splitJk(ifname, manifest, member);
+  JkView* jk = openJk(manifest);
+  size_t i = findJk(jk, member, ifname, dtype, arrayLength);
+
+  Buffer sample = takeBuffer(sizeof(COMPLX) * arrayLength);
+  jkSample(jk, i, (COMPLX*)sample.addr);
+
+  map.addr = NULL;
+  map.bytes = 0;
+  map.header = NULL;
+  map.buffer = sample;
+  return sample.addr;
+}
+
+static void readOnlyJk(const char* ofname) {
+  fprintf(stderr, "%s: Virtual jackknife samples are read-only\n", ofname);
+  exit(1);
+}
+
+void writeJk(const char* manifest, char* rawDataList[], int fileCountTotal, int arrayLength, const COMPLX* sum) {
+  if (!isJkName(manifest)) {
+    fprintf(stderr, "%s: Manifest name must end with .jk\n", manifest);
+    exit(1);
+  }
+
+  // Absolute paths, so that the manifest works from any directory
+  auto absolute = [](const char* fname) {
+    std::string container, member;
+    std::string path = splitMember(fname, container, member) ? container : fname;
+    char* real = realpath(path.c_str(), NULL);
+    if (real == NULL) {
+      perror(path.c_str());
+      exit(1);
+    }
+    path = real;
+    free(real);
+    return container.empty() ? path : path + "#" + member;
+  };
+
+  std::string sumName = std::string(manifest) + ".sum";
+  writeBin(sumName.c_str(), arrayLength, sum);
+
+  FILE* fp = fopen(manifest, "w");
+  if (fp == NULL) {
+    perror(manifest);
+    exit(1);
+  }
+  fprintf(fp, "%s %d\n%d %d\n%s\n", JK_MAGIC, JK_VERSION, fileCountTotal, arrayLength,
+          absolute(sumName.c_str()).c_str());
+  for (int i = 0; i < fileCountTotal; i++) {
+    char stmp[2048];
+    strncpy(stmp, rawDataList[i], 2047);
+    stmp[2047] = '\0';
+    std::string container, member;
+    const char* name = splitMember(rawDataList[i], container, member) ? member.c_str() : basename(stmp);
+    fprintf(fp, "%s\t%s\n", name, absolute(rawDataList[i]).c_str());
+  }
   fclose(fp);
 }
-void readBin(const char* ifname, int arrayLength, DVARRAY& data) {
+
+// Map [offset, offset + bytes) of fd; returns the address of offset
+static char* mapRange(const char* fname, int fd, int64_t offset, int64_t bytes, bool isWrite, BinMap& map) {
+  static const int64_t pageSize = sysconf(_SC_PAGESIZE);
+  int64_t start = offset / pageSize * pageSize;
+  size_t length = offset - start + bytes;
+
+  void* addr = mmap(NULL, length, isWrite ? PROT_READ | PROT_WRITE : PROT_READ, isWrite ? MAP_SHARED : MAP_PRIVATE,
+                    fd, start);
+  if (addr == MAP_FAILED) {
+    perror(fname);
+    exit(1);
+  }
+
+  map.addr = addr;
+  map.bytes = length;
+  map.header = NULL;
+  return (char*)addr + (offset - start);
+}
+
+// The data is not stored as is: it has to be decoded into memory of its own
+static bool isCoded(const BinHeader* header) {
+  return header != NULL && (header->encoding != BIN_ENC_F64 || header->compression != BIN_COMP_NONE);
+}
+
+// Check the payload of a file (the available bytes after the header, if
+// any) and return the data as double: the payload itself when stored as
+// is, otherwise decoded into out (elemSize * arrayLength bytes)
+static const void* payloadData(const char* ifname, const BinHeader* header, const char* payload, size_t available,
+                               size_t elemSize, int arrayLength, void* out) {
+  const size_t offset = header != NULL ? sizeof(BinHeader) : 0;
+  size_t bytes = storedBytes(header, elemSize, arrayLength);
+  const bool isCompressed = header != NULL && header->compression != BIN_COMP_NONE;
+  size_t payloadBytes = bytes;
+  if (isCompressed) {
+    payloadBytes = codecPayloadBytes(payload, available, bytes, header->chunkBytes);
+    if (payloadBytes == 0) {
+      fprintf(stderr, "%s: Compressed data corrupt or truncated\n", ifname);
+      exit(1);
+    }
+  } else if (available < bytes || offset + available == 0) {
+    fprintf(stderr, "%s: File too short (%zu bytes expected, %zu found)\n", ifname, offset + bytes,
+            offset + available);
+    exit(1);
+  }
+
+  if (header != NULL) checkData(ifname, *header, payload, payloadBytes);
+  bytesReadTotal += payloadBytes;
+  if (!isCoded(header)) return payload;
+
+  const char* data = payload;
+  Buffer raw;
+  if (isCompressed) {
+    // Straight into out unless it still has to be widened
+    void* target = out;
+    if (header->encoding != BIN_ENC_F64) {
+      raw = takeBuffer(bytes);
+      target = raw.addr;
+    }
+    const size_t typeSize = convertSize(BinEncoding(header->encoding));
+    if (!codecDecompress(payload, target, bytes, typeSize, header->chunkBytes, codecThreadCount())) {
+      fprintf(stderr, "%s: Compressed data corrupt\n", ifname);
+      exit(1);
+    }
+    data = (const char*)target;
+  }
+  if (header->encoding != BIN_ENC_F64) widenData(*header, data, elemSize, arrayLength, out);
+  if (raw.addr != NULL) releaseBuffer(raw);
+  return out;
+}
+
+// Find the header (if any) of a whole file in memory and check it; returns
+// the start of the payload
+static const char* filePayload(const char* ifname, const char* file, size_t fileBytes, uint32_t dtype,
+                               int arrayLength, const BinHeader*& header) {
+  header = NULL;
+  if (fileBytes < sizeof(BinHeader) || !isHeader(*(const BinHeader*)file)) return file;
+  header = (const BinHeader*)file;
+  checkHeader(ifname, *header, dtype, arrayLength);
+  return file + sizeof(BinHeader);
+}
+
+// Let map hand out the data as double: coded data is decoded into a pooled
+// buffer, which replaces whatever held the payload
+static const void* mapPayload(const char* ifname, const BinHeader* header, const char* payload, size_t available,
+                              size_t elemSize, int arrayLength, BinMap& map) {
+  if (!isCoded(header)) return payloadData(ifname, header, payload, available, elemSize, arrayLength, NULL);
+
+  Buffer buf = takeBuffer(elemSize * arrayLength);
+  payloadData(ifname, header, payload, available, elemSize, arrayLength, buf.addr);
+  if (map.addr != NULL) munmap(map.addr, map.bytes);
+  if (map.buffer.addr != NULL) releaseBuffer(map.buffer);
+  map.addr = NULL;
+  map.bytes = 0;
+  map.buffer = buf;
+  return buf.addr;
+}
+
+// LIME files (ILDG configurations, SciDAC and Bridge++ output): "file#TYPE"
+// is the first record of that LIME type, "file#TYPE@N" the N-th (from 0),
+// and a LIME file by its bare name its largest record. The payload is
+// big-endian double or, at half the size, float. Only the record headers are
+// streamed; the payload is read or mapped once and swapped (and widened)
+// straight into the data, so there is no conversion pass over a copy.
+static bool splitLime(const char* fname, std::string& path, std::string& type, int& index) {
+  const char* mark = strrchr(fname, '#');
+  if (mark == NULL) return false;
+  path.assign(fname, mark - fname);
+  if (!limeIsFile(path.c_str())) return false;
+  type.assign(mark + 1);
+  index = 0;
+  size_t at = type.rfind('@');
+  if (at != std::string::npos) {
+    index = atoi(type.c_str() + at + 1);
+    type.resize(at);
+  }
+  return true;
+}
+
+static void readOnlyLime(const char* ofname) {
+  fprintf(stderr, "%s: LIME records are read-only\n", ofname);
+  exit(1);
+}
+
+// Find the record and the precision of its payload
+static BinEncoding findLime(const char* ifname, const char* path, const std::string& type, int index, size_t elemSize,
+                            int arrayLength, LimeRecord& record) {
+  if (!limeFind(path, type.c_str(), index, record)) {
+    fprintf(stderr, "%s: No such LIME record\n", ifname);
+    exit(1);
+  }
+  struct stat st;
+  if (stat(path, &st) != 0) {
+    perror(path);
+    exit(1);
+  }
+  if (record.offset + record.bytes > st.st_size) {
+    fprintf(stderr, "%s: File too short (%lld bytes expected, %lld found)\n", ifname,
+            (long long)(record.offset + record.bytes), (long long)st.st_size);
+    exit(1);
+  }
+
+  const size_t bytes = elemSize * arrayLength;
+  if (size_t(record.bytes) == bytes) return BIN_ENC_F64;
+  if (size_t(record.bytes) == bytes / 2) return BIN_ENC_F32;
+  fprintf(stderr, "%s: LIME record of %lld bytes (%zu expected for double, %zu for float)\n", ifname,
+          (long long)record.bytes, bytes, bytes / 2);
+  exit(1);
+}
+
+// Swap (and widen) a whole payload in memory into data
+static void limeData(const LimeRecord& record, BinEncoding encoding, const void* payload, size_t elemSize,
+                     int arrayLength, void* data) {
+  convertSwapped(payload, (DOUBLE*)data, elemSize * arrayLength / sizeof(DOUBLE), encoding);
+  bytesReadTotal += record.bytes;
+}
+
+// Read the numbers [first, first + count) of a record
+static void readLime(const char* ifname, const char* path, const std::string& type, int index, size_t elemSize,
+                     int arrayLength, int first, int count, void* data) {
+  LimeRecord record;
+  BinEncoding encoding = findLime(ifname, path, type, index, elemSize, arrayLength, record);
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    perror(path);
+    exit(1);
+  }
+
+  // Doubles are swapped in place; floats need room of their own
+  const size_t storedElemSize = elemSize / sizeof(DOUBLE) * convertSize(encoding);
+  const size_t bytes = storedElemSize * count;
+  const int64_t offset = record.offset + storedElemSize * first;
+  const size_t doubleCount = elemSize * count / sizeof(DOUBLE);
+  if (encoding == BIN_ENC_F64) {
+    preadAll(ifname, fd, data, bytes, offset);
+    convertSwapped(data, (DOUBLE*)data, doubleCount, encoding);
+  } else {
+    Buffer stored = takeBuffer(bytes);
+    preadAll(ifname, fd, stored.addr, bytes, offset);
+    convertSwapped(stored.addr, (DOUBLE*)data, doubleCount, encoding);
+    releaseBuffer(stored);
+  }
+  bytesReadTotal += bytes;
+  close(fd);
+}
+
+// Let map hand out a payload in memory (mapped or prefetched) as double: it
+// is converted into a pooled buffer, which replaces whatever held it
+static const void* mapLime(const LimeRecord& record, BinEncoding encoding, const void* payload, size_t elemSize,
+                           int arrayLength, BinMap& map) {
+  Buffer buf = takeBuffer(elemSize * arrayLength);
+  limeData(record, encoding, payload, elemSize, arrayLength, buf.addr);
+  if (map.addr != NULL) munmap(map.addr, map.bytes);
+  if (map.buffer.addr != NULL) releaseBuffer(map.buffer);
+  map.addr = NULL;
+  map.bytes = 0;
+  map.header = NULL;
+  map.buffer = buf;
+  return buf.addr;
+}
+
+static void writeFile(const char* ofname, uint32_t dtype, size_t elemSize, int arrayLength, const void* data);
+static void releaseMap(BinMap& map);
+
+// Asynchronous I/O between prefetchBin() and syncBin(). The reader thread
+// loads the listed files in order into pooled buffers, staying at most
+// 'depth' files (and about 'budget' bytes) ahead of the consumers; mapBin()
+// and readBin() of such a file take the buffer instead of touching the disk.
+// The writer thread drains writeBin() (from a copy of the data) and the
+// sealing of output mappings with headers, with the same limits.
+struct Prefetched {
+  Buffer buf;
+  size_t bytes = 0;  // File size
+};
+
+struct PendingWrite {
+  std::string name;
+  uint32_t dtype = 0;
+  size_t elemSize = 0;
+  int arrayLength = 0;
+  Buffer buf;        // Copy of the data for writeBin()
+  BinMap map;        // Output mapping to seal and release instead
+  size_t bytes = 0;  // Counted against the budget
+};
+
+struct AsyncIo {
+  std::mutex mutex;
+  std::condition_variable readCv, takeCv, writeCv, drainCv;
+  std::atomic<bool> isActive{false};
+  bool isStopping = false;
+  int depth = 0;
+  long long budget = -1;
+
+  std::vector<std::string> names;                 // Files to prefetch, in order
+  std::unordered_map<std::string, size_t> order;  // Name -> position in names
+  size_t next = 0;                                // Next position for the reader
+  std::unordered_map<std::string, Prefetched> ready;
+  long long readyBytes = 0;
+
+  std::deque<PendingWrite> writes;
+  long long writeBytes = 0;
+
+  std::thread reader, writer;
+};
+
+// Never destroyed: exit() on an error may come while the threads still run
+static AsyncIo& aio = *new AsyncIo;
+
+static void asyncReader() {
+  isBackground = true;
+  std::unique_lock<std::mutex> lock(aio.mutex);
+  while (aio.next < aio.names.size()) {
+    aio.readCv.wait(lock, [] {
+      return aio.isStopping || aio.ready.empty() ||
+             (int(aio.ready.size()) < aio.depth && (aio.budget < 0 || aio.readyBytes < aio.budget));
+    });
+    if (aio.isStopping) return;
+
+    const std::string name = aio.names[aio.next];
+    lock.unlock();
+
+    // Members of containers and virtual samples are left to the consumer
+    Prefetched item;
+    std::string container, member;
+    bool isPlain = !splitMember(name.c_str(), container, member) && !splitJk(name.c_str(), container, member);
+    if (isPlain) {
+      const char* fname = name.c_str();
+      int fd = open(fname, O_RDONLY);
+      struct stat st;
+      if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(fname);
+        exit(1);
+      }
+      item.bytes = st.st_size;
+      item.buf = takeBuffer(item.bytes);
+      preadAll(fname, fd, item.buf.addr, item.bytes, 0);
+      close(fd);
+    }
+
+    lock.lock();
+    if (isPlain) {
+      aio.ready[name] = item;
+      aio.readyBytes += item.bytes;
+    }
+    aio.next++;
+    aio.takeCv.notify_all();
+  }
+}
+
+static void asyncWriter() {
+  isBackground = true;
+  std::unique_lock<std::mutex> lock(aio.mutex);
+  while (true) {
+    aio.writeCv.wait(lock, [] { return aio.isStopping || !aio.writes.empty(); });
+    if (aio.writes.empty()) return;  // Stopping, and everything is written
+
+    PendingWrite item = aio.writes.front();
+    aio.writes.pop_front();
+    lock.unlock();
+
+    if (item.map.addr != NULL) {
+      releaseMap(item.map);
+    } else {
+      writeFile(item.name.c_str(), item.dtype, item.elemSize, item.arrayLength, item.buf.addr);
+      releaseBuffer(item.buf);
+    }
+
+    lock.lock();
+    aio.writeBytes -= item.bytes;
+    aio.drainCv.notify_all();
+  }
+}
+
+// The prefetched contents of ifname, if it is on the list: waits for the
+// reader when it has not got there yet
+static bool takePrefetched(const char* ifname, Prefetched& item) {
+  std::unique_lock<std::mutex> lock(aio.mutex);
+  if (!aio.isActive) return false;
+  auto found = aio.order.find(ifname);
+  if (found == aio.order.end()) return false;
+
+  const size_t position = found->second;
+  aio.takeCv.wait(lock, [&] { return aio.next > position; });
+  auto loaded = aio.ready.find(ifname);
+  if (loaded == aio.ready.end()) return false;  // Not prefetched, or taken already
+
+  item = loaded->second;
+  aio.readyBytes -= item.bytes;
+  aio.ready.erase(loaded);
+  aio.readCv.notify_all();
+  return true;
+}
+
+// Queue a write for the writer thread (blocks while the queue is full)
+static void queueWrite(const PendingWrite& item) {
+  std::unique_lock<std::mutex> lock(aio.mutex);
+  aio.drainCv.wait(lock, [] {
+    return aio.writes.empty() ||
+           (int(aio.writes.size()) < aio.depth && (aio.budget < 0 || aio.writeBytes < aio.budget));
+  });
+  aio.writeBytes += item.bytes;
+  aio.writes.push_back(item);
+  aio.writeCv.notify_one();
+}
+
+void prefetchBin(char* nameList[], int fileCountTotal, int depth, long long budgetBytes) {
+  if (depth <= 0) return;
+  syncBin();
+
+  std::lock_guard<std::mutex> lock(aio.mutex);
+  aio.names.assign(nameList, nameList + fileCountTotal);
+  aio.order.clear();
+  for (size_t i = 0; i < aio.names.size(); i++) aio.order.emplace(aio.names[i], i);
+  aio.next = 0;
+  aio.depth = depth;
+  aio.budget = budgetBytes;
+  aio.isStopping = false;
+  aio.isActive = true;
+  aio.reader = std::thread(asyncReader);
+  aio.writer = std::thread(asyncWriter);
+}
+
+void syncBin() {
+  {
+    std::lock_guard<std::mutex> lock(aio.mutex);
+    if (!aio.isActive) return;
+    aio.isStopping = true;
+  }
+  aio.readCv.notify_all();
+  aio.writeCv.notify_all();
+  aio.reader.join();
+  aio.writer.join();
+
+  std::lock_guard<std::mutex> lock(aio.mutex);
+  for (auto& item : aio.ready) releaseBuffer(item.second.buf);
+  aio.ready.clear();
+  aio.readyBytes = 0;
+  aio.names.clear();
+  aio.order.clear();
+  aio.next = 0;
+  aio.isActive = false;
+}
+
+bool probeBin(const char* ifname, BinHeader& header) {
+  std::string container, member;
+  if (splitJk(ifname, container, member)) {
+    // A sample looks like its raw file
+    JkView* jk = openJk(container);
+    return probeBin(jk->raws[findJk(jk, member, ifname, BIN_COMPLX, jk->arrayLength)].c_str(), header);
+  }
+
+  if (splitMember(ifname, container, member)) {
+    Ensemble* ens = openEnsemble(container, false);
+    EnsEntry entry = findMember(ens, member, ifname);
+    preadAll(ifname, ens->fd, &header, sizeof(header), entry.offset);
+    return isHeader(header);
+  }
+
+  int index;
+  if (splitLime(ifname, container, member, index)) return false;
+
   FILE* fp = fopen(ifname, "rb");
   if (fp == NULL) {
     perror(ifname);
     exit(1);
   }
 
-  fread(&data[0], sizeof(DOUBLE), arrayLength, fp);
+  bool isFound = fread(&header, sizeof(header), 1, fp) == 1 && isHeader(header);
   fclose(fp);
+  return isFound;
 }
-void readBin(const char* ifname, int arrayLength, CVARRAY& data) {
+
+static void readFile(const char* ifname, uint32_t dtype, size_t elemSize, int arrayLength, void* data) {
+  std::string container, member;
+  if (splitJk(ifname, container, member)) {
+    readJk(ifname, dtype, arrayLength, data);
+    return;
+  }
+  if (splitMember(ifname, container, member)) {
+    Ensemble* ens = openEnsemble(container, false);
+    EnsEntry entry = findMember(ens, member, ifname);
+    BinHeader header;
+    preadAll(ifname, ens->fd, &header, sizeof(header), entry.offset);
+    checkHeader(ifname, header, dtype, arrayLength);
+    if (isCoded(&header)) {
+      size_t available = entry.bytes - sizeof(header);
+      Buffer stored = takeBuffer(available);
+      preadAll(ifname, ens->fd, stored.addr, available, entry.offset + sizeof(header));
+      payloadData(ifname, &header, (const char*)stored.addr, available, elemSize, arrayLength, data);
+      releaseBuffer(stored);
+      return;
+    }
+    preadAll(ifname, ens->fd, data, elemSize * arrayLength, entry.offset + sizeof(header));
+    bytesReadTotal += elemSize * arrayLength;
+    checkData(ifname, header, data, elemSize * arrayLength);
+    return;
+  }
+  int index;
+  if (splitLime(ifname, container, member, index)) {
+    readLime(ifname, container.c_str(), member, index, elemSize, arrayLength, 0, arrayLength, data);
+    return;
+  }
+
+  Prefetched item;
+  if (takePrefetched(ifname, item)) {
+    const BinHeader* header;
+    const char* file = (const char*)item.buf.addr;
+    if (limeIsHeader(file, item.bytes)) {
+      LimeRecord record;
+      BinEncoding encoding = findLime(ifname, ifname, "", 0, elemSize, arrayLength, record);
+      limeData(record, encoding, file + record.offset, elemSize, arrayLength, data);
+      releaseBuffer(item.buf);
+      return;
+    }
+    const char* payload = filePayload(ifname, file, item.bytes, dtype, arrayLength, header);
+    const void* src = payloadData(ifname, header, payload, item.bytes - (payload - file), elemSize, arrayLength, data);
+    if (src != data) memcpy(data, src, elemSize * arrayLength);
+    releaseBuffer(item.buf);
+    return;
+  }
+
   FILE* fp = fopen(ifname, "rb");
   if (fp == NULL) {
     perror(ifname);
     exit(1);
   }
 
-  fread(&data[0], sizeof(COMPLX), arrayLength, fp);
+  BinHeader header;
+  bool isRead = fread(&header, sizeof(header), 1, fp) == 1;
+  bool isFound = isRead && isHeader(header);
+  if (isRead && !isFound && limeIsHeader(&header, sizeof(header))) {
+    fclose(fp);
+    readLime(ifname, ifname, "", 0, elemSize, arrayLength, 0, arrayLength, data);
+    return;
+  }
+  if (isFound) {
+    checkHeader(ifname, header, dtype, arrayLength);
+  } else {
+    rewind(fp);
+  }
+
+  if (isFound && isCoded(&header)) {
+    struct stat st;
+    if (fstat(fileno(fp), &st) != 0) {
+      perror(ifname);
+      exit(1);
+    }
+    size_t available = st.st_size - sizeof(header);
+    Buffer stored = takeBuffer(available);
+    if (fread(stored.addr, 1, available, fp) != available) {
+      perror(ifname);
+      exit(1);
+    }
+    fclose(fp);
+    payloadData(ifname, &header, (const char*)stored.addr, available, elemSize, arrayLength, data);
+    releaseBuffer(stored);
+    return;
+  }
+
+  bytesReadTotal += elemSize * fread(data, elemSize, arrayLength, fp);
   fclose(fp);
+
+  if (isFound) checkData(ifname, header, data, elemSize * arrayLength);
 }
 
-void writeBin(const char* ofname, int arrayLength, const DOUBLE* data) {
-  FILE* fp = fopen(ofname, "wb");
-  if (fp == NULL) {
-    perror(ofname);
+static void writeFile(const char* ofname, uint32_t dtype, size_t elemSize, int arrayLength, const void* data) {
+  std::string container, member;
+  if (splitJk(ofname, container, member)) readOnlyJk(ofname);
+  int index;
+  if (splitLime(ofname, container, member, index)) readOnlyLime(ofname);
+
+  // Reduced precision: encode into a pooled buffer and write that
+  size_t bytes = elemSize * arrayLength;
+  Buffer encoded;
+  if (outEncoding != BIN_ENC_F64) {
+    const size_t count = bytes / sizeof(DOUBLE);
+    bytes = count * convertSize(outEncoding);
+    encoded = takeBuffer(bytes);
+    convertNarrow((const DOUBLE*)data, encoded.addr, count, outEncoding);
+    data = encoded.addr;
+  }
+
+  // Compression: likewise, after the encoding
+  Buffer packed;
+  if (outCompression != BIN_COMP_NONE) {
+    packed = takeBuffer(codecBound(bytes, BIN_CHUNK_BYTES));
+    bytes = codecCompress(data, bytes, convertSize(outEncoding), BIN_CHUNK_BYTES, packed.addr, codecThreadCount());
+    data = packed.addr;
+  }
+
+  if (splitMember(ofname, container, member)) {
+    // Members always carry a header
+    Ensemble* ens = openEnsemble(container, true);
+    EnsEntry entry = addMember(ens, member, sizeof(BinHeader) + bytes, ofname);
+    BinHeader header;
+    makeHeader(header, dtype, arrayLength);
+    header.checksum = checksum(data, bytes);
+    pwriteAll(ofname, ens->fd, &header, sizeof(header), entry.offset);
+    pwriteAll(ofname, ens->fd, data, bytes, entry.offset + sizeof(header));
+  } else {
+    FILE* fp = fopen(ofname, "wb");
+    if (fp == NULL) {
+      perror(ofname);
+      exit(1);
+    }
+
+    // The encoding and compression are only known from the header
+    if (isOutHeader || isOutCoded()) {
+      BinHeader header;
+      makeHeader(header, dtype, arrayLength);
+      header.checksum = checksum(data, bytes);
+      fwrite(&header, sizeof(header), 1, fp);
+    }
+
+    fwrite(data, 1, bytes, fp);
+    fclose(fp);
+  }
+
+  if (encoded.addr != NULL) releaseBuffer(encoded);
+  if (packed.addr != NULL) releaseBuffer(packed);
+}
+
+void readBin(const char* ifname, int arrayLength, DOUBLE* data) {
+  readFile(ifname, BIN_DOUBLE, sizeof(DOUBLE), arrayLength, data);
+}
+void readBin(const char* ifname, int arrayLength, COMPLX* data) {
+  readFile(ifname, BIN_COMPLX, sizeof(COMPLX), arrayLength, data);
+}
+void readBin(const char* ifname, int arrayLength, DVARRAY& data) {
+  readFile(ifname, BIN_DOUBLE, sizeof(DOUBLE), arrayLength, &data[0]);
+}
+void readBin(const char* ifname, int arrayLength, CVARRAY& data) {
+  readFile(ifname, BIN_COMPLX, sizeof(COMPLX), arrayLength, &data[0]);
+}
+
+// Read the numbers [first, first + count) of ifname: only the bytes, or
+// the compressed chunks, that hold them
+static void readRange(const char* ifname, uint32_t dtype, size_t elemSize, int arrayLength, int first, int count,
+                      void* data) {
+  if (first < 0 || count < 0 || (long long)first + count > arrayLength) {
+    fprintf(stderr, "%s: Numbers [%d, %lld) outside the %d in the file\n", ifname, first, (long long)first + count,
+            arrayLength);
     exit(1);
   }
+  if (count == 0) return;
 
-  fwrite(data, sizeof(DOUBLE), arrayLength, fp);
-  fclose(fp);
+  // Virtual samples are computed as a whole
+  std::string container, member;
+  if (splitJk(ifname, container, member)) {
+    Buffer whole = takeBuffer(elemSize * arrayLength);
+    readJk(ifname, dtype, arrayLength, whole.addr);
+    memcpy(data, (const char*)whole.addr + elemSize * first, elemSize * count);
+    releaseBuffer(whole);
+    return;
+  }
+  int index;
+  if (splitLime(ifname, container, member, index)) {
+    readLime(ifname, container.c_str(), member, index, elemSize, arrayLength, first, count, data);
+    return;
+  }
+
+  // The file or member as descriptor, offset and size
+  int fd;
+  int64_t base = 0, available;
+  bool isOwned = false;
+  if (splitMember(ifname, container, member)) {
+    Ensemble* ens = openEnsemble(container, false);
+    EnsEntry entry = findMember(ens, member, ifname);
+    fd = ens->fd;
+    base = entry.offset;
+    available = entry.bytes;
+  } else {
+    fd = open(ifname, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+      perror(ifname);
+      exit(1);
+    }
+    available = st.st_size;
+    isOwned = true;
+  }
+
+  BinHeader header;
+  const BinHeader* found = NULL;
+  if (available >= int64_t(sizeof(header))) {
+    preadAll(ifname, fd, &header, sizeof(header), base);
+    if (isHeader(header)) {
+      checkHeader(ifname, header, dtype, arrayLength);
+      found = &header;
+      base += sizeof(header);
+      available -= sizeof(header);
+    } else if (isOwned && limeIsHeader(&header, sizeof(header))) {
+      close(fd);
+      readLime(ifname, ifname, "", 0, elemSize, arrayLength, first, count, data);
+      return;
+    }
+  }
+
+  // Byte range of the numbers in the encoding
+  const size_t total = storedBytes(found, elemSize, arrayLength);
+  const size_t lo = storedBytes(found, elemSize, first);
+  const size_t hi = storedBytes(found, elemSize, first + count);
+  Buffer stored, raw;
+  const char* src;
+  if (found == NULL || found->compression == BIN_COMP_NONE) {
+    if (int64_t(total) > available) {
+      fprintf(stderr, "%s: File too short (%zu bytes expected, %lld found)\n", ifname, total, (long long)available);
+      exit(1);
+    }
+    if (!isCoded(found)) {
+      preadAll(ifname, fd, data, hi - lo, base + lo);
+      bytesReadTotal += hi - lo;
+      if (isOwned) close(fd);
+      return;
+    }
+    stored = takeBuffer(hi - lo);
+    preadAll(ifname, fd, stored.addr, hi - lo, base + lo);
+    bytesReadTotal += hi - lo;
+    src = (const char*)stored.addr;
+  } else {
+    const size_t chunkBytes = found->chunkBytes;
+    std::vector<uint64_t> table(codecChunkCount(total, chunkBytes));
+    const size_t tableBytes = table.size() * sizeof(uint64_t);
+    if (int64_t(tableBytes) > available) {
+      fprintf(stderr, "%s: Compressed data corrupt or truncated\n", ifname);
+      exit(1);
+    }
+    preadAll(ifname, fd, table.data(), tableBytes, base);
+    if (codecPayloadBytes(table.data(), available, total, chunkBytes) == 0) {
+      fprintf(stderr, "%s: Compressed data corrupt or truncated\n", ifname);
+      exit(1);
+    }
+
+    // Chunks [c0, c1) hold the numbers
+    const size_t c0 = lo / chunkBytes, c1 = (hi + chunkBytes - 1) / chunkBytes;
+    const uint64_t start = c0 > 0 ? table[c0 - 1] : 0;
+    stored = takeBuffer(table[c1 - 1] - start);
+    preadAll(ifname, fd, stored.addr, table[c1 - 1] - start, base + tableBytes + start);
+    bytesReadTotal += tableBytes + table[c1 - 1] - start;
+
+    raw = takeBuffer((c1 - c0) * chunkBytes);
+    const size_t typeSize = convertSize(BinEncoding(found->encoding));
+    for (size_t c = c0; c < c1; c++) {
+      const uint64_t from = c > 0 ? table[c - 1] : 0;
+      const size_t bytes = std::min<size_t>(chunkBytes, total - c * chunkBytes);
+      if (!codecDecodeChunk((const char*)stored.addr + (from - start), table[c] - from,
+                            (char*)raw.addr + (c - c0) * chunkBytes, bytes, typeSize)) {
+        fprintf(stderr, "%s: Compressed data corrupt\n", ifname);
+        exit(1);
+      }
+    }
+    src = (const char*)raw.addr + (lo - c0 * chunkBytes);
+  }
+  if (isOwned) close(fd);
+
+  if (found->encoding != BIN_ENC_F64) {
+    convertWiden(src, (DOUBLE*)data, elemSize * count / sizeof(DOUBLE), BinEncoding(found->encoding));
+  } else {
+    memcpy(data, src, hi - lo);
+  }
+  releaseBuffer(stored);
+  if (raw.addr != NULL) releaseBuffer(raw);
+}
+
+void readBinRange(const char* ifname, int arrayLength, int first, int count, DOUBLE* data) {
+  readRange(ifname, BIN_DOUBLE, sizeof(DOUBLE), arrayLength, first, count, data);
+}
+void readBinRange(const char* ifname, int arrayLength, int first, int count, COMPLX* data) {
+  readRange(ifname, BIN_COMPLX, sizeof(COMPLX), arrayLength, first, count, data);
+}
+
+// writeFile(), from a copy of the data on the writer thread while asynchronous
+// I/O is on
+static void writeFileAsync(const char* ofname, uint32_t dtype, size_t elemSize, int arrayLength, const void* data) {
+  if (!aio.isActive) {
+    writeFile(ofname, dtype, elemSize, arrayLength, data);
+    return;
+  }
+
+  PendingWrite item;
+  item.name = ofname;
+  item.dtype = dtype;
+  item.elemSize = elemSize;
+  item.arrayLength = arrayLength;
+  item.bytes = elemSize * arrayLength;
+  item.buf = takeBuffer(item.bytes);
+  memcpy(item.buf.addr, data, item.bytes);
+  queueWrite(item);
+}
+
+void writeBin(const char* ofname, int arrayLength, const DOUBLE* data) {
+  writeFileAsync(ofname, BIN_DOUBLE, sizeof(DOUBLE), arrayLength, data);
 }
 void writeBin(const char* ofname, int arrayLength, const COMPLX* data) {
-  FILE* fp = fopen(ofname, "wb");
-  if (fp == NULL) {
-    perror(ofname);
+  writeFileAsync(ofname, BIN_COMPLX, sizeof(COMPLX), arrayLength, data);
+}
+void writeBin(const char* ofname, int arrayLength, const DVARRAY& data) {
+  writeFileAsync(ofname, BIN_DOUBLE, sizeof(DOUBLE), arrayLength, &data[0]);
+}
+void writeBin(const char* ofname, int arrayLength, const CVARRAY& data) {
+  writeFileAsync(ofname, BIN_COMPLX, sizeof(COMPLX), arrayLength, &data[0]);
+}
+
+// Map ifname read-only and return the start of its data (after the header)
+static const void* mapFile(const char* ifname, uint32_t dtype, size_t elemSize, int arrayLength, BinMap& map) {
+  std::string container, member;
+  if (splitJk(ifname, container, member)) return mapJk(ifname, dtype, arrayLength, map);
+  if (splitMember(ifname, container, member)) {
+    Ensemble* ens = openEnsemble(container, false);
+    EnsEntry entry = findMember(ens, member, ifname);
+    const BinHeader* header = (const BinHeader*)mapRange(ifname, ens->fd, entry.offset, entry.bytes, false, map);
+    checkHeader(ifname, *header, dtype, arrayLength);
+    return mapPayload(ifname, header, (const char*)(header + 1), entry.bytes - sizeof(BinHeader), elemSize,
+                      arrayLength, map);
+  }
+  int index;
+  if (splitLime(ifname, container, member, index)) {
+    LimeRecord record;
+    BinEncoding encoding = findLime(ifname, container.c_str(), member, index, elemSize, arrayLength, record);
+    int fd = open(container.c_str(), O_RDONLY);
+    if (fd < 0) {
+      perror(container.c_str());
+      exit(1);
+    }
+    const char* payload = mapRange(ifname, fd, record.offset, record.bytes, false, map);
+    close(fd);
+    return mapLime(record, encoding, payload, elemSize, arrayLength, map);
+  }
+
+  Prefetched item;
+  if (takePrefetched(ifname, item)) {
+    map.addr = NULL;
+    map.bytes = 0;
+    map.header = NULL;
+    map.buffer = item.buf;
+    const BinHeader* header;
+    const char* file = (const char*)item.buf.addr;
+    if (limeIsHeader(file, item.bytes)) {
+      LimeRecord record;
+      BinEncoding encoding = findLime(ifname, ifname, "", 0, elemSize, arrayLength, record);
+      return mapLime(record, encoding, file + record.offset, elemSize, arrayLength, map);
+    }
+    const char* payload = filePayload(ifname, file, item.bytes, dtype, arrayLength, header);
+    return mapPayload(ifname, header, payload, item.bytes - (payload - file), elemSize, arrayLength, map);
+  }
+
+  int fd = open(ifname, O_RDONLY);
+  if (fd < 0) {
+    perror(ifname);
     exit(1);
   }
 
-  fwrite(data, sizeof(COMPLX), arrayLength, fp);
-  fclose(fp);
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    perror(ifname);
+    exit(1);
+  }
+
+  size_t fileBytes = st.st_size;
+  if (fileBytes == 0) {
+    fprintf(stderr, "%s: File too short (%zu bytes expected, %zu found)\n", ifname, elemSize * arrayLength, fileBytes);
+    exit(1);
+  }
+
+  void* addr = mmap(NULL, fileBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (addr == MAP_FAILED) {
+    perror(ifname);
+    exit(1);
+  }
+  close(fd);
+  madvise(addr, fileBytes, MADV_WILLNEED);
+
+  map.addr = addr;
+  map.bytes = fileBytes;
+  map.header = NULL;
+
+  if (limeIsHeader(addr, fileBytes)) {
+    LimeRecord record;
+    BinEncoding encoding = findLime(ifname, ifname, "", 0, elemSize, arrayLength, record);
+    return mapLime(record, encoding, (const char*)addr + record.offset, elemSize, arrayLength, map);
+  }
+
+  const BinHeader* header;
+  const char* payload = filePayload(ifname, (const char*)addr, fileBytes, dtype, arrayLength, header);
+  return mapPayload(ifname, header, payload, fileBytes - (payload - (const char*)addr), elemSize, arrayLength, map);
 }
-void writeBin(const char* ofname, int arrayLength, const DVARRAY& data) {
-  FILE* fp = fopen(ofname, "wb");
-  if (fp == NULL) {
+
+// Create ofname with room for the header (if enabled) and the data, map it
+// read-write and return the start of the data
+static void* mapFileOut(const char* ofname, uint32_t dtype, size_t elemSize, int arrayLength, BinMap& map) {
+  std::string container, member;
+  if (splitJk(ofname, container, member)) readOnlyJk(ofname);
+  int index;
+  if (splitLime(ofname, container, member, index)) readOnlyLime(ofname);
+
+  // Coded output is computed in a buffer and encoded by unmapBin()
+  if (isOutCoded()) {
+    map = BinMap();
+    map.buffer = takeBuffer(elemSize * arrayLength);
+    map.target = ofname;
+    map.dtype = dtype;
+    map.arrayLength = arrayLength;
+    return map.buffer.addr;
+  }
+
+  if (splitMember(ofname, container, member)) {
+    Ensemble* ens = openEnsemble(container, true);
+    EnsEntry entry = addMember(ens, member, sizeof(BinHeader) + elemSize * arrayLength, ofname);
+    {
+      // The mapping must not reach past the end of the file
+      std::lock_guard<std::mutex> lock(ens->mutex);
+      struct stat st;
+      if (fstat(ens->fd, &st) != 0 ||
+          (st.st_size < entry.offset + entry.bytes && ftruncate(ens->fd, entry.offset + entry.bytes) != 0)) {
+        perror(ofname);
+        exit(1);
+      }
+    }
+    BinHeader* header = (BinHeader*)mapRange(ofname, ens->fd, entry.offset, entry.bytes, true, map);
+    makeHeader(*header, dtype, arrayLength);
+    map.header = header;
+    return header + 1;
+  }
+
+  int fd = open(ofname, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
     perror(ofname);
     exit(1);
   }
 
-  fwrite(&data[0], sizeof(DOUBLE), arrayLength, fp);
-  fclose(fp);
-}
-void writeBin(const char* ofname, int arrayLength, const CVARRAY& data) {
-  FILE* fp = fopen(ofname, "wb");
-  if (fp == NULL) {
+  size_t offset = isOutHeader ? sizeof(BinHeader) : 0;
+  size_t bytes = offset + elemSize * arrayLength;
+  if (ftruncate(fd, bytes) != 0) {
     perror(ofname);
     exit(1);
   }
 
-  fwrite(&data[0], sizeof(COMPLX), arrayLength, fp);
-  fclose(fp);
+  void* addr = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) {
+    perror(ofname);
+    exit(1);
+  }
+  close(fd);
+
+  map.addr = addr;
+  map.bytes = bytes;
+  map.header = NULL;
+  if (isOutHeader) {
+    map.header = (BinHeader*)addr;
+    makeHeader(*map.header, dtype, arrayLength);
+  }
+
+  return (char*)addr + offset;
+}
+
+void mapBin(const char* ifname, int arrayLength, const DOUBLE*& data, BinMap& map) {
+  data = (const DOUBLE*)mapFile(ifname, BIN_DOUBLE, sizeof(DOUBLE), arrayLength, map);
+}
+void mapBin(const char* ifname, int arrayLength, const COMPLX*& data, BinMap& map) {
+  data = (const COMPLX*)mapFile(ifname, BIN_COMPLX, sizeof(COMPLX), arrayLength, map);
+}
+
+void mapBinOut(const char* ofname, int arrayLength, DOUBLE*& data, BinMap& map) {
+  data = (DOUBLE*)mapFileOut(ofname, BIN_DOUBLE, sizeof(DOUBLE), arrayLength, map);
+}
+void mapBinOut(const char* ofname, int arrayLength, COMPLX*& data, BinMap& map) {
+  data = (COMPLX*)mapFileOut(ofname, BIN_COMPLX, sizeof(COMPLX), arrayLength, map);
+}
+
+void unmapBin(BinMap& map) {
+  if (!map.target.empty()) {
+    size_t elemSize = map.dtype == BIN_COMPLX ? sizeof(COMPLX) : sizeof(DOUBLE);
+    writeFileAsync(map.target.c_str(), map.dtype, elemSize, map.arrayLength, map.buffer.addr);
+    releaseBuffer(map.buffer);
+    map = BinMap();
+    return;
+  }
+
+  // Sealing (a pass over the data) is left to the writer thread, if any
+  if (map.header != NULL && aio.isActive) {
+    PendingWrite item;
+    item.map = map;
+    item.bytes = map.bytes;
+    queueWrite(item);
+    map = BinMap();
+    return;
+  }
+  releaseMap(map);
+}
+
+static void releaseMap(BinMap& map) {
+  // The data of an output mapping is final now: seal it with the checksum
+  if (map.header != NULL) {
+    size_t elemSize = map.header->dtype == BIN_COMPLX ? sizeof(COMPLX) : sizeof(DOUBLE);
+    map.header->checksum = checksum(map.header + 1, elemSize * map.header->arrayLength);
+  }
+
+  if (map.addr != NULL) {
+    munmap(map.addr, map.bytes);
+  }
+  if (map.buffer.addr != NULL) {
+    releaseBuffer(map.buffer);
+    map.buffer = Buffer();
+  }
+  map.addr = NULL;
+  map.bytes = 0;
+  map.header = NULL;
+}
+
+void expandBin(int& argc, char**& argv) {
+  std::vector<char*> names;
+  bool isExpanded = false;
+  for (int i = 0; i < argc; i++) {
+    std::string container, pattern;
+    if (isJkName(argv[i]) || (splitJk(argv[i], container, pattern) && strpbrk(pattern.c_str(), "*?[") != NULL)) {
+      // Samples in the order of the raw files
+      if (container.empty()) {
+        container = argv[i];
+        pattern = "*";
+      }
+      JkView* jk = openJk(container);
+      for (const std::string& member : jk->members) {
+        if (fnmatch(pattern.c_str(), member.c_str(), 0) != 0) continue;
+        names.push_back(strdup((container + "#" + member).c_str()));
+      }
+      isExpanded = true;
+      continue;
+    }
+
+    if (isEnsName(argv[i])) {
+      container = argv[i];
+      pattern = "*";
+    } else if (!splitMember(argv[i], container, pattern) || strpbrk(pattern.c_str(), "*?[") == NULL) {
+      names.push_back(argv[i]);
+      continue;
+    }
+
+    // Members in the order they were written
+    Ensemble* ens = openEnsemble(container, false);
+    std::lock_guard<std::mutex> lock(ens->mutex);
+    for (const EnsEntry& entry : ens->entries) {
+      if (fnmatch(pattern.c_str(), entry.name, 0) != 0) continue;
+      std::string name = container + "#" + entry.name;
+      names.push_back(strdup(name.c_str()));
+    }
+    isExpanded = true;
+  }
+  if (!isExpanded) return;
+
+  // The expanded list lives until the process exits
+  char** list = (char**)malloc((names.size() + 1) * sizeof(char*));
+  std::copy(names.begin(), names.end(), list);
+  list[names.size()] = NULL;
+  argc = names.size();
+  argv = list;
+}
+
+void listBin(const char* dir, const char* pattern, std::vector<std::string>& names) {
+  size_t first = names.size();
+
+  if (isJkName(dir)) {
+    for (const std::string& member : openJk(dir)->members) {
+      if (fnmatch(pattern, member.c_str(), 0) == 0) names.push_back(member);
+    }
+  } else if (isEnsName(dir)) {
+    Ensemble* ens = openEnsemble(dir, false);
+    std::lock_guard<std::mutex> lock(ens->mutex);
+    for (const EnsEntry& entry : ens->entries) {
+      if (fnmatch(pattern, entry.name, 0) == 0) names.push_back(entry.name);
+    }
+  } else {
+    DIR* dp = opendir(dir);
+    if (dp == NULL) {
+      perror(dir);
+      exit(1);
+    }
+    for (struct dirent* entry = readdir(dp); entry != NULL; entry = readdir(dp)) {
+      if (fnmatch(pattern, entry->d_name, FNM_PERIOD) == 0) names.push_back(entry->d_name);
+    }
+    closedir(dp);
+  }
+
+  std::sort(names.begin() + first, names.end());
 }
 
 void keepReal(CVARRAY& data, DVARRAY& realData, int arrayLength) {
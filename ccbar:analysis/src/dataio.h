@@ -2,9 +2,35 @@
  * @file dataio.h
  * @author Tianchen Zhang
  * @brief Deal with binary data.
- *        Provide 5 functions:
+ *        Files may start with a self-describing header (BinHeader); legacy
+ *        headerless files are still accepted everywhere.
+ *        Wherever a file name is expected, "file.ens#member" names one array
+ *        inside a packed ensemble container (written the same way), and
+ *        "file.jk#member" a virtual jackknife sample (read-only): the manifest
+ *        file.jk written by jre -J lists the sum of N raw files and the raw
+ *        file of each member, and the sample (sum - raw) / (N - 1) is computed
+ *        when it is read. LIME files (ILDG configurations, SciDAC output) are
+ *        read directly, if built with LIME: "file#TYPE" (or "file#TYPE@N")
+ *        names a record of that LIME type, a bare LIME file its largest
+ *        record; big-endian double or float, converted while loaded.
+ *        Provide 20 functions:
+ *        void setBinOutput(): Choose whether output files get a header;
+ *        void setBinEncoding(): Choose the encoding of output files;
+ *        bool parseBinEncoding(): Encoding from its name (f64, f32, bf16);
+ *        void setBinCompression(): Choose whether output files are compressed;
+ *        bool probeBin(): Read the header of a binary file, if any;
  *        void readBin(): Read data from binary file;
+ *        void readBinRange(): Read a part of the data of a binary file;
  *        void writeBin(): Write data to binary file;
+ *        void mapBin(): Map binary file read-only into memory (zero-copy);
+ *        void mapBinOut(): Create binary file and map it for writing;
+ *        void unmapBin(): Release a mapping created by mapBin()/mapBinOut();
+ *        long long binBytesRead(): Total bytes read by readBin()/mapBin();
+ *        void prefetchBin(): Read files ahead and write in the background;
+ *        void syncBin(): Finish the background reads and writes;
+ *        void expandBin(): Expand ensemble containers in a list of file names;
+ *        void listBin(): Names in a directory or ensemble container matching a pattern;
+ *        void writeJk(): Write the manifest of a virtual jackknife;
  *        void keepReal(): Keep the real part of each element in complex valarray;
  *        void keepImag(): Keep the imaginary of each element in complex valarray;
  *        void varryNorm(): Calculate the norm of each element in complex valarray
@@ -16,13 +42,129 @@
 #ifndef CCBAR_SRC_DATAIO_H_
 #define CCBAR_SRC_DATAIO_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <complex>
+#include <string>
 #include <valarray>
+#include <vector>
 
 #include "alias.h"
+#include "buffer.h"
+
+// Element types of BinHeader::dtype
+enum BinDtype { BIN_DOUBLE = 1, BIN_COMPLX = 2 };
+
+// Encodings of the numbers in the file (BinHeader::encoding); the data is
+// always double (or complex<double>) in memory
+enum BinEncoding {
+  BIN_ENC_F64 = 0,   // IEEE double, as before
+  BIN_ENC_F32 = 1,   // IEEE float, rounded to nearest
+  BIN_ENC_BF16 = 2,  // bfloat16: upper 16 bits of the float
+};
+
+// Compression of the data in the file (BinHeader::compression)
+enum BinCompression {
+  BIN_COMP_NONE = 0,  // Stored as is
+  BIN_COMP_LZ = 1,    // Byte-shuffled chunks with LZ compression (codec.h)
+};
+
+// Array layouts of BinHeader::layout
+enum BinLayout {
+  BIN_LAYOUT_FLAT = 0,   // Anything else
+  BIN_LAYOUT_XYZ = 1,    // L^3 sites, x fastest: x + L * (y + L * z)
+  BIN_LAYOUT_T = 2,      // T time slices
+  BIN_LAYOUT_ORBIT = 3,  // O_h orbit representatives x <= y <= z <= L/2 (a1plus -r)
+};
+
+/**
+ * @brief Header of self-describing binary files (128 bytes, followed by the
+ *        data exactly as in headerless files, unless encoded or compressed)
+ */
+struct BinHeader {
+  char magic[8];         // "CCBARBIN"
+  uint32_t version;      // Format version (1; 2 if encoded or compressed)
+  uint32_t byteOrder;    // 0x01020304 in the byte order of the writer
+  uint32_t dtype;        // BinDtype
+  uint32_t layout;       // BinLayout
+  int32_t xyzSize;       // Spacial size of lattice (0: unknown)
+  int32_t tSize;         // Temporal size of lattice (0: unknown)
+  int64_t arrayLength;   // Total of double/complex numbers
+  uint64_t checksum;     // 64-bit FNV-1a (word-wise) of the data as stored
+  char provenance[64];   // Program (and input) that produced the file
+  uint32_t encoding;     // BinEncoding (zero in version 1)
+  uint32_t compression;  // BinCompression (zero in version 1)
+  uint32_t chunkBytes;   // Raw bytes per compressed chunk (0: not compressed)
+  char reserved[4];      // Zero
+};
+static_assert(sizeof(BinHeader) == 128, "BinHeader must be 128 bytes");
+
+/**
+ * @brief Memory mapping of a binary data file (see mapBin() and mapBinOut())
+ */
+struct BinMap {
+  void* addr = NULL;          // Start address of the mapping
+  size_t bytes = 0;           // Length of the mapping in bytes
+  BinHeader* header = NULL;   // Header inside an output mapping, if any
+  Buffer buffer;              // Memory behind the data when it is not a file mapping
+  std::string target;         // Output written from buffer by unmapBin() (encoded output)
+  uint32_t dtype = 0;         // BinDtype of target
+  int arrayLength = 0;        // Length of target
+};
+
+/**
+ * @brief Choose whether writeBin()/mapBinOut() put a header in front of the
+ *        data (default: no header, as before)
+ *
+ * @param isHeader Write headers
+ * @param provenance Recorded in the header (e.g. program name)
+ * @param xyzSize Spacial size of lattice (0: unknown)
+ * @param tSize Temporal size of lattice (0: unknown)
+ */
+void setBinOutput(bool isHeader, const char* provenance, int xyzSize, int tSize);
+
+/**
+ * @brief Choose the encoding of the numbers in output files (default:
+ *        BIN_ENC_F64, as before). Reduced-precision files always get a header
+ *        (which records the encoding) and are widened to double when read.
+ *
+ * @param encoding Encoding of writeBin()/mapBinOut() from now on
+ */
+void setBinEncoding(BinEncoding encoding);
 
 /**
- * @brief Read data from binary file
+ * @brief Encoding from its name on the command line
+ *
+ * @param name "f64", "f32" or "bf16"
+ * @param encoding The encoding (unchanged if the name is unknown)
+ * @return false if the name is unknown
+ */
+bool parseBinEncoding(const char* name, BinEncoding& encoding);
+
+/**
+ * @brief Choose whether the numbers in output files are compressed
+ *        (default: BIN_COMP_NONE, as before). Compressed files always get a
+ *        header and are decompressed when read.
+ *
+ * @param compression Compression of writeBin()/mapBinOut() from now on
+ * @param threadCount Threads for the chunks of one file (inside the
+ *        per-file loop of a tool, or in the background, one is used)
+ */
+void setBinCompression(BinCompression compression, int threadCount);
+
+/**
+ * @brief Read the header of a binary file, if any (the data is not checked)
+ *
+ * @param ifname Input file name of the data file
+ * @param header Filled when the file has a header
+ * @return true if the file has a valid header
+ */
+bool probeBin(const char* ifname, BinHeader& header);
+
+/**
+ * @brief Read data from binary file; a header, if present, is validated
+ *        (type, length, byte order and checksum) and skipped
  *
  * @param ifname Input file name of the data file
  * @param arrayLength Total of double/complex numbers
@@ -33,6 +175,20 @@ void readBin(const char* ifname, int arrayLength, COMPLX* data);
 void readBin(const char* ifname, int arrayLength, DVARRAY& data);
 void readBin(const char* ifname, int arrayLength, CVARRAY& data);
 
+/**
+ * @brief Read the numbers [first, first + count) of a binary file: only the
+ *        chunks that hold them are read and decompressed (the checksum,
+ *        which covers the whole file, is not checked)
+ *
+ * @param ifname Input file name of the data file
+ * @param arrayLength Total of double/complex numbers in the file
+ * @param first Index of the first number to read
+ * @param count Number of numbers to read
+ * @param data The array that receives the count numbers
+ */
+void readBinRange(const char* ifname, int arrayLength, int first, int count, DOUBLE* data);
+void readBinRange(const char* ifname, int arrayLength, int first, int count, COMPLX* data);
+
 /**
  * @brief Write data to binary file
  *
@@ -46,6 +202,100 @@ void writeBin(const char* ofname, int arrayLength, const COMPLX* data);
 void writeBin(const char* ofname, int arrayLength, const DVARRAY& data);
 void writeBin(const char* ofname, int arrayLength, const CVARRAY& data);
 
+/**
+ * @brief Map binary file read-only into memory, no copy and no allocation
+ *
+ * @param ifname Input file name of the data file
+ * @param arrayLength Total of double/complex numbers
+ * @param data Set to the first element of the mapped file
+ * @param map Mapping handle, to be released with unmapBin()
+ */
+void mapBin(const char* ifname, int arrayLength, const DOUBLE*& data, BinMap& map);
+void mapBin(const char* ifname, int arrayLength, const COMPLX*& data, BinMap& map);
+
+/**
+ * @brief Create (or truncate) binary file of the right size and map it for
+ *        writing; the data reaches the file when unmapBin() is called
+ *
+ * @param ofname Output file name of the data file
+ * @param arrayLength Total of double/complex numbers
+ * @param data Set to the first element of the mapped file
+ * @param map Mapping handle, to be released with unmapBin()
+ */
+void mapBinOut(const char* ofname, int arrayLength, DOUBLE*& data, BinMap& map);
+void mapBinOut(const char* ofname, int arrayLength, COMPLX*& data, BinMap& map);
+
+/**
+ * @brief Release a mapping created by mapBin() or mapBinOut()
+ *
+ * @param map Mapping handle
+ */
+void unmapBin(BinMap& map);
+
+/**
+ * @brief Total bytes read from binary files by readBin() and mapBin() so far
+ *        in this process (thread-safe)
+ *
+ * @return Byte count
+ */
+long long binBytesRead();
+
+/**
+ * @brief Start asynchronous I/O for a batch loop: a reader thread loads the
+ *        listed files, in order, up to 'depth' files ahead of readBin() and
+ *        mapBin() (which then take the loaded data instead of reading), and
+ *        writeBin() and unmapBin() of output mappings finish on a writer
+ *        thread, at most 'depth' writes behind. Files that are read in
+ *        another order, or are not on the list, are read as usual.
+ *
+ * @param nameList Input files, in the order they will be read
+ * @param fileCountTotal Number of files
+ * @param depth Queue depth of reads and of writes (0: synchronous I/O, no-op)
+ * @param budgetBytes About the most bytes held by each queue (negative: no limit)
+ */
+void prefetchBin(char* nameList[], int fileCountTotal, int depth, long long budgetBytes);
+
+/**
+ * @brief Wait for the background writes and stop the threads started by
+ *        prefetchBin() (no-op if there are none)
+ */
+void syncBin();
+
+/**
+ * @brief Expand ensemble containers and virtual jackknifes in a list of file
+ *        names: "file.ens" (or "file.jk") becomes all its members,
+ *        "file.ens#pattern" (with *, ? or [...]) the matching ones; other names
+ *        are kept as they are
+ *
+ * @param argc Number of names, updated
+ * @param argv The names, replaced by the expanded list if anything was expanded
+ */
+void expandBin(int& argc, char**& argv);
+
+/**
+ * @brief Names of the files in a directory, or of the members of an ensemble
+ *        container or virtual jackknife, that match a pattern (*, ? and [...]),
+ *        sorted
+ *
+ * @param dir Directory, ensemble container (*.ens) or virtual jackknife (*.jk)
+ * @param pattern Pattern for the names
+ * @param names Matching names (without directory), appended
+ */
+void listBin(const char* dir, const char* pattern, std::vector<std::string>& names);
+
+/**
+ * @brief Write the manifest of a virtual jackknife over the given raw files
+ *        and their sum (the sum is written to "manifest.sum"); member i is
+ *        named after raw file i, like the sample files jre writes
+ *
+ * @param manifest Name of the manifest (ends with ".jk")
+ * @param rawDataList Raw data files, in the order they were summed
+ * @param fileCountTotal Number of raw files (N)
+ * @param arrayLength Total of complex numbers per file
+ * @param sum Sum of the raw files
+ */
+void writeJk(const char* manifest, char* rawDataList[], int fileCountTotal, int arrayLength, const COMPLX* sum);
+
 /**
  * @brief Keep the real part of each element in complex valarray
  *
@@ -12,38 +12,77 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
 #include <complex>
+#include <string>
 #include <valarray>
+#include <vector>
 
+#include "buffer.h"
 #include "dataio.h"
 #include "misc.h"
+#include "threadpool.h"
 
 void usage(char* name) {
-  fprintf(stderr, "Effective masses for charmonium (ofname: exp.xxx and csh.xxx)\n");
+  fprintf(stderr, "Effective masses for charmonium (ofname: exp.xxx, csh.xxx, ...)\n");
   fprintf(stderr,
           "USAGE: \n"
-          "    %s [OPTIONS] ifname1 [ifname2 ...]\n",
+          "    %s [OPTIONS] ifname1 [ifname2 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -n <TSIZE>:        Temporal size of lattice\n"
-          "    -d <OFDIR>:        Directory of output files\n"
+          "    -n <TSIZE>:        Temporal size of lattice (default: from file header)\n"
+          "    -d <OFDIR>:        Directory (or ensemble container *.ens) of output files\n"
+          "    [-e <EST,...>]:    Estimators, computed in one pass (default: exp,csh):\n"
+          "                       exp: log[C(t)/C(t+1)]\n"
+          "                       csh: C(t)/C(t+1) = cosh[m(T/2-t)]/cosh[m(T/2-t-1)]\n"
+          "                       snh: C(t)/C(t+1) = sinh[m(T/2-t)]/sinh[m(T/2-t-1)]\n"
+          "                       ach: acosh{[C(t-1)+C(t+1)]/[2C(t)]} (no T dependence)\n"
           "    -ep <EXPPREFIX>:   Prefix for exp output files\n"
           "    -hp <CSHPREFIX>:   Prefix for csh output files\n"
+          "    [-sp <SNHPREFIX>]: Prefix for snh output files\n"
+          "    [-ap <ACHPREFIX>]: Prefix for ach output files\n"
+          "    [-rp <RECPREFIX>]: One record per input file instead, with prefix RECPREFIX: the\n"
+          "                       estimators in the order of -e, T values each\n"
+          "    [-F <FLAGFILE>]:   List the time slices without mass (file, estimator, t, reason)\n"
+          "    [-j <THREADS>]:    Number of threads (default: 1)\n"
+          "    [-H]:              Write self-describing header to output files\n"
           "    [-h, --help]:      Print help\n");
 }
 
+enum Estimator { EST_EXP, EST_CSH, EST_SNH, EST_ACH, EST_COUNT };
+static const char* estName[EST_COUNT] = {"exp", "csh", "snh", "ach"};
+
+// Why an effective mass could not be computed (NaN or inf is written instead)
+enum MassFlag {
+  MASS_OK = 0,
+  MASS_DOMAIN = 1,   // Ratio of correlators outside the range of the estimator
+  MASS_BRACKET = 2,  // No root in [M0, M1]
+  MASS_ITER = 3,     // Not converged within JMAX steps
+};
+static const char* massFlagName[] = {"ok", "domain", "bracket", "iter"};
+
 // Custom function declaration
-void expMass(char* rawDataList[], char* expList[], int tSize, int fileCountTotal);
-void cshMass(char* rawDataList[], char* cshList[], int tSize, int fileCountTotal);
+void effMass(char* rawDataList[], const std::vector<std::string>& ofnameList, const std::vector<Estimator>& estList,
+             bool isRecord, int tSize, int fileCountTotal, int threadCount, uint8_t flags[]);
+void massRow(Estimator est, const COMPLX* raw, COMPLX* effmass, int tSize, uint8_t flags[]);
+DOUBLE hypMassCal(Estimator est, int t1, int t2, DOUBLE corr1, DOUBLE corr2, int tSize, uint8_t& flag);
 
 // Main function
 int main(int argc, char* argv[]) {
   // Global variables
   int tSize = 0;
   static const char* ofDir = NULL;
-  static const char* expPrefix = NULL;
-  static const char* cshPrefix = NULL;
+  const char* prefix[EST_COUNT] = {NULL, NULL, NULL, NULL};
+  static const char* recPrefix = NULL;
+  std::vector<Estimator> estList = {EST_EXP, EST_CSH};
+  static const char* flagFile = NULL;
+  int threadCount = 1;
+  bool isHeader = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -81,10 +120,35 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -e: estimators
+    if (strcmp(argv[0], "-e") == 0) {
+      if (argv[1] == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      estList.clear();
+      char list[1024];
+      strncpy(list, argv[1], 1023);
+      list[1023] = '\0';
+      for (char* name = strtok(list, ","); name != NULL; name = strtok(NULL, ",")) {
+        int e = 0;
+        while (e < EST_COUNT && strcmp(name, estName[e]) != 0) e++;
+        if (e == EST_COUNT) {
+          fprintf(stderr, "Error: Unknown estimator '%s'\n", name);
+          usage(programName);
+          exit(1);
+        }
+        estList.push_back(Estimator(e));
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
     // -ep: Prefix for exp output files
     if (strcmp(argv[0], "-ep") == 0) {
-      expPrefix = argv[1];
-      if (expPrefix == NULL) {
+      prefix[EST_EXP] = argv[1];
+      if (prefix[EST_EXP] == NULL) {
         usage(programName);
         exit(1);
       }
@@ -95,8 +159,68 @@ int main(int argc, char* argv[]) {
 
     // -hp: Prefix for csh output files
     if (strcmp(argv[0], "-hp") == 0) {
-      cshPrefix = argv[1];
-      if (cshPrefix == NULL) {
+      prefix[EST_CSH] = argv[1];
+      if (prefix[EST_CSH] == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -sp: Prefix for snh output files
+    if (strcmp(argv[0], "-sp") == 0) {
+      prefix[EST_SNH] = argv[1];
+      if (prefix[EST_SNH] == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -ap: Prefix for ach output files
+    if (strcmp(argv[0], "-ap") == 0) {
+      prefix[EST_ACH] = argv[1];
+      if (prefix[EST_ACH] == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -rp: Prefix for record output files
+    if (strcmp(argv[0], "-rp") == 0) {
+      recPrefix = argv[1];
+      if (recPrefix == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -F: list of failed effective masses
+    if (strcmp(argv[0], "-F") == 0) {
+      flagFile = argv[1];
+      if (flagFile == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
         usage(programName);
         exit(1);
       }
@@ -105,11 +229,22 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
   }
 
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
   // Initialization
   const int fileCountTotal = argc;  // # of data files
   if (fileCountTotal < 1) {
@@ -117,93 +252,190 @@ int main(int argc, char* argv[]) {
     exit(1);
   }
 
-  // Create arrays to store ofnames
-  char *expNameArr[fileCountTotal], *cshNameArr[fileCountTotal];
-  for (int i = 0; i < fileCountTotal; i++) {
-    char stmp[2048];
-
-    expNameArr[i] = (char*)malloc(2048 * sizeof(char));
-    addPrefix(argv[i], expPrefix, stmp);
-    changePath(stmp, ofDir, expNameArr[i]);
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !tSize) tSize = header.tSize;
+  if (!tSize) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, 0, tSize);
 
-    cshNameArr[i] = (char*)malloc(2048 * sizeof(char));
-    addPrefix(argv[i], cshPrefix, stmp);
-    changePath(stmp, ofDir, cshNameArr[i]);
+  // Output names: one record per input, or one file per input and estimator
+  const bool isRecord = recPrefix != NULL;
+  const int estCount = estList.size();
+  std::vector<std::string> ofnameList;
+  for (int i = 0; i < fileCountTotal; i++) {
+    char stmp[2048], ofname[2048];
+    for (int e = 0; e < (isRecord ? 1 : estCount); e++) {
+      addPrefix(argv[i], isRecord ? recPrefix : prefix[estList[e]], stmp);
+      changePath(stmp, ofDir, ofname);
+      ofnameList.push_back(ofname);
+    }
   }
 
   // Main part for calculation
-  expMass(argv, expNameArr, tSize, fileCountTotal);
-  cshMass(argv, cshNameArr, tSize, fileCountTotal);
+  std::vector<uint8_t> flags(size_t(fileCountTotal) * estCount * tSize, MASS_OK);
+  effMass(argv, ofnameList, estList, isRecord, tSize, fileCountTotal, threadCount, flags.data());
 
-  // Finalization for the string arrays
-  for (int i = 0; i < fileCountTotal; i++) {
-    free(expNameArr[i]);
-    free(cshNameArr[i]);
+  // Failed effective masses: one summary line, the details in the flag file
+  int failCount = 0;
+  for (uint8_t flag : flags) failCount += flag != MASS_OK;
+  if (flagFile != NULL) {
+    FILE* fp = fopen(flagFile, "w");
+    if (fp == NULL) {
+      perror(flagFile);
+      exit(1);
+    }
+    for (int i = 0; i < fileCountTotal; i++) {
+      for (int e = 0; e < estCount; e++) {
+        for (int j = 0; j < tSize; j++) {
+          uint8_t flag = flags[(size_t(i) * estCount + e) * tSize + j];
+          if (flag != MASS_OK) fprintf(fp, "%s %s %d %s\n", argv[i], estName[estList[e]], j, massFlagName[flag]);
+        }
+      }
+    }
+    fclose(fp);
+  }
+  if (failCount) {
+    fprintf(stderr, "%s: no effective mass for %d of %d values%s\n", programName, failCount,
+            fileCountTotal * estCount * tSize, flagFile == NULL ? " (list them with -F)" : "");
   }
 
   return 0;
 }
 
 // Custom function definition
-void expMass(char* rawDataList[], char* expList[], int tSize, int fileCountTotal) {
-  for (int i = 0; i < fileCountTotal; i++) {
-    COMPLX raw[tSize], effmass[tSize];
-    for (int j = 0; j < tSize; j++) {
-      raw[j] = 0.0;
-      effmass[j] = 0.0;
+
+// Each correlator is read once and all estimators are computed from it
+void effMass(char* rawDataList[], const std::vector<std::string>& ofnameList, const std::vector<Estimator>& estList,
+             bool isRecord, int tSize, int fileCountTotal, int threadCount, uint8_t flags[]) {
+  const int estCount = estList.size();
+
+  parallelFor(fileCountTotal, threadCount, [&](int i) {
+    const COMPLX* raw;
+    BinMap inMap;
+    COMPLX* effmass = bufferScratch<COMPLX>(0, size_t(estCount) * tSize);
+    std::fill(effmass, effmass + size_t(estCount) * tSize, 0.0);
+    mapBin(rawDataList[i], tSize, raw, inMap);
+
+    for (int e = 0; e < estCount; e++) {
+      massRow(estList[e], raw, &effmass[size_t(e) * tSize], tSize, &flags[(size_t(i) * estCount + e) * tSize]);
     }
-    readBin(rawDataList[i], tSize, raw);
+    unmapBin(inMap);
 
-    for (int j = 0; j < tSize; j++) {
-      effmass[j].real(log(raw[j].real() / raw[(j + 1) % tSize].real()));
+    if (isRecord) {
+      writeBin(ofnameList[i].c_str(), estCount * tSize, effmass);
+    } else {
+      for (int e = 0; e < estCount; e++) {
+        writeBin(ofnameList[size_t(i) * estCount + e].c_str(), tSize, &effmass[size_t(e) * tSize]);
+      }
     }
+  });
+}
 
-    writeBin(expList[i], tSize, effmass);
+// One estimator for all t (real part; the imaginary part stays 0)
+void massRow(Estimator est, const COMPLX* raw, COMPLX* effmass, int tSize, uint8_t flags[]) {
+  for (int j = 0; j < tSize; j++) {
+    const int tp = (j + 1) % tSize, tm = (j - 1 + tSize) % tSize;
+    DOUBLE mass;
+    switch (est) {
+      case EST_EXP:
+        mass = log(raw[j].real() / raw[tp].real());
+        break;
+      case EST_ACH:
+        // Forward and backward propagating state: C(t-1) + C(t+1) = 2 cosh(m) C(t)
+        mass = acosh((raw[tm].real() + raw[tp].real()) / (2.0 * raw[j].real()));
+        break;
+      default:
+        mass = hypMassCal(est, j, tp, raw[j].real(), raw[tp].real(), tSize, flags[j]);
+        break;
+    }
+    if (!std::isfinite(mass) && flags[j] == MASS_OK) flags[j] = MASS_DOMAIN;
+    effmass[j].real(mass);
   }
 }
 
-DOUBLE
-cshMassCal(int t1, int t2, DOUBLE corr1, DOUBLE corr2, int tSize) {
+// log(cosh(x)) and log|sinh(x)| without overflow
+static inline DOUBLE logCosh(DOUBLE x) {
+  x = fabs(x);
+  return x + log1p(exp(-2.0 * x)) - M_LN2;
+}
+
+static inline DOUBLE logSinh(DOUBLE x) {
+  x = fabs(x);
+  return x + log1p(-exp(-2.0 * x)) - M_LN2;
+}
+
+// Solve C(t1)/C(t2) = h(m (T/2 - t1)) / h(m (T/2 - t2)) for m in [M0, M1],
+// h = cosh (EST_CSH) or sinh (EST_SNH). The equation is taken in logs,
+// f(m) = log(C1/C2) - log(h ratio), which is nearly linear in m; Newton steps
+// start from the exp effective mass and fall back to bisection whenever they
+// leave the bracket or stall
+DOUBLE hypMassCal(Estimator est, int t1, int t2, DOUBLE corr1, DOUBLE corr2, int tSize, uint8_t& flag) {
 #define JMAX 100
 #define M0 0.001
 #define M1 10.0
 #define MACC 1.0e-12
-#define coshtype(m) (corr1 / corr2 - cosh((m) * (tSize / 2.0 - t1)) / cosh((m) * (tSize / 2.0 - t2)))
 
-  DOUBLE dm, f, fmid, mmid, mass;
+  const DOUBLE a = tSize / 2.0 - t1, b = tSize / 2.0 - t2;
+  const bool isSinh = est == EST_SNH;
 
-  f = coshtype(M0);
-  fmid = coshtype(M1);
-  if (f * fmid >= 0.0) {
-    fprintf(stderr, "Root must be bracketed for bisection in RTBIS\n");
+  // sinh changes sign at T/2: the ratio has the sign of a b (and no root for a b = 0)
+  DOUBLE ratio = corr1 / corr2;
+  if (isSinh && a * b < 0.0) ratio = -ratio;
+  const DOUBLE logRatio = log(ratio);
+  if (!std::isfinite(logRatio) || (isSinh && a * b == 0.0)) {
+    flag = MASS_DOMAIN;
     return NAN;
   }
-  mass = f < 0.0 ? (dm = M1 - M0, M0) : (dm = M0 - M1, M1);
-  for (int j = 1; j <= JMAX; j++) {
-    mmid = mass + (dm *= 0.5);
-    fmid = coshtype(mmid);
-    if (fmid <= 0.0) mass = mmid;
-    if (fabs(dm) < MACC || fmid == 0.0) return mass;
+
+  auto f = [&](DOUBLE m) {
+    return logRatio - (isSinh ? logSinh(m * a) - logSinh(m * b) : logCosh(m * a) - logCosh(m * b));
+  };
+  auto df = [&](DOUBLE m) {
+    return isSinh ? fabs(b) / tanh(m * fabs(b)) - fabs(a) / tanh(m * fabs(a)) : b * tanh(m * b) - a * tanh(m * a);
+  };
+
+  DOUBLE fLo = f(M0), fHi = f(M1);
+  if (fLo * fHi >= 0.0) {
+    flag = fLo == 0.0 ? MASS_OK : fHi == 0.0 ? MASS_OK : MASS_BRACKET;
+    return fLo == 0.0 ? M0 : fHi == 0.0 ? M1 : NAN;
   }
-  fprintf(stderr, "Too many bisections in RTBIS");
-  return 0.0;
-}
 
-void cshMass(char* rawDataList[], char* cshList[], int tSize, int fileCountTotal) {
-  for (int i = 0; i < fileCountTotal; i++) {
-    COMPLX raw[tSize], effmass[tSize];
-    for (int j = 0; j < tSize; j++) {
-      raw[j] = 0.0;
-      effmass[j] = 0.0;
+  // Bracket oriented so that f(lo) < 0 < f(hi)
+  DOUBLE lo = fLo < 0.0 ? M0 : M1, hi = fLo < 0.0 ? M1 : M0;
+  DOUBLE mass = logRatio > M0 && logRatio < M1 ? logRatio : 0.5 * (M0 + M1);
+  DOUBLE dmOld = fabs(M1 - M0), dm = dmOld;
+  DOUBLE fm = f(mass), dfm = df(mass);
+  for (int j = 1; j <= JMAX; j++) {
+    if (((mass - hi) * dfm - fm) * ((mass - lo) * dfm - fm) > 0.0 || fabs(2.0 * fm) > fabs(dmOld * dfm)) {
+      // Newton would leave the bracket or converge too slowly: bisect
+      dmOld = dm;
+      dm = 0.5 * (hi - lo);
+      mass = lo + dm;
+    } else {
+      dmOld = dm;
+      dm = fm / dfm;
+      mass -= dm;
     }
-    readBin(rawDataList[i], tSize, raw);
-
-    for (int j = 0; j < tSize; j++) {
-      int t1 = j;
-      int t2 = (j + 1) % tSize;
-      effmass[j].real(cshMassCal(t1, t2, raw[t1].real(), raw[t2].real(), tSize));
+    if (fabs(dm) < MACC) {
+      flag = MASS_OK;
+      return mass;
+    }
+    fm = f(mass);
+    dfm = df(mass);
+    if (fm == 0.0) {
+      flag = MASS_OK;
+      return mass;
+    }
+    if (fm < 0.0) {
+      lo = mass;
+    } else {
+      hi = mass;
     }
-
-    writeBin(cshList[i], tSize, effmass);
   }
+
+  flag = MASS_ITER;
+  return NAN;
 }
@@ -0,0 +1,520 @@
+/**
+ * @file fitmass.cc
+ * @author Tianchen Zhang
+ * @brief Correlated fit of hadron masses to jackknife samples of 2pt
+ *        correlators: A exp(-M t) or A cosh(M (t - T/2))
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <valarray>
+#include <vector>
+
+#include "dataio.h"
+#include "threadpool.h"
+
+void usage(char* name) {
+  fprintf(stderr, "Correlated fit of hadron masses to jackknife samples (replaces fit-mqq.py)\n");
+  fprintf(stderr,
+          "USAGE: \n"
+          "    %s [OPTIONS] ifname1 ifname2 [ifname3 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
+          name);
+  fprintf(stderr,
+          "    Inputs are jackknife samples of a correlator (jre, the real part is fitted).\n"
+          "    The covariance matrix is estimated from the samples and shared by all fits;\n"
+          "    the mass and chi^2/df are averaged over the samples with jackknife errors\n");
+  fprintf(stderr,
+          "OPTIONS: \n"
+          "    -n <TSIZE>:            Temporal size of lattice (default: from file header)\n"
+          "    -f <FTYPE>:            Fit function: exp (A e^{-Mt}) or csh (A cosh(M(t-T/2)))\n"
+          "    -r <TMIN>-<TMAX>:      Fit range [TMIN, TMAX)\n"
+          "    -s <TMIN1>-<TMIN2>,<TMAX1>-<TMAX2>:\n"
+          "                           Scan all ranges with TMIN1 <= TMIN <= TMIN2 and\n"
+          "                           TMAX1 <= TMAX <= TMAX2: one line per range with\n"
+          "                           its AIC weight, then the AIC-weighted average of M\n"
+          "    [-c <CUTOFF>]:         Lattice cutoff a^{-1} (GeV) to print M in MeV\n"
+          "    [-u]:                  Uncorrelated fit (diagonal of the covariance only)\n"
+          "    [-j <THREADS>]:        Number of threads (default: 1)\n"
+          "    [-h, --help]:          Print help\n");
+}
+
+enum FitModel { FIT_EXP, FIT_CSH };
+
+// Whitening of a fit range [tMin, tMax): errors and the Cholesky factor of
+// the correlation matrix (lower triangle, row major)
+struct FitCov {
+  int tMin, tMax;
+  std::vector<DOUBLE> sigma;
+  std::vector<DOUBLE> chol;
+};
+
+// Best-fit parameters of one sample
+struct FitResult {
+  DOUBLE A, M, chisq;
+  bool isConverged;
+};
+
+// Jackknife averages of the fits in one range
+struct FitSummary {
+  int tMin, tMax;
+  DOUBLE M, MErr, chisq, chisqErr;
+  DOUBLE aic, weight;  // AIC = chi^2 + 2 (# of parameters) + 2 (# of points cut), weight ~ exp(-AIC/2)
+  int failCount;
+};
+
+// Custom function declaration
+void readSamples(char* fileList[], int fileCountTotal, int tSize, std::vector<DOUBLE>& samples);
+void covFull(const std::vector<DOUBLE>& samples, int sampleCount, int tSize, std::vector<DOUBLE>& covariance);
+bool covInit(FitCov& cov, const std::vector<DOUBLE>& covariance, int tSize, int tMin, int tMax, bool isUncorrelated);
+FitResult fitSample(FitModel model, const DOUBLE* corr, const FitCov& cov, int tSize, DOUBLE A, DOUBLE M);
+FitSummary fitRange(FitModel model, const std::vector<DOUBLE>& samples, int sampleCount, const FitCov& cov, int tSize,
+                    int threadCount, std::vector<FitResult>& fits);
+void aicWeights(std::vector<FitSummary>& rows);
+
+// Main function
+int main(int argc, char* argv[]) {
+  // Global variables
+  int tSize = 0;
+  FitModel model = FIT_EXP;
+  bool isModelSet = false;
+  int tMin = -1, tMax = -1;
+  int scanMin[2] = {-1, -1}, scanMax[2] = {-1, -1};
+  bool isScan = false;
+  DOUBLE cutoff = 0.0;
+  bool isUncorrelated = false;
+  int threadCount = 1;
+  char programName[128];
+  strncpy(programName, basename(argv[0]), 127);
+  argc--;
+  argv++;
+
+  // Read options (order irrelevant)
+  while (argc > 0 && argv[0][0] == '-') {
+    // -h and --help: show usage
+    if (strcmp(argv[0], "-h") == 0 || strcmp(argv[0], "--help") == 0) {
+      usage(programName);
+      exit(0);
+    }
+
+    // -n: tSize
+    if (strcmp(argv[0], "-n") == 0) {
+      tSize = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (!tSize) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -f: fit function
+    if (strcmp(argv[0], "-f") == 0) {
+      if (argv[1] != NULL && strcmp(argv[1], "exp") == 0) {
+        model = FIT_EXP;
+      } else if (argv[1] != NULL && strcmp(argv[1], "csh") == 0) {
+        model = FIT_CSH;
+      } else {
+        usage(programName);
+        exit(1);
+      }
+      isModelSet = true;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -r: fit range
+    if (strcmp(argv[0], "-r") == 0) {
+      if (argv[1] == NULL || sscanf(argv[1], "%d-%d", &tMin, &tMax) != 2) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -s: scan of fit ranges
+    if (strcmp(argv[0], "-s") == 0) {
+      if (argv[1] == NULL ||
+          sscanf(argv[1], "%d-%d,%d-%d", &scanMin[0], &scanMin[1], &scanMax[0], &scanMax[1]) != 4) {
+        usage(programName);
+        exit(1);
+      }
+      isScan = true;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -c: lattice cutoff
+    if (strcmp(argv[0], "-c") == 0) {
+      cutoff = atof(argv[1]);  // atof(): convert ASCII string to float
+      if (cutoff == 0.0) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -u: uncorrelated fit
+    if (strcmp(argv[0], "-u") == 0) {
+      isUncorrelated = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
+    usage(programName);
+    exit(1);
+  }
+
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
+  const int fileCountTotal = argc;  // # of data files
+  if (fileCountTotal < 2 || !isModelSet || (!isScan && tMin < 0)) {
+    usage(programName);
+    exit(1);
+  }
+
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !tSize) tSize = header.tSize;
+  if (!tSize) {
+    usage(programName);
+    exit(1);
+  }
+
+  // Two parameters and one more point for chi^2/df (as fit-mqq.py)
+  if (!isScan) {
+    scanMin[0] = scanMin[1] = tMin;
+    scanMax[0] = scanMax[1] = tMax;
+  }
+  if (scanMin[0] < 0 || scanMin[0] > scanMin[1] || scanMax[0] > scanMax[1] || scanMax[1] > tSize ||
+      scanMax[1] - scanMin[0] < 4 || (!isScan && tMax - tMin < 4)) {
+    fprintf(stderr, "Please check the range for fit! (0 <= TMIN, TMIN + 4 <= TMAX <= %d)\n", tSize);
+    exit(1);
+  }
+
+  // All samples are read and the covariance matrix of all time slices is
+  // computed once; each range takes its sub-block
+  std::vector<DOUBLE> samples, covariance;
+  readSamples(argv, fileCountTotal, tSize, samples);
+  covFull(samples, fileCountTotal, tSize, covariance);
+
+  // Each range starts from the fits of its neighbour: (TMIN, TMAX - 1), or
+  // (TMIN - 1, TMAX) at the start of a row
+  std::vector<FitSummary> rows;
+  std::vector<FitResult> fits, rowStart(fileCountTotal, FitResult{0.0, 0.0, 0.0, false});
+  for (int iMin = scanMin[0]; iMin <= scanMin[1]; iMin++) {
+    fits = rowStart;
+    bool isRowStarted = false;
+    for (int iMax = scanMax[0]; iMax <= scanMax[1]; iMax++) {
+      if (iMax - iMin < 4) continue;
+
+      FitCov cov;
+      if (!covInit(cov, covariance, tSize, iMin, iMax, isUncorrelated)) {
+        fprintf(stderr, "[%d, %d): Covariance matrix is singular (try -u or a shorter range)\n", iMin, iMax);
+        if (!isScan) exit(1);
+        continue;
+      }
+
+      FitSummary sum = fitRange(model, samples, fileCountTotal, cov, tSize, threadCount, fits);
+      if (sum.failCount) fprintf(stderr, "[%d, %d): %d of %d fits did not converge\n", iMin, iMax, sum.failCount,
+                                 fileCountTotal);
+      rows.push_back(sum);
+
+      if (!isRowStarted) {
+        rowStart = fits;
+        isRowStarted = true;
+      }
+    }
+  }
+
+  if (!isScan) {
+    const FitSummary& sum = rows[0];
+    printf("##  Fit range: [%d, %d]\n", sum.tMin, sum.tMax);
+    printf("##  M(LU)  = %.16g ± %.16g\n", sum.M, sum.MErr);
+    if (cutoff != 0.0) printf("##  M      = %.16g ± %.16g\n", sum.M * cutoff * 1000, sum.MErr * cutoff * 1000);
+    printf("##  χ^2/df = %.16g ± %.16g\n", sum.chisq, sum.chisqErr);
+    return 0;
+  }
+
+  aicWeights(rows);
+
+  printf("#%5s %6s %24s %24s %24s %24s %24s %24s %6s\n", "TMIN", "TMAX", "M", "M_err", "chi2/df", "chi2/df_err",
+         "AIC", "weight", "fail");
+  for (const FitSummary& sum : rows) {
+    printf("%6d %6d %24.16e %24.16e %24.16e %24.16e %24.16e %24.16e %6d\n", sum.tMin, sum.tMax, sum.M, sum.MErr,
+           sum.chisq, sum.chisqErr, sum.aic, sum.weight, sum.failCount);
+  }
+
+  // Model average: statistical error and spread over the ranges, added in quadrature
+  DOUBLE mean = 0.0, stat = 0.0, syst = 0.0;
+  for (const FitSummary& sum : rows) mean += sum.weight * sum.M;
+  for (const FitSummary& sum : rows) {
+    stat += sum.weight * sum.MErr * sum.MErr;
+    syst += sum.weight * (sum.M - mean) * (sum.M - mean);
+  }
+  const DOUBLE err = sqrt(stat + syst);
+  printf("##  AIC average of %d ranges\n", int(rows.size()));
+  printf("##  M(LU)  = %.16g ± %.16g (stat %.16g, syst %.16g)\n", mean, err, sqrt(stat), sqrt(syst));
+  if (cutoff != 0.0) printf("##  M      = %.16g ± %.16g\n", mean * cutoff * 1000, err * cutoff * 1000);
+
+  return 0;
+}
+
+// Custom function definition
+
+// Real parts of all samples, one row of tSize per file
+void readSamples(char* fileList[], int fileCountTotal, int tSize, std::vector<DOUBLE>& samples) {
+  samples.assign(size_t(fileCountTotal) * tSize, 0.0);
+  for (int i = 0; i < fileCountTotal; i++) {
+    const COMPLX* data;
+    BinMap inMap;
+    mapBin(fileList[i], tSize, data, inMap);
+    for (int t = 0; t < tSize; t++) samples[size_t(i) * tSize + t] = data[t].real();
+    unmapBin(inMap);
+  }
+}
+
+// Jackknife covariance of all time slices (tSize x tSize, row major)
+void covFull(const std::vector<DOUBLE>& samples, int sampleCount, int tSize, std::vector<DOUBLE>& covariance) {
+  std::vector<DOUBLE> mean(tSize, 0.0);
+  covariance.assign(size_t(tSize) * tSize, 0.0);
+  for (int s = 0; s < sampleCount; s++) {
+    for (int i = 0; i < tSize; i++) mean[i] += samples[size_t(s) * tSize + i] / sampleCount;
+  }
+  for (int s = 0; s < sampleCount; s++) {
+    const DOUBLE* y = &samples[size_t(s) * tSize];
+    for (int i = 0; i < tSize; i++) {
+      for (int j = 0; j <= i; j++) covariance[i * tSize + j] += (y[i] - mean[i]) * (y[j] - mean[j]);
+    }
+  }
+  for (int i = 0; i < tSize; i++) {
+    for (int j = 0; j <= i; j++) {
+      covariance[i * tSize + j] *= (sampleCount - 1.0) / sampleCount;
+      covariance[j * tSize + i] = covariance[i * tSize + j];
+    }
+  }
+}
+
+// Errors of [tMin, tMax) and the Cholesky factor of the correlation matrix
+// (a sub-block of the full covariance); false if that is not positive definite
+bool covInit(FitCov& cov, const std::vector<DOUBLE>& covariance, int tSize, int tMin, int tMax, bool isUncorrelated) {
+  const int n = tMax - tMin;
+  cov.tMin = tMin;
+  cov.tMax = tMax;
+  const DOUBLE* c = &covariance[tMin * tSize + tMin];
+
+  cov.sigma.resize(n);
+  for (int i = 0; i < n; i++) {
+    if (!(c[i * tSize + i] > 0.0)) return false;
+    cov.sigma[i] = sqrt(c[i * tSize + i]);
+  }
+
+  // Correlation matrix (identity for an uncorrelated fit), factorized in place
+  cov.chol.assign(n * n, 0.0);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j <= i; j++) {
+      cov.chol[i * n + j] = i == j ? 1.0 : isUncorrelated ? 0.0 : c[i * tSize + j] / (cov.sigma[i] * cov.sigma[j]);
+    }
+  }
+  for (int j = 0; j < n; j++) {
+    DOUBLE d = cov.chol[j * n + j];
+    for (int k = 0; k < j; k++) d -= cov.chol[j * n + k] * cov.chol[j * n + k];
+    if (!(d > 1e-14)) return false;
+    d = sqrt(d);
+    cov.chol[j * n + j] = d;
+    for (int i = j + 1; i < n; i++) {
+      DOUBLE v = cov.chol[i * n + j];
+      for (int k = 0; k < j; k++) v -= cov.chol[i * n + k] * cov.chol[j * n + k];
+      cov.chol[i * n + j] = v / d;
+    }
+  }
+
+  return true;
+}
+
+// v <- L^{-1} (v / sigma)
+static void whiten(const FitCov& cov, DOUBLE* v) {
+  const int n = cov.tMax - cov.tMin;
+  for (int i = 0; i < n; i++) {
+    DOUBLE x = v[i] / cov.sigma[i];
+    for (int k = 0; k < i; k++) x -= cov.chol[i * n + k] * v[k];
+    v[i] = x / cov.chol[i * n + i];
+  }
+}
+
+// Whitened residuals (corr - model) and, if requested, the whitened Jacobian
+// of the model (d/dA, d/dM); returns chi^2
+static DOUBLE residual(FitModel model, const DOUBLE* corr, const FitCov& cov, int tSize, DOUBLE A, DOUBLE M,
+                       DOUBLE* res, DOUBLE* jacA, DOUBLE* jacM) {
+  const int n = cov.tMax - cov.tMin;
+  for (int i = 0; i < n; i++) {
+    const int t = cov.tMin + i;
+    DOUBLE f, dfdM;
+    if (model == FIT_EXP) {
+      f = exp(-M * t);
+      dfdM = -t * A * f;
+    } else {
+      const DOUBLE x = t - tSize / 2.0;
+      f = cosh(M * x);
+      dfdM = x * A * sinh(M * x);
+    }
+    res[i] = corr[t] - A * f;
+    if (jacA != NULL) {
+      jacA[i] = f;
+      jacM[i] = dfdM;
+    }
+  }
+
+  whiten(cov, res);
+  if (jacA != NULL) {
+    whiten(cov, jacA);
+    whiten(cov, jacM);
+  }
+
+  DOUBLE chisq = 0.0;
+  for (int i = 0; i < n; i++) chisq += res[i] * res[i];
+  return chisq;
+}
+
+// Levenberg-Marquardt with the analytic Jacobian, started from (A, M)
+FitResult fitSample(FitModel model, const DOUBLE* corr, const FitCov& cov, int tSize, DOUBLE A, DOUBLE M) {
+#define LM_ITER 200
+#define LM_TOL 1.0e-12
+
+  const int n = cov.tMax - cov.tMin;
+  DOUBLE res[n], jacA[n], jacM[n], trial[n];
+  DOUBLE lambda = 1.0e-3;
+  FitResult fit = {A, M, 0.0, false};
+
+  fit.chisq = residual(model, corr, cov, tSize, A, M, res, jacA, jacM);
+  for (int iter = 0; iter < LM_ITER; iter++) {
+    // Normal equations J^T J delta = J^T res
+    DOUBLE haa = 0.0, ham = 0.0, hmm = 0.0, ga = 0.0, gm = 0.0;
+    for (int i = 0; i < n; i++) {
+      haa += jacA[i] * jacA[i];
+      ham += jacA[i] * jacM[i];
+      hmm += jacM[i] * jacM[i];
+      ga += jacA[i] * res[i];
+      gm += jacM[i] * res[i];
+    }
+
+    // Marquardt damping: raise lambda until chi^2 decreases
+    bool isAccepted = false;
+    while (lambda < 1.0e16) {
+      const DOUBLE daa = haa * (1.0 + lambda), dmm = hmm * (1.0 + lambda);
+      const DOUBLE det = daa * dmm - ham * ham;
+      const DOUBLE dA = (dmm * ga - ham * gm) / det, dM = (daa * gm - ham * ga) / det;
+      const DOUBLE chisq = residual(model, corr, cov, tSize, fit.A + dA, fit.M + dM, trial, NULL, NULL);
+      if (chisq <= fit.chisq) {
+        const bool isSmall = fit.chisq - chisq <= LM_TOL * fit.chisq || (fabs(dA) <= LM_TOL * fabs(fit.A) &&
+                                                                         fabs(dM) <= LM_TOL * fabs(fit.M));
+        fit.A += dA;
+        fit.M += dM;
+        fit.chisq = residual(model, corr, cov, tSize, fit.A, fit.M, res, jacA, jacM);
+        lambda = lambda * 0.1 > 1.0e-12 ? lambda * 0.1 : 1.0e-12;
+        isAccepted = true;
+        if (isSmall) fit.isConverged = true;
+        break;
+      }
+      lambda *= 10.0;
+    }
+
+    // No step lowers chi^2 any more: at the minimum within rounding
+    if (!isAccepted) fit.isConverged = true;
+    if (fit.isConverged) break;
+  }
+
+  fit.isConverged = fit.isConverged && std::isfinite(fit.chisq);
+  return fit;
+}
+
+// Starting values from the effective mass at the start of the range
+static void initialGuess(FitModel model, const DOUBLE* corr, int tSize, int tMin, DOUBLE& A, DOUBLE& M) {
+  M = log(corr[tMin] / corr[tMin + 1]);
+  if (!std::isfinite(M) || M <= 0.0) M = 1.0;
+  A = corr[tMin] / (model == FIT_EXP ? exp(-M * tMin) : cosh(M * (tMin - tSize / 2.0)));
+}
+
+// Fit every sample in [cov.tMin, cov.tMax) and average (jackknife); fits
+// holds the starting values (converged fits of a neighbouring range) and
+// receives the new fits
+FitSummary fitRange(FitModel model, const std::vector<DOUBLE>& samples, int sampleCount, const FitCov& cov, int tSize,
+                    int threadCount, std::vector<FitResult>& fits) {
+  parallelFor(sampleCount, threadCount, [&](int s) {
+    const DOUBLE* corr = &samples[size_t(s) * tSize];
+    DOUBLE A = fits[s].A, M = fits[s].M;
+    if (!fits[s].isConverged) initialGuess(model, corr, tSize, cov.tMin, A, M);
+    fits[s] = fitSample(model, corr, cov, tSize, A, M);
+  });
+
+  // degree of freedom: (# of data) - (# of parameters) - 1
+  const int df = cov.tMax - cov.tMin - 2 - 1;
+
+  FitSummary sum = {cov.tMin, cov.tMax, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0};
+  for (const FitResult& fit : fits) {
+    sum.M += fit.M / sampleCount;
+    sum.chisq += fit.chisq / df / sampleCount;
+    if (!fit.isConverged) sum.failCount++;
+  }
+  for (const FitResult& fit : fits) {
+    sum.MErr += (fit.M - sum.M) * (fit.M - sum.M);
+    sum.chisqErr += (fit.chisq / df - sum.chisq) * (fit.chisq / df - sum.chisq);
+  }
+  sum.MErr = sqrt(sum.MErr * (sampleCount - 1.0) / sampleCount);
+  sum.chisqErr = sqrt(sum.chisqErr * (sampleCount - 1.0) / sampleCount);
+
+  return sum;
+}
+
+// AIC of every range from its mean chi^2, counting the points cut relative to
+// the longest range, and the normalized weights exp(-AIC/2)
+void aicWeights(std::vector<FitSummary>& rows) {
+  int nMax = 0;
+  for (const FitSummary& sum : rows) nMax = std::max(nMax, sum.tMax - sum.tMin);
+
+  DOUBLE aicMin = INFINITY;
+  for (FitSummary& sum : rows) {
+    const int n = sum.tMax - sum.tMin;
+    sum.aic = sum.chisq * (n - 2 - 1) + 2.0 * 2 + 2.0 * (nMax - n);
+    if (sum.failCount || !std::isfinite(sum.aic)) sum.aic = INFINITY;
+    aicMin = std::min(aicMin, sum.aic);
+  }
+
+  DOUBLE norm = 0.0;
+  for (FitSummary& sum : rows) {
+    sum.weight = std::isfinite(sum.aic) ? exp(-0.5 * (sum.aic - aicMin)) : 0.0;
+    norm += sum.weight;
+  }
+  for (FitSummary& sum : rows) sum.weight = norm > 0.0 ? sum.weight / norm : 0.0;
+}
@@ -14,21 +14,29 @@
 
 #include <complex>
 #include <valarray>
-#include <vector>
 
 #include "dataio.h"
+#include "fused.h"
 #include "misc.h"
+#include "tdbatch.h"
 
 void usage(char* name) {
   fprintf(stderr, "F_{KS} (time-dependent version)\n");
   fprintf(stderr,
           "USAGE: \n"
-          "    %s [OPTIONS] CV(t-1) CV(t+1) CPS(t-1) CPS(t+1) ppotV ppotPS\n",
-          name);
+          "    %s [OPTIONS] CV(t-1) CV(t+1) CPS(t-1) CPS(t+1) ppotV ppotPS\n"
+          "    %s [OPTIONS] -t <T1>-<T2> -d <OFDIR> CORRDIR PREVDIR\n"
+          "    (batch: all <CONF> of CORRDIR/<ch>.<t>.<CONF> and PREVDIR/<ch>.<t>.<CONF>,\n"
+          "    as written by jre and prev, to OFDIR/<t>.<CONF>; directories may be *.ens)\n",
+          name, name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -n <XYZSIZE>:   Spacial size of lattice\n"
+          "    -n <XYZSIZE>:   Spacial size of lattice (default: from file header)\n"
           "    -o <OFNAME>:    ofname of F_KS\n"
+          "    -t <T1>-<T2>:   Time slices (batch mode, T1 >= 1)\n"
+          "    -d <OFDIR>:     Directory (or ensemble container *.ens) of output files (batch mode)\n"
+          "    [-j <THREADS>]: Number of threads (batch mode, default: 1)\n"
+          "    [-H]:           Write self-describing header to output files\n"
           "    [-h, --help]:   Print help\n");
 }
 
@@ -37,6 +45,10 @@ int main(int argc, char* argv[]) {
   // Global variables
   int xyzSize = 0;
   static const char* ofname = NULL;
+  static const char* ofDir = NULL;
+  int tMin = 0, tMax = -1;
+  int threadCount = 1;
+  bool isHeader = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -74,34 +86,98 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -t: time slices (batch mode)
+    if (strcmp(argv[0], "-t") == 0) {
+      if (argv[1] == NULL || sscanf(argv[1], "%d-%d", &tMin, &tMax) != 2 || tMin < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -d: directory for output file (batch mode)
+    if (strcmp(argv[0], "-d") == 0) {
+      ofDir = argv[1];
+      if (ofDir == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
   }
 
   // Make sure of all needed syntax
-  if (argc != 6) {
+  const bool isBatch = tMax >= tMin;
+  if (isBatch ? argc != 2 || ofDir == NULL : argc != 6 || ofname == NULL) {
     usage(programName);
     exit(1);
   }
 
-  int arrayLength = int(pow(xyzSize, 3));
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  bool isFound = isBatch ? tdBatchProbe(argv[1], tMin, header) : probeBin(argv[0], header);
+  if (isFound && !xyzSize) xyzSize = header.xyzSize;
+  if (!xyzSize) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, xyzSize, 0);
 
-  CVARRAY ddt(arrayLength), fks(arrayLength);
-  ddt = fks = 0.0;
+  int arrayLength = int(pow(xyzSize, 3));
 
-  std::vector<CVARRAY> data;
-  for (int i = 0; i < 6; i++) {
-    CVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(argv[i], arrayLength, tmp);
-    data.push_back(tmp);
+  if (isBatch) {
+    tdBatch(argv[0], argv[1], tMin, tMax, arrayLength, threadCount, [&](const char* name, const COMPLX* const data[6]) {
+      char fksName[2048];
+      COMPLX* fks;
+      BinMap outMap;
+      changePath(name, ofDir, fksName);
+
+      mapBinOut(fksName, arrayLength, fks, outMap);
+      fusedFksTd(data, fks, arrayLength);
+      unmapBin(outMap);
+    });
+    return 0;
   }
 
-  ddt = (log(data[1] / data[3]) - log(data[0] / data[2])) / 2.0;
-  fks = (data[4] - data[5]) / ddt;
+  // Inputs and output are mapped, the fused kernel makes one pass over them
+  const COMPLX* data[6];
+  BinMap inMap[6], outMap;
+  for (int i = 0; i < 6; i++) mapBin(argv[i], arrayLength, data[i], inMap[i]);
+
+  COMPLX* fks;
+  mapBinOut(ofname, arrayLength, fks, outMap);
+  fusedFksTd(data, fks, arrayLength);
 
-  writeBin(ofname, arrayLength, fks);
+  for (int i = 0; i < 6; i++) unmapBin(inMap[i]);
+  unmapBin(outMap);
 
   return 0;
 }
@@ -26,9 +26,10 @@ void usage(char* name) {
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -n <XYZSIZE>:   Spacial size of lattice\n"
+          "    -n <XYZSIZE>:   Spacial size of lattice (default: from file header)\n"
           "    -m <MDIFF>:     (M_V - M_PS) (LUnit)\n"
           "    -o <OFNAME>:    ofname of F_KS\n"
+          "    [-H]:           Write self-describing header to output files\n"
           "    [-h, --help]:   Print help\n");
 }
 
@@ -38,6 +39,7 @@ int main(int argc, char* argv[]) {
   int xyzSize = 0;
   DOUBLE mdiff = 0.0;
   static const char* ofname = NULL;
+  bool isHeader = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -87,6 +89,14 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
@@ -98,6 +108,15 @@ int main(int argc, char* argv[]) {
     exit(1);
   }
 
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !xyzSize) xyzSize = header.xyzSize;
+  if (!xyzSize) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, xyzSize, 0);
+
   int arrayLength = int(pow(xyzSize, 3));
 
   CVARRAY ppotv(arrayLength), ppotps(arrayLength), fks(arrayLength);
@@ -0,0 +1,478 @@
+/**
+ * @file fused.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "fused.h"
+
+#include <float.h>
+#include <immintrin.h>
+
+#include <cmath>
+#include <complex>
+
+#include "alias.h"
+#include "stencil.h"
+
+// Both formulae only need, per element (d_k = data[k]):
+//   log(d1 / d3) - log(d0 / d2)
+//     = log(|d1|^2 / |d3|^2 * |d2|^2 / |d0|^2) / 2 + i [arg(d1 conj d3) - arg(d0 conj d2)]
+//   log(d1) - log(d0) = log(|d1|^2 / |d0|^2) / 2 + i [arg d1 - arg d0] (and d3, d2 alike)
+// The arguments are principal values as in std::log, so the results agree
+// with the complex formulae up to rounding.
+
+// Cephes log: log(1+f) = f - f^2/2 + f^3 P(f)/Q(f) for sqrt(1/2) <= 1+f < sqrt(2)
+static const DOUBLE LOG_P[6] = {1.01875663804580931796E-4, 4.97494994976747001425E-1, 4.70579119878881725854E0,
+                                1.44989225341610930846E1,  1.79368678507819816313E1,  7.70838733755885391666E0};
+static const DOUBLE LOG_Q[5] = {1.12873587189167450590E1, 4.52279145837532221105E1, 8.29875266912776603211E1,
+                                7.11544750618563894466E1, 2.31251620126765340583E1};
+static const DOUBLE LN2_HI = 0.693359375;
+static const DOUBLE LN2_LO = -2.121944400546905827679E-4;
+static const DOUBLE SQRTH = 0.70710678118654752440;
+
+// Cephes atan: atan(t) = t + t^3 P(t^2)/Q(t^2) for |t| <= 0.66, larger |t|
+// are reduced with pi/4 and pi/2
+static const DOUBLE ATAN_P[5] = {-8.750608600031904122785E-1, -1.615753718733365076637E1,
+                                 -7.500855792314704667340E1,  -1.228866684490136173410E2,
+                                 -6.485021904942025371773E1};
+static const DOUBLE ATAN_Q[5] = {2.485846490142306297962E1, 1.650270098316988542046E2, 4.328810604912902668951E2,
+                                 4.853903996359136964868E2, 1.945506571482613964425E2};
+static const DOUBLE T3P8 = 2.41421356237309504880;  // tan(3 pi/8)
+static const DOUBLE MOREBITS = 6.123233995736765886130E-17;
+
+/* ----------------------------------- scalar ----------------------------------- */
+
+// One element of the inputs as real and imaginary parts
+struct Element {
+  DOUBLE re[6], im[6];
+};
+
+static inline void loadScalar(const COMPLX* const data[6], int i, Element& e) {
+  for (int k = 0; k < 6; k++) {
+    e.re[k] = data[k][i].real();
+    e.im[k] = data[k][i].imag();
+  }
+}
+
+static inline DOUBLE norm2(const Element& e, int k) { return e.re[k] * e.re[k] + e.im[k] * e.im[k]; }
+
+// arg(d_a conj d_b)
+static inline DOUBLE argRatio(const Element& e, int a, int b) {
+  return atan2(e.im[a] * e.re[b] - e.re[a] * e.im[b], e.re[a] * e.re[b] + e.im[a] * e.im[b]);
+}
+
+static inline void fksScalar(const COMPLX* const data[6], COMPLX* fks, int i) {
+  Element e;
+  loadScalar(data, i, e);
+
+  // ddt = [log(d1/d3) - log(d0/d2)] / 2
+  const DOUBLE ddtRe = 0.25 * log(norm2(e, 1) / norm2(e, 3) * (norm2(e, 2) / norm2(e, 0)));
+  const DOUBLE ddtIm = 0.5 * (argRatio(e, 1, 3) - argRatio(e, 0, 2));
+
+  // (d4 - d5) / ddt = (d4 - d5) conj(ddt) / |ddt|^2
+  const DOUBLE nRe = e.re[4] - e.re[5], nIm = e.im[4] - e.im[5];
+  const DOUBLE den = ddtRe * ddtRe + ddtIm * ddtIm;
+  fks[i] = COMPLX((nRe * ddtRe + nIm * ddtIm) / den, (nIm * ddtRe - nRe * ddtIm) / den);
+}
+
+static inline void vScalar(const COMPLX* const data[6], DOUBLE mc, COMPLX* v0, COMPLX* vs, int i) {
+  Element e;
+  loadScalar(data, i, e);
+
+  // a = log(d1) - log(d0), b = log(d3) - log(d2), c = log(d1/d3) - log(d0/d2)
+  const DOUBLE aRe = 0.5 * log(norm2(e, 1) / norm2(e, 0));
+  const DOUBLE bRe = 0.5 * log(norm2(e, 3) / norm2(e, 2));
+  const DOUBLE aIm = atan2(e.im[1], e.re[1]) - atan2(e.im[0], e.re[0]);
+  const DOUBLE bIm = atan2(e.im[3], e.re[3]) - atan2(e.im[2], e.re[2]);
+  const DOUBLE cRe = aRe - bRe;
+  const DOUBLE cIm = argRatio(e, 1, 3) - argRatio(e, 0, 2);
+
+  v0[i] = COMPLX((3.0 * e.re[4] + e.re[5]) / (4.0 * mc) - 0.25 * (1.5 * aRe + 0.5 * bRe) - 2.0 * mc,
+                 (3.0 * e.im[4] + e.im[5]) / (4.0 * mc) - 0.25 * (1.5 * aIm + 0.5 * bIm));
+  vs[i] = COMPLX((e.re[4] - e.re[5]) / mc - 0.5 * cRe, (e.im[4] - e.im[5]) / mc - 0.5 * cIm);
+}
+
+static void fksScalarLoop(const COMPLX* const data[6], COMPLX* fks, int from, int to) {
+  for (int i = from; i < to; i++) fksScalar(data, fks, i);
+}
+
+static void vScalarLoop(const COMPLX* const data[6], DOUBLE mc, COMPLX* v0, COMPLX* vs, int from, int to) {
+  for (int i = from; i < to; i++) vScalar(data, mc, v0, vs, i);
+}
+
+/* ------------------------------------ AVX2 ------------------------------------ */
+
+// 4 complex numbers as (re, im) vectors; the lane order (0, 2, 1, 3) is undone by storeAvx2
+__attribute__((target("avx2,fma"))) static inline void loadAvx2(const COMPLX* p, __m256d& re, __m256d& im) {
+  __m256d a = _mm256_loadu_pd((const DOUBLE*)p);
+  __m256d b = _mm256_loadu_pd((const DOUBLE*)(p + 2));
+  re = _mm256_unpacklo_pd(a, b);
+  im = _mm256_unpackhi_pd(a, b);
+}
+
+__attribute__((target("avx2,fma"))) static inline void storeAvx2(COMPLX* p, __m256d re, __m256d im) {
+  _mm256_storeu_pd((DOUBLE*)p, _mm256_unpacklo_pd(re, im));
+  _mm256_storeu_pd((DOUBLE*)(p + 2), _mm256_unpackhi_pd(re, im));
+}
+
+// Horner schemes; p1 has an implied leading coefficient 1
+template <int N>
+__attribute__((target("avx2,fma"))) static inline __m256d polyAvx2(__m256d x, const DOUBLE (&c)[N]) {
+  __m256d r = _mm256_set1_pd(c[0]);
+  for (int k = 1; k < N; k++) r = _mm256_fmadd_pd(r, x, _mm256_set1_pd(c[k]));
+  return r;
+}
+
+template <int N>
+__attribute__((target("avx2,fma"))) static inline __m256d poly1Avx2(__m256d x, const DOUBLE (&c)[N]) {
+  __m256d r = _mm256_add_pd(x, _mm256_set1_pd(c[0]));
+  for (int k = 1; k < N; k++) r = _mm256_fmadd_pd(r, x, _mm256_set1_pd(c[k]));
+  return r;
+}
+
+// log(x) for normal, finite x > 0 (others are flagged by badLogAvx2)
+__attribute__((target("avx2,fma"))) static inline __m256d logAvx2(__m256d x) {
+  const __m256i bits = _mm256_castpd_si256(x);
+
+  // x = m 2^e with 1/2 <= m < 1; the biased exponent becomes a double via 2^52
+  const __m256i magic = _mm256_set1_epi64x(0x4330000000000000LL);
+  __m256d e = _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), magic));
+  e = _mm256_sub_pd(e, _mm256_set1_pd(4503599627370496.0 + 1022.0));
+  __m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+                                                  _mm256_set1_epi64x(0x3FE0000000000000LL)));
+
+  // f = m - 1, or 2m - 1 with e - 1 below sqrt(1/2)
+  const __m256d one = _mm256_set1_pd(1.0);
+  __m256d small = _mm256_cmp_pd(m, _mm256_set1_pd(SQRTH), _CMP_LT_OQ);
+  e = _mm256_sub_pd(e, _mm256_and_pd(small, one));
+  __m256d f = _mm256_add_pd(_mm256_sub_pd(m, one), _mm256_and_pd(small, m));
+
+  __m256d z = _mm256_mul_pd(f, f);
+  __m256d y = _mm256_mul_pd(f, _mm256_div_pd(_mm256_mul_pd(z, polyAvx2(f, LOG_P)), poly1Avx2(f, LOG_Q)));
+  y = _mm256_fmadd_pd(e, _mm256_set1_pd(LN2_LO), y);
+  y = _mm256_fnmadd_pd(_mm256_set1_pd(0.5), z, y);
+  return _mm256_fmadd_pd(e, _mm256_set1_pd(LN2_HI), _mm256_add_pd(f, y));
+}
+
+// atan2(y, x) for finite y and finite nonzero x (others are flagged by badAtan2Avx2)
+__attribute__((target("avx2,fma"))) static inline __m256d atan2Avx2(__m256d y, __m256d x) {
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  const __m256d one = _mm256_set1_pd(1.0);
+  const __m256d zero = _mm256_setzero_pd();
+
+  __m256d t = _mm256_div_pd(y, x);
+  __m256d a = _mm256_andnot_pd(sign, t);
+
+  // Reduction: |t| > tan(3 pi/8): pi/2 + atan(-1/|t|); |t| > 0.66: pi/4 + atan((|t|-1)/(|t|+1))
+  __m256d big = _mm256_cmp_pd(a, _mm256_set1_pd(T3P8), _CMP_GT_OQ);
+  __m256d mid = _mm256_cmp_pd(a, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+  __m256d r = _mm256_blendv_pd(a, _mm256_div_pd(_mm256_sub_pd(a, one), _mm256_add_pd(a, one)), mid);
+  r = _mm256_blendv_pd(r, _mm256_div_pd(_mm256_set1_pd(-1.0), a), big);
+  __m256d y0 = _mm256_blendv_pd(_mm256_blendv_pd(zero, _mm256_set1_pd(M_PI_4), mid), _mm256_set1_pd(M_PI_2), big);
+  __m256d more = _mm256_blendv_pd(_mm256_blendv_pd(zero, _mm256_set1_pd(0.5 * MOREBITS), mid),
+                                  _mm256_set1_pd(MOREBITS), big);
+
+  __m256d z = _mm256_mul_pd(r, r);
+  z = _mm256_div_pd(_mm256_mul_pd(z, polyAvx2(z, ATAN_P)), poly1Avx2(z, ATAN_Q));
+  z = _mm256_add_pd(_mm256_fmadd_pd(r, z, r), more);
+  __m256d res = _mm256_xor_pd(_mm256_add_pd(y0, z), _mm256_and_pd(t, sign));
+
+  // x < 0: +-pi by the sign bit of y
+  __m256d w = _mm256_blendv_pd(_mm256_set1_pd(M_PI), _mm256_set1_pd(-M_PI), y);
+  return _mm256_add_pd(res, _mm256_and_pd(w, _mm256_cmp_pd(x, zero, _CMP_LT_OQ)));
+}
+
+__attribute__((target("avx2,fma"))) static inline __m256d badLogAvx2(__m256d x) {
+  return _mm256_or_pd(_mm256_cmp_pd(x, _mm256_set1_pd(DBL_MIN), _CMP_NGE_UQ),
+                      _mm256_cmp_pd(x, _mm256_set1_pd(DBL_MAX), _CMP_GT_OQ));
+}
+
+__attribute__((target("avx2,fma"))) static inline __m256d badAtan2Avx2(__m256d y, __m256d x) {
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  const __m256d max = _mm256_set1_pd(DBL_MAX);
+  __m256d bad = _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ);
+  bad = _mm256_or_pd(bad, _mm256_cmp_pd(_mm256_andnot_pd(sign, x), max, _CMP_NLE_UQ));
+  return _mm256_or_pd(bad, _mm256_cmp_pd(_mm256_andnot_pd(sign, y), max, _CMP_NLE_UQ));
+}
+
+__attribute__((target("avx2,fma"))) static void fksAvx2(const COMPLX* const data[6], COMPLX* fks, int arrayLength) {
+  int i = 0;
+  for (; i + 4 <= arrayLength; i += 4) {
+    __m256d re[6], im[6], n[4];
+    for (int k = 0; k < 6; k++) loadAvx2(data[k] + i, re[k], im[k]);
+    for (int k = 0; k < 4; k++) n[k] = _mm256_fmadd_pd(re[k], re[k], _mm256_mul_pd(im[k], im[k]));
+
+    // d1 conj d3 and d0 conj d2
+    __m256d pRe = _mm256_fmadd_pd(re[1], re[3], _mm256_mul_pd(im[1], im[3]));
+    __m256d pIm = _mm256_fmsub_pd(im[1], re[3], _mm256_mul_pd(re[1], im[3]));
+    __m256d qRe = _mm256_fmadd_pd(re[0], re[2], _mm256_mul_pd(im[0], im[2]));
+    __m256d qIm = _mm256_fmsub_pd(im[0], re[2], _mm256_mul_pd(re[0], im[2]));
+    __m256d ratio = _mm256_mul_pd(_mm256_div_pd(n[1], n[3]), _mm256_div_pd(n[2], n[0]));
+
+    __m256d bad = _mm256_or_pd(badLogAvx2(ratio), _mm256_or_pd(badAtan2Avx2(pIm, pRe), badAtan2Avx2(qIm, qRe)));
+    if (_mm256_movemask_pd(bad)) {
+      fksScalarLoop(data, fks, i, i + 4);
+      continue;
+    }
+
+    __m256d ddtRe = _mm256_mul_pd(_mm256_set1_pd(0.25), logAvx2(ratio));
+    __m256d ddtIm = _mm256_mul_pd(_mm256_set1_pd(0.5), _mm256_sub_pd(atan2Avx2(pIm, pRe), atan2Avx2(qIm, qRe)));
+
+    __m256d nRe = _mm256_sub_pd(re[4], re[5]), nIm = _mm256_sub_pd(im[4], im[5]);
+    __m256d den = _mm256_fmadd_pd(ddtRe, ddtRe, _mm256_mul_pd(ddtIm, ddtIm));
+    __m256d outRe = _mm256_div_pd(_mm256_fmadd_pd(nRe, ddtRe, _mm256_mul_pd(nIm, ddtIm)), den);
+    __m256d outIm = _mm256_div_pd(_mm256_fmsub_pd(nIm, ddtRe, _mm256_mul_pd(nRe, ddtIm)), den);
+    storeAvx2(fks + i, outRe, outIm);
+  }
+  fksScalarLoop(data, fks, i, arrayLength);
+}
+
+__attribute__((target("avx2,fma"))) static void vAvx2(const COMPLX* const data[6], DOUBLE mc, COMPLX* v0, COMPLX* vs,
+                                                      int arrayLength) {
+  const __m256d quarter = _mm256_set1_pd(0.25), half = _mm256_set1_pd(0.5);
+  const __m256d mc4Inv = _mm256_set1_pd(1.0 / (4.0 * mc)), mcInv = _mm256_set1_pd(1.0 / mc);
+  const __m256d three = _mm256_set1_pd(3.0), mc2 = _mm256_set1_pd(2.0 * mc);
+  int i = 0;
+  for (; i + 4 <= arrayLength; i += 4) {
+    __m256d re[6], im[6], n[4];
+    for (int k = 0; k < 6; k++) loadAvx2(data[k] + i, re[k], im[k]);
+    for (int k = 0; k < 4; k++) n[k] = _mm256_fmadd_pd(re[k], re[k], _mm256_mul_pd(im[k], im[k]));
+
+    __m256d pRe = _mm256_fmadd_pd(re[1], re[3], _mm256_mul_pd(im[1], im[3]));
+    __m256d pIm = _mm256_fmsub_pd(im[1], re[3], _mm256_mul_pd(re[1], im[3]));
+    __m256d qRe = _mm256_fmadd_pd(re[0], re[2], _mm256_mul_pd(im[0], im[2]));
+    __m256d qIm = _mm256_fmsub_pd(im[0], re[2], _mm256_mul_pd(re[0], im[2]));
+    __m256d ratio10 = _mm256_div_pd(n[1], n[0]), ratio32 = _mm256_div_pd(n[3], n[2]);
+
+    __m256d bad = _mm256_or_pd(badLogAvx2(ratio10), badLogAvx2(ratio32));
+    bad = _mm256_or_pd(bad, _mm256_or_pd(badAtan2Avx2(pIm, pRe), badAtan2Avx2(qIm, qRe)));
+    for (int k = 0; k < 4; k++) bad = _mm256_or_pd(bad, badAtan2Avx2(im[k], re[k]));
+    if (_mm256_movemask_pd(bad)) {
+      vScalarLoop(data, mc, v0, vs, i, i + 4);
+      continue;
+    }
+
+    __m256d aRe = _mm256_mul_pd(half, logAvx2(ratio10));
+    __m256d bRe = _mm256_mul_pd(half, logAvx2(ratio32));
+    __m256d aIm = _mm256_sub_pd(atan2Avx2(im[1], re[1]), atan2Avx2(im[0], re[0]));
+    __m256d bIm = _mm256_sub_pd(atan2Avx2(im[3], re[3]), atan2Avx2(im[2], re[2]));
+    __m256d cRe = _mm256_sub_pd(aRe, bRe);
+    __m256d cIm = _mm256_sub_pd(atan2Avx2(pIm, pRe), atan2Avx2(qIm, qRe));
+
+    // v0 = (3 d4 + d5) / (4 mc) - (3/2 a + 1/2 b) / 4 - 2 mc
+    __m256d logRe = _mm256_mul_pd(quarter, _mm256_fmadd_pd(_mm256_set1_pd(1.5), aRe, _mm256_mul_pd(half, bRe)));
+    __m256d logIm = _mm256_mul_pd(quarter, _mm256_fmadd_pd(_mm256_set1_pd(1.5), aIm, _mm256_mul_pd(half, bIm)));
+    __m256d v0Re = _mm256_fmsub_pd(_mm256_fmadd_pd(three, re[4], re[5]), mc4Inv, logRe);
+    __m256d v0Im = _mm256_fmsub_pd(_mm256_fmadd_pd(three, im[4], im[5]), mc4Inv, logIm);
+    storeAvx2(v0 + i, _mm256_sub_pd(v0Re, mc2), v0Im);
+
+    // vs = (d4 - d5) / mc - c / 2
+    __m256d vsRe = _mm256_fnmadd_pd(half, cRe, _mm256_mul_pd(_mm256_sub_pd(re[4], re[5]), mcInv));
+    __m256d vsIm = _mm256_fnmadd_pd(half, cIm, _mm256_mul_pd(_mm256_sub_pd(im[4], im[5]), mcInv));
+    storeAvx2(vs + i, vsRe, vsIm);
+  }
+  vScalarLoop(data, mc, v0, vs, i, arrayLength);
+}
+
+/* ----------------------------------- AVX-512 ---------------------------------- */
+
+// 8 complex numbers as (re, im) vectors; the lane order is undone by storeAvx512
+__attribute__((target("avx512f"))) static inline void loadAvx512(const COMPLX* p, __m512d& re, __m512d& im) {
+  __m512d a = _mm512_loadu_pd((const DOUBLE*)p);
+  __m512d b = _mm512_loadu_pd((const DOUBLE*)(p + 4));
+  re = _mm512_unpacklo_pd(a, b);
+  im = _mm512_unpackhi_pd(a, b);
+}
+
+__attribute__((target("avx512f"))) static inline void storeAvx512(COMPLX* p, __m512d re, __m512d im) {
+  _mm512_storeu_pd((DOUBLE*)p, _mm512_unpacklo_pd(re, im));
+  _mm512_storeu_pd((DOUBLE*)(p + 4), _mm512_unpackhi_pd(re, im));
+}
+
+template <int N>
+__attribute__((target("avx512f"))) static inline __m512d polyAvx512(__m512d x, const DOUBLE (&c)[N]) {
+  __m512d r = _mm512_set1_pd(c[0]);
+  for (int k = 1; k < N; k++) r = _mm512_fmadd_pd(r, x, _mm512_set1_pd(c[k]));
+  return r;
+}
+
+template <int N>
+__attribute__((target("avx512f"))) static inline __m512d poly1Avx512(__m512d x, const DOUBLE (&c)[N]) {
+  __m512d r = _mm512_add_pd(x, _mm512_set1_pd(c[0]));
+  for (int k = 1; k < N; k++) r = _mm512_fmadd_pd(r, x, _mm512_set1_pd(c[k]));
+  return r;
+}
+
+// log(x) for normal, finite x > 0; getexp/getmant give the split x = m 2^e directly
+__attribute__((target("avx512f"))) static inline __m512d logAvx512(__m512d x) {
+  const __m512d one = _mm512_set1_pd(1.0);
+  __m512d m = _mm512_getmant_pd(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+  __m512d e = _mm512_add_pd(_mm512_getexp_pd(x), one);
+
+  __mmask8 small = _mm512_cmp_pd_mask(m, _mm512_set1_pd(SQRTH), _CMP_LT_OQ);
+  e = _mm512_mask_sub_pd(e, small, e, one);
+  __m512d f = _mm512_sub_pd(m, one);
+  f = _mm512_mask_add_pd(f, small, f, m);
+
+  __m512d z = _mm512_mul_pd(f, f);
+  __m512d y = _mm512_mul_pd(f, _mm512_div_pd(_mm512_mul_pd(z, polyAvx512(f, LOG_P)), poly1Avx512(f, LOG_Q)));
+  y = _mm512_fmadd_pd(e, _mm512_set1_pd(LN2_LO), y);
+  y = _mm512_fnmadd_pd(_mm512_set1_pd(0.5), z, y);
+  return _mm512_fmadd_pd(e, _mm512_set1_pd(LN2_HI), _mm512_add_pd(f, y));
+}
+
+// atan2(y, x) for finite y and finite nonzero x
+__attribute__((target("avx512f"))) static inline __m512d atan2Avx512(__m512d y, __m512d x) {
+  const __m512i sign = _mm512_set1_epi64(0x8000000000000000LL);
+  const __m512d one = _mm512_set1_pd(1.0);
+
+  __m512d t = _mm512_div_pd(y, x);
+  __m512d a = _mm512_abs_pd(t);
+
+  __mmask8 big = _mm512_cmp_pd_mask(a, _mm512_set1_pd(T3P8), _CMP_GT_OQ);
+  __mmask8 mid = _mm512_cmp_pd_mask(a, _mm512_set1_pd(0.66), _CMP_GT_OQ) & ~big;
+  __m512d r = _mm512_mask_div_pd(a, mid, _mm512_sub_pd(a, one), _mm512_add_pd(a, one));
+  r = _mm512_mask_div_pd(r, big, _mm512_set1_pd(-1.0), a);
+  __m512d y0 = _mm512_mask_blend_pd(mid, _mm512_setzero_pd(), _mm512_set1_pd(M_PI_4));
+  y0 = _mm512_mask_blend_pd(big, y0, _mm512_set1_pd(M_PI_2));
+  __m512d more = _mm512_mask_blend_pd(mid, _mm512_setzero_pd(), _mm512_set1_pd(0.5 * MOREBITS));
+  more = _mm512_mask_blend_pd(big, more, _mm512_set1_pd(MOREBITS));
+
+  __m512d z = _mm512_mul_pd(r, r);
+  z = _mm512_div_pd(_mm512_mul_pd(z, polyAvx512(z, ATAN_P)), poly1Avx512(z, ATAN_Q));
+  z = _mm512_add_pd(_mm512_fmadd_pd(r, z, r), more);
+  __m512i tSign = _mm512_and_epi64(_mm512_castpd_si512(t), sign);
+  __m512d res = _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(_mm512_add_pd(y0, z)), tSign));
+
+  // x < 0: +-pi by the sign bit of y
+  __m512i ySign = _mm512_and_epi64(_mm512_castpd_si512(y), sign);
+  __m512d w = _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(_mm512_set1_pd(M_PI)), ySign));
+  __mmask8 neg = _mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_LT_OQ);
+  return _mm512_mask_add_pd(res, neg, res, w);
+}
+
+__attribute__((target("avx512f"))) static inline __mmask8 badLogAvx512(__m512d x) {
+  return _mm512_cmp_pd_mask(x, _mm512_set1_pd(DBL_MIN), _CMP_NGE_UQ) |
+         _mm512_cmp_pd_mask(x, _mm512_set1_pd(DBL_MAX), _CMP_GT_OQ);
+}
+
+__attribute__((target("avx512f"))) static inline __mmask8 badAtan2Avx512(__m512d y, __m512d x) {
+  const __m512d max = _mm512_set1_pd(DBL_MAX);
+  return _mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_OQ) |
+         _mm512_cmp_pd_mask(_mm512_abs_pd(x), max, _CMP_NLE_UQ) |
+         _mm512_cmp_pd_mask(_mm512_abs_pd(y), max, _CMP_NLE_UQ);
+}
+
+__attribute__((target("avx512f"))) static void fksAvx512(const COMPLX* const data[6], COMPLX* fks,
+                                                         int arrayLength) {
+  int i = 0;
+  for (; i + 8 <= arrayLength; i += 8) {
+    __m512d re[6], im[6], n[4];
+    for (int k = 0; k < 6; k++) loadAvx512(data[k] + i, re[k], im[k]);
+    for (int k = 0; k < 4; k++) n[k] = _mm512_fmadd_pd(re[k], re[k], _mm512_mul_pd(im[k], im[k]));
+
+    // d1 conj d3 and d0 conj d2
+    __m512d pRe = _mm512_fmadd_pd(re[1], re[3], _mm512_mul_pd(im[1], im[3]));
+    __m512d pIm = _mm512_fmsub_pd(im[1], re[3], _mm512_mul_pd(re[1], im[3]));
+    __m512d qRe = _mm512_fmadd_pd(re[0], re[2], _mm512_mul_pd(im[0], im[2]));
+    __m512d qIm = _mm512_fmsub_pd(im[0], re[2], _mm512_mul_pd(re[0], im[2]));
+    __m512d ratio = _mm512_mul_pd(_mm512_div_pd(n[1], n[3]), _mm512_div_pd(n[2], n[0]));
+
+    if (badLogAvx512(ratio) | badAtan2Avx512(pIm, pRe) | badAtan2Avx512(qIm, qRe)) {
+      fksScalarLoop(data, fks, i, i + 8);
+      continue;
+    }
+
+    __m512d ddtRe = _mm512_mul_pd(_mm512_set1_pd(0.25), logAvx512(ratio));
+    __m512d ddtIm =
+        _mm512_mul_pd(_mm512_set1_pd(0.5), _mm512_sub_pd(atan2Avx512(pIm, pRe), atan2Avx512(qIm, qRe)));
+
+    __m512d nRe = _mm512_sub_pd(re[4], re[5]), nIm = _mm512_sub_pd(im[4], im[5]);
+    __m512d den = _mm512_fmadd_pd(ddtRe, ddtRe, _mm512_mul_pd(ddtIm, ddtIm));
+    __m512d outRe = _mm512_div_pd(_mm512_fmadd_pd(nRe, ddtRe, _mm512_mul_pd(nIm, ddtIm)), den);
+    __m512d outIm = _mm512_div_pd(_mm512_fmsub_pd(nIm, ddtRe, _mm512_mul_pd(nRe, ddtIm)), den);
+    storeAvx512(fks + i, outRe, outIm);
+  }
+  fksScalarLoop(data, fks, i, arrayLength);
+}
+
+__attribute__((target("avx512f"))) static void vAvx512(const COMPLX* const data[6], DOUBLE mc, COMPLX* v0,
+                                                       COMPLX* vs, int arrayLength) {
+  const __m512d quarter = _mm512_set1_pd(0.25), half = _mm512_set1_pd(0.5);
+  const __m512d mc4Inv = _mm512_set1_pd(1.0 / (4.0 * mc)), mcInv = _mm512_set1_pd(1.0 / mc);
+  const __m512d three = _mm512_set1_pd(3.0), mc2 = _mm512_set1_pd(2.0 * mc);
+  int i = 0;
+  for (; i + 8 <= arrayLength; i += 8) {
+    __m512d re[6], im[6], n[4];
+    for (int k = 0; k < 6; k++) loadAvx512(data[k] + i, re[k], im[k]);
+    for (int k = 0; k < 4; k++) n[k] = _mm512_fmadd_pd(re[k], re[k], _mm512_mul_pd(im[k], im[k]));
+
+    __m512d pRe = _mm512_fmadd_pd(re[1], re[3], _mm512_mul_pd(im[1], im[3]));
+    __m512d pIm = _mm512_fmsub_pd(im[1], re[3], _mm512_mul_pd(re[1], im[3]));
+    __m512d qRe = _mm512_fmadd_pd(re[0], re[2], _mm512_mul_pd(im[0], im[2]));
+    __m512d qIm = _mm512_fmsub_pd(im[0], re[2], _mm512_mul_pd(re[0], im[2]));
+    __m512d ratio10 = _mm512_div_pd(n[1], n[0]), ratio32 = _mm512_div_pd(n[3], n[2]);
+
+    __mmask8 bad = badLogAvx512(ratio10) | badLogAvx512(ratio32);
+    bad |= badAtan2Avx512(pIm, pRe) | badAtan2Avx512(qIm, qRe);
+    for (int k = 0; k < 4; k++) bad |= badAtan2Avx512(im[k], re[k]);
+    if (bad) {
+      vScalarLoop(data, mc, v0, vs, i, i + 8);
+      continue;
+    }
+
+    __m512d aRe = _mm512_mul_pd(half, logAvx512(ratio10));
+    __m512d bRe = _mm512_mul_pd(half, logAvx512(ratio32));
+    __m512d aIm = _mm512_sub_pd(atan2Avx512(im[1], re[1]), atan2Avx512(im[0], re[0]));
+    __m512d bIm = _mm512_sub_pd(atan2Avx512(im[3], re[3]), atan2Avx512(im[2], re[2]));
+    __m512d cRe = _mm512_sub_pd(aRe, bRe);
+    __m512d cIm = _mm512_sub_pd(atan2Avx512(pIm, pRe), atan2Avx512(qIm, qRe));
+
+    // v0 = (3 d4 + d5) / (4 mc) - (3/2 a + 1/2 b) / 4 - 2 mc
+    __m512d logRe = _mm512_mul_pd(quarter, _mm512_fmadd_pd(_mm512_set1_pd(1.5), aRe, _mm512_mul_pd(half, bRe)));
+    __m512d logIm = _mm512_mul_pd(quarter, _mm512_fmadd_pd(_mm512_set1_pd(1.5), aIm, _mm512_mul_pd(half, bIm)));
+    __m512d v0Re = _mm512_fmsub_pd(_mm512_fmadd_pd(three, re[4], re[5]), mc4Inv, logRe);
+    __m512d v0Im = _mm512_fmsub_pd(_mm512_fmadd_pd(three, im[4], im[5]), mc4Inv, logIm);
+    storeAvx512(v0 + i, _mm512_sub_pd(v0Re, mc2), v0Im);
+
+    // vs = (d4 - d5) / mc - c / 2
+    __m512d vsRe = _mm512_fnmadd_pd(half, cRe, _mm512_mul_pd(_mm512_sub_pd(re[4], re[5]), mcInv));
+    __m512d vsIm = _mm512_fnmadd_pd(half, cIm, _mm512_mul_pd(_mm512_sub_pd(im[4], im[5]), mcInv));
+    storeAvx512(vs + i, vsRe, vsIm);
+  }
+  vScalarLoop(data, mc, v0, vs, i, arrayLength);
+}
+
+/* ---------------------------------- dispatch ---------------------------------- */
+
+void fusedFksTd(const COMPLX* const data[6], COMPLX* fks, int arrayLength) {
+  fusedFksTd(data, fks, arrayLength, stencilDetect());
+}
+
+void fusedFksTd(const COMPLX* const data[6], COMPLX* fks, int arrayLength, StencilIsa isa) {
+  if (isa == STENCIL_AVX512) {
+    fksAvx512(data, fks, arrayLength);
+  } else if (isa == STENCIL_AVX2) {
+    fksAvx2(data, fks, arrayLength);
+  } else {
+    fksScalarLoop(data, fks, 0, arrayLength);
+  }
+}
+
+void fusedVTd(const COMPLX* const data[6], DOUBLE mc, COMPLX* v0, COMPLX* vs, int arrayLength) {
+  fusedVTd(data, mc, v0, vs, arrayLength, stencilDetect());
+}
+
+void fusedVTd(const COMPLX* const data[6], DOUBLE mc, COMPLX* v0, COMPLX* vs, int arrayLength, StencilIsa isa) {
+  if (isa == STENCIL_AVX512) {
+    vAvx512(data, mc, v0, vs, arrayLength);
+  } else if (isa == STENCIL_AVX2) {
+    vAvx2(data, mc, v0, vs, arrayLength);
+  } else {
+    vScalarLoop(data, mc, v0, vs, 0, arrayLength);
+  }
+}
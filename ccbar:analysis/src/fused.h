@@ -0,0 +1,52 @@
+/**
+ * @file fused.h
+ * @author Tianchen Zhang
+ * @brief Fused kernels of the time-dependent formulae (fks-td and v-td):
+ *        every output element is computed in one pass over the six input
+ *        arrays, with no complex temporaries. Complex log and division are
+ *        split into real log, atan2 and multiplication by the conjugate,
+ *        which are vectorized (AVX-512, AVX2 or scalar, chosen at runtime
+ *        like the stencil).
+ *        Provide 2 functions:
+ *        void fusedFksTd(): F_KS of one time slice;
+ *        void fusedVTd(): V_0 and V_s of one time slice
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_FUSED_H_
+#define CCBAR_SRC_FUSED_H_
+
+#include <complex>
+
+#include "alias.h"
+#include "stencil.h"
+
+/**
+ * @brief F_KS = (ppotV - ppotPS) / (d/dt log[CV/CPS]), with the time
+ *        derivative as the symmetric difference
+ *
+ * @param data CV(t-1), CV(t+1), CPS(t-1), CPS(t+1), ppotV, ppotPS
+ * @param fks Output array
+ * @param arrayLength Length of the arrays
+ * @param isa Instruction set (default: best available)
+ */
+void fusedFksTd(const COMPLX* const data[6], COMPLX* fks, int arrayLength);
+void fusedFksTd(const COMPLX* const data[6], COMPLX* fks, int arrayLength, StencilIsa isa);
+
+/**
+ * @brief Spin-independent V_0 and spin-dependent V_s, the time derivatives
+ *        as symmetric differences
+ *
+ * @param data CV(t-1), CV(t+1), CPS(t-1), CPS(t+1), ppotV, ppotPS
+ * @param mc Kinetic mass of charm quark
+ * @param v0 Output array of V_0
+ * @param vs Output array of V_s
+ * @param arrayLength Length of the arrays
+ * @param isa Instruction set (default: best available)
+ */
+void fusedVTd(const COMPLX* const data[6], DOUBLE mc, COMPLX* v0, COMPLX* vs, int arrayLength);
+void fusedVTd(const COMPLX* const data[6], DOUBLE mc, COMPLX* v0, COMPLX* vs, int arrayLength, StencilIsa isa);
+
+#endif
@@ -12,9 +12,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
 #include <complex>
 #include <valarray>
+#include <vector>
 
+#include "accum.h"
+#include "convert.h"
 #include "dataio.h"
 #include "misc.h"
 
@@ -22,26 +26,48 @@ void usage(char* name) {
   fprintf(stderr, "Jackknife resampling for raw data\n");
   fprintf(stderr,
           "USAGE: \n"
-          "    %s [OPTIONS] ifname1 ifname2 [ifname3 ...]\n",
+          "    %s [OPTIONS] ifname1 ifname2 [ifname3 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -l <LENGTH>:      Length of data arrays\n"
-          "    -d <OFDIR>:       Directory of output files\n"
+          "    -l <LENGTH>:      Length of data arrays (default: from file header)\n"
+          "    -d <OFDIR>:       Directory (or ensemble container *.ens) of output files\n"
           "    [-v]:             Calculate variance for each sample\n"
+          "    [-J <NAME.jk>]:   Write a virtual jackknife instead of the samples: the manifest\n"
+          "                      NAME.jk and the sum NAME.jk.sum; sample i is then read as\n"
+          "                      NAME.jk#<file name of ifname i> (or all of them as NAME.jk)\n"
+          "    [-m <MBYTES>]:    Memory budget for the resident ensemble (default: unlimited)\n"
+          "    [-s]:             Report bytes read per input file\n"
+          "    [-e <ENC>]:       Encoding of output files: f64 (default), f32 or bf16\n"
+          "    [-V]:             Report the largest error induced by the encoding, relative\n"
+          "                      to the jackknife error of the same element (needs -e)\n"
+          "    [-z]:             Compress output files (lossless: byte shuffle and LZ)\n"
+          "    [-H]:             Write self-describing header to output files\n"
           "    [-h, --help]:     Print help\n");
 }
 
 // Custom function declaration
-void jackknifeResample(char* rawDataList[], char* sampleList[], int arrayLength, int fileCountTotal);
-void jackknifeResampleWithVar(char* rawDataList[], char* sampleList[], int arrayLength, int fileCountTotal);
+void jackknifeResample(char* rawDataList[], char* sampleList[], int arrayLength, int fileCountTotal,
+                       long long cacheBytes, long long readBytes[], BinEncoding verifyEncoding);
+void jackknifeResampleWithVar(char* rawDataList[], char* sampleList[], int arrayLength, int fileCountTotal,
+                              long long cacheBytes, long long readBytes[]);
+void jackknifeVirtual(char* rawDataList[], const char* manifest, int arrayLength, int fileCountTotal,
+                      long long readBytes[]);
 
 // Main function
 int main(int argc, char* argv[]) {
   // Global variables
   int arrayLength = 0;
   static const char* ofDir = NULL;
+  static const char* manifest = NULL;
   bool isSaveVar = false;
+  bool isReport = false;
+  long long cacheBytes = -1;  // Negative: keep the whole ensemble resident
+  bool isHeader = false;
+  bool isCompress = false;
+  BinEncoding encoding = BIN_ENC_F64;
+  bool isVerify = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -87,30 +113,133 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -J: virtual jackknife manifest
+    if (strcmp(argv[0], "-J") == 0) {
+      manifest = argv[1];
+      if (manifest == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -m: memory budget (MB) for the resident ensemble
+    if (strcmp(argv[0], "-m") == 0) {
+      if (argv[1] == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      cacheBytes = atoll(argv[1]) * 1024 * 1024;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -s: report bytes read per file
+    if (strcmp(argv[0], "-s") == 0) {
+      isReport = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -e: encoding of output files
+    if (strcmp(argv[0], "-e") == 0) {
+      if (!parseBinEncoding(argv[1], encoding)) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -V: report the error induced by the encoding
+    if (strcmp(argv[0], "-V") == 0) {
+      isVerify = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -z: compress output files
+    if (strcmp(argv[0], "-z") == 0) {
+      isCompress = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
   }
 
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
   const int fileCountTotal = argc;  // # of data files
   if (fileCountTotal < 2) {
     usage(programName);
     exit(1);
   }
 
+  // Length (and lattice sizes) from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !arrayLength) arrayLength = header.arrayLength;
+  if (!arrayLength) {
+    usage(programName);
+    exit(1);
+  }
+  if (manifest != NULL && isSaveVar) {
+    fprintf(stderr, "Error: -J and -v cannot be combined\n");
+    exit(1);
+  }
+  if (manifest != NULL && encoding != BIN_ENC_F64) {
+    fprintf(stderr, "Error: -J and -e cannot be combined\n");
+    exit(1);
+  }
+  if (isVerify && (encoding == BIN_ENC_F64 || manifest != NULL || isSaveVar)) {
+    fprintf(stderr, "Error: -V needs -e and plain samples (no -J or -v)\n");
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, header.xyzSize, header.tSize);
+  setBinEncoding(encoding);
+  setBinCompression(isCompress ? BIN_COMP_LZ : BIN_COMP_NONE, 1);
+
   // Create an array to store ofnames
   char* ofnameArr[fileCountTotal];
 
   for (int i = 0; i < fileCountTotal; i++) {
     ofnameArr[i] = (char*)malloc(2048 * sizeof(char));
-    changePath(argv[i], ofDir, ofnameArr[i]);
+    if (manifest == NULL) changePath(argv[i], ofDir, ofnameArr[i]);  // No sample files with -J
   }
 
   // Main part for calculation
-  if (isSaveVar) {
-    jackknifeResampleWithVar(argv, ofnameArr, arrayLength, fileCountTotal);
+  long long readBytes[fileCountTotal];
+  if (manifest != NULL) {
+    jackknifeVirtual(argv, manifest, arrayLength, fileCountTotal, readBytes);
+  } else if (isSaveVar) {
+    jackknifeResampleWithVar(argv, ofnameArr, arrayLength, fileCountTotal, cacheBytes, readBytes);
   } else {
-    jackknifeResample(argv, ofnameArr, arrayLength, fileCountTotal);
+    BinEncoding verifyEncoding = isVerify ? encoding : BIN_ENC_F64;
+    jackknifeResample(argv, ofnameArr, arrayLength, fileCountTotal, cacheBytes, readBytes, verifyEncoding);
+  }
+
+  if (isReport) {
+    for (int i = 0; i < fileCountTotal; i++) {
+      fprintf(stderr, "%s: %lld bytes read\n", argv[i], readBytes[i]);
+    }
   }
 
   // Finalization for the string arrays
@@ -122,77 +251,181 @@ int main(int argc, char* argv[]) {
 }
 
 // Custom function definition
-void jackknifeResample(char* rawDataList[], char* sampleList[], int arrayLength, int fileCountTotal) {
-  CVARRAY sum(arrayLength), value(arrayLength);
-  sum = value = 0.0;
 
-  // First round: Get sum of all data
+// Number of files (from the front of the list) that fit in the cache
+int residentCount(int arrayLength, int fileCountTotal, long long cacheBytes) {
+  if (cacheBytes < 0) return fileCountTotal;
+  long long count = cacheBytes / (long long)(sizeof(COMPLX) * arrayLength);
+  return count < fileCountTotal ? int(count) : fileCountTotal;
+}
+
+// Fetch file i: from the resident cache if present, otherwise from disk
+const COMPLX* fetchSample(char* rawDataList[], int i, int arrayLength, const std::vector<COMPLX>& cache,
+                          int cacheCount, BinMap& map, long long readBytes[]) {
+  if (i < cacheCount) return &cache[size_t(i) * arrayLength];
+
+  const COMPLX* data;
+  long long before = binBytesRead();
+  mapBin(rawDataList[i], arrayLength, data, map);
+  readBytes[i] += binBytesRead() - before;
+  return data;
+}
+
+// Largest error of the encoded samples relative to the jackknife error,
+// over the real parts of all elements
+void reportEncodingError(const Welford& acc, const DVARRAY& maxError, int arrayLength) {
+  std::vector<COMPLX> meanError(arrayLength);
+  welfordJackknife(acc, meanError.data());
+
+  DOUBLE worst = 0.0, worstError = 0.0;
+  int worstIndex = 0;
+  for (int j = 0; j < arrayLength; j++) {
+    if (meanError[j].imag() <= 0.0) continue;  // Constant element: nothing to compare with
+    DOUBLE ratio = maxError[j] / meanError[j].imag();
+    if (ratio > worst) {
+      worst = ratio;
+      worstError = maxError[j];
+      worstIndex = j;
+    }
+  }
+
+  fprintf(stderr, "Encoding error: max |error| / jackknife error = %.3e (element %d, |error| = %.3e)\n", worst,
+          worstIndex, worstError);
+}
+
+void jackknifeResample(char* rawDataList[], char* sampleList[], int arrayLength, int fileCountTotal,
+                       long long cacheBytes, long long readBytes[], BinEncoding verifyEncoding) {
+  CVARRAY sum(arrayLength);
+  sum = 0.0;
+
+  // -V: samples round-tripped through the output encoding
+  Welford acc;
+  DVARRAY maxError;
+  std::vector<char> stored;
+  std::vector<COMPLX> encoded;
+  if (verifyEncoding != BIN_ENC_F64) {
+    welfordInit(acc, arrayLength);
+    maxError.resize(arrayLength, 0.0);
+    stored.resize(sizeof(COMPLX) / sizeof(DOUBLE) * arrayLength * convertSize(verifyEncoding));
+    encoded.resize(arrayLength);
+  }
+
+  int cacheCount = residentCount(arrayLength, fileCountTotal, cacheBytes);
+  std::vector<COMPLX> cache(size_t(cacheCount) * arrayLength);
+
+  // First round: Get sum of all data, keeping as many files resident as
+  // allowed
   for (int i = 0; i < fileCountTotal; i++) {
-    CVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
+    const COMPLX* tmp;
+    BinMap inMap;
+    readBytes[i] = 0;
+    tmp = fetchSample(rawDataList, i, arrayLength, cache, 0, inMap, readBytes);
+
+    for (int j = 0; j < arrayLength; j++) sum[j] += tmp[j];
+    if (i < cacheCount) std::copy(tmp, tmp + arrayLength, &cache[size_t(i) * arrayLength]);
 
-    sum += tmp;
+    unmapBin(inMap);
   }
 
   // Second round: Generate jackknife resampled data and save files
   for (int i = 0; i < fileCountTotal; i++) {
-    CVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
-
-    value = (sum - tmp) / (fileCountTotal - 1.0);
+    const COMPLX* tmp;
+    COMPLX* value;
+    BinMap inMap, outMap;
+    tmp = fetchSample(rawDataList, i, arrayLength, cache, cacheCount, inMap, readBytes);
+    mapBinOut(sampleList[i], arrayLength, value, outMap);
+
+    for (int j = 0; j < arrayLength; j++) value[j] = (sum[j] - tmp[j]) / (fileCountTotal - 1.0);
+
+    if (verifyEncoding != BIN_ENC_F64) {
+      // Same conversion as writing and reading the file (two doubles per element)
+      convertNarrow((const DOUBLE*)value, stored.data(), 2 * arrayLength, verifyEncoding);
+      convertWiden(stored.data(), (DOUBLE*)encoded.data(), 2 * arrayLength, verifyEncoding);
+      welfordPush(acc, value);
+      for (int j = 0; j < arrayLength; j++) {
+        maxError[j] = std::max(maxError[j], std::abs(encoded[j].real() - value[j].real()));
+      }
+    }
 
-    writeBin(sampleList[i], arrayLength, value);
+    unmapBin(inMap);
+    unmapBin(outMap);
   }
+
+  if (verifyEncoding != BIN_ENC_F64) reportEncodingError(acc, maxError, arrayLength);
 }
 
-void jackknifeResampleWithVar(char* rawDataList[], char* sampleList[], int arrayLength, int fileCountTotal) {
-  DVARRAY sum(arrayLength), sumSquare(arrayLength), value(arrayLength), var(arrayLength);
-  sum = sumSquare = value = var = 0.0;
+void jackknifeResampleWithVar(char* rawDataList[], char* sampleList[], int arrayLength, int fileCountTotal,
+                              long long cacheBytes, long long readBytes[]) {
+  DVARRAY sum(arrayLength), sumSquare(arrayLength);
+  sum = sumSquare = 0.0;
+
+  int cacheCount = residentCount(arrayLength, fileCountTotal, cacheBytes);
+  std::vector<COMPLX> cache(size_t(cacheCount) * arrayLength);
 
-  // First round: Get sum and sum^2 of all data
+  // First round: Get sum and sum^2 of all data, keeping as many files
+  // resident as allowed
   for (int i = 0; i < fileCountTotal; i++) {
-    CVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
+    const COMPLX* tmp;
+    BinMap inMap;
+    readBytes[i] = 0;
+    tmp = fetchSample(rawDataList, i, arrayLength, cache, 0, inMap, readBytes);
 
-    DVARRAY rtmp(arrayLength);
-    rtmp = 0.0;
-    keepReal(tmp, rtmp, arrayLength);
-    // varryNorm(tmp, rtmp, arrayLength);
+    for (int j = 0; j < arrayLength; j++) {
+      DOUBLE rtmp = tmp[j].real();
+      // DOUBLE rtmp = abs(tmp[j]);
+      sum[j] += rtmp;
+      sumSquare[j] += rtmp * rtmp;
+    }
+    if (i < cacheCount) std::copy(tmp, tmp + arrayLength, &cache[size_t(i) * arrayLength]);
 
-    sum += rtmp;
-    sumSquare += rtmp * rtmp;
+    unmapBin(inMap);
   }
 
   // Second round: Generate the Jackknife sampled data and calculate the
   // variance
   // Also, save files to sampleList[]
   for (int i = 0; i < fileCountTotal; i++) {
-    CVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
+    const COMPLX* tmp;
+    COMPLX* result;
+    BinMap inMap, outMap;
+    tmp = fetchSample(rawDataList, i, arrayLength, cache, cacheCount, inMap, readBytes);
+    mapBinOut(sampleList[i], arrayLength, result, outMap);
 
-    DVARRAY rtmp(arrayLength);
-    rtmp = 0.0;
-    keepReal(tmp, rtmp, arrayLength);
-    // varryNorm(tmp, rtmp, arrayLength);
+    for (int j = 0; j < arrayLength; j++) {
+      DOUBLE rtmp = tmp[j].real();
+      // DOUBLE rtmp = abs(tmp[j]);
+      DOUBLE value = (sum[j] - rtmp) / (fileCountTotal - 1.0);
+      // About this variance, please refer to eq.(7.37) on P.383, Montvay LQCD
+      // book
+      DOUBLE var = sqrt(((sumSquare[j] - rtmp * rtmp) / DOUBLE(fileCountTotal - 1.0) - value * value) /
+                        DOUBLE(fileCountTotal - 2.0));
+
+      result[j] = COMPLX(value, var);
+    }
 
-    value = (sum - rtmp) / (fileCountTotal - 1.0);
-    // About this variance, please refer to eq.(7.37) on P.383, Montvay LQCD
-    // book
-    var =
-        sqrt(((sumSquare - rtmp * rtmp) / DOUBLE(fileCountTotal - 1.0) - value * value) / DOUBLE(fileCountTotal - 2.0));
+    unmapBin(inMap);
+    unmapBin(outMap);
+  }
+}
 
-    CVARRAY result(arrayLength);
-    result = 0.0;
+// Only the sum is written: samples are computed when they are read
+void jackknifeVirtual(char* rawDataList[], const char* manifest, int arrayLength, int fileCountTotal,
+                      long long readBytes[]) {
+  CVARRAY sum(arrayLength);
+  sum = 0.0;
 
-    for (int j = 0; j < arrayLength; j++) {
-      result[j].real(value[j]);
-      result[j].imag(var[j]);
-    }
+  // Same order of summation as jackknifeResample(), so samples are identical
+  for (int i = 0; i < fileCountTotal; i++) {
+    const COMPLX* tmp;
+    BinMap inMap;
+    long long before = binBytesRead();
+    mapBin(rawDataList[i], arrayLength, tmp, inMap);
+    readBytes[i] = binBytesRead() - before;
 
-    writeBin(sampleList[i], arrayLength, result);
+    for (int j = 0; j < arrayLength; j++) sum[j] += tmp[j];
+
+    unmapBin(inMap);
   }
+
+  writeJk(manifest, rawDataList, fileCountTotal, arrayLength, &sum[0]);
 }
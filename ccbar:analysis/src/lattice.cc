@@ -0,0 +1,157 @@
+/**
+ * @file lattice.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "lattice.h"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "alias.h"
+
+void latticeInit(Lattice& lat, int xyzSize) {
+  lat.xyzSize = xyzSize;
+  lat.siteCount = xyzSize * xyzSize * xyzSize;
+  lat.up.resize(xyzSize);
+  lat.down.resize(xyzSize);
+  lat.refl.resize(xyzSize);
+
+  for (int x = 0; x < xyzSize; x++) {
+    lat.up[x] = (x + 1) % xyzSize;
+    lat.down[x] = (x - 1 + xyzSize) % xyzSize;
+    lat.refl[x] = (xyzSize - x) % xyzSize;
+  }
+
+  // Number the representatives x <= y <= z <= L/2
+  const int half = xyzSize / 2 + 1;
+  std::vector<int> repIndex(half * half * half, -1);
+  lat.orbitRep.clear();
+  for (int i = 0; i < half; i++)
+    for (int j = i; j < half; j++)
+      for (int k = j; k < half; k++) {
+        repIndex[i + half * (j + half * k)] = lat.orbitRep.size();
+        lat.orbitRep.push_back(lat.site(i, j, k));
+      }
+  lat.orbitCount = lat.orbitRep.size();
+
+  // Fold each site into [0, L/2]^3 and sort the coordinates
+  lat.orbit.resize(lat.siteCount);
+  lat.orbitSize.assign(lat.orbitCount, 0);
+  for (int iz = 0; iz < xyzSize; iz++)
+    for (int iy = 0; iy < xyzSize; iy++)
+      for (int ix = 0; ix < xyzSize; ix++) {
+        int c[3] = {std::min(ix, lat.refl[ix]), std::min(iy, lat.refl[iy]), std::min(iz, lat.refl[iz])};
+        std::sort(c, c + 3);
+        int o = repIndex[c[0] + half * (c[1] + half * c[2])];
+        lat.orbit[lat.site(ix, iy, iz)] = o;
+        lat.orbitSize[o]++;
+      }
+
+  // Group the representatives by r^2 = x^2 + y^2 + z^2
+  std::vector<int> r2(lat.orbitCount);
+  for (int o = 0; o < lat.orbitCount; o++) {
+    const int s = lat.orbitRep[o], ix = s % xyzSize, iy = s / xyzSize % xyzSize, iz = s / (xyzSize * xyzSize);
+    r2[o] = ix * ix + iy * iy + iz * iz;
+  }
+  lat.radialOrder.resize(lat.orbitCount);
+  for (int o = 0; o < lat.orbitCount; o++) lat.radialOrder[o] = o;
+  std::stable_sort(lat.radialOrder.begin(), lat.radialOrder.end(), [&](int a, int b) { return r2[a] < r2[b]; });
+
+  lat.radialStart.clear();
+  lat.radialR2.clear();
+  for (int n = 0; n < lat.orbitCount; n++) {
+    const int o = lat.radialOrder[n];
+    if (n == 0 || r2[o] != lat.radialR2.back()) {
+      lat.radialStart.push_back(n);
+      lat.radialR2.push_back(r2[o]);
+    }
+  }
+  lat.radialCount = lat.radialR2.size();
+  lat.radialStart.push_back(lat.orbitCount);
+}
+
+// Average over the 6 permutations of (x, y, z), coordinates already wrapped;
+// same summation order as naiveSym() used to have
+static inline COMPLX permSym(const COMPLX* data, int x, int y, int z, int L) {
+  const int L2 = L * L;
+  return (data[x + L * y + L2 * z] + data[y + L * z + L2 * x] + data[z + L * x + L2 * y] + data[x + L * z + L2 * y] +
+          data[z + L * y + L2 * x] + data[y + L * x + L2 * z]) /
+         6.0;
+}
+
+void latticeA1Sym(const Lattice& lat, const COMPLX* data, COMPLX* result) {
+  const int L = lat.xyzSize;
+
+  for (int iz = 0; iz < L; iz++) {
+    const int rz = lat.refl[iz];
+    for (int iy = 0; iy < L; iy++) {
+      const int ry = lat.refl[iy];
+      COMPLX* out = result + L * (iy + L * iz);
+      for (int ix = 0; ix < L; ix++) {
+        const int rx = lat.refl[ix];
+        out[ix] = (permSym(data, ix, iy, iz, L) + permSym(data, ix, iy, rz, L) + permSym(data, ix, ry, iz, L) +
+                   permSym(data, ix, ry, rz, L) + permSym(data, rx, iy, iz, L) + permSym(data, rx, iy, rz, L) +
+                   permSym(data, rx, ry, iz, L) + permSym(data, rx, ry, rz, L)) /
+                  8.0;
+      }
+    }
+  }
+}
+
+void latticeOrbitMean(const Lattice& lat, const COMPLX* data, COMPLX* orbitMean) {
+  for (int o = 0; o < lat.orbitCount; o++) orbitMean[o] = 0.0;
+  for (int s = 0; s < lat.siteCount; s++) orbitMean[lat.orbit[s]] += data[s];
+  for (int o = 0; o < lat.orbitCount; o++) orbitMean[o] /= DOUBLE(lat.orbitSize[o]);
+}
+
+void latticeOrbitScatter(const Lattice& lat, const COMPLX* orbitMean, COMPLX* result) {
+  for (int s = 0; s < lat.siteCount; s++) result[s] = orbitMean[lat.orbit[s]];
+}
+
+void latticePrePotential(const Lattice& lat, const COMPLX* data, COMPLX* result) {
+  const int L = lat.xyzSize;
+
+  for (int iz = 0; iz < L; iz++) {
+    const COMPLX* zp = data + L * L * lat.up[iz];
+    const COMPLX* zm = data + L * L * lat.down[iz];
+    for (int iy = 0; iy < L; iy++) {
+      const COMPLX* line = data + L * (iy + L * iz);
+      const COMPLX* yp = data + L * (lat.up[iy] + L * iz);
+      const COMPLX* ym = data + L * (lat.down[iy] + L * iz);
+      COMPLX* out = result + L * (iy + L * iz);
+      for (int ix = 0; ix < L; ix++) {
+        const int xp = lat.up[ix], xm = lat.down[ix];
+        // clang-format off
+        out[ix] = (-6.0 * line[ix]
+        + line[xp] + line[xm]
+        + yp[ix] + ym[ix]
+        + zp[ix + L * iy] + zm[ix + L * iy]
+        ) / line[ix];
+        // clang-format on
+      }
+    }
+  }
+}
+
+void latticePrePotentialOrbit(const Lattice& lat, const COMPLX* data, COMPLX* result) {
+  const int L = lat.xyzSize;
+  const int* orbit = lat.orbit.data();
+
+  for (int o = 0; o < lat.orbitCount; o++) {
+    const int s = lat.orbitRep[o];
+    const int ix = s % L, iy = (s / L) % L, iz = s / (L * L);
+    // clang-format off
+    result[o] = (-6.0 * data[o]
+    + data[orbit[lat.site(lat.up[ix], iy, iz)]] + data[orbit[lat.site(lat.down[ix], iy, iz)]]
+    + data[orbit[lat.site(ix, lat.up[iy], iz)]] + data[orbit[lat.site(ix, lat.down[iy], iz)]]
+    + data[orbit[lat.site(ix, iy, lat.up[iz])]] + data[orbit[lat.site(ix, iy, lat.down[iz])]]
+    ) / data[o];
+    // clang-format on
+  }
+}
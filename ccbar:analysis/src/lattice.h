@@ -0,0 +1,109 @@
+/**
+ * @file lattice.h
+ * @author Tianchen Zhang
+ * @brief Periodic index tables for L^3 lattices (modulo-free replacement for
+ *        CORR() in the inner loops).
+ *        Provide 6 functions:
+ *        void latticeInit(): Build the index, orbit and radial tables for a given xyzSize;
+ *        void latticeA1Sym(): A1+ projection of one array (48 terms per site);
+ *        void latticeOrbitMean(): A1+ projection as one average per O_h orbit;
+ *        void latticeOrbitScatter(): Expand orbit values to the full lattice;
+ *        void latticePrePotential(): [▽^2 C]/C of one array;
+ *        void latticePrePotentialOrbit(): [▽^2 C]/C of one array of orbit values
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_LATTICE_H_
+#define CCBAR_SRC_LATTICE_H_
+
+#include <complex>
+#include <vector>
+
+#include "alias.h"
+
+/**
+ * @brief Index tables of a periodic L^3 lattice, site = x + L * (y + L * z)
+ */
+struct Lattice {
+  int xyzSize = 0;
+  int siteCount = 0;
+  std::vector<int> up;    // up[x] = (x + 1) % L
+  std::vector<int> down;  // down[x] = (x - 1 + L) % L
+  std::vector<int> refl;  // refl[x] = (L - x) % L
+
+  // Cubic group (O_h) orbits. Representatives are the sites x <= y <= z <= L/2,
+  // numbered in the order cart2sphr writes them (x outermost, z innermost)
+  int orbitCount = 0;
+  std::vector<int> orbit;      // orbit[site]: orbit containing the site
+  std::vector<int> orbitSize;  // # of sites in each orbit
+  std::vector<int> orbitRep;   // Representative site of each orbit
+
+  // Distinct distances |r| of the representatives (shells). Shell s holds the
+  // orbits radialOrder[radialStart[s]] ... radialOrder[radialStart[s + 1] - 1],
+  // in the order above within a shell
+  int radialCount = 0;
+  std::vector<int> radialOrder;  // Orbits sorted by r^2
+  std::vector<int> radialStart;  // First entry of each shell in radialOrder (radialCount + 1 entries)
+  std::vector<int> radialR2;     // r^2 of each shell
+
+  inline int site(int x, int y, int z) const { return x + xyzSize * (y + xyzSize * z); }
+};
+
+/**
+ * @brief Build the index, orbit and radial tables for a given xyzSize (once per run)
+ *
+ * @param lat The tables to fill
+ * @param xyzSize Spacial size of lattice
+ */
+void latticeInit(Lattice& lat, int xyzSize);
+
+/**
+ * @brief A1+ projection: average over the 48 elements of O_h
+ *
+ * @param lat Index tables
+ * @param data Input array (L^3)
+ * @param result Output array (L^3)
+ */
+void latticeA1Sym(const Lattice& lat, const COMPLX* data, COMPLX* result);
+
+/**
+ * @brief A1+ projection computed once per O_h orbit: the 48-term average of
+ *        a1Sym equals the plain average over the distinct sites of the orbit
+ *
+ * @param lat Index and orbit tables
+ * @param data Input array (L^3)
+ * @param orbitMean Output array (lat.orbitCount), one value per orbit
+ */
+void latticeOrbitMean(const Lattice& lat, const COMPLX* data, COMPLX* orbitMean);
+
+/**
+ * @brief Expand one value per orbit to the full lattice
+ *
+ * @param lat Index and orbit tables
+ * @param orbitMean Input array (lat.orbitCount)
+ * @param result Output array (L^3)
+ */
+void latticeOrbitScatter(const Lattice& lat, const COMPLX* orbitMean, COMPLX* result);
+
+/**
+ * @brief Pre-potential [▽^2 C]/C with the 7-point stencil
+ *
+ * @param lat Index tables
+ * @param data Input array (L^3)
+ * @param result Output array (L^3)
+ */
+void latticePrePotential(const Lattice& lat, const COMPLX* data, COMPLX* result);
+
+/**
+ * @brief Pre-potential of an A1+ projected array stored as orbit values; the
+ *        Laplacian commutes with O_h, so the result is again one value per orbit
+ *
+ * @param lat Index and orbit tables
+ * @param data Input array (lat.orbitCount)
+ * @param result Output array (lat.orbitCount)
+ */
+void latticePrePotentialOrbit(const Lattice& lat, const COMPLX* data, COMPLX* result);
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file limeio.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "limeio.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const unsigned char LIME_MAGIC_BYTES[4] = {0x45, 0x67, 0x89, 0xab};  // 0x456789ab, big endian
+
+bool limeIsHeader(const void* head, size_t bytes) {
+  return bytes >= sizeof(LIME_MAGIC_BYTES) && memcmp(head, LIME_MAGIC_BYTES, sizeof(LIME_MAGIC_BYTES)) == 0;
+}
+
+bool limeIsFile(const char* fname) {
+  FILE* fp = fopen(fname, "rb");
+  if (fp == NULL) return false;
+  unsigned char head[sizeof(LIME_MAGIC_BYTES)];
+  const size_t got = fread(head, 1, sizeof(head), fp);
+  fclose(fp);
+  return limeIsHeader(head, got);
+}
+
+#ifdef CCBAR_LIME
+
+// lime-1.3.2 has no C++ guards of its own
+extern "C" {
+#include <lime.h>
+}
+
+bool limeFind(const char* fname, const char* type, int index, LimeRecord& record) {
+  FILE* fp = fopen(fname, "rb");
+  if (fp == NULL) {
+    perror(fname);
+    exit(1);
+  }
+  LimeReader* reader = limeCreateReader(fp);
+  if (reader == NULL) {
+    fprintf(stderr, "Error: %s: cannot create a LIME reader\n", fname);
+    exit(1);
+  }
+
+  bool isFound = false;
+  int status;
+  while ((status = limeReaderNextRecord(reader)) == LIME_SUCCESS) {
+    const int64_t bytes = limeReaderBytes(reader);
+    if (type[0] == '\0') {
+      if (!isFound || bytes > record.bytes) {
+        record.offset = reader->rec_start;
+        record.bytes = bytes;
+        isFound = true;
+      }
+    } else if (strcmp(limeReaderType(reader), type) == 0 && index-- == 0) {
+      record.offset = reader->rec_start;
+      record.bytes = bytes;
+      isFound = true;
+      break;
+    }
+  }
+  if (status != LIME_SUCCESS && status != LIME_EOF) {
+    fprintf(stderr, "Error: %s: corrupt LIME record header (status %d)\n", fname, status);
+    exit(1);
+  }
+
+  limeDestroyReader(reader);
+  fclose(fp);
+  return isFound;
+}
+
+#else
+
+bool limeFind(const char* fname, const char* type, int index, LimeRecord& record) {
+  fprintf(stderr, "Error: Built without LIME (see LIME_PATH in Makefile)\n");
+  exit(1);
+}
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * @file limeio.h
+ * @author Tianchen Zhang
+ * @brief Records of LIME files (ILDG configurations, SciDAC and Bridge++
+ *        output) through the bundled lime-1.3.2 (built only when LIME is
+ *        found, see Makefile). Only the record headers are read; the payload
+ *        is left to dataio.h, which maps it and converts it from big endian.
+ *        Provide 3 functions:
+ *        bool limeIsHeader(): Whether some bytes start with a LIME record header;
+ *        bool limeIsFile(): Whether a file is a LIME file;
+ *        bool limeFind(): Offset and size of the payload of a record
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_LIMEIO_H_
+#define CCBAR_SRC_LIMEIO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Payload of a LIME record
+ */
+struct LimeRecord {
+  int64_t offset = 0;  // From the start of the file
+  int64_t bytes = 0;   // Without the padding to 8 bytes
+};
+
+/**
+ * @brief Whether some bytes start with a LIME record header (the magic
+ *        number, big endian); needs no LIME library
+ */
+bool limeIsHeader(const void* head, size_t bytes);
+
+/**
+ * @brief Whether a file starts with a LIME record header
+ */
+bool limeIsFile(const char* fname);
+
+/**
+ * @brief Find a record by streaming the record headers (payloads are skipped)
+ *
+ * @param fname LIME file
+ * @param type LIME type of the record; "" for the largest record of the file
+ *        (the binary data of an ILDG configuration or a correlator)
+ * @param index Which record of that type, from 0
+ * @param record Payload of the record
+ * @return false if there is no such record
+ */
+bool limeFind(const char* fname, const char* type, int index, LimeRecord& record);
+
+#endif
@@ -15,6 +15,7 @@
 #include <complex>
 #include <valarray>
 
+#include "accum.h"
 #include "dataio.h"
 #include "misc.h"
 
@@ -22,14 +23,16 @@ void usage(char* name) {
   fprintf(stderr, "Mean for raw data (Optional: calculate jackknife variance)\n");
   fprintf(stderr,
           "USAGE: \n"
-          "    %s [OPTIONS] ifname1 ifname2 [ifname3 ...]\n",
+          "    %s [OPTIONS] ifname1 ifname2 [ifname3 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -l <LENGTH>:      Length of data arrays\n"
+          "    -l <LENGTH>:      Length of data arrays (default: from file header)\n"
           "    -o <OFNAME>:      Name of output file\n"
           "    [-jc]:            Calculate jackknife variance (COMPLX)\n"
           "    [-jd]:            Calculate jackknife variance (DOUBLE)\n"
+          "    [-H]:             Write self-describing header to output files\n"
           "    [-h, --help]:     Print help\n");
 }
 
@@ -45,6 +48,7 @@ int main(int argc, char* argv[]) {
   static const char* ofname = NULL;
   bool isJackknifeC = false;
   bool isJackknifeD = false;
+  bool isHeader = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -98,17 +102,37 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
   }
 
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
   const int fileCountTotal = argc;
   if (fileCountTotal < 2) {
     usage(programName);
     exit(1);
   }
 
+  // Length (and lattice sizes) from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !arrayLength) arrayLength = header.arrayLength;
+  if (!arrayLength) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, header.xyzSize, header.tSize);
+
   if (isJackknifeC) {
     jackknifeMeanC(argv, ofname, arrayLength, fileCountTotal);
   } else if (isJackknifeD) {
@@ -122,79 +146,51 @@ int main(int argc, char* argv[]) {
 
 // Custom function definition
 void jackknifeMeanC(char* rawDataList[], const char* result, int arrayLength, int fileCountTotal) {
-  DVARRAY mean(arrayLength), var(arrayLength);
-  mean = var = 0.0;
+  Welford acc;
+  welfordInit(acc, arrayLength);
 
+  // Single pass: mean and variance together
   for (int i = 0; i < fileCountTotal; i++) {
-    CVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
+    const COMPLX* tmp;
+    BinMap inMap;
+    mapBin(rawDataList[i], arrayLength, tmp, inMap);
 
-    DVARRAY rtmp(arrayLength);
-    rtmp = 0.0;
-    keepReal(tmp, rtmp, arrayLength);
-    // varryNorm(tmp, rtmp, arrayLength);
+    welfordPush(acc, tmp);
 
-    mean += rtmp / DOUBLE(fileCountTotal);
+    unmapBin(inMap);
   }
 
-  for (int i = 0; i < fileCountTotal; i++) {
-    CVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
+  COMPLX* out;
+  BinMap outMap;
+  mapBinOut(result, arrayLength, out, outMap);
 
-    DVARRAY rtmp(arrayLength);
-    rtmp = 0.0;
-    keepReal(tmp, rtmp, arrayLength);
-    // varryNorm(tmp, rtmp, arrayLength);
+  welfordJackknife(acc, out);
 
-    var += (rtmp - mean) * (rtmp - mean);
-  }
-
-  var = sqrt(var * DOUBLE(fileCountTotal - 1) / DOUBLE(fileCountTotal));
-
-  CVARRAY out(arrayLength);
-  out = 0.0;
-
-  for (int i = 0; i < arrayLength; i++) {
-    out[i].real(mean[i]);
-    out[i].imag(var[i]);
-  }
-
-  writeBin(result, arrayLength, out);
+  unmapBin(outMap);
 }
 
 void jackknifeMeanD(char* rawDataList[], const char* result, int arrayLength, int fileCountTotal) {
-  DVARRAY mean(arrayLength), var(arrayLength);
-  mean = var = 0.0;
+  Welford acc;
+  welfordInit(acc, arrayLength);
 
+  // Single pass: mean and variance together
   for (int i = 0; i < fileCountTotal; i++) {
-    DVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
+    const DOUBLE* tmp;
+    BinMap inMap;
+    mapBin(rawDataList[i], arrayLength, tmp, inMap);
 
-    mean += tmp / DOUBLE(fileCountTotal);
-  }
+    welfordPush(acc, tmp);
 
-  for (int i = 0; i < fileCountTotal; i++) {
-    DVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
-
-    var += (tmp - mean) * (tmp - mean);
+    unmapBin(inMap);
   }
 
-  var = sqrt(var * DOUBLE(fileCountTotal - 1) / DOUBLE(fileCountTotal));
+  COMPLX* out;
+  BinMap outMap;
+  mapBinOut(result, arrayLength, out, outMap);
 
-  CVARRAY out(arrayLength);
-  out = 0.0;
+  welfordJackknife(acc, out);
 
-  for (int i = 0; i < arrayLength; i++) {
-    out[i].real(mean[i]);
-    out[i].imag(var[i]);
-  }
-
-  writeBin(result, arrayLength, out);
+  unmapBin(outMap);
 }
 
 void arithmeticMean(char* rawDataList[], const char* result, int arrayLength, int fileCountTotal) {
@@ -202,11 +198,13 @@ void arithmeticMean(char* rawDataList[], const char* result, int arrayLength, in
   mean = 0.0;
 
   for (int i = 0; i < fileCountTotal; i++) {
-    CVARRAY tmp(arrayLength);
-    tmp = 0.0;
-    readBin(rawDataList[i], arrayLength, tmp);
+    const COMPLX* tmp;
+    BinMap inMap;
+    mapBin(rawDataList[i], arrayLength, tmp, inMap);
+
+    for (int j = 0; j < arrayLength; j++) mean[j] += tmp[j] / COMPLX(fileCountTotal, 0.0);
 
-    mean += tmp / COMPLX(fileCountTotal, 0.0);
+    unmapBin(inMap);
   }
 
   writeBin(result, arrayLength, mean);
@@ -14,36 +14,57 @@
 #include <stdlib.h>
 #include <string.h>
 
-void addPrefix(const char* origPath, const char* prefix, char* newPath) {
-  char stmp[2048], dir[2048], base[2048], pre[2048];
+// Split origPath into its directory and file name; for a member of an
+// ensemble container ("dir/file.ens#member") or of a virtual jackknife
+// ("dir/file.jk#member") these are the container and the member name
+static void splitPath(const char* origPath, char* dir, char* base) {
+  char stmp[2048];
+  const char* mark = strstr(origPath, ".ens#");
+  int extLength = 4;
+  if (mark == NULL) {
+    mark = strstr(origPath, ".jk#");
+    extLength = 3;
+  }
+
+  if (mark != NULL) {
+    snprintf(dir, 2048, "%.*s", int(mark + extLength - origPath), origPath);
+    strncpy(base, mark + extLength + 1, 2047);
+    return;
+  }
 
-  strncpy(pre, prefix, 2047);
   strncpy(stmp, origPath, 2047);
   strncpy(dir, dirname(stmp), 2047);
   strncpy(stmp, origPath, 2047);
   strncpy(base, basename(stmp), 2047);
+}
+
+// Join directory and file name; members of a container are joined with '#'
+static void joinPath(const char* dir, const char* base, char* newPath) {
+  size_t length = strlen(dir);
+  bool isEns = length > 4 && strcmp(dir + length - 4, ".ens") == 0;
 
-  snprintf(newPath, 2048, "%s/%s.%s", dir, pre, base);
+  snprintf(newPath, 2048, "%s%c%s", dir, isEns ? '#' : '/', base);
 }
 
-void addSuffix(const char* origPath, const char* suffix, char* newPath) {
-  char stmp[2048], dir[2048], base[2048], suf[2048];
+void addPrefix(const char* origPath, const char* prefix, char* newPath) {
+  char dir[2048], base[2048], stmp[4096];
 
-  strncpy(suf, suffix, 2047);
-  strncpy(stmp, origPath, 2047);
-  strncpy(dir, dirname(stmp), 2047);
-  strncpy(stmp, origPath, 2047);
-  strncpy(base, basename(stmp), 2047);
+  splitPath(origPath, dir, base);
+  snprintf(stmp, 4096, "%s.%s", prefix, base);
+  joinPath(dir, stmp, newPath);
+}
+
+void addSuffix(const char* origPath, const char* suffix, char* newPath) {
+  char dir[2048], base[2048], stmp[4096];
 
-  snprintf(newPath, 2048, "%s/%s.%s", dir, base, suf);
+  splitPath(origPath, dir, base);
+  snprintf(stmp, 4096, "%s.%s", base, suffix);
+  joinPath(dir, stmp, newPath);
 }
 
 void changePath(const char* origPath, const char* tarDir, char* newPath) {
-  char stmp[2048], dir[2048], base[2048];
-
-  strncpy(dir, tarDir, 2047);
-  strncpy(stmp, origPath, 2047);
-  strncpy(base, basename(stmp), 2047);
+  char dir[2048], base[2048];
 
-  snprintf(newPath, 2048, "%s/%s", dir, base);
+  splitPath(origPath, dir, base);
+  joinPath(tarDir, base, newPath);
 }
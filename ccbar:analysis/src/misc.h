@@ -6,6 +6,10 @@
  *        void addPrefix(): Add prefix to a file name;
  *        void addSuffix(): Add suffix to a file name;
  *        void changePath(): Change the directory part for a file path.
+ *        A member of an ensemble container ("dir/file.ens#member") counts as
+ *        a file "member" in the directory "dir/file.ens", and a target
+ *        directory ending in ".ens" is a container. Virtual jackknife samples
+ *        ("dir/file.jk#member") are split the same way.
  * @version 1.2
  * @date 2024-07-20
  *
@@ -0,0 +1,400 @@
+/**
+ * @file pipeline.cc
+ * @author Tianchen Zhang
+ * @brief 4-point chain in one process: a1plus -> jre -> prev -> fks-ti/v-ti
+ *        -> mean -jc -> cart2sphr, configured by a spec file; intermediates
+ *        stay in memory unless the spec asks for them
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <complex>
+#include <string>
+#include <valarray>
+#include <vector>
+
+#include "accum.h"
+#include "buffer.h"
+#include "dataio.h"
+#include "lattice.h"
+#include "stencil.h"
+#include "threadpool.h"
+
+void usage(char* name) {
+  fprintf(stderr, "4-point chain (a1plus, jre, prev, fks-ti, v-ti, mean -jc, cart2sphr) in one process\n");
+  fprintf(stderr,
+          "USAGE: \n"
+          "    %s [OPTIONS] specfile\n",
+          name);
+  fprintf(stderr,
+          "OPTIONS: \n"
+          "    [-j <THREADS>]:   Number of threads (default: from spec file, or 1)\n"
+          "    [-H]:             Write self-describing header to output files\n"
+          "    [-h, --help]:     Print help\n");
+  fprintf(stderr,
+          "SPEC FILE: \n"
+          "    One 'key = value' per line, ' #' starts a comment. File names are\n"
+          "    templates: {ch} is ps or v, {t} is +05-style, {bin} is BIN03-style.\n"
+          "    xyzSize = <XYZSIZE>   Spacial size of lattice (default: from file header)\n"
+          "    t = <T1>[-<T2>]       Time slices\n"
+          "    bins = <BINCOUNT>     Bins BIN01 ... (at least 2)\n"
+          "    input = <TEMPLATE>    Raw data ({ch}, {t}, {bin})\n"
+          "    threads = <THREADS>   Number of threads\n"
+          "    reduced = yes|no      Keep only O_h orbit representatives (a1plus -r)\n"
+          "    mdiff = <MDIFF>       (M_V - M_PS) (LUnit), for F_KS\n"
+          "    mps, mv, mc = <MASS>  Meson and quark masses (LUnit), for V0 and Vs\n"
+          "    fks, v0, vs = <TEMPLATE>              Jackknife mean and error ({t})\n"
+          "    fksSphr, v0Sphr, vsSphr = <TEMPLATE>  Same in cart2sphr text form ({t})\n"
+          "    Intermediates, written only when given:\n"
+          "    a1plus, jksamp, prev = <TEMPLATE>              ({ch}, {t}, {bin})\n"
+          "    fksSample, v0Sample, vsSample = <TEMPLATE>     ({t}, {bin})\n");
+}
+
+// Settings read from the spec file
+struct PipeSpec {
+  int xyzSize = 0;
+  int tMin = 0, tMax = -1;
+  int binCount = 0;
+  int threadCount = 0;
+  bool isReduced = false;
+  DOUBLE mdiff = 0.0, mPS = 0.0, mV = 0.0, mc = 0.0;
+  std::string input;
+  std::string a1plus, jksamp, prev;
+  std::string fksSample, v0Sample, vsSample;
+  std::string fks, v0, vs;
+  std::string fksSphr, v0Sphr, vsSphr;
+};
+
+// Custom function declaration
+void readSpec(const char* specFile, PipeSpec& spec);
+std::string fillName(const std::string& pattern, const char* channel, int t, int bin);
+void writeSphr(const char* ofname, const Lattice& lat, const COMPLX* data, bool isReduced);
+void runPipeline(const PipeSpec& spec, int t, const Lattice& lat);
+
+// Main function
+int main(int argc, char* argv[]) {
+  // Global variables
+  int threadCount = 0;
+  bool isHeader = false;
+  char programName[128];
+  strncpy(programName, basename(argv[0]), 127);
+  argc--;
+  argv++;
+
+  // Read options (order irrelevant)
+  while (argc > 0 && argv[0][0] == '-') {
+    // -h and --help: show usage
+    if (strcmp(argv[0], "-h") == 0 || strcmp(argv[0], "--help") == 0) {
+      usage(programName);
+      exit(0);
+    }
+
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
+    usage(programName);
+    exit(1);
+  }
+
+  // Make sure of all needed syntax
+  if (argc != 1) {
+    usage(programName);
+    exit(1);
+  }
+
+  PipeSpec spec;
+  readSpec(argv[0], spec);
+  if (threadCount) spec.threadCount = threadCount;
+  if (!spec.threadCount) spec.threadCount = 1;
+  if (spec.input.empty() || spec.binCount < 2 || spec.tMax < spec.tMin) {
+    fprintf(stderr, "%s: input, bins (at least 2) and t are required\n", argv[0]);
+    exit(1);
+  }
+  if (spec.mdiff == 0.0 && !(spec.fks + spec.fksSphr + spec.fksSample).empty()) {
+    fprintf(stderr, "%s: F_KS needs mdiff\n", argv[0]);
+    exit(1);
+  }
+  if (spec.mc == 0.0 && !(spec.v0 + spec.v0Sphr + spec.v0Sample + spec.vs + spec.vsSphr + spec.vsSample).empty()) {
+    fprintf(stderr, "%s: V0 and Vs need mc (and mps, mv)\n", argv[0]);
+    exit(1);
+  }
+
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  std::string first = fillName(spec.input, "ps", spec.tMin, 1);
+  if (probeBin(first.c_str(), header) && !spec.xyzSize) spec.xyzSize = header.xyzSize;
+  if (!spec.xyzSize) {
+    fprintf(stderr, "%s: xyzSize is required for headerless input\n", argv[0]);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, spec.xyzSize, 0);
+
+  Lattice lat;
+  latticeInit(lat, spec.xyzSize);
+
+  // Main part for calculation
+  for (int t = spec.tMin; t <= spec.tMax; t++) {
+    runPipeline(spec, t, lat);
+  }
+
+  return 0;
+}
+
+// Custom function definition
+void readSpec(const char* specFile, PipeSpec& spec) {
+  FILE* fp = fopen(specFile, "r");
+  if (fp == NULL) {
+    perror(specFile);
+    exit(1);
+  }
+
+  char line[4096];
+  int lineCount = 0;
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    lineCount++;
+
+    // Strip comment ('#' after a blank, so that "file.ens#member" is kept)
+    for (char* mark = line; *mark != '\0'; mark++) {
+      if (*mark == '#' && (mark == line || *(mark - 1) == ' ' || *(mark - 1) == '\t')) {
+        *mark = '\0';
+        break;
+      }
+    }
+    char key[128], value[4096];
+    if (sscanf(line, " %127[^= \t] = %4095s", key, value) != 2) {
+      if (sscanf(line, " %127s", key) == 1) {
+        fprintf(stderr, "%s:%d: Expected 'key = value'\n", specFile, lineCount);
+        exit(1);
+      }
+      continue;
+    }
+
+    if (strcmp(key, "xyzSize") == 0) {
+      spec.xyzSize = atoi(value);
+    } else if (strcmp(key, "t") == 0) {
+      if (sscanf(value, "%d-%d", &spec.tMin, &spec.tMax) == 1) spec.tMax = spec.tMin;
+    } else if (strcmp(key, "bins") == 0) {
+      spec.binCount = atoi(value);
+    } else if (strcmp(key, "threads") == 0) {
+      spec.threadCount = atoi(value);
+    } else if (strcmp(key, "reduced") == 0) {
+      spec.isReduced = strcmp(value, "yes") == 0;
+    } else if (strcmp(key, "mdiff") == 0) {
+      spec.mdiff = atof(value);
+    } else if (strcmp(key, "mps") == 0) {
+      spec.mPS = atof(value);
+    } else if (strcmp(key, "mv") == 0) {
+      spec.mV = atof(value);
+    } else if (strcmp(key, "mc") == 0) {
+      spec.mc = atof(value);
+    } else if (strcmp(key, "input") == 0) {
+      spec.input = value;
+    } else if (strcmp(key, "a1plus") == 0) {
+      spec.a1plus = value;
+    } else if (strcmp(key, "jksamp") == 0) {
+      spec.jksamp = value;
+    } else if (strcmp(key, "prev") == 0) {
+      spec.prev = value;
+    } else if (strcmp(key, "fksSample") == 0) {
+      spec.fksSample = value;
+    } else if (strcmp(key, "v0Sample") == 0) {
+      spec.v0Sample = value;
+    } else if (strcmp(key, "vsSample") == 0) {
+      spec.vsSample = value;
+    } else if (strcmp(key, "fks") == 0) {
+      spec.fks = value;
+    } else if (strcmp(key, "v0") == 0) {
+      spec.v0 = value;
+    } else if (strcmp(key, "vs") == 0) {
+      spec.vs = value;
+    } else if (strcmp(key, "fksSphr") == 0) {
+      spec.fksSphr = value;
+    } else if (strcmp(key, "v0Sphr") == 0) {
+      spec.v0Sphr = value;
+    } else if (strcmp(key, "vsSphr") == 0) {
+      spec.vsSphr = value;
+    } else {
+      fprintf(stderr, "%s:%d: Unknown key '%s'\n", specFile, lineCount, key);
+      exit(1);
+    }
+  }
+
+  fclose(fp);
+}
+
+// Replace {ch}, {t} and {bin} in pattern
+std::string fillName(const std::string& pattern, const char* channel, int t, int bin) {
+  char tName[16], binName[16];
+  snprintf(tName, sizeof(tName), "%+03d", t);
+  snprintf(binName, sizeof(binName), "BIN%02d", bin);
+
+  std::string name;
+  for (size_t i = 0; i < pattern.size(); i++) {
+    if (pattern.compare(i, 4, "{ch}") == 0) {
+      name += channel;
+      i += 3;
+    } else if (pattern.compare(i, 3, "{t}") == 0) {
+      name += tName;
+      i += 2;
+    } else if (pattern.compare(i, 5, "{bin}") == 0) {
+      name += binName;
+      i += 4;
+    } else {
+      name += pattern[i];
+    }
+  }
+  return name;
+}
+
+// Same text as cart2sphr: one line per orbit representative, in its order
+void writeSphr(const char* ofname, const Lattice& lat, const COMPLX* data, bool isReduced) {
+  FILE* fp = fopen(ofname, "w");
+  if (fp == NULL) {
+    perror(ofname);
+    exit(1);
+  }
+
+  const int xyzSize = lat.xyzSize;
+  for (int n = 0; n < lat.orbitCount; n++) {
+    int site = lat.orbitRep[n];
+    int i = site % xyzSize, j = site / xyzSize % xyzSize, k = site / (xyzSize * xyzSize);
+    const COMPLX& value = isReduced ? data[n] : data[site];
+
+    DOUBLE distance = sqrt(pow(DOUBLE(i), 2) + pow(DOUBLE(j), 2) + pow(DOUBLE(k), 2));
+    fprintf(fp, "%1.16e %1.16e %1.16e\n", distance, value.real(), value.imag());
+  }
+
+  fclose(fp);
+}
+
+// All stages for time slice t; arrays of bin b start at b * length
+void runPipeline(const PipeSpec& spec, int t, const Lattice& lat) {
+  const char* channel[2] = {"ps", "v"};
+  const int binCount = spec.binCount;
+  const int arrayLength = spec.isReduced ? lat.orbitCount : lat.siteCount;
+  const size_t length = arrayLength;
+
+  const bool isFks = !(spec.fks + spec.fksSphr + spec.fksSample).empty();
+  const bool isV = !(spec.v0 + spec.v0Sphr + spec.v0Sample + spec.vs + spec.vsSphr + spec.vsSample).empty();
+
+  // a1plus: every raw file is read once
+  std::vector<COMPLX> a1[2];
+  a1[0].resize(binCount * length);
+  a1[1].resize(binCount * length);
+  parallelFor(2 * binCount, spec.threadCount, [&](int n) {
+    const int ch = n / binCount, b = n % binCount;
+    COMPLX* result = &a1[ch][b * length];
+    const COMPLX* tmp;
+    BinMap inMap;
+    mapBin(fillName(spec.input, channel[ch], t, b + 1).c_str(), lat.siteCount, tmp, inMap);
+
+    if (spec.isReduced) {
+      latticeOrbitMean(lat, tmp, result);
+    } else {
+      COMPLX* orbitMean = bufferScratch<COMPLX>(0, lat.orbitCount);
+      latticeOrbitMean(lat, tmp, orbitMean);
+      latticeOrbitScatter(lat, orbitMean, result);
+    }
+    unmapBin(inMap);
+
+    if (!spec.a1plus.empty()) writeBin(fillName(spec.a1plus, channel[ch], t, b + 1).c_str(), arrayLength, result);
+  });
+
+  // jre, first round: sum of all bins, in bin order
+  std::vector<COMPLX> sum[2];
+  for (int ch = 0; ch < 2; ch++) {
+    sum[ch].assign(length, 0.0);
+    for (int b = 0; b < binCount; b++)
+      for (size_t n = 0; n < length; n++) sum[ch][n] += a1[ch][b * length + n];
+  }
+
+  // jre (second round), prev, fks-ti and v-ti per jackknife sample
+  std::vector<COMPLX> fks(isFks ? binCount * length : 0);
+  std::vector<COMPLX> v0(isV ? binCount * length : 0), vs(isV ? binCount * length : 0);
+  parallelFor(binCount, spec.threadCount, [&](int b) {
+    std::vector<COMPLX> sample(length), ppot[2];
+
+    for (int ch = 0; ch < 2; ch++) {
+      for (size_t n = 0; n < length; n++) sample[n] = (sum[ch][n] - a1[ch][b * length + n]) / (binCount - 1.0);
+      if (!spec.jksamp.empty()) {
+        writeBin(fillName(spec.jksamp, channel[ch], t, b + 1).c_str(), arrayLength, sample.data());
+      }
+
+      ppot[ch].resize(length);
+      if (spec.isReduced) {
+        latticePrePotentialOrbit(lat, sample.data(), ppot[ch].data());
+      } else {
+        stencilPrePotential(sample.data(), ppot[ch].data(), lat.xyzSize);
+      }
+      if (!spec.prev.empty()) {
+        writeBin(fillName(spec.prev, channel[ch], t, b + 1).c_str(), arrayLength, ppot[ch].data());
+      }
+    }
+
+    const COMPLX* ppotPS = ppot[0].data();
+    const COMPLX* ppotV = ppot[1].data();
+    const DOUBLE mdiff = spec.mdiff, mPS = spec.mPS, mV = spec.mV, mc = spec.mc;
+    if (isFks) {
+      COMPLX* out = &fks[b * length];
+      for (size_t n = 0; n < length; n++) out[n] = -(ppotV[n] - ppotPS[n]) / mdiff;
+      if (!spec.fksSample.empty()) writeBin(fillName(spec.fksSample, "", t, b + 1).c_str(), arrayLength, out);
+    }
+    if (isV) {
+      COMPLX* out0 = &v0[b * length];
+      COMPLX* outS = &vs[b * length];
+      for (size_t n = 0; n < length; n++) {
+        out0[n] = 1 / (4.0 * mc) * (3.0 * ppotV[n] + ppotPS[n]) + 1 / 4.0 * (3.0 * mV + mPS) - 2.0 * mc;
+        outS[n] = 1 / mc * (ppotV[n] - ppotPS[n]) + (mV - mPS);
+      }
+      if (!spec.v0Sample.empty()) writeBin(fillName(spec.v0Sample, "", t, b + 1).c_str(), arrayLength, out0);
+      if (!spec.vsSample.empty()) writeBin(fillName(spec.vsSample, "", t, b + 1).c_str(), arrayLength, outS);
+    }
+  });
+
+  // mean -jc and cart2sphr
+  struct Result {
+    const std::vector<COMPLX>& samples;
+    const std::string& ofname;
+    const std::string& sphrName;
+  } results[3] = {{fks, spec.fks, spec.fksSphr}, {v0, spec.v0, spec.v0Sphr}, {vs, spec.vs, spec.vsSphr}};
+
+  for (const Result& result : results) {
+    if (result.ofname.empty() && result.sphrName.empty()) continue;
+
+    Welford acc;
+    welfordInit(acc, arrayLength);
+    for (int b = 0; b < binCount; b++) welfordPush(acc, &result.samples[b * length]);
+
+    std::vector<COMPLX> mean(length);
+    welfordJackknife(acc, mean.data());
+
+    if (!result.ofname.empty()) writeBin(fillName(result.ofname, "", t, 0).c_str(), arrayLength, mean.data());
+    if (!result.sphrName.empty()) {
+      writeSphr(fillName(result.sphrName, "", t, 0).c_str(), lat, mean.data(), spec.isReduced);
+    }
+  }
+}
@@ -15,31 +15,58 @@
 #include <complex>
 #include <valarray>
 
-#include "arr2corr.h"
 #include "dataio.h"
+#include "lattice.h"
 #include "misc.h"
+#include "spectral.h"
+#include "stencil.h"
+#include "threadpool.h"
 
 void usage(char* name) {
   fprintf(stderr, "Pre-potential: [▽^2 C(r,t)]/C(r,t)\n");
   fprintf(stderr,
           "USAGE: \n"
-          "    %s [OPTIONS] ifname1 [ifname2 ...]\n",
+          "    %s [OPTIONS] ifname1 [ifname2 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -n <XYZSIZE>:     Spacial size of lattice\n"
-          "    -d <OFDIR>:       Directory of output files\n"
+          "    -n <XYZSIZE>:     Spacial size of lattice (default: from file header)\n"
+          "    -d <OFDIR>:       Directory (or ensemble container *.ens) of output files\n"
+          "    [-j <THREADS>]:   Number of threads (default: 1)\n"
+          "    [-r]:             Input and output are O_h orbit representatives (a1plus -r)\n"
+          "    [-k <KERNEL>]:    Laplacian in momentum space (FFTW): lat (lattice dispersion,\n"
+          "                      same operator as the stencil) or cont (continuum k^2)\n"
+          "    [-w <WISDOM>]:    FFTW wisdom file, loaded before and saved after planning\n"
+          "    [-q <DEPTH>]:     Read up to DEPTH files ahead and write in the background\n"
+          "    [-m <MBYTES>]:    Memory budget of each background queue (default: unlimited)\n"
+          "    [-e <ENC>]:       Encoding of output files: f64 (default), f32 or bf16\n"
+          "    [-z]:             Compress output files (lossless: byte shuffle and LZ)\n"
+          "    [-H]:             Write self-describing header to output files\n"
           "    [-h, --help]:     Print help\n");
 }
 
 // Custom function declaration
-void prePotential(char* rawDataList[], char* ppotList[], int xyzSize, int fileCountTotal);
+void prePotential(char* rawDataList[], char* ppotList[], int xyzSize, int fileCountTotal, int threadCount,
+                  bool isReduced);
+void spectralPotential(char* rawDataList[], char* ppotList[], int xyzSize, int fileCountTotal, int threadCount,
+                       SpectralKernel kernel, const char* wisdomFile);
 
 // Main function
 int main(int argc, char* argv[]) {
   // Global variables
   int xyzSize = 0;
   static const char* ofDir = NULL;
+  int threadCount = 1;
+  bool isReduced = false;
+  bool isSpectral = false;
+  SpectralKernel kernel = SPECTRAL_LATTICE;
+  static const char* wisdomFile = NULL;
+  int queueDepth = 0;  // 0: synchronous I/O
+  long long budgetBytes = -1;
+  BinEncoding encoding = BIN_ENC_F64;
+  bool isHeader = false;
+  bool isCompress = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -77,17 +104,131 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -r: orbit representatives only
+    if (strcmp(argv[0], "-r") == 0) {
+      isReduced = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -k: Laplacian in momentum space
+    if (strcmp(argv[0], "-k") == 0) {
+      if (argv[1] != NULL && strcmp(argv[1], "lat") == 0) {
+        kernel = SPECTRAL_LATTICE;
+      } else if (argv[1] != NULL && strcmp(argv[1], "cont") == 0) {
+        kernel = SPECTRAL_CONTINUUM;
+      } else {
+        usage(programName);
+        exit(1);
+      }
+      isSpectral = true;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -w: FFTW wisdom file
+    if (strcmp(argv[0], "-w") == 0) {
+      wisdomFile = argv[1];
+      if (wisdomFile == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -q: queue depth of asynchronous I/O
+    if (strcmp(argv[0], "-q") == 0) {
+      if (argv[1] == NULL || atoi(argv[1]) < 1) {
+        usage(programName);
+        exit(1);
+      }
+      queueDepth = atoi(argv[1]);
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -m: memory budget (MB) of asynchronous I/O
+    if (strcmp(argv[0], "-m") == 0) {
+      if (argv[1] == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      budgetBytes = atoll(argv[1]) * 1024 * 1024;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -e: encoding of output files
+    if (strcmp(argv[0], "-e") == 0) {
+      if (!parseBinEncoding(argv[1], encoding)) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -z: compress output files
+    if (strcmp(argv[0], "-z") == 0) {
+      isCompress = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
   }
 
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
   const int fileCountTotal = argc;  // # of data files
-  if (fileCountTotal < 1) {
+  if (fileCountTotal < 1 || (isSpectral && isReduced)) {
     usage(programName);
     exit(1);
   }
 
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !xyzSize) xyzSize = header.xyzSize;
+  if (header.layout == BIN_LAYOUT_ORBIT) isReduced = true;
+  if (!xyzSize || (isSpectral && isReduced)) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, xyzSize, 0);
+  setBinEncoding(encoding);
+  setBinCompression(isCompress ? BIN_COMP_LZ : BIN_COMP_NONE, threadCount);
+
   // Create an array to store ofnames
   char* ofnameArr[fileCountTotal];
 
@@ -96,8 +237,14 @@ int main(int argc, char* argv[]) {
     changePath(argv[i], ofDir, ofnameArr[i]);
   }
 
-  // Main part for calculation
-  prePotential(argv, ofnameArr, xyzSize, fileCountTotal);
+  // Main part for calculation (files are handed out in order, so they can be read ahead)
+  prefetchBin(argv, fileCountTotal, queueDepth, budgetBytes);
+  if (isSpectral) {
+    spectralPotential(argv, ofnameArr, xyzSize, fileCountTotal, threadCount, kernel, wisdomFile);
+  } else {
+    prePotential(argv, ofnameArr, xyzSize, fileCountTotal, threadCount, isReduced);
+  }
+  syncBin();
 
   // Finalization for the string arrays
   for (int i = 0; i < fileCountTotal; i++) {
@@ -108,29 +255,53 @@ int main(int argc, char* argv[]) {
 }
 
 // Custom function definition
-void prePotential(char* rawDataList[], char* ppotList[], int xyzSize, int fileCountTotal) {
-  int arrayLength = int(pow(xyzSize, 3));
+void prePotential(char* rawDataList[], char* ppotList[], int xyzSize, int fileCountTotal, int threadCount,
+                  bool isReduced) {
+  Lattice lat;
+  latticeInit(lat, xyzSize);
 
-  for (int i = 0; i < fileCountTotal; i++) {
-    COMPLX tmp[arrayLength], result[arrayLength];
-    for (int j = 0; j < arrayLength; j++)  // Initialize the empty arrays
-    {
-      tmp[j] = result[j] = 0.0;
+  int arrayLength = isReduced ? lat.orbitCount : lat.siteCount;
+
+  parallelFor(fileCountTotal, threadCount, [&](int i) {
+    const COMPLX* tmp;
+    COMPLX* result;
+    BinMap inMap, outMap;
+
+    mapBin(rawDataList[i], arrayLength, tmp, inMap);
+    mapBinOut(ppotList[i], arrayLength, result, outMap);
+
+    if (isReduced) {
+      latticePrePotentialOrbit(lat, tmp, result);
+    } else {
+      stencilPrePotential(tmp, result, xyzSize);
     }
 
-    readBin(rawDataList[i], arrayLength, tmp);
-
-    for (int ix = 0; ix < xyzSize; ix++)
-      for (int iy = 0; iy < xyzSize; iy++)
-        for (int iz = 0; iz < xyzSize; iz++) {
-          // clang-format off
-          CORR(result, ix, iy, iz, xyzSize) = (-6.0 * CORR(tmp, ix, iy, iz, xyzSize)
-          + CORR(tmp, ix + 1, iy, iz, xyzSize) + CORR(tmp, ix - 1, iy, iz, xyzSize)
-          + CORR(tmp, ix, iy + 1, iz, xyzSize) + CORR(tmp, ix, iy - 1, iz, xyzSize)
-          + CORR(tmp, ix, iy, iz + 1, xyzSize) + CORR(tmp, ix, iy, iz - 1, xyzSize)
-          ) / CORR(tmp, ix, iy, iz, xyzSize);
-          // clang-format on
-        }
-    writeBin(ppotList[i], arrayLength, result);
-  }
+    unmapBin(inMap);
+    unmapBin(outMap);
+  });
+}
+
+void spectralPotential(char* rawDataList[], char* ppotList[], int xyzSize, int fileCountTotal, int threadCount,
+                       SpectralKernel kernel, const char* wisdomFile) {
+  int arrayLength = int(pow(xyzSize, 3));
+
+  // Plans are created once and shared by all files (and threads)
+  Spectral sp;
+  spectralInit(sp, xyzSize, kernel, wisdomFile);
+
+  parallelFor(fileCountTotal, threadCount, [&](int i) {
+    const COMPLX* tmp;
+    COMPLX* result;
+    BinMap inMap, outMap;
+
+    mapBin(rawDataList[i], arrayLength, tmp, inMap);
+    mapBinOut(ppotList[i], arrayLength, result, outMap);
+
+    spectralPrePotential(sp, tmp, result);
+
+    unmapBin(inMap);
+    unmapBin(outMap);
+  });
+
+  spectralFinalize(sp);
 }
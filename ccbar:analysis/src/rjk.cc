@@ -0,0 +1,301 @@
+/**
+ * @file rjk.cc
+ * @author Tianchen Zhang
+ * @brief Recursive (nested) jackknife of F_{KS} (time-independent version):
+ *        jre -> prev -> fks-ti -> mean -jc for every outer bin, in memory
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <complex>
+#include <map>
+#include <string>
+#include <valarray>
+#include <vector>
+
+#include "accum.h"
+#include "dataio.h"
+#include "lattice.h"
+#include "misc.h"
+#include "stencil.h"
+#include "threadpool.h"
+
+void usage(char* name) {
+  fprintf(stderr, "Recursive (nested) jackknife of F_{KS} (time-independent version)\n");
+  fprintf(stderr,
+          "USAGE: \n"
+          "    %s [OPTIONS] ifname1 ifname2 [ifname3 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
+          name);
+  fprintf(stderr,
+          "    Inputs are raw (a1plus) data named ps.<ID>.BINxx and v.<ID>.BINxx; every\n"
+          "    <ID> needs the same bins (at least 3) in both channels. For each <ID> and\n"
+          "    outer bin BINxx, the jackknife mean and error of F_KS over the inner\n"
+          "    samples are written to <OFDIR>/<ID>.BINxx\n");
+  fprintf(stderr,
+          "OPTIONS: \n"
+          "    -n <XYZSIZE>:     Spacial size of lattice (default: from file header)\n"
+          "    -m <MDIFF>:       (M_V - M_PS) (LUnit)\n"
+          "    -d <OFDIR>:       Directory (or ensemble container *.ens) of output files\n"
+          "    [-j <THREADS>]:   Number of threads (default: 1)\n"
+          "    [-r]:             Input and output are O_h orbit representatives (a1plus -r)\n"
+          "    [-H]:             Write self-describing header to output files\n"
+          "    [-h, --help]:     Print help\n");
+}
+
+// Bins of one <ID>: bin label -> raw data file of each channel
+struct BinGroup {
+  std::map<std::string, const char*> ps, v;
+};
+
+// Custom function declaration
+void groupFiles(char* fileList[], int fileCountTotal, std::map<std::string, BinGroup>& groups);
+void recursiveJackknife(const std::string& id, const BinGroup& group, const char* ofDir, int xyzSize, DOUBLE mdiff,
+                        int threadCount, bool isReduced);
+
+// Main function
+int main(int argc, char* argv[]) {
+  // Global variables
+  int xyzSize = 0;
+  DOUBLE mdiff = 0.0;
+  static const char* ofDir = NULL;
+  int threadCount = 1;
+  bool isReduced = false;
+  bool isHeader = false;
+  char programName[128];
+  strncpy(programName, basename(argv[0]), 127);
+  argc--;
+  argv++;
+
+  // Read options (order irrelevant)
+  while (argc > 0 && argv[0][0] == '-') {
+    // -h and --help: show usage
+    if (strcmp(argv[0], "-h") == 0 || strcmp(argv[0], "--help") == 0) {
+      usage(programName);
+      exit(0);
+    }
+
+    // -n: xyzSize
+    if (strcmp(argv[0], "-n") == 0) {
+      xyzSize = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (!xyzSize) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -m: mdiff
+    if (strcmp(argv[0], "-m") == 0) {
+      mdiff = atof(argv[1]);  // atof(): convert ASCII string to float
+      if (mdiff == 0.0) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -d: directory for output file
+    if (strcmp(argv[0], "-d") == 0) {
+      ofDir = argv[1];
+      if (ofDir == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -r: reduced (orbit) input and output
+    if (strcmp(argv[0], "-r") == 0) {
+      isReduced = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
+    usage(programName);
+    exit(1);
+  }
+
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
+  const int fileCountTotal = argc;  // # of data files
+  if (fileCountTotal < 2 || mdiff == 0.0 || ofDir == NULL) {
+    usage(programName);
+    exit(1);
+  }
+
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !xyzSize) xyzSize = header.xyzSize;
+  if (header.layout == BIN_LAYOUT_ORBIT) isReduced = true;
+  if (!xyzSize) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, xyzSize, 0);
+
+  std::map<std::string, BinGroup> groups;
+  groupFiles(argv, fileCountTotal, groups);
+
+  // Main part for calculation
+  for (const auto& item : groups) {
+    recursiveJackknife(item.first, item.second, ofDir, xyzSize, mdiff, threadCount, isReduced);
+  }
+
+  return 0;
+}
+
+// Custom function definition
+
+// Sort ps.<ID>.BINxx and v.<ID>.BINxx into groups by <ID>
+void groupFiles(char* fileList[], int fileCountTotal, std::map<std::string, BinGroup>& groups) {
+  for (int i = 0; i < fileCountTotal; i++) {
+    // File name without directory (or container)
+    const char* name = fileList[i];
+    const char* mark = strrchr(name, '/');
+    if (mark != NULL) name = mark + 1;
+    mark = strrchr(name, '#');
+    if (mark != NULL) name = mark + 1;
+
+    const char* firstDot = strchr(name, '.');
+    const char* lastDot = strrchr(name, '.');
+    if (firstDot == NULL || lastDot == firstDot) {
+      fprintf(stderr, "%s: Name is not <ps|v>.<ID>.<BIN>\n", fileList[i]);
+      exit(1);
+    }
+
+    std::string channel(name, firstDot);
+    std::string id(firstDot + 1, lastDot);
+    std::string bin(lastDot + 1);
+
+    BinGroup& group = groups[id];
+    if (channel == "ps") {
+      group.ps[bin] = fileList[i];
+    } else if (channel == "v") {
+      group.v[bin] = fileList[i];
+    } else {
+      fprintf(stderr, "%s: Channel is neither ps nor v\n", fileList[i]);
+      exit(1);
+    }
+  }
+
+  for (const auto& item : groups) {
+    const BinGroup& group = item.second;
+    bool isMatched = group.ps.size() == group.v.size();
+    for (auto p = group.ps.begin(), v = group.v.begin(); isMatched && p != group.ps.end(); ++p, ++v) {
+      isMatched = p->first == v->first;
+    }
+    if (!isMatched || group.ps.size() < 3) {
+      fprintf(stderr, "%s: ps and v need the same bins (at least 3)\n", item.first.c_str());
+      exit(1);
+    }
+  }
+}
+
+// Every raw file is read once; for outer bin i, the inner samples are the
+// jackknife samples of the other bins (what jre makes of them), each goes
+// through prev and fks-ti, and mean -jc of the results is written
+void recursiveJackknife(const std::string& id, const BinGroup& group, const char* ofDir, int xyzSize, DOUBLE mdiff,
+                        int threadCount, bool isReduced) {
+  Lattice lat;
+  latticeInit(lat, xyzSize);
+
+  const int arrayLength = isReduced ? lat.orbitCount : lat.siteCount;
+  const int binCount = group.ps.size();
+  const size_t length = arrayLength;
+
+  std::vector<COMPLX> rawPs(binCount * length), rawV(binCount * length);
+  std::vector<std::string> binList;
+  for (const auto& item : group.ps) {
+    int i = binList.size();
+    readBin(item.second, arrayLength, &rawPs[i * length]);
+    readBin(group.v.at(item.first), arrayLength, &rawV[i * length]);
+    binList.push_back(item.first);
+  }
+
+  parallelFor(binCount, threadCount, [&](int i) {
+    std::vector<COMPLX> sumPs(length, 0.0), sumV(length, 0.0);
+    std::vector<COMPLX> sampPs(length), sampV(length), ppotPs(length), ppotV(length), fks(length);
+    Welford acc;
+    welfordInit(acc, arrayLength);
+
+    // Sum of the bins left in the outer sample, in file order as jre does
+    for (int k = 0; k < binCount; k++) {
+      if (k == i) continue;
+      for (size_t n = 0; n < length; n++) {
+        sumPs[n] += rawPs[k * length + n];
+        sumV[n] += rawV[k * length + n];
+      }
+    }
+
+    for (int j = 0; j < binCount; j++) {
+      if (j == i) continue;
+
+      // jre
+      for (size_t n = 0; n < length; n++) {
+        sampPs[n] = (sumPs[n] - rawPs[j * length + n]) / (binCount - 2.0);
+        sampV[n] = (sumV[n] - rawV[j * length + n]) / (binCount - 2.0);
+      }
+
+      // prev
+      if (isReduced) {
+        latticePrePotentialOrbit(lat, sampPs.data(), ppotPs.data());
+        latticePrePotentialOrbit(lat, sampV.data(), ppotV.data());
+      } else {
+        stencilPrePotential(sampPs.data(), ppotPs.data(), xyzSize);
+        stencilPrePotential(sampV.data(), ppotV.data(), xyzSize);
+      }
+
+      // fks-ti
+      for (size_t n = 0; n < length; n++) fks[n] = -(ppotV[n] - ppotPs[n]) / mdiff;
+
+      welfordPush(acc, fks.data());
+    }
+
+    // mean -jc
+    char ofname[2048];
+    COMPLX* out;
+    BinMap outMap;
+    changePath((id + "." + binList[i]).c_str(), ofDir, ofname);
+    mapBinOut(ofname, arrayLength, out, outMap);
+
+    welfordJackknife(acc, out);
+
+    unmapBin(outMap);
+  });
+}
@@ -0,0 +1,102 @@
+/**
+ * @file spectral.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "spectral.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <complex>
+#include <vector>
+
+#include "alias.h"
+#include "buffer.h"
+
+#ifdef CCBAR_FFTW
+
+#include <fftw3.h>
+
+void spectralInit(Spectral& sp, int xyzSize, SpectralKernel kernel, const char* wisdomFile) {
+  sp.xyzSize = xyzSize;
+  sp.siteCount = xyzSize * xyzSize * xyzSize;
+  sp.wisdomFile = wisdomFile;
+
+  // Momentum of each mode, n > L/2 folded to negative k
+  std::vector<DOUBLE> k2(xyzSize);
+  for (int n = 0; n < xyzSize; n++) {
+    DOUBLE k = 2.0 * M_PI * (n <= xyzSize / 2 ? n : n - xyzSize) / xyzSize;
+    k2[n] = (kernel == SPECTRAL_LATTICE) ? 4.0 * sin(k / 2.0) * sin(k / 2.0) : k * k;
+  }
+
+  sp.minusK2.resize(sp.siteCount);
+  for (int nz = 0; nz < xyzSize; nz++)
+    for (int ny = 0; ny < xyzSize; ny++)
+      for (int nx = 0; nx < xyzSize; nx++) {
+        sp.minusK2[nx + xyzSize * (ny + xyzSize * nz)] = -(k2[nx] + k2[ny] + k2[nz]) / sp.siteCount;
+      }
+
+  if (wisdomFile != NULL) fftw_import_wisdom_from_filename(wisdomFile);
+
+  // FFTW_MEASURE overwrites the arrays, so plan on scratch buffers; the
+  // plans are later applied to other (equally aligned) arrays
+  fftw_complex* in = fftw_alloc_complex(sp.siteCount);
+  fftw_complex* out = fftw_alloc_complex(sp.siteCount);
+  sp.forward = fftw_plan_dft_3d(xyzSize, xyzSize, xyzSize, in, out, FFTW_FORWARD, FFTW_MEASURE);
+  sp.backward = fftw_plan_dft_3d(xyzSize, xyzSize, xyzSize, out, out, FFTW_BACKWARD, FFTW_MEASURE);
+  fftw_free(in);
+  fftw_free(out);
+
+  if (sp.forward == NULL || sp.backward == NULL) {
+    fprintf(stderr, "Error: Failed to create FFTW plans for L = %d\n", xyzSize);
+    exit(1);
+  }
+}
+
+void spectralPrePotential(const Spectral& sp, const COMPLX* data, COMPLX* result) {
+  // Reused by every file this thread transforms (64-byte aligned, as FFTW wants)
+  fftw_complex* work = bufferScratch<fftw_complex>(0, sp.siteCount);
+  if (fftw_alignment_of((double*)data) != 0) {
+    fprintf(stderr, "Error: Input array is not aligned for FFTW\n");
+    exit(1);
+  }
+
+  // Out-of-place complex DFTs leave the input untouched
+  fftw_execute_dft((fftw_plan)sp.forward, (fftw_complex*)data, work);
+
+  COMPLX* ck = (COMPLX*)work;
+  for (int i = 0; i < sp.siteCount; i++) ck[i] *= sp.minusK2[i];
+
+  fftw_execute_dft((fftw_plan)sp.backward, work, work);
+
+  for (int i = 0; i < sp.siteCount; i++) result[i] = ck[i] / data[i];
+}
+
+void spectralFinalize(Spectral& sp) {
+  if (sp.wisdomFile != NULL && !fftw_export_wisdom_to_filename(sp.wisdomFile)) {
+    fprintf(stderr, "Warning: Failed to save FFTW wisdom to %s\n", sp.wisdomFile);
+  }
+
+  fftw_destroy_plan((fftw_plan)sp.forward);
+  fftw_destroy_plan((fftw_plan)sp.backward);
+  sp.forward = sp.backward = NULL;
+}
+
+#else
+
+void spectralInit(Spectral& sp, int xyzSize, SpectralKernel kernel, const char* wisdomFile) {
+  fprintf(stderr, "Error: Built without FFTW (see FFTW_PATH in Makefile)\n");
+  exit(1);
+}
+
+void spectralPrePotential(const Spectral& sp, const COMPLX* data, COMPLX* result) {}
+
+void spectralFinalize(Spectral& sp) {}
+
+#endif
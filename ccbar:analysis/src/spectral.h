@@ -0,0 +1,70 @@
+/**
+ * @file spectral.h
+ * @author Tianchen Zhang
+ * @brief Laplacian in momentum space with FFTW (built only when FFTW is
+ *        found, see Makefile).
+ *        Provide 3 functions:
+ *        void spectralInit(): Create (or load from wisdom) the FFTW plans;
+ *        void spectralPrePotential(): [▽^2 C]/C of one array;
+ *        void spectralFinalize(): Save wisdom and destroy the plans
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_SPECTRAL_H_
+#define CCBAR_SRC_SPECTRAL_H_
+
+#include <complex>
+#include <vector>
+
+#include "alias.h"
+
+/**
+ * @brief Momentum-space form of the Laplacian
+ */
+enum SpectralKernel {
+  SPECTRAL_LATTICE,   // -sum_i 4 sin^2(k_i/2): same operator as the 7-point stencil
+  SPECTRAL_CONTINUUM  // -k^2 with k in (-pi, pi]: spectrally accurate derivative
+};
+
+/**
+ * @brief FFTW plans and the Laplacian in momentum space, shared by all files
+ */
+struct Spectral {
+  int xyzSize = 0;
+  int siteCount = 0;
+  const char* wisdomFile = NULL;
+  std::vector<DOUBLE> minusK2;  // Laplacian in momentum space, divided by L^3
+  void* forward = NULL;         // fftw_plan (opaque here)
+  void* backward = NULL;        // fftw_plan (opaque here)
+};
+
+/**
+ * @brief Create the FFTW plans with FFTW_MEASURE (reusing wisdom if present)
+ *
+ * @param sp Plans and kernel
+ * @param xyzSize Spacial size of lattice
+ * @param kernel Momentum-space form of the Laplacian
+ * @param wisdomFile File to load/save FFTW wisdom, NULL for none
+ */
+void spectralInit(Spectral& sp, int xyzSize, SpectralKernel kernel, const char* wisdomFile);
+
+/**
+ * @brief Pre-potential [▽^2 C]/C computed in momentum space; safe to call
+ *        from several threads at once
+ *
+ * @param sp Plans and kernel
+ * @param data Input array (L^3)
+ * @param result Output array (L^3)
+ */
+void spectralPrePotential(const Spectral& sp, const COMPLX* data, COMPLX* result);
+
+/**
+ * @brief Save wisdom (if a wisdom file was given) and destroy the plans
+ *
+ * @param sp Plans and kernel
+ */
+void spectralFinalize(Spectral& sp);
+
+#endif
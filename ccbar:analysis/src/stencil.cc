@@ -0,0 +1,139 @@
+/**
+ * @file stencil.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "stencil.h"
+
+#include <immintrin.h>
+
+#include <complex>
+
+#include "alias.h"
+
+StencilIsa stencilDetect() {
+  static const StencilIsa isa = __builtin_cpu_supports("avx512f")                                    ? STENCIL_AVX512
+                                : __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? STENCIL_AVX2
+                                                                                                    : STENCIL_SCALAR;
+  return isa;
+}
+
+const char* stencilIsaName(StencilIsa isa) {
+  switch (isa) {
+    case STENCIL_AVX512:
+      return "avx512";
+    case STENCIL_AVX2:
+      return "avx2";
+    default:
+      return "scalar";
+  }
+}
+
+// Neighbour lines of one x-line: center, x-line at y±1 and at z±1
+struct Lines {
+  const DOUBLE *c, *yp, *ym, *zp, *zm;
+};
+
+// (sum of neighbours - 6 c) / c for element x of the line; the complex
+// division is written out as s * conj(c) / |c|^2 like in the vector paths
+static inline void siteScalar(const Lines& l, DOUBLE* out, int x, int xp, int xm) {
+  const DOUBLE cr = l.c[2 * x], ci = l.c[2 * x + 1];
+  const DOUBLE sr = -6.0 * cr + l.c[2 * xp] + l.c[2 * xm] + l.yp[2 * x] + l.ym[2 * x] + l.zp[2 * x] + l.zm[2 * x];
+  const DOUBLE si = -6.0 * ci + l.c[2 * xp + 1] + l.c[2 * xm + 1] + l.yp[2 * x + 1] + l.ym[2 * x + 1] +
+                    l.zp[2 * x + 1] + l.zm[2 * x + 1];
+  const DOUBLE den = cr * cr + ci * ci;
+  out[2 * x] = (sr * cr + si * ci) / den;
+  out[2 * x + 1] = (si * cr - sr * ci) / den;
+}
+
+// Periodic ends of a line and the scalar tail
+static inline void lineEnds(const Lines& l, DOUBLE* out, int L, int from) {
+  siteScalar(l, out, 0, 1 % L, L - 1);
+  for (int x = from; x < L - 1; x++) siteScalar(l, out, x, x + 1, x - 1);
+  if (L > 1) siteScalar(l, out, L - 1, 0, L - 2);
+}
+
+static void lineScalar(const Lines& l, DOUBLE* out, int L) { lineEnds(l, out, L, 1); }
+
+__attribute__((target("avx2,fma"))) static void lineAvx2(const Lines& l, DOUBLE* out, int L) {
+  const __m256d minus6 = _mm256_set1_pd(-6.0);
+  int x = 1;
+  // 2 complex numbers per vector
+  for (; x + 2 <= L - 1; x += 2) {
+    __m256d c = _mm256_loadu_pd(l.c + 2 * x);
+    __m256d s = _mm256_mul_pd(minus6, c);
+    s = _mm256_add_pd(s, _mm256_loadu_pd(l.c + 2 * (x + 1)));
+    s = _mm256_add_pd(s, _mm256_loadu_pd(l.c + 2 * (x - 1)));
+    s = _mm256_add_pd(s, _mm256_loadu_pd(l.yp + 2 * x));
+    s = _mm256_add_pd(s, _mm256_loadu_pd(l.ym + 2 * x));
+    s = _mm256_add_pd(s, _mm256_loadu_pd(l.zp + 2 * x));
+    s = _mm256_add_pd(s, _mm256_loadu_pd(l.zm + 2 * x));
+
+    // s / c = s * conj(c) / |c|^2
+    __m256d cRe = _mm256_movedup_pd(c);             // (cr, cr)
+    __m256d cIm = _mm256_permute_pd(c, 0xF);        // (ci, ci)
+    __m256d sSwap = _mm256_permute_pd(s, 0x5);      // (si, sr)
+    __m256d t = _mm256_mul_pd(sSwap, cIm);          // (si ci, sr ci)
+    __m256d num = _mm256_fmsubadd_pd(s, cRe, t);    // (sr cr + si ci, si cr - sr ci)
+    __m256d c2 = _mm256_mul_pd(c, c);               // (cr^2, ci^2)
+    __m256d den = _mm256_add_pd(c2, _mm256_permute_pd(c2, 0x5));
+    _mm256_storeu_pd(out + 2 * x, _mm256_div_pd(num, den));
+  }
+  lineEnds(l, out, L, x);
+}
+
+__attribute__((target("avx512f"))) static void lineAvx512(const Lines& l, DOUBLE* out, int L) {
+  const __m512d minus6 = _mm512_set1_pd(-6.0);
+  int x = 1;
+  // 4 complex numbers per vector
+  for (; x + 4 <= L - 1; x += 4) {
+    __m512d c = _mm512_loadu_pd(l.c + 2 * x);
+    __m512d s = _mm512_mul_pd(minus6, c);
+    s = _mm512_add_pd(s, _mm512_loadu_pd(l.c + 2 * (x + 1)));
+    s = _mm512_add_pd(s, _mm512_loadu_pd(l.c + 2 * (x - 1)));
+    s = _mm512_add_pd(s, _mm512_loadu_pd(l.yp + 2 * x));
+    s = _mm512_add_pd(s, _mm512_loadu_pd(l.ym + 2 * x));
+    s = _mm512_add_pd(s, _mm512_loadu_pd(l.zp + 2 * x));
+    s = _mm512_add_pd(s, _mm512_loadu_pd(l.zm + 2 * x));
+
+    // s / c = s * conj(c) / |c|^2
+    __m512d cRe = _mm512_movedup_pd(c);
+    __m512d cIm = _mm512_permute_pd(c, 0xFF);
+    __m512d sSwap = _mm512_permute_pd(s, 0x55);
+    __m512d t = _mm512_mul_pd(sSwap, cIm);
+    __m512d num = _mm512_fmsubadd_pd(s, cRe, t);
+    __m512d c2 = _mm512_mul_pd(c, c);
+    __m512d den = _mm512_add_pd(c2, _mm512_permute_pd(c2, 0x55));
+    _mm512_storeu_pd(out + 2 * x, _mm512_div_pd(num, den));
+  }
+  lineEnds(l, out, L, x);
+}
+
+void stencilPrePotential(const COMPLX* data, COMPLX* result, int xyzSize) {
+  stencilPrePotential(data, result, xyzSize, stencilDetect());
+}
+
+void stencilPrePotential(const COMPLX* data, COMPLX* result, int xyzSize, StencilIsa isa) {
+  const int L = xyzSize;
+  const DOUBLE* d = (const DOUBLE*)data;
+  void (*line)(const Lines&, DOUBLE*, int) =
+      isa == STENCIL_AVX512 ? lineAvx512 : isa == STENCIL_AVX2 ? lineAvx2 : lineScalar;
+
+  for (int iz = 0; iz < L; iz++) {
+    const int zp = (iz + 1) % L, zm = (iz - 1 + L) % L;
+    for (int iy = 0; iy < L; iy++) {
+      const int yp = (iy + 1) % L, ym = (iy - 1 + L) % L;
+      Lines l;
+      l.c = d + 2 * L * (iy + L * iz);
+      l.yp = d + 2 * L * (yp + L * iz);
+      l.ym = d + 2 * L * (ym + L * iz);
+      l.zp = d + 2 * L * (iy + L * zp);
+      l.zm = d + 2 * L * (iy + L * zm);
+      line(l, (DOUBLE*)(result + L * (iy + L * iz)), L);
+    }
+  }
+}
@@ -0,0 +1,49 @@
+/**
+ * @file stencil.h
+ * @author Tianchen Zhang
+ * @brief Vectorized 7-point Laplacian for the pre-potential [▽^2 C]/C.
+ *        x-lines are processed as contiguous vectors (AVX-512, AVX2 or
+ *        scalar, chosen at runtime); x = 0 and x = L-1 are done separately.
+ *        Provide 3 functions:
+ *        StencilIsa stencilDetect(): Best instruction set of this CPU;
+ *        const char* stencilIsaName(): Name of an instruction set;
+ *        void stencilPrePotential(): [▽^2 C]/C of one array
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_STENCIL_H_
+#define CCBAR_SRC_STENCIL_H_
+
+#include <complex>
+
+#include "alias.h"
+
+enum StencilIsa { STENCIL_SCALAR, STENCIL_AVX2, STENCIL_AVX512 };
+
+/**
+ * @brief Best instruction set supported by this CPU
+ *
+ * @return STENCIL_AVX512, STENCIL_AVX2 or STENCIL_SCALAR
+ */
+StencilIsa stencilDetect();
+
+/**
+ * @brief Name of an instruction set ("avx512", "avx2" or "scalar")
+ */
+const char* stencilIsaName(StencilIsa isa);
+
+/**
+ * @brief Pre-potential [▽^2 C]/C with the 7-point stencil; the division by
+ *        the center value is fused into the same pass
+ *
+ * @param data Input array (L^3)
+ * @param result Output array (L^3)
+ * @param xyzSize Spacial size of lattice
+ * @param isa Instruction set (default: best available)
+ */
+void stencilPrePotential(const COMPLX* data, COMPLX* result, int xyzSize);
+void stencilPrePotential(const COMPLX* data, COMPLX* result, int xyzSize, StencilIsa isa);
+
+#endif
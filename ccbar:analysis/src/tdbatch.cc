@@ -0,0 +1,105 @@
+/**
+ * @file tdbatch.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "tdbatch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include "alias.h"
+#include "buffer.h"
+#include "dataio.h"
+#include "misc.h"
+#include "threadpool.h"
+
+// "<ch>.<t>.<CONF>" in dir
+static std::string sliceName(const char* dir, const char* channel, int t, const std::string& conf) {
+  char name[2048], path[2048];
+  snprintf(name, sizeof(name), "%s.%+03d.%s", channel, t, conf.c_str());
+  changePath(name, dir, path);
+  return path;
+}
+
+// Configurations: what follows "ps.<tMin>." in the pre-potential names
+static void listConfs(const char* prevDir, int tMin, std::vector<std::string>& confList) {
+  char pattern[64];
+  snprintf(pattern, sizeof(pattern), "ps.%+03d.*", tMin);
+  std::vector<std::string> names;
+  listBin(prevDir, pattern, names);
+  if (names.empty()) {
+    fprintf(stderr, "%s: No files matching %s\n", prevDir, pattern);
+    exit(1);
+  }
+
+  for (const std::string& name : names) confList.push_back(name.substr(strlen(pattern) - 1));
+}
+
+bool tdBatchProbe(const char* prevDir, int tMin, BinHeader& header) {
+  std::vector<std::string> confList;
+  listConfs(prevDir, tMin, confList);
+  return probeBin(sliceName(prevDir, "ps", tMin, confList[0]).c_str(), header);
+}
+
+void tdBatch(const char* corrDir, const char* prevDir, int tMin, int tMax, int arrayLength, int threadCount,
+             const TdKernel& kernel) {
+  std::vector<std::string> confList;
+  listConfs(prevDir, tMin, confList);
+
+  const int confCount = confList.size();
+
+  // Sliding window: correlators of time slice s (both channels, all
+  // configurations) live in slot s % 3 until s + 3 needs the slot
+  const size_t length = arrayLength;
+  const size_t sliceLength = 2 * confCount * length;  // [channel][configuration][site]
+  Buffer windowBuf;  // Large: huge pages where available
+  bufferAlloc(windowBuf, 3 * sliceLength * sizeof(COMPLX));
+  COMPLX* window = (COMPLX*)windowBuf.addr;
+  int slotTime[3] = {-1, -1, -1};
+
+  auto corr = [&](int s, int ch, int conf) {
+    return &window[(s % 3) * sliceLength + (ch * confCount + conf) * length];
+  };
+  auto load = [&](int s) {
+    if (slotTime[s % 3] == s) return;
+    parallelFor(2 * confCount, threadCount, [&](int n) {
+      const int ch = n / confCount, conf = n % confCount;
+      readBin(sliceName(corrDir, ch == 0 ? "v" : "ps", s, confList[conf]).c_str(), arrayLength, corr(s, ch, conf));
+    });
+    slotTime[s % 3] = s;
+  };
+
+  for (int t = tMin; t <= tMax; t++) {
+    load(t - 1);
+    load(t + 1);
+
+    parallelFor(confCount, threadCount, [&](int conf) {
+      const COMPLX *ppotV, *ppotPS;
+      BinMap mapV, mapPS;
+      mapBin(sliceName(prevDir, "v", t, confList[conf]).c_str(), arrayLength, ppotV, mapV);
+      mapBin(sliceName(prevDir, "ps", t, confList[conf]).c_str(), arrayLength, ppotPS, mapPS);
+
+      const COMPLX* const data[6] = {corr(t - 1, 0, conf), corr(t + 1, 0, conf), corr(t - 1, 1, conf),
+                                     corr(t + 1, 1, conf), ppotV, ppotPS};
+
+      char name[2048];
+      snprintf(name, sizeof(name), "%+03d.%s", t, confList[conf].c_str());
+      kernel(name, data);
+
+      unmapBin(mapV);
+      unmapBin(mapPS);
+    });
+  }
+
+  bufferFree(windowBuf);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file tdbatch.h
+ * @author Tianchen Zhang
+ * @brief Batch driver for the time-dependent tools (fks-td, v-td): all
+ *        configurations and a range of time slices in one run, with a sliding
+ *        window of three time slices so that each correlator is read once.
+ *        Provide 2 functions:
+ *        bool tdBatchProbe(): Read the header of the first file of a batch;
+ *        void tdBatch(): Run a kernel for every configuration and time slice
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_TDBATCH_H_
+#define CCBAR_SRC_TDBATCH_H_
+
+#include <complex>
+#include <functional>
+
+#include "alias.h"
+#include "dataio.h"
+
+/**
+ * @brief Kernel of a time-dependent tool
+ *
+ * @param name Output name for this configuration and time slice: <t>.<CONF>
+ * @param data CV(t-1), CV(t+1), CPS(t-1), CPS(t+1), ppotV(t), ppotPS(t)
+ */
+typedef std::function<void(const char* name, const COMPLX* const data[6])> TdKernel;
+
+/**
+ * @brief Read the header of the first pre-potential of a batch, if any
+ *
+ * @param prevDir Directory (or ensemble container) of the pre-potentials
+ * @param tMin First time slice
+ * @param header Filled when the file has a header
+ * @return true if the file has a valid header
+ */
+bool tdBatchProbe(const char* prevDir, int tMin, BinHeader& header);
+
+/**
+ * @brief Run kernel for every configuration and every t in [tMin, tMax].
+ *        Files are named as jre and prev write them: <ch>.<t>.<CONF> with
+ *        <ch> ps or v and <t> like "+05"; the configurations are those of
+ *        ps.<tMin>.* in prevDir. Configurations run in parallel.
+ *
+ * @param corrDir Directory (or ensemble container) of the correlators
+ * @param prevDir Directory (or ensemble container) of the pre-potentials
+ * @param tMin First time slice (at least 1)
+ * @param tMax Last time slice
+ * @param arrayLength Total of complex numbers per file
+ * @param threadCount Number of threads
+ * @param kernel Called once per configuration and time slice
+ */
+void tdBatch(const char* corrDir, const char* prevDir, int tMin, int tMax, int arrayLength, int threadCount,
+             const TdKernel& kernel);
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file threadpool.cc
+ * @author Tianchen Zhang
+ * @brief
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#include "threadpool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class ThreadPool {
+ public:
+  void run(int taskCount, int threadCount, const std::function<void(int)>& task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (int(workers_.size()) < threadCount - 1) {
+      workers_.emplace_back([this] { workerLoop(); });
+    }
+
+    task_ = &task;
+    taskCount_ = taskCount;
+    next_ = 0;
+    seats_ = threadCount - 1;
+    generation_++;
+    lock.unlock();
+    wakeCv_.notify_all();
+
+    drain();  // The calling thread works as well
+
+    lock.lock();
+    doneCv_.wait(lock, [this] { return active_ == 0; });
+    seats_ = 0;
+    task_ = nullptr;
+  }
+
+ private:
+  void drain() {
+    for (int i = next_++; i < taskCount_; i = next_++) (*task_)(i);
+  }
+
+  void workerLoop() {
+    long seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wakeCv_.wait(lock, [&] { return generation_ != seen; });
+      seen = generation_;
+      if (seats_ == 0) continue;
+      seats_--;
+      active_++;
+      lock.unlock();
+
+      drain();
+
+      lock.lock();
+      if (--active_ == 0) doneCv_.notify_all();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable wakeCv_, doneCv_;
+  std::vector<std::thread> workers_;
+  const std::function<void(int)>* task_ = nullptr;
+  int taskCount_ = 0;
+  std::atomic<int> next_{0};
+  int seats_ = 0;
+  int active_ = 0;
+  long generation_ = 0;
+};
+
+}  // namespace
+
+void parallelFor(int taskCount, int threadCount, const std::function<void(int)>& task) {
+  // Inside a task (e.g. chunks of a file in a per-file loop) the pool is busy
+  static thread_local bool isInTask = false;
+  if (threadCount <= 1 || taskCount <= 1 || isInTask) {
+    for (int i = 0; i < taskCount; i++) task(i);
+    return;
+  }
+
+  // Never destroyed: workers may still be blocked when exit() runs
+  static ThreadPool* pool = new ThreadPool;
+  static std::mutex runMutex;
+  std::lock_guard<std::mutex> lock(runMutex);
+
+  pool->run(taskCount, threadCount, [&](int i) {
+    isInTask = true;
+    task(i);
+    isInTask = false;
+  });
+}
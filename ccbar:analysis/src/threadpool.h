@@ -0,0 +1,30 @@
+/**
+ * @file threadpool.h
+ * @author Tianchen Zhang
+ * @brief Shared thread pool for the per-file loops of the batch tools.
+ *        Provide 1 function:
+ *        void parallelFor(): Run task(i) for all i in [0, taskCount)
+ * @version 1.2
+ * @date 2024-07-20
+ *
+ */
+
+#ifndef CCBAR_SRC_THREADPOOL_H_
+#define CCBAR_SRC_THREADPOOL_H_
+
+#include <functional>
+
+/**
+ * @brief Run task(i) for all i in [0, taskCount) on up to threadCount threads
+ *        (the calling thread included) and return when all tasks are done.
+ *        Tasks are handed out one at a time, so uneven files balance out.
+ *        The worker threads are created once and reused by later calls;
+ *        calls from inside a task run serially.
+ *
+ * @param taskCount Number of tasks (usually the number of files)
+ * @param threadCount Number of threads; 1 runs everything serially
+ * @param task The task to run for each index
+ */
+void parallelFor(int taskCount, int threadCount, const std::function<void(int)>& task);
+
+#endif
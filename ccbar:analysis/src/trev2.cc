@@ -15,30 +15,43 @@
 #include <complex>
 #include <valarray>
 
+#include "buffer.h"
 #include "dataio.h"
 #include "misc.h"
+#include "threadpool.h"
 
 void usage(char* name) {
   fprintf(stderr, "Time reversal for 2-point correlators\n");
   fprintf(stderr,
           "USAGE: \n"
-          "    %s [OPTIONS] ifname1 [ifname2 ...]\n",
+          "    %s [OPTIONS] ifname1 [ifname2 ...]\n"
+          "    (ifname may be file.ens or file.ens#PATTERN: members of an ensemble container)\n",
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -n <TSIZE>:       Temporal size of lattice\n"
-          "    -d <OFDIR>:       Directory of output files\n"
+          "    -n <TSIZE>:       Temporal size of lattice (default: from file header)\n"
+          "    -d <OFDIR>:       Directory (or ensemble container *.ens) of output files\n"
+          "    [-j <THREADS>]:   Number of threads (default: 1)\n"
+          "    [-q <DEPTH>]:     Read up to DEPTH files ahead and write in the background\n"
+          "    [-m <MBYTES>]:    Memory budget of each background queue (default: unlimited)\n"
+          "    [-z]:             Compress output files (lossless: byte shuffle and LZ)\n"
+          "    [-H]:             Write self-describing header to output files\n"
           "    [-h, --help]:     Print help\n");
 }
 
 // Custom function declaration
-void timeReverse2pt(char* rawDataList[], char* tr2ptList[], int tSize, int fileCountTotal);
+void timeReverse2pt(char* rawDataList[], char* tr2ptList[], int tSize, int fileCountTotal, int threadCount);
 
 // Main function
 int main(int argc, char* argv[]) {
   // Global variables
   int tSize = 0;
   static const char* ofDir = NULL;
+  int threadCount = 1;
+  int queueDepth = 0;  // 0: synchronous I/O
+  long long budgetBytes = -1;
+  bool isHeader = false;
+  bool isCompress = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -76,17 +89,82 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -j: number of threads
+    if (strcmp(argv[0], "-j") == 0) {
+      threadCount = atoi(argv[1]);  // atoi(): convert ASCII string to integer
+      if (threadCount < 1) {
+        usage(programName);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -q: queue depth of asynchronous I/O
+    if (strcmp(argv[0], "-q") == 0) {
+      if (argv[1] == NULL || atoi(argv[1]) < 1) {
+        usage(programName);
+        exit(1);
+      }
+      queueDepth = atoi(argv[1]);
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -m: memory budget (MB) of asynchronous I/O
+    if (strcmp(argv[0], "-m") == 0) {
+      if (argv[1] == NULL) {
+        usage(programName);
+        exit(1);
+      }
+      budgetBytes = atoll(argv[1]) * 1024 * 1024;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    // -z: compress output files
+    if (strcmp(argv[0], "-z") == 0) {
+      isCompress = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
   }
 
+  // Members of ensemble containers count as files
+  expandBin(argc, argv);
+
   const int fileCountTotal = argc;  // # of data files
   if (fileCountTotal < 1) {
     usage(programName);
     exit(1);
   }
 
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !tSize) tSize = header.tSize;
+  if (!tSize) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, 0, tSize);
+  setBinCompression(isCompress ? BIN_COMP_LZ : BIN_COMP_NONE, threadCount);
+
   // Create an array to store ofnames
   char* ofnameArr[fileCountTotal];
 
@@ -95,8 +173,10 @@ int main(int argc, char* argv[]) {
     changePath(argv[i], ofDir, ofnameArr[i]);
   }
 
-  // Main part for calculation
-  timeReverse2pt(argv, ofnameArr, tSize, fileCountTotal);
+  // Main part for calculation (files are handed out in order, so they can be read ahead)
+  prefetchBin(argv, fileCountTotal, queueDepth, budgetBytes);
+  timeReverse2pt(argv, ofnameArr, tSize, fileCountTotal, threadCount);
+  syncBin();
 
   // Finalization for the string arrays
   for (int i = 0; i < fileCountTotal; i++) {
@@ -107,9 +187,10 @@ int main(int argc, char* argv[]) {
 }
 
 // Custom function definition
-void timeReverse2pt(char* rawDataList[], char* tr2ptList[], int tSize, int fileCountTotal) {
-  for (int i = 0; i < fileCountTotal; i++) {
-    COMPLX raw[tSize], data[tSize];
+void timeReverse2pt(char* rawDataList[], char* tr2ptList[], int tSize, int fileCountTotal, int threadCount) {
+  parallelFor(fileCountTotal, threadCount, [&](int i) {
+    COMPLX* raw = bufferScratch<COMPLX>(0, tSize);
+    COMPLX* data = bufferScratch<COMPLX>(1, tSize);
     for (int j = 0; j < tSize; j++) raw[j] = data[j] = 0.0;
 
     readBin(rawDataList[i], tSize, raw);
@@ -117,5 +198,5 @@ void timeReverse2pt(char* rawDataList[], char* tr2ptList[], int tSize, int fileC
     for (int j = 0; j < tSize; j++) data[j] = (raw[j] + raw[(tSize - j) % tSize]) * 0.5;
 
     writeBin(tr2ptList[i], tSize, data);
-  }
+  });
 }
@@ -26,12 +26,13 @@ void usage(char* name) {
           name);
   fprintf(stderr,
           "OPTIONS: \n"
-          "    -n <XYZSIZE>:      Spacial size of lattice\n"
+          "    -n <XYZSIZE>:      Spacial size of lattice (default: from file header)\n"
           "    -mps <M_PS>:       M_PS (LUnit)\n"
           "    -mv <M_V>:         M_V (LUnit)\n"
           "    -mc <MC>:          charm quark mass (LUnit)\n"
           "    -ov0 <OFNAMEV0>:   ofname of v0\n"
           "    -ovs <OFNAMEVS>:   ofname of vs\n"
+          "    [-H]:              Write self-describing header to output files\n"
           "    [-h, --help]:      Print help\n");
 }
 
@@ -44,6 +45,7 @@ int main(int argc, char* argv[]) {
   DOUBLE mc = 0.0;
   static const char* ofnameV0 = NULL;
   static const char* ofnameVs = NULL;
+  bool isHeader = false;
   char programName[128];
   strncpy(programName, basename(argv[0]), 127);
   argc--;
@@ -130,6 +132,14 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    // -H: write headers
+    if (strcmp(argv[0], "-H") == 0) {
+      isHeader = true;
+      argc--;
+      argv++;
+      continue;
+    }
+
     fprintf(stderr, "Error: Unknown option '%s'\n", argv[0]);
     usage(programName);
     exit(1);
@@ -141,6 +151,15 @@ int main(int argc, char* argv[]) {
     exit(1);
   }
 
+  // Lattice size from the header of the first input, unless given
+  BinHeader header = {};
+  if (probeBin(argv[0], header) && !xyzSize) xyzSize = header.xyzSize;
+  if (!xyzSize) {
+    usage(programName);
+    exit(1);
+  }
+  setBinOutput(isHeader, programName, xyzSize, 0);
+
   int arrayLength = int(pow(xyzSize, 3));
 
   CVARRAY prev_v(arrayLength), ppotps(arrayLength), v0(arrayLength), vs(arrayLength);
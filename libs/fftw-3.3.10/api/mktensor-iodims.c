@@ -0,0 +1,2 @@
+#include "guru.h"
+#include "mktensor-iodims.h"
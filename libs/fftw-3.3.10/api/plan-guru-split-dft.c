@@ -0,0 +1,2 @@
+#include "guru.h"
+#include "plan-guru-split-dft.h"
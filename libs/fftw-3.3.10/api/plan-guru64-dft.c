@@ -0,0 +1,2 @@
+#include "guru64.h"
+#include "plan-guru-dft.h"
@@ -0,0 +1,2 @@
+#include "guru64.h"
+#include "plan-guru-split-dft-c2r.h"
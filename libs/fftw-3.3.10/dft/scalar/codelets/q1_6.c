@@ -0,0 +1,1320 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:44:42 EDT 2021 */
+
+#include "dft/codelet-dft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_twidsq.native -fma -compact -variables 4 -pipeline-latency 4 -reload-twiddle -dif -n 6 -name q1_6 -include dft/scalar/q.h */
+
+/*
+ * This function contains 276 FP additions, 192 FP multiplications,
+ * (or, 144 additions, 60 multiplications, 132 fused multiply/add),
+ * 109 stack variables, 2 constants, and 144 memory accesses
+ */
+#include "dft/scalar/q.h"
+
+static void q1_6(R *rio, R *iio, const R *W, stride rs, stride vs, INT mb, INT me, INT ms)
+{
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 10); m < me; m = m + 1, rio = rio + ms, iio = iio + ms, W = W + 10, MAKE_VOLATILE_STRIDE(12, rs), MAKE_VOLATILE_STRIDE(0, vs)) {
+	       E T3, Tc, Tw, TW, Ta, TM, Tf, Tg, Tt, TT, Tn, TP, Tu, Tv, TU;
+	       E TV, T17, T1g, T1A, T20, T1e, T1Q, T1j, T1k, T1x, T1X, T1r, T1T, T1y, T1z;
+	       E T1Y, T1Z, T2B, T31, T2v, T2X, T2C, T2D, T32, T33, T2b, T2k, T2E, T34, T2i;
+	       E T2U, T2n, T2o, T3f, T3o, T3I, T48, T3m, T3Y, T3r, T3s, T3F, T45, T3z, T41;
+	       E T3G, T3H, T46, T47, T4j, T4s, T4M, T5c, T4q, T52, T4v, T4w, T4J, T59, T4D;
+	       E T55, T4K, T4L, T5a, T5b, T5N, T6d, T5H, T69, T5O, T5P, T6e, T6f, T5n, T5w;
+	       E T5Q, T6g, T5u, T66, T5z, T5A;
+	       {
+		    E T9, Te, T6, Td, T1, T2;
+		    T1 = rio[0];
+		    T2 = rio[WS(rs, 3)];
+		    T3 = T1 + T2;
+		    Tc = T1 - T2;
+		    {
+			 E T7, T8, T4, T5;
+			 T7 = rio[WS(rs, 4)];
+			 T8 = rio[WS(rs, 1)];
+			 T9 = T7 + T8;
+			 Te = T7 - T8;
+			 T4 = rio[WS(rs, 2)];
+			 T5 = rio[WS(rs, 5)];
+			 T6 = T4 + T5;
+			 Td = T4 - T5;
+		    }
+		    Tw = Te - Td;
+		    TW = T9 - T6;
+		    Ta = T6 + T9;
+		    TM = FNMS(KP500000000, Ta, T3);
+		    Tf = Td + Te;
+		    Tg = FNMS(KP500000000, Tf, Tc);
+	       }
+	       {
+		    E Tj, TN, Tm, TO, Th, Ti;
+		    Th = iio[WS(rs, 2)];
+		    Ti = iio[WS(rs, 5)];
+		    Tj = Th - Ti;
+		    TN = Th + Ti;
+		    {
+			 E Tr, Ts, Tk, Tl;
+			 Tr = iio[0];
+			 Ts = iio[WS(rs, 3)];
+			 Tt = Tr - Ts;
+			 TT = Tr + Ts;
+			 Tk = iio[WS(rs, 4)];
+			 Tl = iio[WS(rs, 1)];
+			 Tm = Tk - Tl;
+			 TO = Tk + Tl;
+		    }
+		    Tn = Tj - Tm;
+		    TP = TN - TO;
+		    Tu = Tj + Tm;
+		    Tv = FNMS(KP500000000, Tu, Tt);
+		    TU = TN + TO;
+		    TV = FNMS(KP500000000, TU, TT);
+	       }
+	       {
+		    E T1d, T1i, T1a, T1h, T15, T16;
+		    T15 = rio[WS(vs, 1)];
+		    T16 = rio[WS(vs, 1) + WS(rs, 3)];
+		    T17 = T15 + T16;
+		    T1g = T15 - T16;
+		    {
+			 E T1b, T1c, T18, T19;
+			 T1b = rio[WS(vs, 1) + WS(rs, 4)];
+			 T1c = rio[WS(vs, 1) + WS(rs, 1)];
+			 T1d = T1b + T1c;
+			 T1i = T1b - T1c;
+			 T18 = rio[WS(vs, 1) + WS(rs, 2)];
+			 T19 = rio[WS(vs, 1) + WS(rs, 5)];
+			 T1a = T18 + T19;
+			 T1h = T18 - T19;
+		    }
+		    T1A = T1i - T1h;
+		    T20 = T1d - T1a;
+		    T1e = T1a + T1d;
+		    T1Q = FNMS(KP500000000, T1e, T17);
+		    T1j = T1h + T1i;
+		    T1k = FNMS(KP500000000, T1j, T1g);
+	       }
+	       {
+		    E T1n, T1R, T1q, T1S, T1l, T1m;
+		    T1l = iio[WS(vs, 1) + WS(rs, 2)];
+		    T1m = iio[WS(vs, 1) + WS(rs, 5)];
+		    T1n = T1l - T1m;
+		    T1R = T1l + T1m;
+		    {
+			 E T1v, T1w, T1o, T1p;
+			 T1v = iio[WS(vs, 1)];
+			 T1w = iio[WS(vs, 1) + WS(rs, 3)];
+			 T1x = T1v - T1w;
+			 T1X = T1v + T1w;
+			 T1o = iio[WS(vs, 1) + WS(rs, 4)];
+			 T1p = iio[WS(vs, 1) + WS(rs, 1)];
+			 T1q = T1o - T1p;
+			 T1S = T1o + T1p;
+		    }
+		    T1r = T1n - T1q;
+		    T1T = T1R - T1S;
+		    T1y = T1n + T1q;
+		    T1z = FNMS(KP500000000, T1y, T1x);
+		    T1Y = T1R + T1S;
+		    T1Z = FNMS(KP500000000, T1Y, T1X);
+	       }
+	       {
+		    E T2r, T2V, T2u, T2W, T2p, T2q;
+		    T2p = iio[WS(vs, 2) + WS(rs, 2)];
+		    T2q = iio[WS(vs, 2) + WS(rs, 5)];
+		    T2r = T2p - T2q;
+		    T2V = T2p + T2q;
+		    {
+			 E T2z, T2A, T2s, T2t;
+			 T2z = iio[WS(vs, 2)];
+			 T2A = iio[WS(vs, 2) + WS(rs, 3)];
+			 T2B = T2z - T2A;
+			 T31 = T2z + T2A;
+			 T2s = iio[WS(vs, 2) + WS(rs, 4)];
+			 T2t = iio[WS(vs, 2) + WS(rs, 1)];
+			 T2u = T2s - T2t;
+			 T2W = T2s + T2t;
+		    }
+		    T2v = T2r - T2u;
+		    T2X = T2V - T2W;
+		    T2C = T2r + T2u;
+		    T2D = FNMS(KP500000000, T2C, T2B);
+		    T32 = T2V + T2W;
+		    T33 = FNMS(KP500000000, T32, T31);
+	       }
+	       {
+		    E T2h, T2m, T2e, T2l, T29, T2a;
+		    T29 = rio[WS(vs, 2)];
+		    T2a = rio[WS(vs, 2) + WS(rs, 3)];
+		    T2b = T29 + T2a;
+		    T2k = T29 - T2a;
+		    {
+			 E T2f, T2g, T2c, T2d;
+			 T2f = rio[WS(vs, 2) + WS(rs, 4)];
+			 T2g = rio[WS(vs, 2) + WS(rs, 1)];
+			 T2h = T2f + T2g;
+			 T2m = T2f - T2g;
+			 T2c = rio[WS(vs, 2) + WS(rs, 2)];
+			 T2d = rio[WS(vs, 2) + WS(rs, 5)];
+			 T2e = T2c + T2d;
+			 T2l = T2c - T2d;
+		    }
+		    T2E = T2m - T2l;
+		    T34 = T2h - T2e;
+		    T2i = T2e + T2h;
+		    T2U = FNMS(KP500000000, T2i, T2b);
+		    T2n = T2l + T2m;
+		    T2o = FNMS(KP500000000, T2n, T2k);
+	       }
+	       {
+		    E T3l, T3q, T3i, T3p, T3d, T3e;
+		    T3d = rio[WS(vs, 3)];
+		    T3e = rio[WS(vs, 3) + WS(rs, 3)];
+		    T3f = T3d + T3e;
+		    T3o = T3d - T3e;
+		    {
+			 E T3j, T3k, T3g, T3h;
+			 T3j = rio[WS(vs, 3) + WS(rs, 4)];
+			 T3k = rio[WS(vs, 3) + WS(rs, 1)];
+			 T3l = T3j + T3k;
+			 T3q = T3j - T3k;
+			 T3g = rio[WS(vs, 3) + WS(rs, 2)];
+			 T3h = rio[WS(vs, 3) + WS(rs, 5)];
+			 T3i = T3g + T3h;
+			 T3p = T3g - T3h;
+		    }
+		    T3I = T3q - T3p;
+		    T48 = T3l - T3i;
+		    T3m = T3i + T3l;
+		    T3Y = FNMS(KP500000000, T3m, T3f);
+		    T3r = T3p + T3q;
+		    T3s = FNMS(KP500000000, T3r, T3o);
+	       }
+	       {
+		    E T3v, T3Z, T3y, T40, T3t, T3u;
+		    T3t = iio[WS(vs, 3) + WS(rs, 2)];
+		    T3u = iio[WS(vs, 3) + WS(rs, 5)];
+		    T3v = T3t - T3u;
+		    T3Z = T3t + T3u;
+		    {
+			 E T3D, T3E, T3w, T3x;
+			 T3D = iio[WS(vs, 3)];
+			 T3E = iio[WS(vs, 3) + WS(rs, 3)];
+			 T3F = T3D - T3E;
+			 T45 = T3D + T3E;
+			 T3w = iio[WS(vs, 3) + WS(rs, 4)];
+			 T3x = iio[WS(vs, 3) + WS(rs, 1)];
+			 T3y = T3w - T3x;
+			 T40 = T3w + T3x;
+		    }
+		    T3z = T3v - T3y;
+		    T41 = T3Z - T40;
+		    T3G = T3v + T3y;
+		    T3H = FNMS(KP500000000, T3G, T3F);
+		    T46 = T3Z + T40;
+		    T47 = FNMS(KP500000000, T46, T45);
+	       }
+	       {
+		    E T4p, T4u, T4m, T4t, T4h, T4i;
+		    T4h = rio[WS(vs, 4)];
+		    T4i = rio[WS(vs, 4) + WS(rs, 3)];
+		    T4j = T4h + T4i;
+		    T4s = T4h - T4i;
+		    {
+			 E T4n, T4o, T4k, T4l;
+			 T4n = rio[WS(vs, 4) + WS(rs, 4)];
+			 T4o = rio[WS(vs, 4) + WS(rs, 1)];
+			 T4p = T4n + T4o;
+			 T4u = T4n - T4o;
+			 T4k = rio[WS(vs, 4) + WS(rs, 2)];
+			 T4l = rio[WS(vs, 4) + WS(rs, 5)];
+			 T4m = T4k + T4l;
+			 T4t = T4k - T4l;
+		    }
+		    T4M = T4u - T4t;
+		    T5c = T4p - T4m;
+		    T4q = T4m + T4p;
+		    T52 = FNMS(KP500000000, T4q, T4j);
+		    T4v = T4t + T4u;
+		    T4w = FNMS(KP500000000, T4v, T4s);
+	       }
+	       {
+		    E T4z, T53, T4C, T54, T4x, T4y;
+		    T4x = iio[WS(vs, 4) + WS(rs, 2)];
+		    T4y = iio[WS(vs, 4) + WS(rs, 5)];
+		    T4z = T4x - T4y;
+		    T53 = T4x + T4y;
+		    {
+			 E T4H, T4I, T4A, T4B;
+			 T4H = iio[WS(vs, 4)];
+			 T4I = iio[WS(vs, 4) + WS(rs, 3)];
+			 T4J = T4H - T4I;
+			 T59 = T4H + T4I;
+			 T4A = iio[WS(vs, 4) + WS(rs, 4)];
+			 T4B = iio[WS(vs, 4) + WS(rs, 1)];
+			 T4C = T4A - T4B;
+			 T54 = T4A + T4B;
+		    }
+		    T4D = T4z - T4C;
+		    T55 = T53 - T54;
+		    T4K = T4z + T4C;
+		    T4L = FNMS(KP500000000, T4K, T4J);
+		    T5a = T53 + T54;
+		    T5b = FNMS(KP500000000, T5a, T59);
+	       }
+	       {
+		    E T5D, T67, T5G, T68, T5B, T5C;
+		    T5B = iio[WS(vs, 5) + WS(rs, 2)];
+		    T5C = iio[WS(vs, 5) + WS(rs, 5)];
+		    T5D = T5B - T5C;
+		    T67 = T5B + T5C;
+		    {
+			 E T5L, T5M, T5E, T5F;
+			 T5L = iio[WS(vs, 5)];
+			 T5M = iio[WS(vs, 5) + WS(rs, 3)];
+			 T5N = T5L - T5M;
+			 T6d = T5L + T5M;
+			 T5E = iio[WS(vs, 5) + WS(rs, 4)];
+			 T5F = iio[WS(vs, 5) + WS(rs, 1)];
+			 T5G = T5E - T5F;
+			 T68 = T5E + T5F;
+		    }
+		    T5H = T5D - T5G;
+		    T69 = T67 - T68;
+		    T5O = T5D + T5G;
+		    T5P = FNMS(KP500000000, T5O, T5N);
+		    T6e = T67 + T68;
+		    T6f = FNMS(KP500000000, T6e, T6d);
+	       }
+	       {
+		    E T5t, T5y, T5q, T5x, T5l, T5m;
+		    T5l = rio[WS(vs, 5)];
+		    T5m = rio[WS(vs, 5) + WS(rs, 3)];
+		    T5n = T5l + T5m;
+		    T5w = T5l - T5m;
+		    {
+			 E T5r, T5s, T5o, T5p;
+			 T5r = rio[WS(vs, 5) + WS(rs, 4)];
+			 T5s = rio[WS(vs, 5) + WS(rs, 1)];
+			 T5t = T5r + T5s;
+			 T5y = T5r - T5s;
+			 T5o = rio[WS(vs, 5) + WS(rs, 2)];
+			 T5p = rio[WS(vs, 5) + WS(rs, 5)];
+			 T5q = T5o + T5p;
+			 T5x = T5o - T5p;
+		    }
+		    T5Q = T5y - T5x;
+		    T6g = T5t - T5q;
+		    T5u = T5q + T5t;
+		    T66 = FNMS(KP500000000, T5u, T5n);
+		    T5z = T5x + T5y;
+		    T5A = FNMS(KP500000000, T5z, T5w);
+	       }
+	       rio[0] = T3 + Ta;
+	       iio[0] = TT + TU;
+	       rio[WS(rs, 1)] = T17 + T1e;
+	       iio[WS(rs, 1)] = T1X + T1Y;
+	       rio[WS(rs, 2)] = T2b + T2i;
+	       iio[WS(rs, 2)] = T31 + T32;
+	       iio[WS(rs, 4)] = T59 + T5a;
+	       rio[WS(rs, 4)] = T4j + T4q;
+	       rio[WS(rs, 3)] = T3f + T3m;
+	       iio[WS(rs, 3)] = T45 + T46;
+	       rio[WS(rs, 5)] = T5n + T5u;
+	       iio[WS(rs, 5)] = T6d + T6e;
+	       {
+		    E To, Tx, Tp, Ty, Tb, Tq;
+		    To = FMA(KP866025403, Tn, Tg);
+		    Tx = FMA(KP866025403, Tw, Tv);
+		    Tb = W[0];
+		    Tp = Tb * To;
+		    Ty = Tb * Tx;
+		    Tq = W[1];
+		    rio[WS(vs, 1)] = FMA(Tq, Tx, Tp);
+		    iio[WS(vs, 1)] = FNMS(Tq, To, Ty);
+	       }
+	       {
+		    E TG, TJ, TH, TK, TF, TI;
+		    TG = Tc + Tf;
+		    TJ = Tt + Tu;
+		    TF = W[4];
+		    TH = TF * TG;
+		    TK = TF * TJ;
+		    TI = W[5];
+		    rio[WS(vs, 3)] = FMA(TI, TJ, TH);
+		    iio[WS(vs, 3)] = FNMS(TI, TG, TK);
+	       }
+	       {
+		    E T10, T13, T11, T14, TZ, T12;
+		    T10 = FMA(KP866025403, TP, TM);
+		    T13 = FMA(KP866025403, TW, TV);
+		    TZ = W[6];
+		    T11 = TZ * T10;
+		    T14 = TZ * T13;
+		    T12 = W[7];
+		    rio[WS(vs, 4)] = FMA(T12, T13, T11);
+		    iio[WS(vs, 4)] = FNMS(T12, T10, T14);
+	       }
+	       {
+		    E T60, T63, T61, T64, T5Z, T62;
+		    T60 = T5w + T5z;
+		    T63 = T5N + T5O;
+		    T5Z = W[4];
+		    T61 = T5Z * T60;
+		    T64 = T5Z * T63;
+		    T62 = W[5];
+		    rio[WS(vs, 3) + WS(rs, 5)] = FMA(T62, T63, T61);
+		    iio[WS(vs, 3) + WS(rs, 5)] = FNMS(T62, T60, T64);
+	       }
+	       {
+		    E T6k, T6n, T6l, T6o, T6j, T6m;
+		    T6k = FMA(KP866025403, T69, T66);
+		    T6n = FMA(KP866025403, T6g, T6f);
+		    T6j = W[6];
+		    T6l = T6j * T6k;
+		    T6o = T6j * T6n;
+		    T6m = W[7];
+		    rio[WS(vs, 4) + WS(rs, 5)] = FMA(T6m, T6n, T6l);
+		    iio[WS(vs, 4) + WS(rs, 5)] = FNMS(T6m, T6k, T6o);
+	       }
+	       {
+		    E TA, TD, TB, TE, Tz, TC;
+		    TA = FNMS(KP866025403, Tn, Tg);
+		    TD = FNMS(KP866025403, Tw, Tv);
+		    Tz = W[8];
+		    TB = Tz * TA;
+		    TE = Tz * TD;
+		    TC = W[9];
+		    rio[WS(vs, 5)] = FMA(TC, TD, TB);
+		    iio[WS(vs, 5)] = FNMS(TC, TA, TE);
+	       }
+	       {
+		    E TQ, TX, TR, TY, TL, TS;
+		    TQ = FNMS(KP866025403, TP, TM);
+		    TX = FNMS(KP866025403, TW, TV);
+		    TL = W[2];
+		    TR = TL * TQ;
+		    TY = TL * TX;
+		    TS = W[3];
+		    rio[WS(vs, 2)] = FMA(TS, TX, TR);
+		    iio[WS(vs, 2)] = FNMS(TS, TQ, TY);
+	       }
+	       {
+		    E T5U, T5X, T5V, T5Y, T5T, T5W;
+		    T5U = FNMS(KP866025403, T5H, T5A);
+		    T5X = FNMS(KP866025403, T5Q, T5P);
+		    T5T = W[8];
+		    T5V = T5T * T5U;
+		    T5Y = T5T * T5X;
+		    T5W = W[9];
+		    rio[WS(vs, 5) + WS(rs, 5)] = FMA(T5W, T5X, T5V);
+		    iio[WS(vs, 5) + WS(rs, 5)] = FNMS(T5W, T5U, T5Y);
+	       }
+	       {
+		    E T6a, T6h, T6b, T6i, T65, T6c;
+		    T6a = FNMS(KP866025403, T69, T66);
+		    T6h = FNMS(KP866025403, T6g, T6f);
+		    T65 = W[2];
+		    T6b = T65 * T6a;
+		    T6i = T65 * T6h;
+		    T6c = W[3];
+		    rio[WS(vs, 2) + WS(rs, 5)] = FMA(T6c, T6h, T6b);
+		    iio[WS(vs, 2) + WS(rs, 5)] = FNMS(T6c, T6a, T6i);
+	       }
+	       {
+		    E T5I, T5R, T5J, T5S, T5v, T5K;
+		    T5I = FMA(KP866025403, T5H, T5A);
+		    T5R = FMA(KP866025403, T5Q, T5P);
+		    T5v = W[0];
+		    T5J = T5v * T5I;
+		    T5S = T5v * T5R;
+		    T5K = W[1];
+		    rio[WS(vs, 1) + WS(rs, 5)] = FMA(T5K, T5R, T5J);
+		    iio[WS(vs, 1) + WS(rs, 5)] = FNMS(T5K, T5I, T5S);
+	       }
+	       {
+		    E T1s, T1B, T1t, T1C, T1f, T1u;
+		    T1s = FMA(KP866025403, T1r, T1k);
+		    T1B = FMA(KP866025403, T1A, T1z);
+		    T1f = W[0];
+		    T1t = T1f * T1s;
+		    T1C = T1f * T1B;
+		    T1u = W[1];
+		    rio[WS(vs, 1) + WS(rs, 1)] = FMA(T1u, T1B, T1t);
+		    iio[WS(vs, 1) + WS(rs, 1)] = FNMS(T1u, T1s, T1C);
+	       }
+	       {
+		    E T3S, T3V, T3T, T3W, T3R, T3U;
+		    T3S = T3o + T3r;
+		    T3V = T3F + T3G;
+		    T3R = W[4];
+		    T3T = T3R * T3S;
+		    T3W = T3R * T3V;
+		    T3U = W[5];
+		    rio[WS(vs, 3) + WS(rs, 3)] = FMA(T3U, T3V, T3T);
+		    iio[WS(vs, 3) + WS(rs, 3)] = FNMS(T3U, T3S, T3W);
+	       }
+	       {
+		    E T3A, T3J, T3B, T3K, T3n, T3C;
+		    T3A = FMA(KP866025403, T3z, T3s);
+		    T3J = FMA(KP866025403, T3I, T3H);
+		    T3n = W[0];
+		    T3B = T3n * T3A;
+		    T3K = T3n * T3J;
+		    T3C = W[1];
+		    rio[WS(vs, 1) + WS(rs, 3)] = FMA(T3C, T3J, T3B);
+		    iio[WS(vs, 1) + WS(rs, 3)] = FNMS(T3C, T3A, T3K);
+	       }
+	       {
+		    E T56, T5d, T57, T5e, T51, T58;
+		    T56 = FNMS(KP866025403, T55, T52);
+		    T5d = FNMS(KP866025403, T5c, T5b);
+		    T51 = W[2];
+		    T57 = T51 * T56;
+		    T5e = T51 * T5d;
+		    T58 = W[3];
+		    rio[WS(vs, 2) + WS(rs, 4)] = FMA(T58, T5d, T57);
+		    iio[WS(vs, 2) + WS(rs, 4)] = FNMS(T58, T56, T5e);
+	       }
+	       {
+		    E T2Y, T35, T2Z, T36, T2T, T30;
+		    T2Y = FNMS(KP866025403, T2X, T2U);
+		    T35 = FNMS(KP866025403, T34, T33);
+		    T2T = W[2];
+		    T2Z = T2T * T2Y;
+		    T36 = T2T * T35;
+		    T30 = W[3];
+		    rio[WS(vs, 2) + WS(rs, 2)] = FMA(T30, T35, T2Z);
+		    iio[WS(vs, 2) + WS(rs, 2)] = FNMS(T30, T2Y, T36);
+	       }
+	       {
+		    E T3M, T3P, T3N, T3Q, T3L, T3O;
+		    T3M = FNMS(KP866025403, T3z, T3s);
+		    T3P = FNMS(KP866025403, T3I, T3H);
+		    T3L = W[8];
+		    T3N = T3L * T3M;
+		    T3Q = T3L * T3P;
+		    T3O = W[9];
+		    rio[WS(vs, 5) + WS(rs, 3)] = FMA(T3O, T3P, T3N);
+		    iio[WS(vs, 5) + WS(rs, 3)] = FNMS(T3O, T3M, T3Q);
+	       }
+	       {
+		    E T38, T3b, T39, T3c, T37, T3a;
+		    T38 = FMA(KP866025403, T2X, T2U);
+		    T3b = FMA(KP866025403, T34, T33);
+		    T37 = W[6];
+		    T39 = T37 * T38;
+		    T3c = T37 * T3b;
+		    T3a = W[7];
+		    rio[WS(vs, 4) + WS(rs, 2)] = FMA(T3a, T3b, T39);
+		    iio[WS(vs, 4) + WS(rs, 2)] = FNMS(T3a, T38, T3c);
+	       }
+	       {
+		    E T1E, T1H, T1F, T1I, T1D, T1G;
+		    T1E = FNMS(KP866025403, T1r, T1k);
+		    T1H = FNMS(KP866025403, T1A, T1z);
+		    T1D = W[8];
+		    T1F = T1D * T1E;
+		    T1I = T1D * T1H;
+		    T1G = W[9];
+		    rio[WS(vs, 5) + WS(rs, 1)] = FMA(T1G, T1H, T1F);
+		    iio[WS(vs, 5) + WS(rs, 1)] = FNMS(T1G, T1E, T1I);
+	       }
+	       {
+		    E T5g, T5j, T5h, T5k, T5f, T5i;
+		    T5g = FMA(KP866025403, T55, T52);
+		    T5j = FMA(KP866025403, T5c, T5b);
+		    T5f = W[6];
+		    T5h = T5f * T5g;
+		    T5k = T5f * T5j;
+		    T5i = W[7];
+		    rio[WS(vs, 4) + WS(rs, 4)] = FMA(T5i, T5j, T5h);
+		    iio[WS(vs, 4) + WS(rs, 4)] = FNMS(T5i, T5g, T5k);
+	       }
+	       {
+		    E T1K, T1N, T1L, T1O, T1J, T1M;
+		    T1K = T1g + T1j;
+		    T1N = T1x + T1y;
+		    T1J = W[4];
+		    T1L = T1J * T1K;
+		    T1O = T1J * T1N;
+		    T1M = W[5];
+		    rio[WS(vs, 3) + WS(rs, 1)] = FMA(T1M, T1N, T1L);
+		    iio[WS(vs, 3) + WS(rs, 1)] = FNMS(T1M, T1K, T1O);
+	       }
+	       {
+		    E T4W, T4Z, T4X, T50, T4V, T4Y;
+		    T4W = T4s + T4v;
+		    T4Z = T4J + T4K;
+		    T4V = W[4];
+		    T4X = T4V * T4W;
+		    T50 = T4V * T4Z;
+		    T4Y = W[5];
+		    rio[WS(vs, 3) + WS(rs, 4)] = FMA(T4Y, T4Z, T4X);
+		    iio[WS(vs, 3) + WS(rs, 4)] = FNMS(T4Y, T4W, T50);
+	       }
+	       {
+		    E T4E, T4N, T4F, T4O, T4r, T4G;
+		    T4E = FMA(KP866025403, T4D, T4w);
+		    T4N = FMA(KP866025403, T4M, T4L);
+		    T4r = W[0];
+		    T4F = T4r * T4E;
+		    T4O = T4r * T4N;
+		    T4G = W[1];
+		    rio[WS(vs, 1) + WS(rs, 4)] = FMA(T4G, T4N, T4F);
+		    iio[WS(vs, 1) + WS(rs, 4)] = FNMS(T4G, T4E, T4O);
+	       }
+	       {
+		    E T2O, T2R, T2P, T2S, T2N, T2Q;
+		    T2O = T2k + T2n;
+		    T2R = T2B + T2C;
+		    T2N = W[4];
+		    T2P = T2N * T2O;
+		    T2S = T2N * T2R;
+		    T2Q = W[5];
+		    rio[WS(vs, 3) + WS(rs, 2)] = FMA(T2Q, T2R, T2P);
+		    iio[WS(vs, 3) + WS(rs, 2)] = FNMS(T2Q, T2O, T2S);
+	       }
+	       {
+		    E T2w, T2F, T2x, T2G, T2j, T2y;
+		    T2w = FMA(KP866025403, T2v, T2o);
+		    T2F = FMA(KP866025403, T2E, T2D);
+		    T2j = W[0];
+		    T2x = T2j * T2w;
+		    T2G = T2j * T2F;
+		    T2y = W[1];
+		    rio[WS(vs, 1) + WS(rs, 2)] = FMA(T2y, T2F, T2x);
+		    iio[WS(vs, 1) + WS(rs, 2)] = FNMS(T2y, T2w, T2G);
+	       }
+	       {
+		    E T24, T27, T25, T28, T23, T26;
+		    T24 = FMA(KP866025403, T1T, T1Q);
+		    T27 = FMA(KP866025403, T20, T1Z);
+		    T23 = W[6];
+		    T25 = T23 * T24;
+		    T28 = T23 * T27;
+		    T26 = W[7];
+		    rio[WS(vs, 4) + WS(rs, 1)] = FMA(T26, T27, T25);
+		    iio[WS(vs, 4) + WS(rs, 1)] = FNMS(T26, T24, T28);
+	       }
+	       {
+		    E T42, T49, T43, T4a, T3X, T44;
+		    T42 = FNMS(KP866025403, T41, T3Y);
+		    T49 = FNMS(KP866025403, T48, T47);
+		    T3X = W[2];
+		    T43 = T3X * T42;
+		    T4a = T3X * T49;
+		    T44 = W[3];
+		    rio[WS(vs, 2) + WS(rs, 3)] = FMA(T44, T49, T43);
+		    iio[WS(vs, 2) + WS(rs, 3)] = FNMS(T44, T42, T4a);
+	       }
+	       {
+		    E T2I, T2L, T2J, T2M, T2H, T2K;
+		    T2I = FNMS(KP866025403, T2v, T2o);
+		    T2L = FNMS(KP866025403, T2E, T2D);
+		    T2H = W[8];
+		    T2J = T2H * T2I;
+		    T2M = T2H * T2L;
+		    T2K = W[9];
+		    rio[WS(vs, 5) + WS(rs, 2)] = FMA(T2K, T2L, T2J);
+		    iio[WS(vs, 5) + WS(rs, 2)] = FNMS(T2K, T2I, T2M);
+	       }
+	       {
+		    E T4Q, T4T, T4R, T4U, T4P, T4S;
+		    T4Q = FNMS(KP866025403, T4D, T4w);
+		    T4T = FNMS(KP866025403, T4M, T4L);
+		    T4P = W[8];
+		    T4R = T4P * T4Q;
+		    T4U = T4P * T4T;
+		    T4S = W[9];
+		    rio[WS(vs, 5) + WS(rs, 4)] = FMA(T4S, T4T, T4R);
+		    iio[WS(vs, 5) + WS(rs, 4)] = FNMS(T4S, T4Q, T4U);
+	       }
+	       {
+		    E T1U, T21, T1V, T22, T1P, T1W;
+		    T1U = FNMS(KP866025403, T1T, T1Q);
+		    T21 = FNMS(KP866025403, T20, T1Z);
+		    T1P = W[2];
+		    T1V = T1P * T1U;
+		    T22 = T1P * T21;
+		    T1W = W[3];
+		    rio[WS(vs, 2) + WS(rs, 1)] = FMA(T1W, T21, T1V);
+		    iio[WS(vs, 2) + WS(rs, 1)] = FNMS(T1W, T1U, T22);
+	       }
+	       {
+		    E T4c, T4f, T4d, T4g, T4b, T4e;
+		    T4c = FMA(KP866025403, T41, T3Y);
+		    T4f = FMA(KP866025403, T48, T47);
+		    T4b = W[6];
+		    T4d = T4b * T4c;
+		    T4g = T4b * T4f;
+		    T4e = W[7];
+		    rio[WS(vs, 4) + WS(rs, 3)] = FMA(T4e, T4f, T4d);
+		    iio[WS(vs, 4) + WS(rs, 3)] = FNMS(T4e, T4c, T4g);
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_FULL, 0, 6 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 6, "q1_6", twinstr, &GENUS, { 144, 60, 132, 0 }, 0, 0, 0 };
+
+void X(codelet_q1_6) (planner *p) {
+     X(kdft_difsq_register) (p, q1_6, &desc);
+}
+#else
+
+/* Generated by: ../../../genfft/gen_twidsq.native -compact -variables 4 -pipeline-latency 4 -reload-twiddle -dif -n 6 -name q1_6 -include dft/scalar/q.h */
+
+/*
+ * This function contains 276 FP additions, 168 FP multiplications,
+ * (or, 192 additions, 84 multiplications, 84 fused multiply/add),
+ * 85 stack variables, 2 constants, and 144 memory accesses
+ */
+#include "dft/scalar/q.h"
+
+static void q1_6(R *rio, R *iio, const R *W, stride rs, stride vs, INT mb, INT me, INT ms)
+{
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 10); m < me; m = m + 1, rio = rio + ms, iio = iio + ms, W = W + 10, MAKE_VOLATILE_STRIDE(12, rs), MAKE_VOLATILE_STRIDE(0, vs)) {
+	       E T3, Tc, Tt, TM, TX, T16, T1n, T1G, T2h, T2A, T1R, T20, T2L, T2U, T3b;
+	       E T3u, T3F, T3O, T45, T4o, T4Z, T5i, T4z, T4I, Ta, TP, Tf, Tq, Tn, TN;
+	       E Tu, TJ, T14, T1J, T19, T1k, T1h, T1H, T1o, T1D, T2b, T2B, T2i, T2x, T1Y;
+	       E T2D, T23, T2e, T2S, T3x, T2X, T38, T35, T3v, T3c, T3r, T3M, T4r, T3R, T42;
+	       E T3Z, T4p, T46, T4l, T4T, T5j, T50, T5f, T4G, T5l, T4L, T4W;
+	       {
+		    E T1, T2, T1l, T1m;
+		    T1 = rio[0];
+		    T2 = rio[WS(rs, 3)];
+		    T3 = T1 + T2;
+		    Tc = T1 - T2;
+		    {
+			 E Tr, Ts, TV, TW;
+			 Tr = iio[0];
+			 Ts = iio[WS(rs, 3)];
+			 Tt = Tr - Ts;
+			 TM = Tr + Ts;
+			 TV = rio[WS(vs, 1)];
+			 TW = rio[WS(vs, 1) + WS(rs, 3)];
+			 TX = TV + TW;
+			 T16 = TV - TW;
+		    }
+		    T1l = iio[WS(vs, 1)];
+		    T1m = iio[WS(vs, 1) + WS(rs, 3)];
+		    T1n = T1l - T1m;
+		    T1G = T1l + T1m;
+		    {
+			 E T2f, T2g, T1P, T1Q;
+			 T2f = iio[WS(vs, 2)];
+			 T2g = iio[WS(vs, 2) + WS(rs, 3)];
+			 T2h = T2f - T2g;
+			 T2A = T2f + T2g;
+			 T1P = rio[WS(vs, 2)];
+			 T1Q = rio[WS(vs, 2) + WS(rs, 3)];
+			 T1R = T1P + T1Q;
+			 T20 = T1P - T1Q;
+		    }
+	       }
+	       {
+		    E T2J, T2K, T43, T44;
+		    T2J = rio[WS(vs, 3)];
+		    T2K = rio[WS(vs, 3) + WS(rs, 3)];
+		    T2L = T2J + T2K;
+		    T2U = T2J - T2K;
+		    {
+			 E T39, T3a, T3D, T3E;
+			 T39 = iio[WS(vs, 3)];
+			 T3a = iio[WS(vs, 3) + WS(rs, 3)];
+			 T3b = T39 - T3a;
+			 T3u = T39 + T3a;
+			 T3D = rio[WS(vs, 4)];
+			 T3E = rio[WS(vs, 4) + WS(rs, 3)];
+			 T3F = T3D + T3E;
+			 T3O = T3D - T3E;
+		    }
+		    T43 = iio[WS(vs, 4)];
+		    T44 = iio[WS(vs, 4) + WS(rs, 3)];
+		    T45 = T43 - T44;
+		    T4o = T43 + T44;
+		    {
+			 E T4X, T4Y, T4x, T4y;
+			 T4X = iio[WS(vs, 5)];
+			 T4Y = iio[WS(vs, 5) + WS(rs, 3)];
+			 T4Z = T4X - T4Y;
+			 T5i = T4X + T4Y;
+			 T4x = rio[WS(vs, 5)];
+			 T4y = rio[WS(vs, 5) + WS(rs, 3)];
+			 T4z = T4x + T4y;
+			 T4I = T4x - T4y;
+		    }
+	       }
+	       {
+		    E T6, Td, T9, Te;
+		    {
+			 E T4, T5, T7, T8;
+			 T4 = rio[WS(rs, 2)];
+			 T5 = rio[WS(rs, 5)];
+			 T6 = T4 + T5;
+			 Td = T4 - T5;
+			 T7 = rio[WS(rs, 4)];
+			 T8 = rio[WS(rs, 1)];
+			 T9 = T7 + T8;
+			 Te = T7 - T8;
+		    }
+		    Ta = T6 + T9;
+		    TP = KP866025403 * (T9 - T6);
+		    Tf = Td + Te;
+		    Tq = KP866025403 * (Te - Td);
+	       }
+	       {
+		    E Tj, TH, Tm, TI;
+		    {
+			 E Th, Ti, Tk, Tl;
+			 Th = iio[WS(rs, 2)];
+			 Ti = iio[WS(rs, 5)];
+			 Tj = Th - Ti;
+			 TH = Th + Ti;
+			 Tk = iio[WS(rs, 4)];
+			 Tl = iio[WS(rs, 1)];
+			 Tm = Tk - Tl;
+			 TI = Tk + Tl;
+		    }
+		    Tn = KP866025403 * (Tj - Tm);
+		    TN = TH + TI;
+		    Tu = Tj + Tm;
+		    TJ = KP866025403 * (TH - TI);
+	       }
+	       {
+		    E T10, T17, T13, T18;
+		    {
+			 E TY, TZ, T11, T12;
+			 TY = rio[WS(vs, 1) + WS(rs, 2)];
+			 TZ = rio[WS(vs, 1) + WS(rs, 5)];
+			 T10 = TY + TZ;
+			 T17 = TY - TZ;
+			 T11 = rio[WS(vs, 1) + WS(rs, 4)];
+			 T12 = rio[WS(vs, 1) + WS(rs, 1)];
+			 T13 = T11 + T12;
+			 T18 = T11 - T12;
+		    }
+		    T14 = T10 + T13;
+		    T1J = KP866025403 * (T13 - T10);
+		    T19 = T17 + T18;
+		    T1k = KP866025403 * (T18 - T17);
+	       }
+	       {
+		    E T1d, T1B, T1g, T1C;
+		    {
+			 E T1b, T1c, T1e, T1f;
+			 T1b = iio[WS(vs, 1) + WS(rs, 2)];
+			 T1c = iio[WS(vs, 1) + WS(rs, 5)];
+			 T1d = T1b - T1c;
+			 T1B = T1b + T1c;
+			 T1e = iio[WS(vs, 1) + WS(rs, 4)];
+			 T1f = iio[WS(vs, 1) + WS(rs, 1)];
+			 T1g = T1e - T1f;
+			 T1C = T1e + T1f;
+		    }
+		    T1h = KP866025403 * (T1d - T1g);
+		    T1H = T1B + T1C;
+		    T1o = T1d + T1g;
+		    T1D = KP866025403 * (T1B - T1C);
+	       }
+	       {
+		    E T27, T2v, T2a, T2w;
+		    {
+			 E T25, T26, T28, T29;
+			 T25 = iio[WS(vs, 2) + WS(rs, 2)];
+			 T26 = iio[WS(vs, 2) + WS(rs, 5)];
+			 T27 = T25 - T26;
+			 T2v = T25 + T26;
+			 T28 = iio[WS(vs, 2) + WS(rs, 4)];
+			 T29 = iio[WS(vs, 2) + WS(rs, 1)];
+			 T2a = T28 - T29;
+			 T2w = T28 + T29;
+		    }
+		    T2b = KP866025403 * (T27 - T2a);
+		    T2B = T2v + T2w;
+		    T2i = T27 + T2a;
+		    T2x = KP866025403 * (T2v - T2w);
+	       }
+	       {
+		    E T1U, T21, T1X, T22;
+		    {
+			 E T1S, T1T, T1V, T1W;
+			 T1S = rio[WS(vs, 2) + WS(rs, 2)];
+			 T1T = rio[WS(vs, 2) + WS(rs, 5)];
+			 T1U = T1S + T1T;
+			 T21 = T1S - T1T;
+			 T1V = rio[WS(vs, 2) + WS(rs, 4)];
+			 T1W = rio[WS(vs, 2) + WS(rs, 1)];
+			 T1X = T1V + T1W;
+			 T22 = T1V - T1W;
+		    }
+		    T1Y = T1U + T1X;
+		    T2D = KP866025403 * (T1X - T1U);
+		    T23 = T21 + T22;
+		    T2e = KP866025403 * (T22 - T21);
+	       }
+	       {
+		    E T2O, T2V, T2R, T2W;
+		    {
+			 E T2M, T2N, T2P, T2Q;
+			 T2M = rio[WS(vs, 3) + WS(rs, 2)];
+			 T2N = rio[WS(vs, 3) + WS(rs, 5)];
+			 T2O = T2M + T2N;
+			 T2V = T2M - T2N;
+			 T2P = rio[WS(vs, 3) + WS(rs, 4)];
+			 T2Q = rio[WS(vs, 3) + WS(rs, 1)];
+			 T2R = T2P + T2Q;
+			 T2W = T2P - T2Q;
+		    }
+		    T2S = T2O + T2R;
+		    T3x = KP866025403 * (T2R - T2O);
+		    T2X = T2V + T2W;
+		    T38 = KP866025403 * (T2W - T2V);
+	       }
+	       {
+		    E T31, T3p, T34, T3q;
+		    {
+			 E T2Z, T30, T32, T33;
+			 T2Z = iio[WS(vs, 3) + WS(rs, 2)];
+			 T30 = iio[WS(vs, 3) + WS(rs, 5)];
+			 T31 = T2Z - T30;
+			 T3p = T2Z + T30;
+			 T32 = iio[WS(vs, 3) + WS(rs, 4)];
+			 T33 = iio[WS(vs, 3) + WS(rs, 1)];
+			 T34 = T32 - T33;
+			 T3q = T32 + T33;
+		    }
+		    T35 = KP866025403 * (T31 - T34);
+		    T3v = T3p + T3q;
+		    T3c = T31 + T34;
+		    T3r = KP866025403 * (T3p - T3q);
+	       }
+	       {
+		    E T3I, T3P, T3L, T3Q;
+		    {
+			 E T3G, T3H, T3J, T3K;
+			 T3G = rio[WS(vs, 4) + WS(rs, 2)];
+			 T3H = rio[WS(vs, 4) + WS(rs, 5)];
+			 T3I = T3G + T3H;
+			 T3P = T3G - T3H;
+			 T3J = rio[WS(vs, 4) + WS(rs, 4)];
+			 T3K = rio[WS(vs, 4) + WS(rs, 1)];
+			 T3L = T3J + T3K;
+			 T3Q = T3J - T3K;
+		    }
+		    T3M = T3I + T3L;
+		    T4r = KP866025403 * (T3L - T3I);
+		    T3R = T3P + T3Q;
+		    T42 = KP866025403 * (T3Q - T3P);
+	       }
+	       {
+		    E T3V, T4j, T3Y, T4k;
+		    {
+			 E T3T, T3U, T3W, T3X;
+			 T3T = iio[WS(vs, 4) + WS(rs, 2)];
+			 T3U = iio[WS(vs, 4) + WS(rs, 5)];
+			 T3V = T3T - T3U;
+			 T4j = T3T + T3U;
+			 T3W = iio[WS(vs, 4) + WS(rs, 4)];
+			 T3X = iio[WS(vs, 4) + WS(rs, 1)];
+			 T3Y = T3W - T3X;
+			 T4k = T3W + T3X;
+		    }
+		    T3Z = KP866025403 * (T3V - T3Y);
+		    T4p = T4j + T4k;
+		    T46 = T3V + T3Y;
+		    T4l = KP866025403 * (T4j - T4k);
+	       }
+	       {
+		    E T4P, T5d, T4S, T5e;
+		    {
+			 E T4N, T4O, T4Q, T4R;
+			 T4N = iio[WS(vs, 5) + WS(rs, 2)];
+			 T4O = iio[WS(vs, 5) + WS(rs, 5)];
+			 T4P = T4N - T4O;
+			 T5d = T4N + T4O;
+			 T4Q = iio[WS(vs, 5) + WS(rs, 4)];
+			 T4R = iio[WS(vs, 5) + WS(rs, 1)];
+			 T4S = T4Q - T4R;
+			 T5e = T4Q + T4R;
+		    }
+		    T4T = KP866025403 * (T4P - T4S);
+		    T5j = T5d + T5e;
+		    T50 = T4P + T4S;
+		    T5f = KP866025403 * (T5d - T5e);
+	       }
+	       {
+		    E T4C, T4J, T4F, T4K;
+		    {
+			 E T4A, T4B, T4D, T4E;
+			 T4A = rio[WS(vs, 5) + WS(rs, 2)];
+			 T4B = rio[WS(vs, 5) + WS(rs, 5)];
+			 T4C = T4A + T4B;
+			 T4J = T4A - T4B;
+			 T4D = rio[WS(vs, 5) + WS(rs, 4)];
+			 T4E = rio[WS(vs, 5) + WS(rs, 1)];
+			 T4F = T4D + T4E;
+			 T4K = T4D - T4E;
+		    }
+		    T4G = T4C + T4F;
+		    T5l = KP866025403 * (T4F - T4C);
+		    T4L = T4J + T4K;
+		    T4W = KP866025403 * (T4K - T4J);
+	       }
+	       rio[0] = T3 + Ta;
+	       iio[0] = TM + TN;
+	       rio[WS(rs, 1)] = TX + T14;
+	       iio[WS(rs, 1)] = T1G + T1H;
+	       rio[WS(rs, 3)] = T2L + T2S;
+	       rio[WS(rs, 2)] = T1R + T1Y;
+	       iio[WS(rs, 2)] = T2A + T2B;
+	       iio[WS(rs, 3)] = T3u + T3v;
+	       iio[WS(rs, 4)] = T4o + T4p;
+	       iio[WS(rs, 5)] = T5i + T5j;
+	       rio[WS(rs, 5)] = T4z + T4G;
+	       rio[WS(rs, 4)] = T3F + T3M;
+	       {
+		    E T1w, T1y, T1v, T1x;
+		    T1w = T16 + T19;
+		    T1y = T1n + T1o;
+		    T1v = W[4];
+		    T1x = W[5];
+		    rio[WS(vs, 3) + WS(rs, 1)] = FMA(T1v, T1w, T1x * T1y);
+		    iio[WS(vs, 3) + WS(rs, 1)] = FNMS(T1x, T1w, T1v * T1y);
+	       }
+	       {
+		    E T58, T5a, T57, T59;
+		    T58 = T4I + T4L;
+		    T5a = T4Z + T50;
+		    T57 = W[4];
+		    T59 = W[5];
+		    rio[WS(vs, 3) + WS(rs, 5)] = FMA(T57, T58, T59 * T5a);
+		    iio[WS(vs, 3) + WS(rs, 5)] = FNMS(T59, T58, T57 * T5a);
+	       }
+	       {
+		    E TC, TE, TB, TD;
+		    TC = Tc + Tf;
+		    TE = Tt + Tu;
+		    TB = W[4];
+		    TD = W[5];
+		    rio[WS(vs, 3)] = FMA(TB, TC, TD * TE);
+		    iio[WS(vs, 3)] = FNMS(TD, TC, TB * TE);
+	       }
+	       {
+		    E T4e, T4g, T4d, T4f;
+		    T4e = T3O + T3R;
+		    T4g = T45 + T46;
+		    T4d = W[4];
+		    T4f = W[5];
+		    rio[WS(vs, 3) + WS(rs, 4)] = FMA(T4d, T4e, T4f * T4g);
+		    iio[WS(vs, 3) + WS(rs, 4)] = FNMS(T4f, T4e, T4d * T4g);
+	       }
+	       {
+		    E T3k, T3m, T3j, T3l;
+		    T3k = T2U + T2X;
+		    T3m = T3b + T3c;
+		    T3j = W[4];
+		    T3l = W[5];
+		    rio[WS(vs, 3) + WS(rs, 3)] = FMA(T3j, T3k, T3l * T3m);
+		    iio[WS(vs, 3) + WS(rs, 3)] = FNMS(T3l, T3k, T3j * T3m);
+	       }
+	       {
+		    E T2q, T2s, T2p, T2r;
+		    T2q = T20 + T23;
+		    T2s = T2h + T2i;
+		    T2p = W[4];
+		    T2r = W[5];
+		    rio[WS(vs, 3) + WS(rs, 2)] = FMA(T2p, T2q, T2r * T2s);
+		    iio[WS(vs, 3) + WS(rs, 2)] = FNMS(T2r, T2q, T2p * T2s);
+	       }
+	       {
+		    E T5g, T5o, T5m, T5q, T5c, T5k;
+		    T5c = FNMS(KP500000000, T4G, T4z);
+		    T5g = T5c - T5f;
+		    T5o = T5c + T5f;
+		    T5k = FNMS(KP500000000, T5j, T5i);
+		    T5m = T5k - T5l;
+		    T5q = T5l + T5k;
+		    {
+			 E T5b, T5h, T5n, T5p;
+			 T5b = W[2];
+			 T5h = W[3];
+			 rio[WS(vs, 2) + WS(rs, 5)] = FMA(T5b, T5g, T5h * T5m);
+			 iio[WS(vs, 2) + WS(rs, 5)] = FNMS(T5h, T5g, T5b * T5m);
+			 T5n = W[6];
+			 T5p = W[7];
+			 rio[WS(vs, 4) + WS(rs, 5)] = FMA(T5n, T5o, T5p * T5q);
+			 iio[WS(vs, 4) + WS(rs, 5)] = FNMS(T5p, T5o, T5n * T5q);
+		    }
+	       }
+	       {
+		    E To, Ty, Tw, TA, Tg, Tv;
+		    Tg = FNMS(KP500000000, Tf, Tc);
+		    To = Tg + Tn;
+		    Ty = Tg - Tn;
+		    Tv = FNMS(KP500000000, Tu, Tt);
+		    Tw = Tq + Tv;
+		    TA = Tv - Tq;
+		    {
+			 E Tb, Tp, Tx, Tz;
+			 Tb = W[0];
+			 Tp = W[1];
+			 rio[WS(vs, 1)] = FMA(Tb, To, Tp * Tw);
+			 iio[WS(vs, 1)] = FNMS(Tp, To, Tb * Tw);
+			 Tx = W[8];
+			 Tz = W[9];
+			 rio[WS(vs, 5)] = FMA(Tx, Ty, Tz * TA);
+			 iio[WS(vs, 5)] = FNMS(Tz, Ty, Tx * TA);
+		    }
+	       }
+	       {
+		    E T36, T3g, T3e, T3i, T2Y, T3d;
+		    T2Y = FNMS(KP500000000, T2X, T2U);
+		    T36 = T2Y + T35;
+		    T3g = T2Y - T35;
+		    T3d = FNMS(KP500000000, T3c, T3b);
+		    T3e = T38 + T3d;
+		    T3i = T3d - T38;
+		    {
+			 E T2T, T37, T3f, T3h;
+			 T2T = W[0];
+			 T37 = W[1];
+			 rio[WS(vs, 1) + WS(rs, 3)] = FMA(T2T, T36, T37 * T3e);
+			 iio[WS(vs, 1) + WS(rs, 3)] = FNMS(T37, T36, T2T * T3e);
+			 T3f = W[8];
+			 T3h = W[9];
+			 rio[WS(vs, 5) + WS(rs, 3)] = FMA(T3f, T3g, T3h * T3i);
+			 iio[WS(vs, 5) + WS(rs, 3)] = FNMS(T3h, T3g, T3f * T3i);
+		    }
+	       }
+	       {
+		    E T2y, T2G, T2E, T2I, T2u, T2C;
+		    T2u = FNMS(KP500000000, T1Y, T1R);
+		    T2y = T2u - T2x;
+		    T2G = T2u + T2x;
+		    T2C = FNMS(KP500000000, T2B, T2A);
+		    T2E = T2C - T2D;
+		    T2I = T2D + T2C;
+		    {
+			 E T2t, T2z, T2F, T2H;
+			 T2t = W[2];
+			 T2z = W[3];
+			 rio[WS(vs, 2) + WS(rs, 2)] = FMA(T2t, T2y, T2z * T2E);
+			 iio[WS(vs, 2) + WS(rs, 2)] = FNMS(T2z, T2y, T2t * T2E);
+			 T2F = W[6];
+			 T2H = W[7];
+			 rio[WS(vs, 4) + WS(rs, 2)] = FMA(T2F, T2G, T2H * T2I);
+			 iio[WS(vs, 4) + WS(rs, 2)] = FNMS(T2H, T2G, T2F * T2I);
+		    }
+	       }
+	       {
+		    E T3s, T3A, T3y, T3C, T3o, T3w;
+		    T3o = FNMS(KP500000000, T2S, T2L);
+		    T3s = T3o - T3r;
+		    T3A = T3o + T3r;
+		    T3w = FNMS(KP500000000, T3v, T3u);
+		    T3y = T3w - T3x;
+		    T3C = T3x + T3w;
+		    {
+			 E T3n, T3t, T3z, T3B;
+			 T3n = W[2];
+			 T3t = W[3];
+			 rio[WS(vs, 2) + WS(rs, 3)] = FMA(T3n, T3s, T3t * T3y);
+			 iio[WS(vs, 2) + WS(rs, 3)] = FNMS(T3t, T3s, T3n * T3y);
+			 T3z = W[6];
+			 T3B = W[7];
+			 rio[WS(vs, 4) + WS(rs, 3)] = FMA(T3z, T3A, T3B * T3C);
+			 iio[WS(vs, 4) + WS(rs, 3)] = FNMS(T3B, T3A, T3z * T3C);
+		    }
+	       }
+	       {
+		    E T1E, T1M, T1K, T1O, T1A, T1I;
+		    T1A = FNMS(KP500000000, T14, TX);
+		    T1E = T1A - T1D;
+		    T1M = T1A + T1D;
+		    T1I = FNMS(KP500000000, T1H, T1G);
+		    T1K = T1I - T1J;
+		    T1O = T1J + T1I;
+		    {
+			 E T1z, T1F, T1L, T1N;
+			 T1z = W[2];
+			 T1F = W[3];
+			 rio[WS(vs, 2) + WS(rs, 1)] = FMA(T1z, T1E, T1F * T1K);
+			 iio[WS(vs, 2) + WS(rs, 1)] = FNMS(T1F, T1E, T1z * T1K);
+			 T1L = W[6];
+			 T1N = W[7];
+			 rio[WS(vs, 4) + WS(rs, 1)] = FMA(T1L, T1M, T1N * T1O);
+			 iio[WS(vs, 4) + WS(rs, 1)] = FNMS(T1N, T1M, T1L * T1O);
+		    }
+	       }
+	       {
+		    E T4m, T4u, T4s, T4w, T4i, T4q;
+		    T4i = FNMS(KP500000000, T3M, T3F);
+		    T4m = T4i - T4l;
+		    T4u = T4i + T4l;
+		    T4q = FNMS(KP500000000, T4p, T4o);
+		    T4s = T4q - T4r;
+		    T4w = T4r + T4q;
+		    {
+			 E T4h, T4n, T4t, T4v;
+			 T4h = W[2];
+			 T4n = W[3];
+			 rio[WS(vs, 2) + WS(rs, 4)] = FMA(T4h, T4m, T4n * T4s);
+			 iio[WS(vs, 2) + WS(rs, 4)] = FNMS(T4n, T4m, T4h * T4s);
+			 T4t = W[6];
+			 T4v = W[7];
+			 rio[WS(vs, 4) + WS(rs, 4)] = FMA(T4t, T4u, T4v * T4w);
+			 iio[WS(vs, 4) + WS(rs, 4)] = FNMS(T4v, T4u, T4t * T4w);
+		    }
+	       }
+	       {
+		    E TK, TS, TQ, TU, TG, TO;
+		    TG = FNMS(KP500000000, Ta, T3);
+		    TK = TG - TJ;
+		    TS = TG + TJ;
+		    TO = FNMS(KP500000000, TN, TM);
+		    TQ = TO - TP;
+		    TU = TP + TO;
+		    {
+			 E TF, TL, TR, TT;
+			 TF = W[2];
+			 TL = W[3];
+			 rio[WS(vs, 2)] = FMA(TF, TK, TL * TQ);
+			 iio[WS(vs, 2)] = FNMS(TL, TK, TF * TQ);
+			 TR = W[6];
+			 TT = W[7];
+			 rio[WS(vs, 4)] = FMA(TR, TS, TT * TU);
+			 iio[WS(vs, 4)] = FNMS(TT, TS, TR * TU);
+		    }
+	       }
+	       {
+		    E T2c, T2m, T2k, T2o, T24, T2j;
+		    T24 = FNMS(KP500000000, T23, T20);
+		    T2c = T24 + T2b;
+		    T2m = T24 - T2b;
+		    T2j = FNMS(KP500000000, T2i, T2h);
+		    T2k = T2e + T2j;
+		    T2o = T2j - T2e;
+		    {
+			 E T1Z, T2d, T2l, T2n;
+			 T1Z = W[0];
+			 T2d = W[1];
+			 rio[WS(vs, 1) + WS(rs, 2)] = FMA(T1Z, T2c, T2d * T2k);
+			 iio[WS(vs, 1) + WS(rs, 2)] = FNMS(T2d, T2c, T1Z * T2k);
+			 T2l = W[8];
+			 T2n = W[9];
+			 rio[WS(vs, 5) + WS(rs, 2)] = FMA(T2l, T2m, T2n * T2o);
+			 iio[WS(vs, 5) + WS(rs, 2)] = FNMS(T2n, T2m, T2l * T2o);
+		    }
+	       }
+	       {
+		    E T40, T4a, T48, T4c, T3S, T47;
+		    T3S = FNMS(KP500000000, T3R, T3O);
+		    T40 = T3S + T3Z;
+		    T4a = T3S - T3Z;
+		    T47 = FNMS(KP500000000, T46, T45);
+		    T48 = T42 + T47;
+		    T4c = T47 - T42;
+		    {
+			 E T3N, T41, T49, T4b;
+			 T3N = W[0];
+			 T41 = W[1];
+			 rio[WS(vs, 1) + WS(rs, 4)] = FMA(T3N, T40, T41 * T48);
+			 iio[WS(vs, 1) + WS(rs, 4)] = FNMS(T41, T40, T3N * T48);
+			 T49 = W[8];
+			 T4b = W[9];
+			 rio[WS(vs, 5) + WS(rs, 4)] = FMA(T49, T4a, T4b * T4c);
+			 iio[WS(vs, 5) + WS(rs, 4)] = FNMS(T4b, T4a, T49 * T4c);
+		    }
+	       }
+	       {
+		    E T1i, T1s, T1q, T1u, T1a, T1p;
+		    T1a = FNMS(KP500000000, T19, T16);
+		    T1i = T1a + T1h;
+		    T1s = T1a - T1h;
+		    T1p = FNMS(KP500000000, T1o, T1n);
+		    T1q = T1k + T1p;
+		    T1u = T1p - T1k;
+		    {
+			 E T15, T1j, T1r, T1t;
+			 T15 = W[0];
+			 T1j = W[1];
+			 rio[WS(vs, 1) + WS(rs, 1)] = FMA(T15, T1i, T1j * T1q);
+			 iio[WS(vs, 1) + WS(rs, 1)] = FNMS(T1j, T1i, T15 * T1q);
+			 T1r = W[8];
+			 T1t = W[9];
+			 rio[WS(vs, 5) + WS(rs, 1)] = FMA(T1r, T1s, T1t * T1u);
+			 iio[WS(vs, 5) + WS(rs, 1)] = FNMS(T1t, T1s, T1r * T1u);
+		    }
+	       }
+	       {
+		    E T4U, T54, T52, T56, T4M, T51;
+		    T4M = FNMS(KP500000000, T4L, T4I);
+		    T4U = T4M + T4T;
+		    T54 = T4M - T4T;
+		    T51 = FNMS(KP500000000, T50, T4Z);
+		    T52 = T4W + T51;
+		    T56 = T51 - T4W;
+		    {
+			 E T4H, T4V, T53, T55;
+			 T4H = W[0];
+			 T4V = W[1];
+			 rio[WS(vs, 1) + WS(rs, 5)] = FMA(T4H, T4U, T4V * T52);
+			 iio[WS(vs, 1) + WS(rs, 5)] = FNMS(T4V, T4U, T4H * T52);
+			 T53 = W[8];
+			 T55 = W[9];
+			 rio[WS(vs, 5) + WS(rs, 5)] = FMA(T53, T54, T55 * T56);
+			 iio[WS(vs, 5) + WS(rs, 5)] = FNMS(T55, T54, T53 * T56);
+		    }
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_FULL, 0, 6 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 6, "q1_6", twinstr, &GENUS, { 192, 84, 84, 0 }, 0, 0, 0 };
+
+void X(codelet_q1_6) (planner *p) {
+     X(kdft_difsq_register) (p, q1_6, &desc);
+}
+#endif
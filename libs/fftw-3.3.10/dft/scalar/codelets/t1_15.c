@@ -0,0 +1,816 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:44:28 EDT 2021 */
+
+#include "dft/codelet-dft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_twiddle.native -fma -compact -variables 4 -pipeline-latency 4 -n 15 -name t1_15 -include dft/scalar/t.h */
+
+/*
+ * This function contains 184 FP additions, 140 FP multiplications,
+ * (or, 72 additions, 28 multiplications, 112 fused multiply/add),
+ * 51 stack variables, 6 constants, and 60 memory accesses
+ */
+#include "dft/scalar/t.h"
+
+static void t1_15(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DK(KP618033988, +0.618033988749894848204586834365638117720309180);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 28); m < me; m = m + 1, ri = ri + ms, ii = ii + ms, W = W + 28, MAKE_VOLATILE_STRIDE(30, rs)) {
+	       E T1, T3j, T1G, T3u, Te, T1B, T3i, T3t, T1y, T2i, T2a, T2M, T37, T2V, Tz;
+	       E T2e, T1O, T2t, T39, T2X, TT, T2f, T1V, T2z, T3a, T2Y, T1e, T2h, T23, T2G;
+	       E T36, T2U;
+	       {
+		    E T7, T1D, Td, T1F;
+		    T1 = ri[0];
+		    T3j = ii[0];
+		    {
+			 E T3, T6, T4, T1C, T2, T5;
+			 T3 = ri[WS(rs, 5)];
+			 T6 = ii[WS(rs, 5)];
+			 T2 = W[8];
+			 T4 = T2 * T3;
+			 T1C = T2 * T6;
+			 T5 = W[9];
+			 T7 = FMA(T5, T6, T4);
+			 T1D = FNMS(T5, T3, T1C);
+		    }
+		    {
+			 E T9, Tc, Ta, T1E, T8, Tb;
+			 T9 = ri[WS(rs, 10)];
+			 Tc = ii[WS(rs, 10)];
+			 T8 = W[18];
+			 Ta = T8 * T9;
+			 T1E = T8 * Tc;
+			 Tb = W[19];
+			 Td = FMA(Tb, Tc, Ta);
+			 T1F = FNMS(Tb, T9, T1E);
+		    }
+		    T1G = T1D - T1F;
+		    T3u = Td - T7;
+		    Te = T7 + Td;
+		    T1B = FNMS(KP500000000, Te, T1);
+		    T3i = T1D + T1F;
+		    T3t = FNMS(KP500000000, T3i, T3j);
+	       }
+	       {
+		    E T1k, T2I, T1w, T28, T1q, T26;
+		    {
+			 E T1g, T1j, T1h, T2H, T1f, T1i;
+			 T1g = ri[WS(rs, 9)];
+			 T1j = ii[WS(rs, 9)];
+			 T1f = W[16];
+			 T1h = T1f * T1g;
+			 T2H = T1f * T1j;
+			 T1i = W[17];
+			 T1k = FMA(T1i, T1j, T1h);
+			 T2I = FNMS(T1i, T1g, T2H);
+		    }
+		    {
+			 E T1s, T1v, T1t, T27, T1r, T1u;
+			 T1s = ri[WS(rs, 4)];
+			 T1v = ii[WS(rs, 4)];
+			 T1r = W[6];
+			 T1t = T1r * T1s;
+			 T27 = T1r * T1v;
+			 T1u = W[7];
+			 T1w = FMA(T1u, T1v, T1t);
+			 T28 = FNMS(T1u, T1s, T27);
+		    }
+		    {
+			 E T1m, T1p, T1n, T25, T1l, T1o;
+			 T1m = ri[WS(rs, 14)];
+			 T1p = ii[WS(rs, 14)];
+			 T1l = W[26];
+			 T1n = T1l * T1m;
+			 T25 = T1l * T1p;
+			 T1o = W[27];
+			 T1q = FMA(T1o, T1p, T1n);
+			 T26 = FNMS(T1o, T1m, T25);
+		    }
+		    {
+			 E T29, T1x, T24, T2L, T2J, T2K;
+			 T29 = T26 - T28;
+			 T1x = T1q + T1w;
+			 T24 = FNMS(KP500000000, T1x, T1k);
+			 T1y = T1k + T1x;
+			 T2i = FMA(KP866025403, T29, T24);
+			 T2a = FNMS(KP866025403, T29, T24);
+			 T2L = T1w - T1q;
+			 T2J = T26 + T28;
+			 T2K = FNMS(KP500000000, T2J, T2I);
+			 T2M = FMA(KP866025403, T2L, T2K);
+			 T37 = T2I + T2J;
+			 T2V = FNMS(KP866025403, T2L, T2K);
+		    }
+	       }
+	       {
+		    E Tl, T2p, Tx, T1M, Tr, T1K;
+		    {
+			 E Th, Tk, Ti, T2o, Tg, Tj;
+			 Th = ri[WS(rs, 3)];
+			 Tk = ii[WS(rs, 3)];
+			 Tg = W[4];
+			 Ti = Tg * Th;
+			 T2o = Tg * Tk;
+			 Tj = W[5];
+			 Tl = FMA(Tj, Tk, Ti);
+			 T2p = FNMS(Tj, Th, T2o);
+		    }
+		    {
+			 E Tt, Tw, Tu, T1L, Ts, Tv;
+			 Tt = ri[WS(rs, 13)];
+			 Tw = ii[WS(rs, 13)];
+			 Ts = W[24];
+			 Tu = Ts * Tt;
+			 T1L = Ts * Tw;
+			 Tv = W[25];
+			 Tx = FMA(Tv, Tw, Tu);
+			 T1M = FNMS(Tv, Tt, T1L);
+		    }
+		    {
+			 E Tn, Tq, To, T1J, Tm, Tp;
+			 Tn = ri[WS(rs, 8)];
+			 Tq = ii[WS(rs, 8)];
+			 Tm = W[14];
+			 To = Tm * Tn;
+			 T1J = Tm * Tq;
+			 Tp = W[15];
+			 Tr = FMA(Tp, Tq, To);
+			 T1K = FNMS(Tp, Tn, T1J);
+		    }
+		    {
+			 E T1N, Ty, T1I, T2s, T2q, T2r;
+			 T1N = T1K - T1M;
+			 Ty = Tr + Tx;
+			 T1I = FNMS(KP500000000, Ty, Tl);
+			 Tz = Tl + Ty;
+			 T2e = FMA(KP866025403, T1N, T1I);
+			 T1O = FNMS(KP866025403, T1N, T1I);
+			 T2s = Tx - Tr;
+			 T2q = T1K + T1M;
+			 T2r = FNMS(KP500000000, T2q, T2p);
+			 T2t = FMA(KP866025403, T2s, T2r);
+			 T39 = T2p + T2q;
+			 T2X = FNMS(KP866025403, T2s, T2r);
+		    }
+	       }
+	       {
+		    E TF, T2v, TR, T1T, TL, T1R;
+		    {
+			 E TB, TE, TC, T2u, TA, TD;
+			 TB = ri[WS(rs, 12)];
+			 TE = ii[WS(rs, 12)];
+			 TA = W[22];
+			 TC = TA * TB;
+			 T2u = TA * TE;
+			 TD = W[23];
+			 TF = FMA(TD, TE, TC);
+			 T2v = FNMS(TD, TB, T2u);
+		    }
+		    {
+			 E TN, TQ, TO, T1S, TM, TP;
+			 TN = ri[WS(rs, 7)];
+			 TQ = ii[WS(rs, 7)];
+			 TM = W[12];
+			 TO = TM * TN;
+			 T1S = TM * TQ;
+			 TP = W[13];
+			 TR = FMA(TP, TQ, TO);
+			 T1T = FNMS(TP, TN, T1S);
+		    }
+		    {
+			 E TH, TK, TI, T1Q, TG, TJ;
+			 TH = ri[WS(rs, 2)];
+			 TK = ii[WS(rs, 2)];
+			 TG = W[2];
+			 TI = TG * TH;
+			 T1Q = TG * TK;
+			 TJ = W[3];
+			 TL = FMA(TJ, TK, TI);
+			 T1R = FNMS(TJ, TH, T1Q);
+		    }
+		    {
+			 E T1U, TS, T1P, T2y, T2w, T2x;
+			 T1U = T1R - T1T;
+			 TS = TL + TR;
+			 T1P = FNMS(KP500000000, TS, TF);
+			 TT = TF + TS;
+			 T2f = FMA(KP866025403, T1U, T1P);
+			 T1V = FNMS(KP866025403, T1U, T1P);
+			 T2y = TR - TL;
+			 T2w = T1R + T1T;
+			 T2x = FNMS(KP500000000, T2w, T2v);
+			 T2z = FMA(KP866025403, T2y, T2x);
+			 T3a = T2v + T2w;
+			 T2Y = FNMS(KP866025403, T2y, T2x);
+		    }
+	       }
+	       {
+		    E T10, T2C, T1c, T21, T16, T1Z;
+		    {
+			 E TW, TZ, TX, T2B, TV, TY;
+			 TW = ri[WS(rs, 6)];
+			 TZ = ii[WS(rs, 6)];
+			 TV = W[10];
+			 TX = TV * TW;
+			 T2B = TV * TZ;
+			 TY = W[11];
+			 T10 = FMA(TY, TZ, TX);
+			 T2C = FNMS(TY, TW, T2B);
+		    }
+		    {
+			 E T18, T1b, T19, T20, T17, T1a;
+			 T18 = ri[WS(rs, 1)];
+			 T1b = ii[WS(rs, 1)];
+			 T17 = W[0];
+			 T19 = T17 * T18;
+			 T20 = T17 * T1b;
+			 T1a = W[1];
+			 T1c = FMA(T1a, T1b, T19);
+			 T21 = FNMS(T1a, T18, T20);
+		    }
+		    {
+			 E T12, T15, T13, T1Y, T11, T14;
+			 T12 = ri[WS(rs, 11)];
+			 T15 = ii[WS(rs, 11)];
+			 T11 = W[20];
+			 T13 = T11 * T12;
+			 T1Y = T11 * T15;
+			 T14 = W[21];
+			 T16 = FMA(T14, T15, T13);
+			 T1Z = FNMS(T14, T12, T1Y);
+		    }
+		    {
+			 E T22, T1d, T1X, T2F, T2D, T2E;
+			 T22 = T1Z - T21;
+			 T1d = T16 + T1c;
+			 T1X = FNMS(KP500000000, T1d, T10);
+			 T1e = T10 + T1d;
+			 T2h = FMA(KP866025403, T22, T1X);
+			 T23 = FNMS(KP866025403, T22, T1X);
+			 T2F = T1c - T16;
+			 T2D = T1Z + T21;
+			 T2E = FNMS(KP500000000, T2D, T2C);
+			 T2G = FMA(KP866025403, T2F, T2E);
+			 T36 = T2C + T2D;
+			 T2U = FNMS(KP866025403, T2F, T2E);
+		    }
+	       }
+	       {
+		    E T3c, T3e, Tf, T1A, T33, T34, T3d, T35;
+		    {
+			 E T38, T3b, TU, T1z;
+			 T38 = T36 - T37;
+			 T3b = T39 - T3a;
+			 T3c = FNMS(KP618033988, T3b, T38);
+			 T3e = FMA(KP618033988, T38, T3b);
+			 Tf = T1 + Te;
+			 TU = Tz + TT;
+			 T1z = T1e + T1y;
+			 T1A = TU + T1z;
+			 T33 = FNMS(KP250000000, T1A, Tf);
+			 T34 = TU - T1z;
+		    }
+		    ri[0] = Tf + T1A;
+		    T3d = FMA(KP559016994, T34, T33);
+		    ri[WS(rs, 9)] = FNMS(KP951056516, T3e, T3d);
+		    ri[WS(rs, 6)] = FMA(KP951056516, T3e, T3d);
+		    T35 = FNMS(KP559016994, T34, T33);
+		    ri[WS(rs, 12)] = FNMS(KP951056516, T3c, T35);
+		    ri[WS(rs, 3)] = FMA(KP951056516, T3c, T35);
+	       }
+	       {
+		    E T3q, T3s, T3k, T3h, T3l, T3m, T3r, T3n;
+		    {
+			 E T3o, T3p, T3f, T3g;
+			 T3o = T1e - T1y;
+			 T3p = Tz - TT;
+			 T3q = FNMS(KP618033988, T3p, T3o);
+			 T3s = FMA(KP618033988, T3o, T3p);
+			 T3k = T3i + T3j;
+			 T3f = T39 + T3a;
+			 T3g = T36 + T37;
+			 T3h = T3f + T3g;
+			 T3l = FNMS(KP250000000, T3h, T3k);
+			 T3m = T3f - T3g;
+		    }
+		    ii[0] = T3h + T3k;
+		    T3r = FMA(KP559016994, T3m, T3l);
+		    ii[WS(rs, 6)] = FNMS(KP951056516, T3s, T3r);
+		    ii[WS(rs, 9)] = FMA(KP951056516, T3s, T3r);
+		    T3n = FNMS(KP559016994, T3m, T3l);
+		    ii[WS(rs, 3)] = FNMS(KP951056516, T3q, T3n);
+		    ii[WS(rs, 12)] = FMA(KP951056516, T3q, T3n);
+	       }
+	       {
+		    E T30, T32, T1H, T2c, T2R, T2S, T31, T2T;
+		    {
+			 E T2W, T2Z, T1W, T2b;
+			 T2W = T2U - T2V;
+			 T2Z = T2X - T2Y;
+			 T30 = FNMS(KP618033988, T2Z, T2W);
+			 T32 = FMA(KP618033988, T2W, T2Z);
+			 T1H = FNMS(KP866025403, T1G, T1B);
+			 T1W = T1O + T1V;
+			 T2b = T23 + T2a;
+			 T2c = T1W + T2b;
+			 T2R = FNMS(KP250000000, T2c, T1H);
+			 T2S = T1W - T2b;
+		    }
+		    ri[WS(rs, 5)] = T1H + T2c;
+		    T31 = FMA(KP559016994, T2S, T2R);
+		    ri[WS(rs, 14)] = FNMS(KP951056516, T32, T31);
+		    ri[WS(rs, 11)] = FMA(KP951056516, T32, T31);
+		    T2T = FNMS(KP559016994, T2S, T2R);
+		    ri[WS(rs, 2)] = FNMS(KP951056516, T30, T2T);
+		    ri[WS(rs, 8)] = FMA(KP951056516, T30, T2T);
+	       }
+	       {
+		    E T3Q, T3S, T3H, T3K, T3L, T3M, T3R, T3N;
+		    {
+			 E T3O, T3P, T3I, T3J;
+			 T3O = T23 - T2a;
+			 T3P = T1O - T1V;
+			 T3Q = FNMS(KP618033988, T3P, T3O);
+			 T3S = FMA(KP618033988, T3O, T3P);
+			 T3H = FNMS(KP866025403, T3u, T3t);
+			 T3I = T2X + T2Y;
+			 T3J = T2U + T2V;
+			 T3K = T3I + T3J;
+			 T3L = FNMS(KP250000000, T3K, T3H);
+			 T3M = T3I - T3J;
+		    }
+		    ii[WS(rs, 5)] = T3K + T3H;
+		    T3R = FMA(KP559016994, T3M, T3L);
+		    ii[WS(rs, 11)] = FNMS(KP951056516, T3S, T3R);
+		    ii[WS(rs, 14)] = FMA(KP951056516, T3S, T3R);
+		    T3N = FNMS(KP559016994, T3M, T3L);
+		    ii[WS(rs, 2)] = FMA(KP951056516, T3Q, T3N);
+		    ii[WS(rs, 8)] = FNMS(KP951056516, T3Q, T3N);
+	       }
+	       {
+		    E T3E, T3G, T3v, T3y, T3z, T3A, T3F, T3B;
+		    {
+			 E T3C, T3D, T3w, T3x;
+			 T3C = T2e - T2f;
+			 T3D = T2h - T2i;
+			 T3E = FMA(KP618033988, T3D, T3C);
+			 T3G = FNMS(KP618033988, T3C, T3D);
+			 T3v = FMA(KP866025403, T3u, T3t);
+			 T3w = T2t + T2z;
+			 T3x = T2G + T2M;
+			 T3y = T3w + T3x;
+			 T3z = FNMS(KP250000000, T3y, T3v);
+			 T3A = T3w - T3x;
+		    }
+		    ii[WS(rs, 10)] = T3y + T3v;
+		    T3F = FNMS(KP559016994, T3A, T3z);
+		    ii[WS(rs, 7)] = FMA(KP951056516, T3G, T3F);
+		    ii[WS(rs, 13)] = FNMS(KP951056516, T3G, T3F);
+		    T3B = FMA(KP559016994, T3A, T3z);
+		    ii[WS(rs, 1)] = FNMS(KP951056516, T3E, T3B);
+		    ii[WS(rs, 4)] = FMA(KP951056516, T3E, T3B);
+	       }
+	       {
+		    E T2O, T2Q, T2d, T2k, T2l, T2m, T2P, T2n;
+		    {
+			 E T2A, T2N, T2g, T2j;
+			 T2A = T2t - T2z;
+			 T2N = T2G - T2M;
+			 T2O = FMA(KP618033988, T2N, T2A);
+			 T2Q = FNMS(KP618033988, T2A, T2N);
+			 T2d = FMA(KP866025403, T1G, T1B);
+			 T2g = T2e + T2f;
+			 T2j = T2h + T2i;
+			 T2k = T2g + T2j;
+			 T2l = FNMS(KP250000000, T2k, T2d);
+			 T2m = T2g - T2j;
+		    }
+		    ri[WS(rs, 10)] = T2d + T2k;
+		    T2P = FNMS(KP559016994, T2m, T2l);
+		    ri[WS(rs, 7)] = FNMS(KP951056516, T2Q, T2P);
+		    ri[WS(rs, 13)] = FMA(KP951056516, T2Q, T2P);
+		    T2n = FMA(KP559016994, T2m, T2l);
+		    ri[WS(rs, 4)] = FNMS(KP951056516, T2O, T2n);
+		    ri[WS(rs, 1)] = FMA(KP951056516, T2O, T2n);
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_FULL, 0, 15 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 15, "t1_15", twinstr, &GENUS, { 72, 28, 112, 0 }, 0, 0, 0 };
+
+void X(codelet_t1_15) (planner *p) {
+     X(kdft_dit_register) (p, t1_15, &desc);
+}
+#else
+
+/* Generated by: ../../../genfft/gen_twiddle.native -compact -variables 4 -pipeline-latency 4 -n 15 -name t1_15 -include dft/scalar/t.h */
+
+/*
+ * This function contains 184 FP additions, 112 FP multiplications,
+ * (or, 128 additions, 56 multiplications, 56 fused multiply/add),
+ * 65 stack variables, 6 constants, and 60 memory accesses
+ */
+#include "dft/scalar/t.h"
+
+static void t1_15(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DK(KP587785252, +0.587785252292473129168705954639072768597652438);
+     DK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DK(KP500000000, +0.500000000000000000000000000000000000000000000);
+     DK(KP866025403, +0.866025403784438646763723170752936183471402627);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 28); m < me; m = m + 1, ri = ri + ms, ii = ii + ms, W = W + 28, MAKE_VOLATILE_STRIDE(30, rs)) {
+	       E T1q, T34, Td, T1n, T2S, T35, T13, T1k, T1l, T2E, T2F, T2O, T1H, T1T, T2k;
+	       E T2t, T2f, T2s, T1M, T1U, Tu, TL, TM, T2H, T2I, T2N, T1w, T1Q, T29, T2w;
+	       E T24, T2v, T1B, T1R;
+	       {
+		    E T1, T2R, T6, T1o, Tb, T1p, Tc, T2Q;
+		    T1 = ri[0];
+		    T2R = ii[0];
+		    {
+			 E T3, T5, T2, T4;
+			 T3 = ri[WS(rs, 5)];
+			 T5 = ii[WS(rs, 5)];
+			 T2 = W[8];
+			 T4 = W[9];
+			 T6 = FMA(T2, T3, T4 * T5);
+			 T1o = FNMS(T4, T3, T2 * T5);
+		    }
+		    {
+			 E T8, Ta, T7, T9;
+			 T8 = ri[WS(rs, 10)];
+			 Ta = ii[WS(rs, 10)];
+			 T7 = W[18];
+			 T9 = W[19];
+			 Tb = FMA(T7, T8, T9 * Ta);
+			 T1p = FNMS(T9, T8, T7 * Ta);
+		    }
+		    T1q = KP866025403 * (T1o - T1p);
+		    T34 = KP866025403 * (Tb - T6);
+		    Tc = T6 + Tb;
+		    Td = T1 + Tc;
+		    T1n = FNMS(KP500000000, Tc, T1);
+		    T2Q = T1o + T1p;
+		    T2S = T2Q + T2R;
+		    T35 = FNMS(KP500000000, T2Q, T2R);
+	       }
+	       {
+		    E TR, T2c, T18, T2h, TW, T1E, T11, T1F, T12, T2d, T1d, T1J, T1i, T1K, T1j;
+		    E T2i;
+		    {
+			 E TO, TQ, TN, TP;
+			 TO = ri[WS(rs, 6)];
+			 TQ = ii[WS(rs, 6)];
+			 TN = W[10];
+			 TP = W[11];
+			 TR = FMA(TN, TO, TP * TQ);
+			 T2c = FNMS(TP, TO, TN * TQ);
+		    }
+		    {
+			 E T15, T17, T14, T16;
+			 T15 = ri[WS(rs, 9)];
+			 T17 = ii[WS(rs, 9)];
+			 T14 = W[16];
+			 T16 = W[17];
+			 T18 = FMA(T14, T15, T16 * T17);
+			 T2h = FNMS(T16, T15, T14 * T17);
+		    }
+		    {
+			 E TT, TV, TS, TU;
+			 TT = ri[WS(rs, 11)];
+			 TV = ii[WS(rs, 11)];
+			 TS = W[20];
+			 TU = W[21];
+			 TW = FMA(TS, TT, TU * TV);
+			 T1E = FNMS(TU, TT, TS * TV);
+		    }
+		    {
+			 E TY, T10, TX, TZ;
+			 TY = ri[WS(rs, 1)];
+			 T10 = ii[WS(rs, 1)];
+			 TX = W[0];
+			 TZ = W[1];
+			 T11 = FMA(TX, TY, TZ * T10);
+			 T1F = FNMS(TZ, TY, TX * T10);
+		    }
+		    T12 = TW + T11;
+		    T2d = T1E + T1F;
+		    {
+			 E T1a, T1c, T19, T1b;
+			 T1a = ri[WS(rs, 14)];
+			 T1c = ii[WS(rs, 14)];
+			 T19 = W[26];
+			 T1b = W[27];
+			 T1d = FMA(T19, T1a, T1b * T1c);
+			 T1J = FNMS(T1b, T1a, T19 * T1c);
+		    }
+		    {
+			 E T1f, T1h, T1e, T1g;
+			 T1f = ri[WS(rs, 4)];
+			 T1h = ii[WS(rs, 4)];
+			 T1e = W[6];
+			 T1g = W[7];
+			 T1i = FMA(T1e, T1f, T1g * T1h);
+			 T1K = FNMS(T1g, T1f, T1e * T1h);
+		    }
+		    T1j = T1d + T1i;
+		    T2i = T1J + T1K;
+		    {
+			 E T1D, T1G, T2g, T2j;
+			 T13 = TR + T12;
+			 T1k = T18 + T1j;
+			 T1l = T13 + T1k;
+			 T2E = T2c + T2d;
+			 T2F = T2h + T2i;
+			 T2O = T2E + T2F;
+			 T1D = FNMS(KP500000000, T12, TR);
+			 T1G = KP866025403 * (T1E - T1F);
+			 T1H = T1D - T1G;
+			 T1T = T1D + T1G;
+			 T2g = KP866025403 * (T1i - T1d);
+			 T2j = FNMS(KP500000000, T2i, T2h);
+			 T2k = T2g + T2j;
+			 T2t = T2j - T2g;
+			 {
+			      E T2b, T2e, T1I, T1L;
+			      T2b = KP866025403 * (T11 - TW);
+			      T2e = FNMS(KP500000000, T2d, T2c);
+			      T2f = T2b + T2e;
+			      T2s = T2e - T2b;
+			      T1I = FNMS(KP500000000, T1j, T18);
+			      T1L = KP866025403 * (T1J - T1K);
+			      T1M = T1I - T1L;
+			      T1U = T1I + T1L;
+			 }
+		    }
+	       }
+	       {
+		    E Ti, T21, Tz, T26, Tn, T1t, Ts, T1u, Tt, T22, TE, T1y, TJ, T1z, TK;
+		    E T27;
+		    {
+			 E Tf, Th, Te, Tg;
+			 Tf = ri[WS(rs, 3)];
+			 Th = ii[WS(rs, 3)];
+			 Te = W[4];
+			 Tg = W[5];
+			 Ti = FMA(Te, Tf, Tg * Th);
+			 T21 = FNMS(Tg, Tf, Te * Th);
+		    }
+		    {
+			 E Tw, Ty, Tv, Tx;
+			 Tw = ri[WS(rs, 12)];
+			 Ty = ii[WS(rs, 12)];
+			 Tv = W[22];
+			 Tx = W[23];
+			 Tz = FMA(Tv, Tw, Tx * Ty);
+			 T26 = FNMS(Tx, Tw, Tv * Ty);
+		    }
+		    {
+			 E Tk, Tm, Tj, Tl;
+			 Tk = ri[WS(rs, 8)];
+			 Tm = ii[WS(rs, 8)];
+			 Tj = W[14];
+			 Tl = W[15];
+			 Tn = FMA(Tj, Tk, Tl * Tm);
+			 T1t = FNMS(Tl, Tk, Tj * Tm);
+		    }
+		    {
+			 E Tp, Tr, To, Tq;
+			 Tp = ri[WS(rs, 13)];
+			 Tr = ii[WS(rs, 13)];
+			 To = W[24];
+			 Tq = W[25];
+			 Ts = FMA(To, Tp, Tq * Tr);
+			 T1u = FNMS(Tq, Tp, To * Tr);
+		    }
+		    Tt = Tn + Ts;
+		    T22 = T1t + T1u;
+		    {
+			 E TB, TD, TA, TC;
+			 TB = ri[WS(rs, 2)];
+			 TD = ii[WS(rs, 2)];
+			 TA = W[2];
+			 TC = W[3];
+			 TE = FMA(TA, TB, TC * TD);
+			 T1y = FNMS(TC, TB, TA * TD);
+		    }
+		    {
+			 E TG, TI, TF, TH;
+			 TG = ri[WS(rs, 7)];
+			 TI = ii[WS(rs, 7)];
+			 TF = W[12];
+			 TH = W[13];
+			 TJ = FMA(TF, TG, TH * TI);
+			 T1z = FNMS(TH, TG, TF * TI);
+		    }
+		    TK = TE + TJ;
+		    T27 = T1y + T1z;
+		    {
+			 E T1s, T1v, T25, T28;
+			 Tu = Ti + Tt;
+			 TL = Tz + TK;
+			 TM = Tu + TL;
+			 T2H = T21 + T22;
+			 T2I = T26 + T27;
+			 T2N = T2H + T2I;
+			 T1s = FNMS(KP500000000, Tt, Ti);
+			 T1v = KP866025403 * (T1t - T1u);
+			 T1w = T1s - T1v;
+			 T1Q = T1s + T1v;
+			 T25 = KP866025403 * (TJ - TE);
+			 T28 = FNMS(KP500000000, T27, T26);
+			 T29 = T25 + T28;
+			 T2w = T28 - T25;
+			 {
+			      E T20, T23, T1x, T1A;
+			      T20 = KP866025403 * (Ts - Tn);
+			      T23 = FNMS(KP500000000, T22, T21);
+			      T24 = T20 + T23;
+			      T2v = T23 - T20;
+			      T1x = FNMS(KP500000000, TK, Tz);
+			      T1A = KP866025403 * (T1y - T1z);
+			      T1B = T1x - T1A;
+			      T1R = T1x + T1A;
+			 }
+		    }
+	       }
+	       {
+		    E T2C, T1m, T2B, T2K, T2M, T2G, T2J, T2L, T2D;
+		    T2C = KP559016994 * (TM - T1l);
+		    T1m = TM + T1l;
+		    T2B = FNMS(KP250000000, T1m, Td);
+		    T2G = T2E - T2F;
+		    T2J = T2H - T2I;
+		    T2K = FNMS(KP587785252, T2J, KP951056516 * T2G);
+		    T2M = FMA(KP951056516, T2J, KP587785252 * T2G);
+		    ri[0] = Td + T1m;
+		    T2L = T2C + T2B;
+		    ri[WS(rs, 9)] = T2L - T2M;
+		    ri[WS(rs, 6)] = T2L + T2M;
+		    T2D = T2B - T2C;
+		    ri[WS(rs, 12)] = T2D - T2K;
+		    ri[WS(rs, 3)] = T2D + T2K;
+	       }
+	       {
+		    E T2U, T2P, T2T, T2Y, T30, T2W, T2X, T2Z, T2V;
+		    T2U = KP559016994 * (T2N - T2O);
+		    T2P = T2N + T2O;
+		    T2T = FNMS(KP250000000, T2P, T2S);
+		    T2W = T13 - T1k;
+		    T2X = Tu - TL;
+		    T2Y = FNMS(KP587785252, T2X, KP951056516 * T2W);
+		    T30 = FMA(KP951056516, T2X, KP587785252 * T2W);
+		    ii[0] = T2P + T2S;
+		    T2Z = T2U + T2T;
+		    ii[WS(rs, 6)] = T2Z - T30;
+		    ii[WS(rs, 9)] = T30 + T2Z;
+		    T2V = T2T - T2U;
+		    ii[WS(rs, 3)] = T2V - T2Y;
+		    ii[WS(rs, 12)] = T2Y + T2V;
+	       }
+	       {
+		    E T2y, T2A, T1r, T1O, T2p, T2q, T2z, T2r;
+		    {
+			 E T2u, T2x, T1C, T1N;
+			 T2u = T2s - T2t;
+			 T2x = T2v - T2w;
+			 T2y = FNMS(KP587785252, T2x, KP951056516 * T2u);
+			 T2A = FMA(KP951056516, T2x, KP587785252 * T2u);
+			 T1r = T1n - T1q;
+			 T1C = T1w + T1B;
+			 T1N = T1H + T1M;
+			 T1O = T1C + T1N;
+			 T2p = FNMS(KP250000000, T1O, T1r);
+			 T2q = KP559016994 * (T1C - T1N);
+		    }
+		    ri[WS(rs, 5)] = T1r + T1O;
+		    T2z = T2q + T2p;
+		    ri[WS(rs, 14)] = T2z - T2A;
+		    ri[WS(rs, 11)] = T2z + T2A;
+		    T2r = T2p - T2q;
+		    ri[WS(rs, 2)] = T2r - T2y;
+		    ri[WS(rs, 8)] = T2r + T2y;
+	       }
+	       {
+		    E T3h, T3q, T3i, T3l, T3m, T3n, T3p, T3o;
+		    {
+			 E T3f, T3g, T3j, T3k;
+			 T3f = T1H - T1M;
+			 T3g = T1w - T1B;
+			 T3h = FNMS(KP587785252, T3g, KP951056516 * T3f);
+			 T3q = FMA(KP951056516, T3g, KP587785252 * T3f);
+			 T3i = T35 - T34;
+			 T3j = T2v + T2w;
+			 T3k = T2s + T2t;
+			 T3l = T3j + T3k;
+			 T3m = FNMS(KP250000000, T3l, T3i);
+			 T3n = KP559016994 * (T3j - T3k);
+		    }
+		    ii[WS(rs, 5)] = T3l + T3i;
+		    T3p = T3n + T3m;
+		    ii[WS(rs, 11)] = T3p - T3q;
+		    ii[WS(rs, 14)] = T3q + T3p;
+		    T3o = T3m - T3n;
+		    ii[WS(rs, 2)] = T3h + T3o;
+		    ii[WS(rs, 8)] = T3o - T3h;
+	       }
+	       {
+		    E T3c, T3d, T36, T37, T33, T38, T3e, T39;
+		    {
+			 E T3a, T3b, T31, T32;
+			 T3a = T1Q - T1R;
+			 T3b = T1T - T1U;
+			 T3c = FMA(KP951056516, T3a, KP587785252 * T3b);
+			 T3d = FNMS(KP587785252, T3a, KP951056516 * T3b);
+			 T36 = T34 + T35;
+			 T31 = T24 + T29;
+			 T32 = T2f + T2k;
+			 T37 = T31 + T32;
+			 T33 = KP559016994 * (T31 - T32);
+			 T38 = FNMS(KP250000000, T37, T36);
+		    }
+		    ii[WS(rs, 10)] = T37 + T36;
+		    T3e = T38 - T33;
+		    ii[WS(rs, 7)] = T3d + T3e;
+		    ii[WS(rs, 13)] = T3e - T3d;
+		    T39 = T33 + T38;
+		    ii[WS(rs, 1)] = T39 - T3c;
+		    ii[WS(rs, 4)] = T3c + T39;
+	       }
+	       {
+		    E T2m, T2o, T1P, T1W, T1X, T1Y, T2n, T1Z;
+		    {
+			 E T2a, T2l, T1S, T1V;
+			 T2a = T24 - T29;
+			 T2l = T2f - T2k;
+			 T2m = FMA(KP951056516, T2a, KP587785252 * T2l);
+			 T2o = FNMS(KP587785252, T2a, KP951056516 * T2l);
+			 T1P = T1n + T1q;
+			 T1S = T1Q + T1R;
+			 T1V = T1T + T1U;
+			 T1W = T1S + T1V;
+			 T1X = KP559016994 * (T1S - T1V);
+			 T1Y = FNMS(KP250000000, T1W, T1P);
+		    }
+		    ri[WS(rs, 10)] = T1P + T1W;
+		    T2n = T1Y - T1X;
+		    ri[WS(rs, 7)] = T2n - T2o;
+		    ri[WS(rs, 13)] = T2n + T2o;
+		    T1Z = T1X + T1Y;
+		    ri[WS(rs, 4)] = T1Z - T2m;
+		    ri[WS(rs, 1)] = T1Z + T2m;
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_FULL, 0, 15 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 15, "t1_15", twinstr, &GENUS, { 128, 56, 56, 0 }, 0, 0, 0 };
+
+void X(codelet_t1_15) (planner *p) {
+     X(kdft_dit_register) (p, t1_15, &desc);
+}
+#endif
@@ -0,0 +1,1572 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:44:30 EDT 2021 */
+
+#include "dft/codelet-dft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_twiddle.native -fma -compact -variables 4 -pipeline-latency 4 -n 25 -name t1_25 -include dft/scalar/t.h */
+
+/*
+ * This function contains 400 FP additions, 364 FP multiplications,
+ * (or, 84 additions, 48 multiplications, 316 fused multiply/add),
+ * 138 stack variables, 47 constants, and 100 memory accesses
+ */
+#include "dft/scalar/t.h"
+
+static void t1_25(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DK(KP860541664, +0.860541664367944677098261680920518816412804187);
+     DK(KP560319534, +0.560319534973832390111614715371676131169633784);
+     DK(KP681693190, +0.681693190061530575150324149145440022633095390);
+     DK(KP949179823, +0.949179823508441261575555465843363271711583843);
+     DK(KP557913902, +0.557913902031834264187699648465567037992437152);
+     DK(KP249506682, +0.249506682107067890488084201715862638334226305);
+     DK(KP614372930, +0.614372930789563808870829930444362096004872855);
+     DK(KP621716863, +0.621716863012209892444754556304102309693593202);
+     DK(KP998026728, +0.998026728428271561952336806863450553336905220);
+     DK(KP906616052, +0.906616052148196230441134447086066874408359177);
+     DK(KP845997307, +0.845997307939530944175097360758058292389769300);
+     DK(KP968479752, +0.968479752739016373193524836781420152702090879);
+     DK(KP994076283, +0.994076283785401014123185814696322018529298887);
+     DK(KP772036680, +0.772036680810363904029489473607579825330539880);
+     DK(KP734762448, +0.734762448793050413546343770063151342619912334);
+     DK(KP062914667, +0.062914667253649757225485955897349402364686947);
+     DK(KP943557151, +0.943557151597354104399655195398983005179443399);
+     DK(KP803003575, +0.803003575438660414833440593570376004635464850);
+     DK(KP554608978, +0.554608978404018097464974850792216217022558774);
+     DK(KP248028675, +0.248028675328619457762448260696444630363259177);
+     DK(KP525970792, +0.525970792408939708442463226536226366643874659);
+     DK(KP726211448, +0.726211448929902658173535992263577167607493062);
+     DK(KP833417178, +0.833417178328688677408962550243238843138996060);
+     DK(KP921177326, +0.921177326965143320250447435415066029359282231);
+     DK(KP541454447, +0.541454447536312777046285590082819509052033189);
+     DK(KP242145790, +0.242145790282157779872542093866183953459003101);
+     DK(KP683113946, +0.683113946453479238701949862233725244439656928);
+     DK(KP559154169, +0.559154169276087864842202529084232643714075927);
+     DK(KP992114701, +0.992114701314477831049793042785778521453036709);
+     DK(KP968583161, +0.968583161128631119490168375464735813836012403);
+     DK(KP851038619, +0.851038619207379630836264138867114231259902550);
+     DK(KP912018591, +0.912018591466481957908415381764119056233607330);
+     DK(KP912575812, +0.912575812670962425556968549836277086778922727);
+     DK(KP470564281, +0.470564281212251493087595091036643380879947982);
+     DK(KP827271945, +0.827271945972475634034355757144307982555673741);
+     DK(KP126329378, +0.126329378446108174786050455341811215027378105);
+     DK(KP904730450, +0.904730450839922351881287709692877908104763647);
+     DK(KP831864738, +0.831864738706457140726048799369896829771167132);
+     DK(KP871714437, +0.871714437527667770979999223229522602943903653);
+     DK(KP549754652, +0.549754652192770074288023275540779861653779767);
+     DK(KP634619297, +0.634619297544148100711287640319130485732531031);
+     DK(KP939062505, +0.939062505817492352556001843133229685779824606);
+     DK(KP256756360, +0.256756360367726783319498520922669048172391148);
+     DK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DK(KP618033988, +0.618033988749894848204586834365638117720309180);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 48); m < me; m = m + 1, ri = ri + ms, ii = ii + ms, W = W + 48, MAKE_VOLATILE_STRIDE(50, rs)) {
+	       E T1, T6X, T3Y, T5G, T7c, T7C, Ts, T3L, T3M, T6W, T77, T78, T4P, T5T, T4W;
+	       E T5Q, T2G, T5S, T4M, T3G, T5P, T4T, T45, T65, T4c, T68, T11, T64, T42, T2Z;
+	       E T67, T49, T4k, T61, T4r, T5Y, T1z, T5X, T4o, T3d, T60, T4h, T4A, T5M, T4H;
+	       E T5J, T28, T5L, T4x, T3s, T5I, T4E;
+	       {
+		    E T7, T3P, Tq, T3W, Tk, T3U, Td, T3R;
+		    T1 = ri[0];
+		    T6X = ii[0];
+		    {
+			 E T3, T6, T4, T3O, T2, T5;
+			 T3 = ri[WS(rs, 5)];
+			 T6 = ii[WS(rs, 5)];
+			 T2 = W[8];
+			 T4 = T2 * T3;
+			 T3O = T2 * T6;
+			 T5 = W[9];
+			 T7 = FMA(T5, T6, T4);
+			 T3P = FNMS(T5, T3, T3O);
+		    }
+		    {
+			 E Tm, Tp, Tn, T3V, Tl, To;
+			 Tm = ri[WS(rs, 15)];
+			 Tp = ii[WS(rs, 15)];
+			 Tl = W[28];
+			 Tn = Tl * Tm;
+			 T3V = Tl * Tp;
+			 To = W[29];
+			 Tq = FMA(To, Tp, Tn);
+			 T3W = FNMS(To, Tm, T3V);
+		    }
+		    {
+			 E Tg, Tj, Th, T3T, Tf, Ti;
+			 Tg = ri[WS(rs, 10)];
+			 Tj = ii[WS(rs, 10)];
+			 Tf = W[18];
+			 Th = Tf * Tg;
+			 T3T = Tf * Tj;
+			 Ti = W[19];
+			 Tk = FMA(Ti, Tj, Th);
+			 T3U = FNMS(Ti, Tg, T3T);
+		    }
+		    {
+			 E T9, Tc, Ta, T3Q, T8, Tb;
+			 T9 = ri[WS(rs, 20)];
+			 Tc = ii[WS(rs, 20)];
+			 T8 = W[38];
+			 Ta = T8 * T9;
+			 T3Q = T8 * Tc;
+			 Tb = W[39];
+			 Td = FMA(Tb, Tc, Ta);
+			 T3R = FNMS(Tb, T9, T3Q);
+		    }
+		    {
+			 E T3S, T3X, T7a, T7b;
+			 T3S = T3P - T3R;
+			 T3X = T3U - T3W;
+			 T3Y = FMA(KP618033988, T3X, T3S);
+			 T5G = FNMS(KP618033988, T3S, T3X);
+			 T7a = T7 - Td;
+			 T7b = Tk - Tq;
+			 T7c = FMA(KP618033988, T7b, T7a);
+			 T7C = FNMS(KP618033988, T7a, T7b);
+		    }
+		    {
+			 E Te, Tr, T6U, T6V;
+			 Te = T7 + Td;
+			 Tr = Tk + Tq;
+			 Ts = Te + Tr;
+			 T3L = FNMS(KP250000000, Ts, T1);
+			 T3M = Te - Tr;
+			 T6U = T3P + T3R;
+			 T6V = T3U + T3W;
+			 T6W = T6U + T6V;
+			 T77 = FNMS(KP250000000, T6W, T6X);
+			 T78 = T6U - T6V;
+		    }
+	       }
+	       {
+		    E T2e, T3u, T2x, T3B, T2D, T3D, T2E, T3E, T2k, T3w, T2q, T3y, T2r, T3z;
+		    {
+			 E T2a, T2d, T2b, T3t, T29, T2c;
+			 T2a = ri[WS(rs, 3)];
+			 T2d = ii[WS(rs, 3)];
+			 T29 = W[4];
+			 T2b = T29 * T2a;
+			 T3t = T29 * T2d;
+			 T2c = W[5];
+			 T2e = FMA(T2c, T2d, T2b);
+			 T3u = FNMS(T2c, T2a, T3t);
+		    }
+		    {
+			 E T2t, T2w, T2u, T3A, T2z, T2C, T2A, T3C, T2s, T2y, T2v, T2B;
+			 T2t = ri[WS(rs, 13)];
+			 T2w = ii[WS(rs, 13)];
+			 T2s = W[24];
+			 T2u = T2s * T2t;
+			 T3A = T2s * T2w;
+			 T2z = ri[WS(rs, 18)];
+			 T2C = ii[WS(rs, 18)];
+			 T2y = W[34];
+			 T2A = T2y * T2z;
+			 T3C = T2y * T2C;
+			 T2v = W[25];
+			 T2x = FMA(T2v, T2w, T2u);
+			 T3B = FNMS(T2v, T2t, T3A);
+			 T2B = W[35];
+			 T2D = FMA(T2B, T2C, T2A);
+			 T3D = FNMS(T2B, T2z, T3C);
+			 T2E = T2x + T2D;
+			 T3E = T3B + T3D;
+		    }
+		    {
+			 E T2g, T2j, T2h, T3v, T2m, T2p, T2n, T3x, T2f, T2l, T2i, T2o;
+			 T2g = ri[WS(rs, 8)];
+			 T2j = ii[WS(rs, 8)];
+			 T2f = W[14];
+			 T2h = T2f * T2g;
+			 T3v = T2f * T2j;
+			 T2m = ri[WS(rs, 23)];
+			 T2p = ii[WS(rs, 23)];
+			 T2l = W[44];
+			 T2n = T2l * T2m;
+			 T3x = T2l * T2p;
+			 T2i = W[15];
+			 T2k = FMA(T2i, T2j, T2h);
+			 T3w = FNMS(T2i, T2g, T3v);
+			 T2o = W[45];
+			 T2q = FMA(T2o, T2p, T2n);
+			 T3y = FNMS(T2o, T2m, T3x);
+			 T2r = T2k + T2q;
+			 T3z = T3w + T3y;
+		    }
+		    {
+			 E T4N, T4O, T4U, T4V;
+			 T4N = T3y - T3w;
+			 T4O = T3D - T3B;
+			 T4P = FMA(KP618033988, T4O, T4N);
+			 T5T = FNMS(KP618033988, T4N, T4O);
+			 T4U = T2k - T2q;
+			 T4V = T2x - T2D;
+			 T4W = FMA(KP618033988, T4V, T4U);
+			 T5Q = FNMS(KP618033988, T4U, T4V);
+		    }
+		    {
+			 E T4L, T2F, T4K, T4S, T3F, T4R;
+			 T4L = T2E - T2r;
+			 T2F = T2r + T2E;
+			 T4K = FNMS(KP250000000, T2F, T2e);
+			 T2G = T2e + T2F;
+			 T5S = FMA(KP559016994, T4L, T4K);
+			 T4M = FNMS(KP559016994, T4L, T4K);
+			 T4S = T3E - T3z;
+			 T3F = T3z + T3E;
+			 T4R = FNMS(KP250000000, T3F, T3u);
+			 T3G = T3u + T3F;
+			 T5P = FMA(KP559016994, T4S, T4R);
+			 T4T = FNMS(KP559016994, T4S, T4R);
+		    }
+	       }
+	       {
+		    E Tz, T2N, TS, T2U, TY, T2W, TZ, T2X, TF, T2P, TL, T2R, TM, T2S;
+		    {
+			 E Tv, Ty, Tw, T2M, Tu, Tx;
+			 Tv = ri[WS(rs, 1)];
+			 Ty = ii[WS(rs, 1)];
+			 Tu = W[0];
+			 Tw = Tu * Tv;
+			 T2M = Tu * Ty;
+			 Tx = W[1];
+			 Tz = FMA(Tx, Ty, Tw);
+			 T2N = FNMS(Tx, Tv, T2M);
+		    }
+		    {
+			 E TO, TR, TP, T2T, TU, TX, TV, T2V, TN, TT, TQ, TW;
+			 TO = ri[WS(rs, 11)];
+			 TR = ii[WS(rs, 11)];
+			 TN = W[20];
+			 TP = TN * TO;
+			 T2T = TN * TR;
+			 TU = ri[WS(rs, 16)];
+			 TX = ii[WS(rs, 16)];
+			 TT = W[30];
+			 TV = TT * TU;
+			 T2V = TT * TX;
+			 TQ = W[21];
+			 TS = FMA(TQ, TR, TP);
+			 T2U = FNMS(TQ, TO, T2T);
+			 TW = W[31];
+			 TY = FMA(TW, TX, TV);
+			 T2W = FNMS(TW, TU, T2V);
+			 TZ = TS + TY;
+			 T2X = T2U + T2W;
+		    }
+		    {
+			 E TB, TE, TC, T2O, TH, TK, TI, T2Q, TA, TG, TD, TJ;
+			 TB = ri[WS(rs, 6)];
+			 TE = ii[WS(rs, 6)];
+			 TA = W[10];
+			 TC = TA * TB;
+			 T2O = TA * TE;
+			 TH = ri[WS(rs, 21)];
+			 TK = ii[WS(rs, 21)];
+			 TG = W[40];
+			 TI = TG * TH;
+			 T2Q = TG * TK;
+			 TD = W[11];
+			 TF = FMA(TD, TE, TC);
+			 T2P = FNMS(TD, TB, T2O);
+			 TJ = W[41];
+			 TL = FMA(TJ, TK, TI);
+			 T2R = FNMS(TJ, TH, T2Q);
+			 TM = TF + TL;
+			 T2S = T2P + T2R;
+		    }
+		    {
+			 E T43, T44, T4a, T4b;
+			 T43 = T2P - T2R;
+			 T44 = T2W - T2U;
+			 T45 = FNMS(KP618033988, T44, T43);
+			 T65 = FMA(KP618033988, T43, T44);
+			 T4a = TL - TF;
+			 T4b = TY - TS;
+			 T4c = FMA(KP618033988, T4b, T4a);
+			 T68 = FNMS(KP618033988, T4a, T4b);
+		    }
+		    {
+			 E T41, T10, T40, T48, T2Y, T47;
+			 T41 = TM - TZ;
+			 T10 = TM + TZ;
+			 T40 = FNMS(KP250000000, T10, Tz);
+			 T11 = Tz + T10;
+			 T64 = FNMS(KP559016994, T41, T40);
+			 T42 = FMA(KP559016994, T41, T40);
+			 T48 = T2S - T2X;
+			 T2Y = T2S + T2X;
+			 T47 = FNMS(KP250000000, T2Y, T2N);
+			 T2Z = T2N + T2Y;
+			 T67 = FNMS(KP559016994, T48, T47);
+			 T49 = FMA(KP559016994, T48, T47);
+		    }
+	       }
+	       {
+		    E T17, T31, T1q, T38, T1w, T3a, T1x, T3b, T1d, T33, T1j, T35, T1k, T36;
+		    {
+			 E T13, T16, T14, T30, T12, T15;
+			 T13 = ri[WS(rs, 4)];
+			 T16 = ii[WS(rs, 4)];
+			 T12 = W[6];
+			 T14 = T12 * T13;
+			 T30 = T12 * T16;
+			 T15 = W[7];
+			 T17 = FMA(T15, T16, T14);
+			 T31 = FNMS(T15, T13, T30);
+		    }
+		    {
+			 E T1m, T1p, T1n, T37, T1s, T1v, T1t, T39, T1l, T1r, T1o, T1u;
+			 T1m = ri[WS(rs, 14)];
+			 T1p = ii[WS(rs, 14)];
+			 T1l = W[26];
+			 T1n = T1l * T1m;
+			 T37 = T1l * T1p;
+			 T1s = ri[WS(rs, 19)];
+			 T1v = ii[WS(rs, 19)];
+			 T1r = W[36];
+			 T1t = T1r * T1s;
+			 T39 = T1r * T1v;
+			 T1o = W[27];
+			 T1q = FMA(T1o, T1p, T1n);
+			 T38 = FNMS(T1o, T1m, T37);
+			 T1u = W[37];
+			 T1w = FMA(T1u, T1v, T1t);
+			 T3a = FNMS(T1u, T1s, T39);
+			 T1x = T1q + T1w;
+			 T3b = T38 + T3a;
+		    }
+		    {
+			 E T19, T1c, T1a, T32, T1f, T1i, T1g, T34, T18, T1e, T1b, T1h;
+			 T19 = ri[WS(rs, 9)];
+			 T1c = ii[WS(rs, 9)];
+			 T18 = W[16];
+			 T1a = T18 * T19;
+			 T32 = T18 * T1c;
+			 T1f = ri[WS(rs, 24)];
+			 T1i = ii[WS(rs, 24)];
+			 T1e = W[46];
+			 T1g = T1e * T1f;
+			 T34 = T1e * T1i;
+			 T1b = W[17];
+			 T1d = FMA(T1b, T1c, T1a);
+			 T33 = FNMS(T1b, T19, T32);
+			 T1h = W[47];
+			 T1j = FMA(T1h, T1i, T1g);
+			 T35 = FNMS(T1h, T1f, T34);
+			 T1k = T1d + T1j;
+			 T36 = T33 + T35;
+		    }
+		    {
+			 E T4i, T4j, T4p, T4q;
+			 T4i = T1j - T1d;
+			 T4j = T1w - T1q;
+			 T4k = FMA(KP618033988, T4j, T4i);
+			 T61 = FNMS(KP618033988, T4i, T4j);
+			 T4p = T35 - T33;
+			 T4q = T3a - T38;
+			 T4r = FMA(KP618033988, T4q, T4p);
+			 T5Y = FNMS(KP618033988, T4p, T4q);
+		    }
+		    {
+			 E T4n, T1y, T4m, T4g, T3c, T4f;
+			 T4n = T1k - T1x;
+			 T1y = T1k + T1x;
+			 T4m = FNMS(KP250000000, T1y, T17);
+			 T1z = T17 + T1y;
+			 T5X = FNMS(KP559016994, T4n, T4m);
+			 T4o = FMA(KP559016994, T4n, T4m);
+			 T4g = T3b - T36;
+			 T3c = T36 + T3b;
+			 T4f = FNMS(KP250000000, T3c, T31);
+			 T3d = T31 + T3c;
+			 T60 = FMA(KP559016994, T4g, T4f);
+			 T4h = FNMS(KP559016994, T4g, T4f);
+		    }
+	       }
+	       {
+		    E T1G, T3g, T1Z, T3n, T25, T3p, T26, T3q, T1M, T3i, T1S, T3k, T1T, T3l;
+		    {
+			 E T1C, T1F, T1D, T3f, T1B, T1E;
+			 T1C = ri[WS(rs, 2)];
+			 T1F = ii[WS(rs, 2)];
+			 T1B = W[2];
+			 T1D = T1B * T1C;
+			 T3f = T1B * T1F;
+			 T1E = W[3];
+			 T1G = FMA(T1E, T1F, T1D);
+			 T3g = FNMS(T1E, T1C, T3f);
+		    }
+		    {
+			 E T1V, T1Y, T1W, T3m, T21, T24, T22, T3o, T1U, T20, T1X, T23;
+			 T1V = ri[WS(rs, 12)];
+			 T1Y = ii[WS(rs, 12)];
+			 T1U = W[22];
+			 T1W = T1U * T1V;
+			 T3m = T1U * T1Y;
+			 T21 = ri[WS(rs, 17)];
+			 T24 = ii[WS(rs, 17)];
+			 T20 = W[32];
+			 T22 = T20 * T21;
+			 T3o = T20 * T24;
+			 T1X = W[23];
+			 T1Z = FMA(T1X, T1Y, T1W);
+			 T3n = FNMS(T1X, T1V, T3m);
+			 T23 = W[33];
+			 T25 = FMA(T23, T24, T22);
+			 T3p = FNMS(T23, T21, T3o);
+			 T26 = T1Z + T25;
+			 T3q = T3n + T3p;
+		    }
+		    {
+			 E T1I, T1L, T1J, T3h, T1O, T1R, T1P, T3j, T1H, T1N, T1K, T1Q;
+			 T1I = ri[WS(rs, 7)];
+			 T1L = ii[WS(rs, 7)];
+			 T1H = W[12];
+			 T1J = T1H * T1I;
+			 T3h = T1H * T1L;
+			 T1O = ri[WS(rs, 22)];
+			 T1R = ii[WS(rs, 22)];
+			 T1N = W[42];
+			 T1P = T1N * T1O;
+			 T3j = T1N * T1R;
+			 T1K = W[13];
+			 T1M = FMA(T1K, T1L, T1J);
+			 T3i = FNMS(T1K, T1I, T3h);
+			 T1Q = W[43];
+			 T1S = FMA(T1Q, T1R, T1P);
+			 T3k = FNMS(T1Q, T1O, T3j);
+			 T1T = T1M + T1S;
+			 T3l = T3i + T3k;
+		    }
+		    {
+			 E T4y, T4z, T4F, T4G;
+			 T4y = T3k - T3i;
+			 T4z = T3n - T3p;
+			 T4A = FNMS(KP618033988, T4z, T4y);
+			 T5M = FMA(KP618033988, T4y, T4z);
+			 T4F = T1S - T1M;
+			 T4G = T25 - T1Z;
+			 T4H = FMA(KP618033988, T4G, T4F);
+			 T5J = FNMS(KP618033988, T4F, T4G);
+		    }
+		    {
+			 E T4w, T27, T4v, T4D, T3r, T4C;
+			 T4w = T26 - T1T;
+			 T27 = T1T + T26;
+			 T4v = FNMS(KP250000000, T27, T1G);
+			 T28 = T1G + T27;
+			 T5L = FMA(KP559016994, T4w, T4v);
+			 T4x = FNMS(KP559016994, T4w, T4v);
+			 T4D = T3q - T3l;
+			 T3r = T3l + T3q;
+			 T4C = FNMS(KP250000000, T3r, T3g);
+			 T3s = T3g + T3r;
+			 T5I = FMA(KP559016994, T4D, T4C);
+			 T4E = FNMS(KP559016994, T4D, T4C);
+		    }
+	       }
+	       {
+		    E T3I, T3K, Tt, T2I, T2J, T2K, T3J, T2L;
+		    {
+			 E T3e, T3H, T1A, T2H;
+			 T3e = T2Z - T3d;
+			 T3H = T3s - T3G;
+			 T3I = FMA(KP618033988, T3H, T3e);
+			 T3K = FNMS(KP618033988, T3e, T3H);
+			 Tt = T1 + Ts;
+			 T1A = T11 + T1z;
+			 T2H = T28 + T2G;
+			 T2I = T1A + T2H;
+			 T2J = FNMS(KP250000000, T2I, Tt);
+			 T2K = T1A - T2H;
+		    }
+		    ri[0] = Tt + T2I;
+		    T3J = FNMS(KP559016994, T2K, T2J);
+		    ri[WS(rs, 10)] = FNMS(KP951056516, T3K, T3J);
+		    ri[WS(rs, 15)] = FMA(KP951056516, T3K, T3J);
+		    T2L = FMA(KP559016994, T2K, T2J);
+		    ri[WS(rs, 20)] = FNMS(KP951056516, T3I, T2L);
+		    ri[WS(rs, 5)] = FMA(KP951056516, T3I, T2L);
+	       }
+	       {
+		    E T74, T76, T6Y, T6T, T6Z, T70, T75, T71;
+		    {
+			 E T72, T73, T6R, T6S;
+			 T72 = T11 - T1z;
+			 T73 = T28 - T2G;
+			 T74 = FMA(KP618033988, T73, T72);
+			 T76 = FNMS(KP618033988, T72, T73);
+			 T6Y = T6W + T6X;
+			 T6R = T2Z + T3d;
+			 T6S = T3s + T3G;
+			 T6T = T6R + T6S;
+			 T6Z = FNMS(KP250000000, T6T, T6Y);
+			 T70 = T6R - T6S;
+		    }
+		    ii[0] = T6T + T6Y;
+		    T75 = FNMS(KP559016994, T70, T6Z);
+		    ii[WS(rs, 10)] = FMA(KP951056516, T76, T75);
+		    ii[WS(rs, 15)] = FNMS(KP951056516, T76, T75);
+		    T71 = FMA(KP559016994, T70, T6Z);
+		    ii[WS(rs, 5)] = FNMS(KP951056516, T74, T71);
+		    ii[WS(rs, 20)] = FMA(KP951056516, T74, T71);
+	       }
+	       {
+		    E T3Z, T5d, T7d, T7p, T56, T59, T7l, T7k, T7e, T7f, T7g, T4u, T4Z, T50, T5y;
+		    E T5B, T7x, T7w, T7q, T7r, T7s, T5k, T5r, T5s, T3N, T79;
+		    T3N = FMA(KP559016994, T3M, T3L);
+		    T3Z = FMA(KP951056516, T3Y, T3N);
+		    T5d = FNMS(KP951056516, T3Y, T3N);
+		    T79 = FMA(KP559016994, T78, T77);
+		    T7d = FNMS(KP951056516, T7c, T79);
+		    T7p = FMA(KP951056516, T7c, T79);
+		    {
+			 E T4e, T54, T4Y, T58, T4t, T55, T4J, T57;
+			 {
+			      E T46, T4d, T4Q, T4X;
+			      T46 = FMA(KP951056516, T45, T42);
+			      T4d = FMA(KP951056516, T4c, T49);
+			      T4e = FMA(KP256756360, T4d, T46);
+			      T54 = FNMS(KP256756360, T46, T4d);
+			      T4Q = FNMS(KP951056516, T4P, T4M);
+			      T4X = FNMS(KP951056516, T4W, T4T);
+			      T4Y = FMA(KP939062505, T4X, T4Q);
+			      T58 = FNMS(KP939062505, T4Q, T4X);
+			 }
+			 {
+			      E T4l, T4s, T4B, T4I;
+			      T4l = FMA(KP951056516, T4k, T4h);
+			      T4s = FNMS(KP951056516, T4r, T4o);
+			      T4t = FMA(KP634619297, T4s, T4l);
+			      T55 = FNMS(KP634619297, T4l, T4s);
+			      T4B = FNMS(KP951056516, T4A, T4x);
+			      T4I = FMA(KP951056516, T4H, T4E);
+			      T4J = FMA(KP549754652, T4I, T4B);
+			      T57 = FNMS(KP549754652, T4B, T4I);
+			 }
+			 T56 = FMA(KP871714437, T55, T54);
+			 T59 = FNMS(KP831864738, T58, T57);
+			 T7l = FNMS(KP831864738, T4Y, T4J);
+			 T7k = FNMS(KP871714437, T4t, T4e);
+			 T7e = FNMS(KP871714437, T55, T54);
+			 T7f = FMA(KP831864738, T58, T57);
+			 T7g = FMA(KP904730450, T7f, T7e);
+			 T4u = FMA(KP871714437, T4t, T4e);
+			 T4Z = FMA(KP831864738, T4Y, T4J);
+			 T50 = FMA(KP904730450, T4Z, T4u);
+		    }
+		    {
+			 E T5g, T5z, T5q, T5x, T5j, T5A, T5n, T5w;
+			 {
+			      E T5e, T5f, T5o, T5p;
+			      T5e = FMA(KP951056516, T4P, T4M);
+			      T5f = FMA(KP951056516, T4W, T4T);
+			      T5g = FNMS(KP126329378, T5f, T5e);
+			      T5z = FMA(KP126329378, T5e, T5f);
+			      T5o = FNMS(KP951056516, T4k, T4h);
+			      T5p = FMA(KP951056516, T4r, T4o);
+			      T5q = FMA(KP827271945, T5p, T5o);
+			      T5x = FNMS(KP827271945, T5o, T5p);
+			 }
+			 {
+			      E T5h, T5i, T5l, T5m;
+			      T5h = FNMS(KP951056516, T4H, T4E);
+			      T5i = FMA(KP951056516, T4A, T4x);
+			      T5j = FNMS(KP470564281, T5i, T5h);
+			      T5A = FMA(KP470564281, T5h, T5i);
+			      T5l = FNMS(KP951056516, T4c, T49);
+			      T5m = FNMS(KP951056516, T45, T42);
+			      T5n = FMA(KP634619297, T5m, T5l);
+			      T5w = FNMS(KP634619297, T5l, T5m);
+			 }
+			 T5y = FMA(KP912575812, T5x, T5w);
+			 T5B = FNMS(KP912018591, T5A, T5z);
+			 T7x = FMA(KP912018591, T5j, T5g);
+			 T7w = FMA(KP912575812, T5q, T5n);
+			 T7q = FMA(KP912018591, T5A, T5z);
+			 T7r = FNMS(KP912575812, T5x, T5w);
+			 T7s = FMA(KP851038619, T7r, T7q);
+			 T5k = FNMS(KP912018591, T5j, T5g);
+			 T5r = FNMS(KP912575812, T5q, T5n);
+			 T5s = FNMS(KP851038619, T5r, T5k);
+		    }
+		    ri[WS(rs, 1)] = FMA(KP968583161, T50, T3Z);
+		    ii[WS(rs, 1)] = FMA(KP968583161, T7g, T7d);
+		    ri[WS(rs, 4)] = FNMS(KP992114701, T5s, T5d);
+		    ii[WS(rs, 4)] = FNMS(KP992114701, T7s, T7p);
+		    {
+			 E T5a, T5c, T53, T5b, T51, T52;
+			 T5a = FMA(KP559154169, T59, T56);
+			 T5c = FNMS(KP683113946, T56, T59);
+			 T51 = FNMS(KP242145790, T50, T3Z);
+			 T52 = FNMS(KP904730450, T4Z, T4u);
+			 T53 = FMA(KP541454447, T52, T51);
+			 T5b = FNMS(KP541454447, T52, T51);
+			 ri[WS(rs, 6)] = FMA(KP921177326, T5a, T53);
+			 ri[WS(rs, 16)] = FMA(KP833417178, T5c, T5b);
+			 ri[WS(rs, 21)] = FNMS(KP921177326, T5a, T53);
+			 ri[WS(rs, 11)] = FNMS(KP833417178, T5c, T5b);
+		    }
+		    {
+			 E T7m, T7o, T7j, T7n, T7h, T7i;
+			 T7m = FMA(KP559154169, T7l, T7k);
+			 T7o = FNMS(KP683113946, T7k, T7l);
+			 T7h = FNMS(KP242145790, T7g, T7d);
+			 T7i = FNMS(KP904730450, T7f, T7e);
+			 T7j = FMA(KP541454447, T7i, T7h);
+			 T7n = FNMS(KP541454447, T7i, T7h);
+			 ii[WS(rs, 6)] = FNMS(KP921177326, T7m, T7j);
+			 ii[WS(rs, 16)] = FNMS(KP833417178, T7o, T7n);
+			 ii[WS(rs, 21)] = FMA(KP921177326, T7m, T7j);
+			 ii[WS(rs, 11)] = FMA(KP833417178, T7o, T7n);
+		    }
+		    {
+			 E T5C, T5E, T5v, T5D, T5t, T5u;
+			 T5C = FNMS(KP726211448, T5B, T5y);
+			 T5E = FMA(KP525970792, T5y, T5B);
+			 T5t = FMA(KP248028675, T5s, T5d);
+			 T5u = FMA(KP851038619, T5r, T5k);
+			 T5v = FMA(KP554608978, T5u, T5t);
+			 T5D = FNMS(KP554608978, T5u, T5t);
+			 ri[WS(rs, 9)] = FNMS(KP803003575, T5C, T5v);
+			 ri[WS(rs, 19)] = FMA(KP943557151, T5E, T5D);
+			 ri[WS(rs, 24)] = FMA(KP803003575, T5C, T5v);
+			 ri[WS(rs, 14)] = FNMS(KP943557151, T5E, T5D);
+		    }
+		    {
+			 E T7y, T7A, T7v, T7z, T7t, T7u;
+			 T7y = FMA(KP726211448, T7x, T7w);
+			 T7A = FNMS(KP525970792, T7w, T7x);
+			 T7t = FMA(KP248028675, T7s, T7p);
+			 T7u = FNMS(KP851038619, T7r, T7q);
+			 T7v = FMA(KP554608978, T7u, T7t);
+			 T7z = FNMS(KP554608978, T7u, T7t);
+			 ii[WS(rs, 9)] = FNMS(KP803003575, T7y, T7v);
+			 ii[WS(rs, 19)] = FNMS(KP943557151, T7A, T7z);
+			 ii[WS(rs, 24)] = FMA(KP803003575, T7y, T7v);
+			 ii[WS(rs, 14)] = FMA(KP943557151, T7A, T7z);
+		    }
+	       }
+	       {
+		    E T5H, T6p, T7D, T7P, T6i, T6l, T7X, T7W, T7Q, T7R, T7S, T5W, T6b, T6c, T6K;
+		    E T6N, T7L, T7K, T7E, T7F, T7G, T6w, T6D, T6E, T5F, T7B;
+		    T5F = FNMS(KP559016994, T3M, T3L);
+		    T5H = FMA(KP951056516, T5G, T5F);
+		    T6p = FNMS(KP951056516, T5G, T5F);
+		    T7B = FNMS(KP559016994, T78, T77);
+		    T7D = FMA(KP951056516, T7C, T7B);
+		    T7P = FNMS(KP951056516, T7C, T7B);
+		    {
+			 E T5O, T6j, T6a, T6h, T5V, T6k, T63, T6g;
+			 {
+			      E T5K, T5N, T66, T69;
+			      T5K = FMA(KP951056516, T5J, T5I);
+			      T5N = FMA(KP951056516, T5M, T5L);
+			      T5O = FMA(KP062914667, T5N, T5K);
+			      T6j = FNMS(KP062914667, T5K, T5N);
+			      T66 = FNMS(KP951056516, T65, T64);
+			      T69 = FMA(KP951056516, T68, T67);
+			      T6a = FMA(KP939062505, T69, T66);
+			      T6h = FNMS(KP939062505, T66, T69);
+			 }
+			 {
+			      E T5R, T5U, T5Z, T62;
+			      T5R = FNMS(KP951056516, T5Q, T5P);
+			      T5U = FNMS(KP951056516, T5T, T5S);
+			      T5V = FNMS(KP827271945, T5U, T5R);
+			      T6k = FMA(KP827271945, T5R, T5U);
+			      T5Z = FNMS(KP951056516, T5Y, T5X);
+			      T62 = FMA(KP951056516, T61, T60);
+			      T63 = FNMS(KP126329378, T62, T5Z);
+			      T6g = FMA(KP126329378, T5Z, T62);
+			 }
+			 T6i = FMA(KP734762448, T6h, T6g);
+			 T6l = FNMS(KP772036680, T6k, T6j);
+			 T7X = FNMS(KP772036680, T5V, T5O);
+			 T7W = FMA(KP734762448, T6a, T63);
+			 T7Q = FMA(KP772036680, T6k, T6j);
+			 T7R = FNMS(KP734762448, T6h, T6g);
+			 T7S = FMA(KP994076283, T7R, T7Q);
+			 T5W = FMA(KP772036680, T5V, T5O);
+			 T6b = FNMS(KP734762448, T6a, T63);
+			 T6c = FNMS(KP994076283, T6b, T5W);
+		    }
+		    {
+			 E T6s, T6L, T6C, T6J, T6v, T6M, T6z, T6I;
+			 {
+			      E T6q, T6r, T6A, T6B;
+			      T6q = FMA(KP951056516, T5Q, T5P);
+			      T6r = FMA(KP951056516, T5T, T5S);
+			      T6s = FMA(KP062914667, T6r, T6q);
+			      T6L = FNMS(KP062914667, T6q, T6r);
+			      T6A = FMA(KP951056516, T65, T64);
+			      T6B = FNMS(KP951056516, T68, T67);
+			      T6C = FMA(KP549754652, T6B, T6A);
+			      T6J = FNMS(KP549754652, T6A, T6B);
+			 }
+			 {
+			      E T6t, T6u, T6x, T6y;
+			      T6t = FNMS(KP951056516, T5J, T5I);
+			      T6u = FNMS(KP951056516, T5M, T5L);
+			      T6v = FMA(KP634619297, T6u, T6t);
+			      T6M = FNMS(KP634619297, T6t, T6u);
+			      T6x = FNMS(KP951056516, T61, T60);
+			      T6y = FMA(KP951056516, T5Y, T5X);
+			      T6z = FNMS(KP470564281, T6y, T6x);
+			      T6I = FMA(KP470564281, T6x, T6y);
+			 }
+			 T6K = FMA(KP968479752, T6J, T6I);
+			 T6N = FNMS(KP845997307, T6M, T6L);
+			 T7L = FNMS(KP845997307, T6v, T6s);
+			 T7K = FNMS(KP968479752, T6C, T6z);
+			 T7E = FMA(KP845997307, T6M, T6L);
+			 T7F = FNMS(KP968479752, T6J, T6I);
+			 T7G = FMA(KP906616052, T7F, T7E);
+			 T6w = FMA(KP845997307, T6v, T6s);
+			 T6D = FMA(KP968479752, T6C, T6z);
+			 T6E = FMA(KP906616052, T6D, T6w);
+		    }
+		    ri[WS(rs, 3)] = FMA(KP998026728, T6c, T5H);
+		    ii[WS(rs, 3)] = FNMS(KP998026728, T7S, T7P);
+		    ri[WS(rs, 2)] = FMA(KP998026728, T6E, T6p);
+		    ii[WS(rs, 2)] = FNMS(KP998026728, T7G, T7D);
+		    {
+			 E T6m, T6o, T6f, T6n, T6d, T6e;
+			 T6m = FNMS(KP621716863, T6l, T6i);
+			 T6o = FMA(KP614372930, T6i, T6l);
+			 T6d = FNMS(KP249506682, T6c, T5H);
+			 T6e = FMA(KP994076283, T6b, T5W);
+			 T6f = FNMS(KP557913902, T6e, T6d);
+			 T6n = FMA(KP557913902, T6e, T6d);
+			 ri[WS(rs, 23)] = FNMS(KP943557151, T6m, T6f);
+			 ri[WS(rs, 13)] = FMA(KP949179823, T6o, T6n);
+			 ri[WS(rs, 8)] = FMA(KP943557151, T6m, T6f);
+			 ri[WS(rs, 18)] = FNMS(KP949179823, T6o, T6n);
+		    }
+		    {
+			 E T7Y, T80, T7V, T7Z, T7T, T7U;
+			 T7Y = FMA(KP621716863, T7X, T7W);
+			 T80 = FNMS(KP614372930, T7W, T7X);
+			 T7T = FMA(KP249506682, T7S, T7P);
+			 T7U = FNMS(KP994076283, T7R, T7Q);
+			 T7V = FMA(KP557913902, T7U, T7T);
+			 T7Z = FNMS(KP557913902, T7U, T7T);
+			 ii[WS(rs, 8)] = FNMS(KP943557151, T7Y, T7V);
+			 ii[WS(rs, 18)] = FNMS(KP949179823, T80, T7Z);
+			 ii[WS(rs, 23)] = FMA(KP943557151, T7Y, T7V);
+			 ii[WS(rs, 13)] = FMA(KP949179823, T80, T7Z);
+		    }
+		    {
+			 E T6O, T6Q, T6H, T6P, T6F, T6G;
+			 T6O = FMA(KP681693190, T6N, T6K);
+			 T6Q = FNMS(KP560319534, T6K, T6N);
+			 T6F = FNMS(KP249506682, T6E, T6p);
+			 T6G = FNMS(KP906616052, T6D, T6w);
+			 T6H = FNMS(KP557913902, T6G, T6F);
+			 T6P = FMA(KP557913902, T6G, T6F);
+			 ri[WS(rs, 22)] = FNMS(KP860541664, T6O, T6H);
+			 ri[WS(rs, 17)] = FMA(KP949179823, T6Q, T6P);
+			 ri[WS(rs, 7)] = FMA(KP860541664, T6O, T6H);
+			 ri[WS(rs, 12)] = FNMS(KP949179823, T6Q, T6P);
+		    }
+		    {
+			 E T7M, T7O, T7J, T7N, T7H, T7I;
+			 T7M = FMA(KP681693190, T7L, T7K);
+			 T7O = FNMS(KP560319534, T7K, T7L);
+			 T7H = FMA(KP249506682, T7G, T7D);
+			 T7I = FNMS(KP906616052, T7F, T7E);
+			 T7J = FMA(KP557913902, T7I, T7H);
+			 T7N = FNMS(KP557913902, T7I, T7H);
+			 ii[WS(rs, 7)] = FMA(KP860541664, T7M, T7J);
+			 ii[WS(rs, 17)] = FMA(KP949179823, T7O, T7N);
+			 ii[WS(rs, 22)] = FNMS(KP860541664, T7M, T7J);
+			 ii[WS(rs, 12)] = FNMS(KP949179823, T7O, T7N);
+		    }
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_FULL, 0, 25 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 25, "t1_25", twinstr, &GENUS, { 84, 48, 316, 0 }, 0, 0, 0 };
+
+void X(codelet_t1_25) (planner *p) {
+     X(kdft_dit_register) (p, t1_25, &desc);
+}
+#else
+
+/* Generated by: ../../../genfft/gen_twiddle.native -compact -variables 4 -pipeline-latency 4 -n 25 -name t1_25 -include dft/scalar/t.h */
+
+/*
+ * This function contains 400 FP additions, 280 FP multiplications,
+ * (or, 260 additions, 140 multiplications, 140 fused multiply/add),
+ * 101 stack variables, 20 constants, and 100 memory accesses
+ */
+#include "dft/scalar/t.h"
+
+static void t1_25(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DK(KP998026728, +0.998026728428271561952336806863450553336905220);
+     DK(KP062790519, +0.062790519529313376076178224565631133122484832);
+     DK(KP425779291, +0.425779291565072648862502445744251703979973042);
+     DK(KP904827052, +0.904827052466019527713668647932697593970413911);
+     DK(KP992114701, +0.992114701314477831049793042785778521453036709);
+     DK(KP125333233, +0.125333233564304245373118759816508793942918247);
+     DK(KP637423989, +0.637423989748689710176712811676016195434917298);
+     DK(KP770513242, +0.770513242775789230803009636396177847271667672);
+     DK(KP684547105, +0.684547105928688673732283357621209269889519233);
+     DK(KP728968627, +0.728968627421411523146730319055259111372571664);
+     DK(KP481753674, +0.481753674101715274987191502872129653528542010);
+     DK(KP876306680, +0.876306680043863587308115903922062583399064238);
+     DK(KP844327925, +0.844327925502015078548558063966681505381659241);
+     DK(KP535826794, +0.535826794978996618271308767867639978063575346);
+     DK(KP248689887, +0.248689887164854788242283746006447968417567406);
+     DK(KP968583161, +0.968583161128631119490168375464735813836012403);
+     DK(KP587785252, +0.587785252292473129168705954639072768597652438);
+     DK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 48); m < me; m = m + 1, ri = ri + ms, ii = ii + ms, W = W + 48, MAKE_VOLATILE_STRIDE(50, rs)) {
+	       E T1, T6b, T2l, T6o, To, T2m, T6a, T6p, T6t, T6S, T2u, T4I, T2i, T60, T3O;
+	       E T5D, T4r, T58, T3Z, T5C, T4q, T5b, TS, T5W, T2G, T5s, T4g, T4M, T2R, T5t;
+	       E T4h, T4P, T1l, T5X, T33, T5w, T4j, T4W, T3e, T5v, T4k, T4T, T1P, T5Z, T3r;
+	       E T5z, T4o, T51, T3C, T5A, T4n, T54;
+	       {
+		    E T6, T2o, Tb, T2p, Tc, T68, Th, T2r, Tm, T2s, Tn, T69;
+		    T1 = ri[0];
+		    T6b = ii[0];
+		    {
+			 E T3, T5, T2, T4;
+			 T3 = ri[WS(rs, 5)];
+			 T5 = ii[WS(rs, 5)];
+			 T2 = W[8];
+			 T4 = W[9];
+			 T6 = FMA(T2, T3, T4 * T5);
+			 T2o = FNMS(T4, T3, T2 * T5);
+		    }
+		    {
+			 E T8, Ta, T7, T9;
+			 T8 = ri[WS(rs, 20)];
+			 Ta = ii[WS(rs, 20)];
+			 T7 = W[38];
+			 T9 = W[39];
+			 Tb = FMA(T7, T8, T9 * Ta);
+			 T2p = FNMS(T9, T8, T7 * Ta);
+		    }
+		    Tc = T6 + Tb;
+		    T68 = T2o + T2p;
+		    {
+			 E Te, Tg, Td, Tf;
+			 Te = ri[WS(rs, 10)];
+			 Tg = ii[WS(rs, 10)];
+			 Td = W[18];
+			 Tf = W[19];
+			 Th = FMA(Td, Te, Tf * Tg);
+			 T2r = FNMS(Tf, Te, Td * Tg);
+		    }
+		    {
+			 E Tj, Tl, Ti, Tk;
+			 Tj = ri[WS(rs, 15)];
+			 Tl = ii[WS(rs, 15)];
+			 Ti = W[28];
+			 Tk = W[29];
+			 Tm = FMA(Ti, Tj, Tk * Tl);
+			 T2s = FNMS(Tk, Tj, Ti * Tl);
+		    }
+		    Tn = Th + Tm;
+		    T69 = T2r + T2s;
+		    T2l = KP559016994 * (Tc - Tn);
+		    T6o = KP559016994 * (T68 - T69);
+		    To = Tc + Tn;
+		    T2m = FNMS(KP250000000, To, T1);
+		    T6a = T68 + T69;
+		    T6p = FNMS(KP250000000, T6a, T6b);
+		    {
+			 E T6r, T6s, T2q, T2t;
+			 T6r = T6 - Tb;
+			 T6s = Th - Tm;
+			 T6t = FMA(KP951056516, T6r, KP587785252 * T6s);
+			 T6S = FNMS(KP587785252, T6r, KP951056516 * T6s);
+			 T2q = T2o - T2p;
+			 T2t = T2r - T2s;
+			 T2u = FMA(KP951056516, T2q, KP587785252 * T2t);
+			 T4I = FNMS(KP587785252, T2q, KP951056516 * T2t);
+		    }
+	       }
+	       {
+		    E T1U, T3S, T3J, T3M, T3X, T3W, T3P, T3Q, T3T, T25, T2g, T2h;
+		    {
+			 E T1R, T1T, T1Q, T1S;
+			 T1R = ri[WS(rs, 3)];
+			 T1T = ii[WS(rs, 3)];
+			 T1Q = W[4];
+			 T1S = W[5];
+			 T1U = FMA(T1Q, T1R, T1S * T1T);
+			 T3S = FNMS(T1S, T1R, T1Q * T1T);
+		    }
+		    {
+			 E T1Z, T3H, T2f, T3L, T24, T3I, T2a, T3K;
+			 {
+			      E T1W, T1Y, T1V, T1X;
+			      T1W = ri[WS(rs, 8)];
+			      T1Y = ii[WS(rs, 8)];
+			      T1V = W[14];
+			      T1X = W[15];
+			      T1Z = FMA(T1V, T1W, T1X * T1Y);
+			      T3H = FNMS(T1X, T1W, T1V * T1Y);
+			 }
+			 {
+			      E T2c, T2e, T2b, T2d;
+			      T2c = ri[WS(rs, 18)];
+			      T2e = ii[WS(rs, 18)];
+			      T2b = W[34];
+			      T2d = W[35];
+			      T2f = FMA(T2b, T2c, T2d * T2e);
+			      T3L = FNMS(T2d, T2c, T2b * T2e);
+			 }
+			 {
+			      E T21, T23, T20, T22;
+			      T21 = ri[WS(rs, 23)];
+			      T23 = ii[WS(rs, 23)];
+			      T20 = W[44];
+			      T22 = W[45];
+			      T24 = FMA(T20, T21, T22 * T23);
+			      T3I = FNMS(T22, T21, T20 * T23);
+			 }
+			 {
+			      E T27, T29, T26, T28;
+			      T27 = ri[WS(rs, 13)];
+			      T29 = ii[WS(rs, 13)];
+			      T26 = W[24];
+			      T28 = W[25];
+			      T2a = FMA(T26, T27, T28 * T29);
+			      T3K = FNMS(T28, T27, T26 * T29);
+			 }
+			 T3J = T3H - T3I;
+			 T3M = T3K - T3L;
+			 T3X = T2a - T2f;
+			 T3W = T1Z - T24;
+			 T3P = T3H + T3I;
+			 T3Q = T3K + T3L;
+			 T3T = T3P + T3Q;
+			 T25 = T1Z + T24;
+			 T2g = T2a + T2f;
+			 T2h = T25 + T2g;
+		    }
+		    T2i = T1U + T2h;
+		    T60 = T3S + T3T;
+		    {
+			 E T3N, T57, T3G, T56, T3E, T3F;
+			 T3N = FMA(KP951056516, T3J, KP587785252 * T3M);
+			 T57 = FNMS(KP587785252, T3J, KP951056516 * T3M);
+			 T3E = KP559016994 * (T25 - T2g);
+			 T3F = FNMS(KP250000000, T2h, T1U);
+			 T3G = T3E + T3F;
+			 T56 = T3F - T3E;
+			 T3O = T3G + T3N;
+			 T5D = T56 + T57;
+			 T4r = T3G - T3N;
+			 T58 = T56 - T57;
+		    }
+		    {
+			 E T3Y, T59, T3V, T5a, T3R, T3U;
+			 T3Y = FMA(KP951056516, T3W, KP587785252 * T3X);
+			 T59 = FNMS(KP587785252, T3W, KP951056516 * T3X);
+			 T3R = KP559016994 * (T3P - T3Q);
+			 T3U = FNMS(KP250000000, T3T, T3S);
+			 T3V = T3R + T3U;
+			 T5a = T3U - T3R;
+			 T3Z = T3V - T3Y;
+			 T5C = T5a - T59;
+			 T4q = T3Y + T3V;
+			 T5b = T59 + T5a;
+		    }
+	       }
+	       {
+		    E Tu, T2K, T2B, T2E, T2P, T2O, T2H, T2I, T2L, TF, TQ, TR;
+		    {
+			 E Tr, Tt, Tq, Ts;
+			 Tr = ri[WS(rs, 1)];
+			 Tt = ii[WS(rs, 1)];
+			 Tq = W[0];
+			 Ts = W[1];
+			 Tu = FMA(Tq, Tr, Ts * Tt);
+			 T2K = FNMS(Ts, Tr, Tq * Tt);
+		    }
+		    {
+			 E Tz, T2z, TP, T2D, TE, T2A, TK, T2C;
+			 {
+			      E Tw, Ty, Tv, Tx;
+			      Tw = ri[WS(rs, 6)];
+			      Ty = ii[WS(rs, 6)];
+			      Tv = W[10];
+			      Tx = W[11];
+			      Tz = FMA(Tv, Tw, Tx * Ty);
+			      T2z = FNMS(Tx, Tw, Tv * Ty);
+			 }
+			 {
+			      E TM, TO, TL, TN;
+			      TM = ri[WS(rs, 16)];
+			      TO = ii[WS(rs, 16)];
+			      TL = W[30];
+			      TN = W[31];
+			      TP = FMA(TL, TM, TN * TO);
+			      T2D = FNMS(TN, TM, TL * TO);
+			 }
+			 {
+			      E TB, TD, TA, TC;
+			      TB = ri[WS(rs, 21)];
+			      TD = ii[WS(rs, 21)];
+			      TA = W[40];
+			      TC = W[41];
+			      TE = FMA(TA, TB, TC * TD);
+			      T2A = FNMS(TC, TB, TA * TD);
+			 }
+			 {
+			      E TH, TJ, TG, TI;
+			      TH = ri[WS(rs, 11)];
+			      TJ = ii[WS(rs, 11)];
+			      TG = W[20];
+			      TI = W[21];
+			      TK = FMA(TG, TH, TI * TJ);
+			      T2C = FNMS(TI, TH, TG * TJ);
+			 }
+			 T2B = T2z - T2A;
+			 T2E = T2C - T2D;
+			 T2P = TK - TP;
+			 T2O = Tz - TE;
+			 T2H = T2z + T2A;
+			 T2I = T2C + T2D;
+			 T2L = T2H + T2I;
+			 TF = Tz + TE;
+			 TQ = TK + TP;
+			 TR = TF + TQ;
+		    }
+		    TS = Tu + TR;
+		    T5W = T2K + T2L;
+		    {
+			 E T2F, T4L, T2y, T4K, T2w, T2x;
+			 T2F = FMA(KP951056516, T2B, KP587785252 * T2E);
+			 T4L = FNMS(KP587785252, T2B, KP951056516 * T2E);
+			 T2w = KP559016994 * (TF - TQ);
+			 T2x = FNMS(KP250000000, TR, Tu);
+			 T2y = T2w + T2x;
+			 T4K = T2x - T2w;
+			 T2G = T2y + T2F;
+			 T5s = T4K + T4L;
+			 T4g = T2y - T2F;
+			 T4M = T4K - T4L;
+		    }
+		    {
+			 E T2Q, T4N, T2N, T4O, T2J, T2M;
+			 T2Q = FMA(KP951056516, T2O, KP587785252 * T2P);
+			 T4N = FNMS(KP587785252, T2O, KP951056516 * T2P);
+			 T2J = KP559016994 * (T2H - T2I);
+			 T2M = FNMS(KP250000000, T2L, T2K);
+			 T2N = T2J + T2M;
+			 T4O = T2M - T2J;
+			 T2R = T2N - T2Q;
+			 T5t = T4O - T4N;
+			 T4h = T2Q + T2N;
+			 T4P = T4N + T4O;
+		    }
+	       }
+	       {
+		    E TX, T37, T2Y, T31, T3c, T3b, T34, T35, T38, T18, T1j, T1k;
+		    {
+			 E TU, TW, TT, TV;
+			 TU = ri[WS(rs, 4)];
+			 TW = ii[WS(rs, 4)];
+			 TT = W[6];
+			 TV = W[7];
+			 TX = FMA(TT, TU, TV * TW);
+			 T37 = FNMS(TV, TU, TT * TW);
+		    }
+		    {
+			 E T12, T2W, T1i, T30, T17, T2X, T1d, T2Z;
+			 {
+			      E TZ, T11, TY, T10;
+			      TZ = ri[WS(rs, 9)];
+			      T11 = ii[WS(rs, 9)];
+			      TY = W[16];
+			      T10 = W[17];
+			      T12 = FMA(TY, TZ, T10 * T11);
+			      T2W = FNMS(T10, TZ, TY * T11);
+			 }
+			 {
+			      E T1f, T1h, T1e, T1g;
+			      T1f = ri[WS(rs, 19)];
+			      T1h = ii[WS(rs, 19)];
+			      T1e = W[36];
+			      T1g = W[37];
+			      T1i = FMA(T1e, T1f, T1g * T1h);
+			      T30 = FNMS(T1g, T1f, T1e * T1h);
+			 }
+			 {
+			      E T14, T16, T13, T15;
+			      T14 = ri[WS(rs, 24)];
+			      T16 = ii[WS(rs, 24)];
+			      T13 = W[46];
+			      T15 = W[47];
+			      T17 = FMA(T13, T14, T15 * T16);
+			      T2X = FNMS(T15, T14, T13 * T16);
+			 }
+			 {
+			      E T1a, T1c, T19, T1b;
+			      T1a = ri[WS(rs, 14)];
+			      T1c = ii[WS(rs, 14)];
+			      T19 = W[26];
+			      T1b = W[27];
+			      T1d = FMA(T19, T1a, T1b * T1c);
+			      T2Z = FNMS(T1b, T1a, T19 * T1c);
+			 }
+			 T2Y = T2W - T2X;
+			 T31 = T2Z - T30;
+			 T3c = T1d - T1i;
+			 T3b = T12 - T17;
+			 T34 = T2W + T2X;
+			 T35 = T2Z + T30;
+			 T38 = T34 + T35;
+			 T18 = T12 + T17;
+			 T1j = T1d + T1i;
+			 T1k = T18 + T1j;
+		    }
+		    T1l = TX + T1k;
+		    T5X = T37 + T38;
+		    {
+			 E T32, T4V, T2V, T4U, T2T, T2U;
+			 T32 = FMA(KP951056516, T2Y, KP587785252 * T31);
+			 T4V = FNMS(KP587785252, T2Y, KP951056516 * T31);
+			 T2T = KP559016994 * (T18 - T1j);
+			 T2U = FNMS(KP250000000, T1k, TX);
+			 T2V = T2T + T2U;
+			 T4U = T2U - T2T;
+			 T33 = T2V + T32;
+			 T5w = T4U + T4V;
+			 T4j = T2V - T32;
+			 T4W = T4U - T4V;
+		    }
+		    {
+			 E T3d, T4R, T3a, T4S, T36, T39;
+			 T3d = FMA(KP951056516, T3b, KP587785252 * T3c);
+			 T4R = FNMS(KP587785252, T3b, KP951056516 * T3c);
+			 T36 = KP559016994 * (T34 - T35);
+			 T39 = FNMS(KP250000000, T38, T37);
+			 T3a = T36 + T39;
+			 T4S = T39 - T36;
+			 T3e = T3a - T3d;
+			 T5v = T4S - T4R;
+			 T4k = T3d + T3a;
+			 T4T = T4R + T4S;
+		    }
+	       }
+	       {
+		    E T1r, T3v, T3m, T3p, T3A, T3z, T3s, T3t, T3w, T1C, T1N, T1O;
+		    {
+			 E T1o, T1q, T1n, T1p;
+			 T1o = ri[WS(rs, 2)];
+			 T1q = ii[WS(rs, 2)];
+			 T1n = W[2];
+			 T1p = W[3];
+			 T1r = FMA(T1n, T1o, T1p * T1q);
+			 T3v = FNMS(T1p, T1o, T1n * T1q);
+		    }
+		    {
+			 E T1w, T3k, T1M, T3o, T1B, T3l, T1H, T3n;
+			 {
+			      E T1t, T1v, T1s, T1u;
+			      T1t = ri[WS(rs, 7)];
+			      T1v = ii[WS(rs, 7)];
+			      T1s = W[12];
+			      T1u = W[13];
+			      T1w = FMA(T1s, T1t, T1u * T1v);
+			      T3k = FNMS(T1u, T1t, T1s * T1v);
+			 }
+			 {
+			      E T1J, T1L, T1I, T1K;
+			      T1J = ri[WS(rs, 17)];
+			      T1L = ii[WS(rs, 17)];
+			      T1I = W[32];
+			      T1K = W[33];
+			      T1M = FMA(T1I, T1J, T1K * T1L);
+			      T3o = FNMS(T1K, T1J, T1I * T1L);
+			 }
+			 {
+			      E T1y, T1A, T1x, T1z;
+			      T1y = ri[WS(rs, 22)];
+			      T1A = ii[WS(rs, 22)];
+			      T1x = W[42];
+			      T1z = W[43];
+			      T1B = FMA(T1x, T1y, T1z * T1A);
+			      T3l = FNMS(T1z, T1y, T1x * T1A);
+			 }
+			 {
+			      E T1E, T1G, T1D, T1F;
+			      T1E = ri[WS(rs, 12)];
+			      T1G = ii[WS(rs, 12)];
+			      T1D = W[22];
+			      T1F = W[23];
+			      T1H = FMA(T1D, T1E, T1F * T1G);
+			      T3n = FNMS(T1F, T1E, T1D * T1G);
+			 }
+			 T3m = T3k - T3l;
+			 T3p = T3n - T3o;
+			 T3A = T1H - T1M;
+			 T3z = T1w - T1B;
+			 T3s = T3k + T3l;
+			 T3t = T3n + T3o;
+			 T3w = T3s + T3t;
+			 T1C = T1w + T1B;
+			 T1N = T1H + T1M;
+			 T1O = T1C + T1N;
+		    }
+		    T1P = T1r + T1O;
+		    T5Z = T3v + T3w;
+		    {
+			 E T3q, T50, T3j, T4Z, T3h, T3i;
+			 T3q = FMA(KP951056516, T3m, KP587785252 * T3p);
+			 T50 = FNMS(KP587785252, T3m, KP951056516 * T3p);
+			 T3h = KP559016994 * (T1C - T1N);
+			 T3i = FNMS(KP250000000, T1O, T1r);
+			 T3j = T3h + T3i;
+			 T4Z = T3i - T3h;
+			 T3r = T3j + T3q;
+			 T5z = T4Z + T50;
+			 T4o = T3j - T3q;
+			 T51 = T4Z - T50;
+		    }
+		    {
+			 E T3B, T52, T3y, T53, T3u, T3x;
+			 T3B = FMA(KP951056516, T3z, KP587785252 * T3A);
+			 T52 = FNMS(KP587785252, T3z, KP951056516 * T3A);
+			 T3u = KP559016994 * (T3s - T3t);
+			 T3x = FNMS(KP250000000, T3w, T3v);
+			 T3y = T3u + T3x;
+			 T53 = T3x - T3u;
+			 T3C = T3y - T3B;
+			 T5A = T53 - T52;
+			 T4n = T3B + T3y;
+			 T54 = T52 + T53;
+		    }
+	       }
+	       {
+		    E T62, T64, Tp, T2k, T5T, T5U, T63, T5V;
+		    {
+			 E T5Y, T61, T1m, T2j;
+			 T5Y = T5W - T5X;
+			 T61 = T5Z - T60;
+			 T62 = FMA(KP951056516, T5Y, KP587785252 * T61);
+			 T64 = FNMS(KP587785252, T5Y, KP951056516 * T61);
+			 Tp = T1 + To;
+			 T1m = TS + T1l;
+			 T2j = T1P + T2i;
+			 T2k = T1m + T2j;
+			 T5T = KP559016994 * (T1m - T2j);
+			 T5U = FNMS(KP250000000, T2k, Tp);
+		    }
+		    ri[0] = Tp + T2k;
+		    T63 = T5U - T5T;
+		    ri[WS(rs, 10)] = T63 - T64;
+		    ri[WS(rs, 15)] = T63 + T64;
+		    T5V = T5T + T5U;
+		    ri[WS(rs, 20)] = T5V - T62;
+		    ri[WS(rs, 5)] = T5V + T62;
+	       }
+	       {
+		    E T6i, T6j, T6c, T67, T6d, T6e, T6k, T6f;
+		    {
+			 E T6g, T6h, T65, T66;
+			 T6g = TS - T1l;
+			 T6h = T1P - T2i;
+			 T6i = FMA(KP951056516, T6g, KP587785252 * T6h);
+			 T6j = FNMS(KP587785252, T6g, KP951056516 * T6h);
+			 T6c = T6a + T6b;
+			 T65 = T5W + T5X;
+			 T66 = T5Z + T60;
+			 T67 = T65 + T66;
+			 T6d = KP559016994 * (T65 - T66);
+			 T6e = FNMS(KP250000000, T67, T6c);
+		    }
+		    ii[0] = T67 + T6c;
+		    T6k = T6e - T6d;
+		    ii[WS(rs, 10)] = T6j + T6k;
+		    ii[WS(rs, 15)] = T6k - T6j;
+		    T6f = T6d + T6e;
+		    ii[WS(rs, 5)] = T6f - T6i;
+		    ii[WS(rs, 20)] = T6i + T6f;
+	       }
+	       {
+		    E T2v, T4f, T6u, T6G, T42, T6z, T43, T6y, T4A, T6H, T4D, T6F, T4u, T6L, T4v;
+		    E T6K, T48, T6v, T4b, T6n, T2n, T6q;
+		    T2n = T2l + T2m;
+		    T2v = T2n + T2u;
+		    T4f = T2n - T2u;
+		    T6q = T6o + T6p;
+		    T6u = T6q - T6t;
+		    T6G = T6t + T6q;
+		    {
+			 E T2S, T3f, T3g, T3D, T40, T41;
+			 T2S = FMA(KP968583161, T2G, KP248689887 * T2R);
+			 T3f = FMA(KP535826794, T33, KP844327925 * T3e);
+			 T3g = T2S + T3f;
+			 T3D = FMA(KP876306680, T3r, KP481753674 * T3C);
+			 T40 = FMA(KP728968627, T3O, KP684547105 * T3Z);
+			 T41 = T3D + T40;
+			 T42 = T3g + T41;
+			 T6z = T3D - T40;
+			 T43 = KP559016994 * (T3g - T41);
+			 T6y = T2S - T3f;
+		    }
+		    {
+			 E T4y, T4z, T6D, T4B, T4C, T6E;
+			 T4y = FNMS(KP844327925, T4g, KP535826794 * T4h);
+			 T4z = FNMS(KP637423989, T4k, KP770513242 * T4j);
+			 T6D = T4y + T4z;
+			 T4B = FMA(KP125333233, T4r, KP992114701 * T4q);
+			 T4C = FMA(KP904827052, T4o, KP425779291 * T4n);
+			 T6E = T4C + T4B;
+			 T4A = T4y - T4z;
+			 T6H = KP559016994 * (T6D + T6E);
+			 T4D = T4B - T4C;
+			 T6F = T6D - T6E;
+		    }
+		    {
+			 E T4i, T4l, T4m, T4p, T4s, T4t;
+			 T4i = FMA(KP535826794, T4g, KP844327925 * T4h);
+			 T4l = FMA(KP637423989, T4j, KP770513242 * T4k);
+			 T4m = T4i - T4l;
+			 T4p = FNMS(KP425779291, T4o, KP904827052 * T4n);
+			 T4s = FNMS(KP992114701, T4r, KP125333233 * T4q);
+			 T4t = T4p + T4s;
+			 T4u = T4m + T4t;
+			 T6L = T4p - T4s;
+			 T4v = KP559016994 * (T4m - T4t);
+			 T6K = T4i + T4l;
+		    }
+		    {
+			 E T46, T47, T6l, T49, T4a, T6m;
+			 T46 = FNMS(KP248689887, T2G, KP968583161 * T2R);
+			 T47 = FNMS(KP844327925, T33, KP535826794 * T3e);
+			 T6l = T46 + T47;
+			 T49 = FNMS(KP481753674, T3r, KP876306680 * T3C);
+			 T4a = FNMS(KP684547105, T3O, KP728968627 * T3Z);
+			 T6m = T49 + T4a;
+			 T48 = T46 - T47;
+			 T6v = KP559016994 * (T6l - T6m);
+			 T4b = T49 - T4a;
+			 T6n = T6l + T6m;
+		    }
+		    ri[WS(rs, 1)] = T2v + T42;
+		    ii[WS(rs, 1)] = T6n + T6u;
+		    ri[WS(rs, 4)] = T4f + T4u;
+		    ii[WS(rs, 4)] = T6F + T6G;
+		    {
+			 E T4c, T4e, T45, T4d, T44;
+			 T4c = FMA(KP951056516, T48, KP587785252 * T4b);
+			 T4e = FNMS(KP587785252, T48, KP951056516 * T4b);
+			 T44 = FNMS(KP250000000, T42, T2v);
+			 T45 = T43 + T44;
+			 T4d = T44 - T43;
+			 ri[WS(rs, 21)] = T45 - T4c;
+			 ri[WS(rs, 16)] = T4d + T4e;
+			 ri[WS(rs, 6)] = T45 + T4c;
+			 ri[WS(rs, 11)] = T4d - T4e;
+		    }
+		    {
+			 E T6A, T6B, T6x, T6C, T6w;
+			 T6A = FMA(KP951056516, T6y, KP587785252 * T6z);
+			 T6B = FNMS(KP587785252, T6y, KP951056516 * T6z);
+			 T6w = FNMS(KP250000000, T6n, T6u);
+			 T6x = T6v + T6w;
+			 T6C = T6w - T6v;
+			 ii[WS(rs, 6)] = T6x - T6A;
+			 ii[WS(rs, 16)] = T6C - T6B;
+			 ii[WS(rs, 21)] = T6A + T6x;
+			 ii[WS(rs, 11)] = T6B + T6C;
+		    }
+		    {
+			 E T4E, T4G, T4x, T4F, T4w;
+			 T4E = FMA(KP951056516, T4A, KP587785252 * T4D);
+			 T4G = FNMS(KP587785252, T4A, KP951056516 * T4D);
+			 T4w = FNMS(KP250000000, T4u, T4f);
+			 T4x = T4v + T4w;
+			 T4F = T4w - T4v;
+			 ri[WS(rs, 24)] = T4x - T4E;
+			 ri[WS(rs, 19)] = T4F + T4G;
+			 ri[WS(rs, 9)] = T4x + T4E;
+			 ri[WS(rs, 14)] = T4F - T4G;
+		    }
+		    {
+			 E T6M, T6N, T6J, T6O, T6I;
+			 T6M = FMA(KP951056516, T6K, KP587785252 * T6L);
+			 T6N = FNMS(KP587785252, T6K, KP951056516 * T6L);
+			 T6I = FNMS(KP250000000, T6F, T6G);
+			 T6J = T6H + T6I;
+			 T6O = T6I - T6H;
+			 ii[WS(rs, 9)] = T6J - T6M;
+			 ii[WS(rs, 19)] = T6O - T6N;
+			 ii[WS(rs, 24)] = T6M + T6J;
+			 ii[WS(rs, 14)] = T6N + T6O;
+		    }
+	       }
+	       {
+		    E T4J, T5r, T6U, T76, T5e, T6Z, T5f, T6Y, T5M, T77, T5P, T75, T5G, T7b, T5H;
+		    E T7a, T5k, T6V, T5n, T6R, T4H, T6T;
+		    T4H = T2m - T2l;
+		    T4J = T4H - T4I;
+		    T5r = T4H + T4I;
+		    T6T = T6p - T6o;
+		    T6U = T6S + T6T;
+		    T76 = T6T - T6S;
+		    {
+			 E T4Q, T4X, T4Y, T55, T5c, T5d;
+			 T4Q = FMA(KP876306680, T4M, KP481753674 * T4P);
+			 T4X = FNMS(KP425779291, T4W, KP904827052 * T4T);
+			 T4Y = T4Q + T4X;
+			 T55 = FMA(KP535826794, T51, KP844327925 * T54);
+			 T5c = FMA(KP062790519, T58, KP998026728 * T5b);
+			 T5d = T55 + T5c;
+			 T5e = T4Y + T5d;
+			 T6Z = T55 - T5c;
+			 T5f = KP559016994 * (T4Y - T5d);
+			 T6Y = T4Q - T4X;
+		    }
+		    {
+			 E T5K, T5L, T73, T5N, T5O, T74;
+			 T5K = FNMS(KP684547105, T5s, KP728968627 * T5t);
+			 T5L = FMA(KP125333233, T5w, KP992114701 * T5v);
+			 T73 = T5K - T5L;
+			 T5N = FNMS(KP998026728, T5z, KP062790519 * T5A);
+			 T5O = FMA(KP770513242, T5D, KP637423989 * T5C);
+			 T74 = T5N - T5O;
+			 T5M = T5K + T5L;
+			 T77 = KP559016994 * (T73 - T74);
+			 T5P = T5N + T5O;
+			 T75 = T73 + T74;
+		    }
+		    {
+			 E T5u, T5x, T5y, T5B, T5E, T5F;
+			 T5u = FMA(KP728968627, T5s, KP684547105 * T5t);
+			 T5x = FNMS(KP992114701, T5w, KP125333233 * T5v);
+			 T5y = T5u + T5x;
+			 T5B = FMA(KP062790519, T5z, KP998026728 * T5A);
+			 T5E = FNMS(KP637423989, T5D, KP770513242 * T5C);
+			 T5F = T5B + T5E;
+			 T5G = T5y + T5F;
+			 T7b = T5B - T5E;
+			 T5H = KP559016994 * (T5y - T5F);
+			 T7a = T5u - T5x;
+		    }
+		    {
+			 E T5i, T5j, T6P, T5l, T5m, T6Q;
+			 T5i = FNMS(KP481753674, T4M, KP876306680 * T4P);
+			 T5j = FMA(KP904827052, T4W, KP425779291 * T4T);
+			 T6P = T5i - T5j;
+			 T5l = FNMS(KP844327925, T51, KP535826794 * T54);
+			 T5m = FNMS(KP998026728, T58, KP062790519 * T5b);
+			 T6Q = T5l + T5m;
+			 T5k = T5i + T5j;
+			 T6V = KP559016994 * (T6P - T6Q);
+			 T5n = T5l - T5m;
+			 T6R = T6P + T6Q;
+		    }
+		    ri[WS(rs, 2)] = T4J + T5e;
+		    ii[WS(rs, 2)] = T6R + T6U;
+		    ri[WS(rs, 3)] = T5r + T5G;
+		    ii[WS(rs, 3)] = T75 + T76;
+		    {
+			 E T5o, T5q, T5h, T5p, T5g;
+			 T5o = FMA(KP951056516, T5k, KP587785252 * T5n);
+			 T5q = FNMS(KP587785252, T5k, KP951056516 * T5n);
+			 T5g = FNMS(KP250000000, T5e, T4J);
+			 T5h = T5f + T5g;
+			 T5p = T5g - T5f;
+			 ri[WS(rs, 22)] = T5h - T5o;
+			 ri[WS(rs, 17)] = T5p + T5q;
+			 ri[WS(rs, 7)] = T5h + T5o;
+			 ri[WS(rs, 12)] = T5p - T5q;
+		    }
+		    {
+			 E T70, T71, T6X, T72, T6W;
+			 T70 = FMA(KP951056516, T6Y, KP587785252 * T6Z);
+			 T71 = FNMS(KP587785252, T6Y, KP951056516 * T6Z);
+			 T6W = FNMS(KP250000000, T6R, T6U);
+			 T6X = T6V + T6W;
+			 T72 = T6W - T6V;
+			 ii[WS(rs, 7)] = T6X - T70;
+			 ii[WS(rs, 17)] = T72 - T71;
+			 ii[WS(rs, 22)] = T70 + T6X;
+			 ii[WS(rs, 12)] = T71 + T72;
+		    }
+		    {
+			 E T5Q, T5S, T5J, T5R, T5I;
+			 T5Q = FMA(KP951056516, T5M, KP587785252 * T5P);
+			 T5S = FNMS(KP587785252, T5M, KP951056516 * T5P);
+			 T5I = FNMS(KP250000000, T5G, T5r);
+			 T5J = T5H + T5I;
+			 T5R = T5I - T5H;
+			 ri[WS(rs, 23)] = T5J - T5Q;
+			 ri[WS(rs, 18)] = T5R + T5S;
+			 ri[WS(rs, 8)] = T5J + T5Q;
+			 ri[WS(rs, 13)] = T5R - T5S;
+		    }
+		    {
+			 E T7c, T7d, T79, T7e, T78;
+			 T7c = FMA(KP951056516, T7a, KP587785252 * T7b);
+			 T7d = FNMS(KP587785252, T7a, KP951056516 * T7b);
+			 T78 = FNMS(KP250000000, T75, T76);
+			 T79 = T77 + T78;
+			 T7e = T78 - T77;
+			 ii[WS(rs, 8)] = T79 - T7c;
+			 ii[WS(rs, 18)] = T7e - T7d;
+			 ii[WS(rs, 23)] = T7c + T79;
+			 ii[WS(rs, 13)] = T7d + T7e;
+		    }
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_FULL, 0, 25 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 25, "t1_25", twinstr, &GENUS, { 260, 140, 140, 0 }, 0, 0, 0 };
+
+void X(codelet_t1_25) (planner *p) {
+     X(kdft_dit_register) (p, t1_25, &desc);
+}
+#endif
@@ -0,0 +1,4105 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:44:29 EDT 2021 */
+
+#include "dft/codelet-dft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_twiddle.native -fma -compact -variables 4 -pipeline-latency 4 -n 64 -name t1_64 -include dft/scalar/t.h */
+
+/*
+ * This function contains 1038 FP additions, 644 FP multiplications,
+ * (or, 520 additions, 126 multiplications, 518 fused multiply/add),
+ * 190 stack variables, 15 constants, and 256 memory accesses
+ */
+#include "dft/scalar/t.h"
+
+static void t1_64(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP098491403, +0.098491403357164253077197521291327432293052451);
+     DK(KP820678790, +0.820678790828660330972281985331011598767386482);
+     DK(KP303346683, +0.303346683607342391675883946941299872384187453);
+     DK(KP534511135, +0.534511135950791641089685961295362908582039528);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP198912367, +0.198912367379658006911597622644676228597850501);
+     DK(KP668178637, +0.668178637919298919997757686523080761552472251);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     DK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 126); m < me; m = m + 1, ri = ri + ms, ii = ii + ms, W = W + 126, MAKE_VOLATILE_STRIDE(128, rs)) {
+	       E Tm, TeM, TjR, Tkl, T7e, TcA, TiV, Tjm, T1G, TeW, TeZ, Ths, T7Q, TcJ, T7X;
+	       E TcI, T29, Tf8, Tf5, Thv, T87, TcN, T8u, TcQ, T5K, Tg9, TfU, ThS, Taq, Tdm;
+	       E Tbj, Tdx, TN, Tjl, TeP, TiP, T7l, TcB, T7s, TcC, T1f, TeR, TeU, Thr, T7B;
+	       E TcG, T7I, TcF, T32, Tfj, Tfg, ThB, T8G, TcU, T93, TcX, T3X, TfI, Tft, ThH;
+	       E T9h, Td3, Taa, Tde, T2A, Tf6, Tfb, Thw, T8m, TcR, T8x, TcO, T3t, Tfh, Tfm;
+	       E ThC, T8V, TcY, T96, TcV, T4o, Tfu, TfL, ThI, T9w, Tdf, Tad, Td4, T6b, TfV;
+	       E Tgc, ThT, TaF, Tdy, Tbm, Tdn, T4Q, ThN, TfA, TfN, Ta1, Tdh, Taf, Td8, T5h;
+	       E ThO, TfF, TfO, T9M, Tdi, Tag, Tdb, T6D, ThY, Tg1, Tge, Tba, TdA, Tbo, Tdr;
+	       E T74, ThZ, Tg6, Tgf, TaV, TdB, Tbp, Tdu;
+	       {
+		    E T1, TiT, T7, TiS, Te, T7a, Tk, T7c;
+		    T1 = ri[0];
+		    TiT = ii[0];
+		    {
+			 E T3, T6, T4, TiR, T2, T5;
+			 T3 = ri[WS(rs, 32)];
+			 T6 = ii[WS(rs, 32)];
+			 T2 = W[62];
+			 T4 = T2 * T3;
+			 TiR = T2 * T6;
+			 T5 = W[63];
+			 T7 = FMA(T5, T6, T4);
+			 TiS = FNMS(T5, T3, TiR);
+		    }
+		    {
+			 E Ta, Td, Tb, T79, T9, Tc;
+			 Ta = ri[WS(rs, 16)];
+			 Td = ii[WS(rs, 16)];
+			 T9 = W[30];
+			 Tb = T9 * Ta;
+			 T79 = T9 * Td;
+			 Tc = W[31];
+			 Te = FMA(Tc, Td, Tb);
+			 T7a = FNMS(Tc, Ta, T79);
+		    }
+		    {
+			 E Tg, Tj, Th, T7b, Tf, Ti;
+			 Tg = ri[WS(rs, 48)];
+			 Tj = ii[WS(rs, 48)];
+			 Tf = W[94];
+			 Th = Tf * Tg;
+			 T7b = Tf * Tj;
+			 Ti = W[95];
+			 Tk = FMA(Ti, Tj, Th);
+			 T7c = FNMS(Ti, Tg, T7b);
+		    }
+		    {
+			 E T8, Tl, TjP, TjQ;
+			 T8 = T1 + T7;
+			 Tl = Te + Tk;
+			 Tm = T8 + Tl;
+			 TeM = T8 - Tl;
+			 TjP = TiT - TiS;
+			 TjQ = Te - Tk;
+			 TjR = TjP - TjQ;
+			 Tkl = TjQ + TjP;
+		    }
+		    {
+			 E T78, T7d, TiQ, TiU;
+			 T78 = T1 - T7;
+			 T7d = T7a - T7c;
+			 T7e = T78 - T7d;
+			 TcA = T78 + T7d;
+			 TiQ = T7a + T7c;
+			 TiU = TiS + TiT;
+			 TiV = TiQ + TiU;
+			 Tjm = TiU - TiQ;
+		    }
+	       }
+	       {
+		    E T1l, T7L, T1E, T7V, T1r, T7N, T1y, T7T;
+		    {
+			 E T1h, T1k, T1i, T7K, T1g, T1j;
+			 T1h = ri[WS(rs, 60)];
+			 T1k = ii[WS(rs, 60)];
+			 T1g = W[118];
+			 T1i = T1g * T1h;
+			 T7K = T1g * T1k;
+			 T1j = W[119];
+			 T1l = FMA(T1j, T1k, T1i);
+			 T7L = FNMS(T1j, T1h, T7K);
+		    }
+		    {
+			 E T1A, T1D, T1B, T7U, T1z, T1C;
+			 T1A = ri[WS(rs, 44)];
+			 T1D = ii[WS(rs, 44)];
+			 T1z = W[86];
+			 T1B = T1z * T1A;
+			 T7U = T1z * T1D;
+			 T1C = W[87];
+			 T1E = FMA(T1C, T1D, T1B);
+			 T7V = FNMS(T1C, T1A, T7U);
+		    }
+		    {
+			 E T1n, T1q, T1o, T7M, T1m, T1p;
+			 T1n = ri[WS(rs, 28)];
+			 T1q = ii[WS(rs, 28)];
+			 T1m = W[54];
+			 T1o = T1m * T1n;
+			 T7M = T1m * T1q;
+			 T1p = W[55];
+			 T1r = FMA(T1p, T1q, T1o);
+			 T7N = FNMS(T1p, T1n, T7M);
+		    }
+		    {
+			 E T1u, T1x, T1v, T7S, T1t, T1w;
+			 T1u = ri[WS(rs, 12)];
+			 T1x = ii[WS(rs, 12)];
+			 T1t = W[22];
+			 T1v = T1t * T1u;
+			 T7S = T1t * T1x;
+			 T1w = W[23];
+			 T1y = FMA(T1w, T1x, T1v);
+			 T7T = FNMS(T1w, T1u, T7S);
+		    }
+		    {
+			 E T1s, T1F, TeX, TeY;
+			 T1s = T1l + T1r;
+			 T1F = T1y + T1E;
+			 T1G = T1s + T1F;
+			 TeW = T1s - T1F;
+			 TeX = T7L + T7N;
+			 TeY = T7T + T7V;
+			 TeZ = TeX - TeY;
+			 Ths = TeX + TeY;
+		    }
+		    {
+			 E T7O, T7P, T7R, T7W;
+			 T7O = T7L - T7N;
+			 T7P = T1y - T1E;
+			 T7Q = T7O + T7P;
+			 TcJ = T7O - T7P;
+			 T7R = T1l - T1r;
+			 T7W = T7T - T7V;
+			 T7X = T7R - T7W;
+			 TcI = T7R + T7W;
+		    }
+	       }
+	       {
+		    E T1O, T82, T27, T8s, T1U, T84, T21, T8q;
+		    {
+			 E T1K, T1N, T1L, T81, T1J, T1M;
+			 T1K = ri[WS(rs, 2)];
+			 T1N = ii[WS(rs, 2)];
+			 T1J = W[2];
+			 T1L = T1J * T1K;
+			 T81 = T1J * T1N;
+			 T1M = W[3];
+			 T1O = FMA(T1M, T1N, T1L);
+			 T82 = FNMS(T1M, T1K, T81);
+		    }
+		    {
+			 E T23, T26, T24, T8r, T22, T25;
+			 T23 = ri[WS(rs, 50)];
+			 T26 = ii[WS(rs, 50)];
+			 T22 = W[98];
+			 T24 = T22 * T23;
+			 T8r = T22 * T26;
+			 T25 = W[99];
+			 T27 = FMA(T25, T26, T24);
+			 T8s = FNMS(T25, T23, T8r);
+		    }
+		    {
+			 E T1Q, T1T, T1R, T83, T1P, T1S;
+			 T1Q = ri[WS(rs, 34)];
+			 T1T = ii[WS(rs, 34)];
+			 T1P = W[66];
+			 T1R = T1P * T1Q;
+			 T83 = T1P * T1T;
+			 T1S = W[67];
+			 T1U = FMA(T1S, T1T, T1R);
+			 T84 = FNMS(T1S, T1Q, T83);
+		    }
+		    {
+			 E T1X, T20, T1Y, T8p, T1W, T1Z;
+			 T1X = ri[WS(rs, 18)];
+			 T20 = ii[WS(rs, 18)];
+			 T1W = W[34];
+			 T1Y = T1W * T1X;
+			 T8p = T1W * T20;
+			 T1Z = W[35];
+			 T21 = FMA(T1Z, T20, T1Y);
+			 T8q = FNMS(T1Z, T1X, T8p);
+		    }
+		    {
+			 E T1V, T28, Tf3, Tf4;
+			 T1V = T1O + T1U;
+			 T28 = T21 + T27;
+			 T29 = T1V + T28;
+			 Tf8 = T1V - T28;
+			 Tf3 = T82 + T84;
+			 Tf4 = T8q + T8s;
+			 Tf5 = Tf3 - Tf4;
+			 Thv = Tf3 + Tf4;
+		    }
+		    {
+			 E T85, T86, T8o, T8t;
+			 T85 = T82 - T84;
+			 T86 = T21 - T27;
+			 T87 = T85 + T86;
+			 TcN = T85 - T86;
+			 T8o = T1O - T1U;
+			 T8t = T8q - T8s;
+			 T8u = T8o - T8t;
+			 TcQ = T8o + T8t;
+		    }
+	       }
+	       {
+		    E T5p, Tal, T5I, Tbh, T5v, Tan, T5C, Tbf;
+		    {
+			 E T5l, T5o, T5m, Tak, T5k, T5n;
+			 T5l = ri[WS(rs, 63)];
+			 T5o = ii[WS(rs, 63)];
+			 T5k = W[124];
+			 T5m = T5k * T5l;
+			 Tak = T5k * T5o;
+			 T5n = W[125];
+			 T5p = FMA(T5n, T5o, T5m);
+			 Tal = FNMS(T5n, T5l, Tak);
+		    }
+		    {
+			 E T5E, T5H, T5F, Tbg, T5D, T5G;
+			 T5E = ri[WS(rs, 47)];
+			 T5H = ii[WS(rs, 47)];
+			 T5D = W[92];
+			 T5F = T5D * T5E;
+			 Tbg = T5D * T5H;
+			 T5G = W[93];
+			 T5I = FMA(T5G, T5H, T5F);
+			 Tbh = FNMS(T5G, T5E, Tbg);
+		    }
+		    {
+			 E T5r, T5u, T5s, Tam, T5q, T5t;
+			 T5r = ri[WS(rs, 31)];
+			 T5u = ii[WS(rs, 31)];
+			 T5q = W[60];
+			 T5s = T5q * T5r;
+			 Tam = T5q * T5u;
+			 T5t = W[61];
+			 T5v = FMA(T5t, T5u, T5s);
+			 Tan = FNMS(T5t, T5r, Tam);
+		    }
+		    {
+			 E T5y, T5B, T5z, Tbe, T5x, T5A;
+			 T5y = ri[WS(rs, 15)];
+			 T5B = ii[WS(rs, 15)];
+			 T5x = W[28];
+			 T5z = T5x * T5y;
+			 Tbe = T5x * T5B;
+			 T5A = W[29];
+			 T5C = FMA(T5A, T5B, T5z);
+			 Tbf = FNMS(T5A, T5y, Tbe);
+		    }
+		    {
+			 E T5w, T5J, TfS, TfT;
+			 T5w = T5p + T5v;
+			 T5J = T5C + T5I;
+			 T5K = T5w + T5J;
+			 Tg9 = T5w - T5J;
+			 TfS = Tal + Tan;
+			 TfT = Tbf + Tbh;
+			 TfU = TfS - TfT;
+			 ThS = TfS + TfT;
+		    }
+		    {
+			 E Tao, Tap, Tbd, Tbi;
+			 Tao = Tal - Tan;
+			 Tap = T5C - T5I;
+			 Taq = Tao + Tap;
+			 Tdm = Tao - Tap;
+			 Tbd = T5p - T5v;
+			 Tbi = Tbf - Tbh;
+			 Tbj = Tbd - Tbi;
+			 Tdx = Tbd + Tbi;
+		    }
+	       }
+	       {
+		    E Ts, T7g, TL, T7q, Ty, T7i, TF, T7o;
+		    {
+			 E To, Tr, Tp, T7f, Tn, Tq;
+			 To = ri[WS(rs, 8)];
+			 Tr = ii[WS(rs, 8)];
+			 Tn = W[14];
+			 Tp = Tn * To;
+			 T7f = Tn * Tr;
+			 Tq = W[15];
+			 Ts = FMA(Tq, Tr, Tp);
+			 T7g = FNMS(Tq, To, T7f);
+		    }
+		    {
+			 E TH, TK, TI, T7p, TG, TJ;
+			 TH = ri[WS(rs, 24)];
+			 TK = ii[WS(rs, 24)];
+			 TG = W[46];
+			 TI = TG * TH;
+			 T7p = TG * TK;
+			 TJ = W[47];
+			 TL = FMA(TJ, TK, TI);
+			 T7q = FNMS(TJ, TH, T7p);
+		    }
+		    {
+			 E Tu, Tx, Tv, T7h, Tt, Tw;
+			 Tu = ri[WS(rs, 40)];
+			 Tx = ii[WS(rs, 40)];
+			 Tt = W[78];
+			 Tv = Tt * Tu;
+			 T7h = Tt * Tx;
+			 Tw = W[79];
+			 Ty = FMA(Tw, Tx, Tv);
+			 T7i = FNMS(Tw, Tu, T7h);
+		    }
+		    {
+			 E TB, TE, TC, T7n, TA, TD;
+			 TB = ri[WS(rs, 56)];
+			 TE = ii[WS(rs, 56)];
+			 TA = W[110];
+			 TC = TA * TB;
+			 T7n = TA * TE;
+			 TD = W[111];
+			 TF = FMA(TD, TE, TC);
+			 T7o = FNMS(TD, TB, T7n);
+		    }
+		    {
+			 E Tz, TM, TeN, TeO;
+			 Tz = Ts + Ty;
+			 TM = TF + TL;
+			 TN = Tz + TM;
+			 Tjl = TM - Tz;
+			 TeN = T7g + T7i;
+			 TeO = T7o + T7q;
+			 TeP = TeN - TeO;
+			 TiP = TeN + TeO;
+		    }
+		    {
+			 E T7j, T7k, T7m, T7r;
+			 T7j = T7g - T7i;
+			 T7k = Ts - Ty;
+			 T7l = T7j - T7k;
+			 TcB = T7k + T7j;
+			 T7m = TF - TL;
+			 T7r = T7o - T7q;
+			 T7s = T7m + T7r;
+			 TcC = T7m - T7r;
+		    }
+	       }
+	       {
+		    E TU, T7w, T1d, T7G, T10, T7y, T17, T7E;
+		    {
+			 E TQ, TT, TR, T7v, TP, TS;
+			 TQ = ri[WS(rs, 4)];
+			 TT = ii[WS(rs, 4)];
+			 TP = W[6];
+			 TR = TP * TQ;
+			 T7v = TP * TT;
+			 TS = W[7];
+			 TU = FMA(TS, TT, TR);
+			 T7w = FNMS(TS, TQ, T7v);
+		    }
+		    {
+			 E T19, T1c, T1a, T7F, T18, T1b;
+			 T19 = ri[WS(rs, 52)];
+			 T1c = ii[WS(rs, 52)];
+			 T18 = W[102];
+			 T1a = T18 * T19;
+			 T7F = T18 * T1c;
+			 T1b = W[103];
+			 T1d = FMA(T1b, T1c, T1a);
+			 T7G = FNMS(T1b, T19, T7F);
+		    }
+		    {
+			 E TW, TZ, TX, T7x, TV, TY;
+			 TW = ri[WS(rs, 36)];
+			 TZ = ii[WS(rs, 36)];
+			 TV = W[70];
+			 TX = TV * TW;
+			 T7x = TV * TZ;
+			 TY = W[71];
+			 T10 = FMA(TY, TZ, TX);
+			 T7y = FNMS(TY, TW, T7x);
+		    }
+		    {
+			 E T13, T16, T14, T7D, T12, T15;
+			 T13 = ri[WS(rs, 20)];
+			 T16 = ii[WS(rs, 20)];
+			 T12 = W[38];
+			 T14 = T12 * T13;
+			 T7D = T12 * T16;
+			 T15 = W[39];
+			 T17 = FMA(T15, T16, T14);
+			 T7E = FNMS(T15, T13, T7D);
+		    }
+		    {
+			 E T11, T1e, TeS, TeT;
+			 T11 = TU + T10;
+			 T1e = T17 + T1d;
+			 T1f = T11 + T1e;
+			 TeR = T11 - T1e;
+			 TeS = T7w + T7y;
+			 TeT = T7E + T7G;
+			 TeU = TeS - TeT;
+			 Thr = TeS + TeT;
+		    }
+		    {
+			 E T7z, T7A, T7C, T7H;
+			 T7z = T7w - T7y;
+			 T7A = T17 - T1d;
+			 T7B = T7z + T7A;
+			 TcG = T7z - T7A;
+			 T7C = TU - T10;
+			 T7H = T7E - T7G;
+			 T7I = T7C - T7H;
+			 TcF = T7C + T7H;
+		    }
+	       }
+	       {
+		    E T2H, T8B, T30, T91, T2N, T8D, T2U, T8Z;
+		    {
+			 E T2D, T2G, T2E, T8A, T2C, T2F;
+			 T2D = ri[WS(rs, 62)];
+			 T2G = ii[WS(rs, 62)];
+			 T2C = W[122];
+			 T2E = T2C * T2D;
+			 T8A = T2C * T2G;
+			 T2F = W[123];
+			 T2H = FMA(T2F, T2G, T2E);
+			 T8B = FNMS(T2F, T2D, T8A);
+		    }
+		    {
+			 E T2W, T2Z, T2X, T90, T2V, T2Y;
+			 T2W = ri[WS(rs, 46)];
+			 T2Z = ii[WS(rs, 46)];
+			 T2V = W[90];
+			 T2X = T2V * T2W;
+			 T90 = T2V * T2Z;
+			 T2Y = W[91];
+			 T30 = FMA(T2Y, T2Z, T2X);
+			 T91 = FNMS(T2Y, T2W, T90);
+		    }
+		    {
+			 E T2J, T2M, T2K, T8C, T2I, T2L;
+			 T2J = ri[WS(rs, 30)];
+			 T2M = ii[WS(rs, 30)];
+			 T2I = W[58];
+			 T2K = T2I * T2J;
+			 T8C = T2I * T2M;
+			 T2L = W[59];
+			 T2N = FMA(T2L, T2M, T2K);
+			 T8D = FNMS(T2L, T2J, T8C);
+		    }
+		    {
+			 E T2Q, T2T, T2R, T8Y, T2P, T2S;
+			 T2Q = ri[WS(rs, 14)];
+			 T2T = ii[WS(rs, 14)];
+			 T2P = W[26];
+			 T2R = T2P * T2Q;
+			 T8Y = T2P * T2T;
+			 T2S = W[27];
+			 T2U = FMA(T2S, T2T, T2R);
+			 T8Z = FNMS(T2S, T2Q, T8Y);
+		    }
+		    {
+			 E T2O, T31, Tfe, Tff;
+			 T2O = T2H + T2N;
+			 T31 = T2U + T30;
+			 T32 = T2O + T31;
+			 Tfj = T2O - T31;
+			 Tfe = T8B + T8D;
+			 Tff = T8Z + T91;
+			 Tfg = Tfe - Tff;
+			 ThB = Tfe + Tff;
+		    }
+		    {
+			 E T8E, T8F, T8X, T92;
+			 T8E = T8B - T8D;
+			 T8F = T2U - T30;
+			 T8G = T8E + T8F;
+			 TcU = T8E - T8F;
+			 T8X = T2H - T2N;
+			 T92 = T8Z - T91;
+			 T93 = T8X - T92;
+			 TcX = T8X + T92;
+		    }
+	       }
+	       {
+		    E T3C, T9c, T3V, Ta8, T3I, T9e, T3P, Ta6;
+		    {
+			 E T3y, T3B, T3z, T9b, T3x, T3A;
+			 T3y = ri[WS(rs, 1)];
+			 T3B = ii[WS(rs, 1)];
+			 T3x = W[0];
+			 T3z = T3x * T3y;
+			 T9b = T3x * T3B;
+			 T3A = W[1];
+			 T3C = FMA(T3A, T3B, T3z);
+			 T9c = FNMS(T3A, T3y, T9b);
+		    }
+		    {
+			 E T3R, T3U, T3S, Ta7, T3Q, T3T;
+			 T3R = ri[WS(rs, 49)];
+			 T3U = ii[WS(rs, 49)];
+			 T3Q = W[96];
+			 T3S = T3Q * T3R;
+			 Ta7 = T3Q * T3U;
+			 T3T = W[97];
+			 T3V = FMA(T3T, T3U, T3S);
+			 Ta8 = FNMS(T3T, T3R, Ta7);
+		    }
+		    {
+			 E T3E, T3H, T3F, T9d, T3D, T3G;
+			 T3E = ri[WS(rs, 33)];
+			 T3H = ii[WS(rs, 33)];
+			 T3D = W[64];
+			 T3F = T3D * T3E;
+			 T9d = T3D * T3H;
+			 T3G = W[65];
+			 T3I = FMA(T3G, T3H, T3F);
+			 T9e = FNMS(T3G, T3E, T9d);
+		    }
+		    {
+			 E T3L, T3O, T3M, Ta5, T3K, T3N;
+			 T3L = ri[WS(rs, 17)];
+			 T3O = ii[WS(rs, 17)];
+			 T3K = W[32];
+			 T3M = T3K * T3L;
+			 Ta5 = T3K * T3O;
+			 T3N = W[33];
+			 T3P = FMA(T3N, T3O, T3M);
+			 Ta6 = FNMS(T3N, T3L, Ta5);
+		    }
+		    {
+			 E T3J, T3W, Tfr, Tfs;
+			 T3J = T3C + T3I;
+			 T3W = T3P + T3V;
+			 T3X = T3J + T3W;
+			 TfI = T3J - T3W;
+			 Tfr = T9c + T9e;
+			 Tfs = Ta6 + Ta8;
+			 Tft = Tfr - Tfs;
+			 ThH = Tfr + Tfs;
+		    }
+		    {
+			 E T9f, T9g, Ta4, Ta9;
+			 T9f = T9c - T9e;
+			 T9g = T3P - T3V;
+			 T9h = T9f + T9g;
+			 Td3 = T9f - T9g;
+			 Ta4 = T3C - T3I;
+			 Ta9 = Ta6 - Ta8;
+			 Taa = Ta4 - Ta9;
+			 Tde = Ta4 + Ta9;
+		    }
+	       }
+	       {
+		    E T2f, T8a, T2y, T8j, T2l, T8c, T2s, T8h;
+		    {
+			 E T2b, T2e, T2c, T89, T2a, T2d;
+			 T2b = ri[WS(rs, 10)];
+			 T2e = ii[WS(rs, 10)];
+			 T2a = W[18];
+			 T2c = T2a * T2b;
+			 T89 = T2a * T2e;
+			 T2d = W[19];
+			 T2f = FMA(T2d, T2e, T2c);
+			 T8a = FNMS(T2d, T2b, T89);
+		    }
+		    {
+			 E T2u, T2x, T2v, T8i, T2t, T2w;
+			 T2u = ri[WS(rs, 26)];
+			 T2x = ii[WS(rs, 26)];
+			 T2t = W[50];
+			 T2v = T2t * T2u;
+			 T8i = T2t * T2x;
+			 T2w = W[51];
+			 T2y = FMA(T2w, T2x, T2v);
+			 T8j = FNMS(T2w, T2u, T8i);
+		    }
+		    {
+			 E T2h, T2k, T2i, T8b, T2g, T2j;
+			 T2h = ri[WS(rs, 42)];
+			 T2k = ii[WS(rs, 42)];
+			 T2g = W[82];
+			 T2i = T2g * T2h;
+			 T8b = T2g * T2k;
+			 T2j = W[83];
+			 T2l = FMA(T2j, T2k, T2i);
+			 T8c = FNMS(T2j, T2h, T8b);
+		    }
+		    {
+			 E T2o, T2r, T2p, T8g, T2n, T2q;
+			 T2o = ri[WS(rs, 58)];
+			 T2r = ii[WS(rs, 58)];
+			 T2n = W[114];
+			 T2p = T2n * T2o;
+			 T8g = T2n * T2r;
+			 T2q = W[115];
+			 T2s = FMA(T2q, T2r, T2p);
+			 T8h = FNMS(T2q, T2o, T8g);
+		    }
+		    {
+			 E T2m, T2z, Tf9, Tfa;
+			 T2m = T2f + T2l;
+			 T2z = T2s + T2y;
+			 T2A = T2m + T2z;
+			 Tf6 = T2z - T2m;
+			 Tf9 = T8a + T8c;
+			 Tfa = T8h + T8j;
+			 Tfb = Tf9 - Tfa;
+			 Thw = Tf9 + Tfa;
+			 {
+			      E T8e, T8w, T8l, T8v;
+			      {
+				   E T88, T8d, T8f, T8k;
+				   T88 = T2f - T2l;
+				   T8d = T8a - T8c;
+				   T8e = T88 + T8d;
+				   T8w = T8d - T88;
+				   T8f = T2s - T2y;
+				   T8k = T8h - T8j;
+				   T8l = T8f - T8k;
+				   T8v = T8f + T8k;
+			      }
+			      T8m = T8e - T8l;
+			      TcR = T8e + T8l;
+			      T8x = T8v - T8w;
+			      TcO = T8w + T8v;
+			 }
+		    }
+	       }
+	       {
+		    E T38, T8J, T3r, T8S, T3e, T8L, T3l, T8Q;
+		    {
+			 E T34, T37, T35, T8I, T33, T36;
+			 T34 = ri[WS(rs, 6)];
+			 T37 = ii[WS(rs, 6)];
+			 T33 = W[10];
+			 T35 = T33 * T34;
+			 T8I = T33 * T37;
+			 T36 = W[11];
+			 T38 = FMA(T36, T37, T35);
+			 T8J = FNMS(T36, T34, T8I);
+		    }
+		    {
+			 E T3n, T3q, T3o, T8R, T3m, T3p;
+			 T3n = ri[WS(rs, 22)];
+			 T3q = ii[WS(rs, 22)];
+			 T3m = W[42];
+			 T3o = T3m * T3n;
+			 T8R = T3m * T3q;
+			 T3p = W[43];
+			 T3r = FMA(T3p, T3q, T3o);
+			 T8S = FNMS(T3p, T3n, T8R);
+		    }
+		    {
+			 E T3a, T3d, T3b, T8K, T39, T3c;
+			 T3a = ri[WS(rs, 38)];
+			 T3d = ii[WS(rs, 38)];
+			 T39 = W[74];
+			 T3b = T39 * T3a;
+			 T8K = T39 * T3d;
+			 T3c = W[75];
+			 T3e = FMA(T3c, T3d, T3b);
+			 T8L = FNMS(T3c, T3a, T8K);
+		    }
+		    {
+			 E T3h, T3k, T3i, T8P, T3g, T3j;
+			 T3h = ri[WS(rs, 54)];
+			 T3k = ii[WS(rs, 54)];
+			 T3g = W[106];
+			 T3i = T3g * T3h;
+			 T8P = T3g * T3k;
+			 T3j = W[107];
+			 T3l = FMA(T3j, T3k, T3i);
+			 T8Q = FNMS(T3j, T3h, T8P);
+		    }
+		    {
+			 E T3f, T3s, Tfk, Tfl;
+			 T3f = T38 + T3e;
+			 T3s = T3l + T3r;
+			 T3t = T3f + T3s;
+			 Tfh = T3s - T3f;
+			 Tfk = T8J + T8L;
+			 Tfl = T8Q + T8S;
+			 Tfm = Tfk - Tfl;
+			 ThC = Tfk + Tfl;
+			 {
+			      E T8N, T95, T8U, T94;
+			      {
+				   E T8H, T8M, T8O, T8T;
+				   T8H = T38 - T3e;
+				   T8M = T8J - T8L;
+				   T8N = T8H + T8M;
+				   T95 = T8M - T8H;
+				   T8O = T3l - T3r;
+				   T8T = T8Q - T8S;
+				   T8U = T8O - T8T;
+				   T94 = T8O + T8T;
+			      }
+			      T8V = T8N - T8U;
+			      TcY = T8N + T8U;
+			      T96 = T94 - T95;
+			      TcV = T95 + T94;
+			 }
+		    }
+	       }
+	       {
+		    E T43, T9k, T4m, T9t, T49, T9m, T4g, T9r;
+		    {
+			 E T3Z, T42, T40, T9j, T3Y, T41;
+			 T3Z = ri[WS(rs, 9)];
+			 T42 = ii[WS(rs, 9)];
+			 T3Y = W[16];
+			 T40 = T3Y * T3Z;
+			 T9j = T3Y * T42;
+			 T41 = W[17];
+			 T43 = FMA(T41, T42, T40);
+			 T9k = FNMS(T41, T3Z, T9j);
+		    }
+		    {
+			 E T4i, T4l, T4j, T9s, T4h, T4k;
+			 T4i = ri[WS(rs, 25)];
+			 T4l = ii[WS(rs, 25)];
+			 T4h = W[48];
+			 T4j = T4h * T4i;
+			 T9s = T4h * T4l;
+			 T4k = W[49];
+			 T4m = FMA(T4k, T4l, T4j);
+			 T9t = FNMS(T4k, T4i, T9s);
+		    }
+		    {
+			 E T45, T48, T46, T9l, T44, T47;
+			 T45 = ri[WS(rs, 41)];
+			 T48 = ii[WS(rs, 41)];
+			 T44 = W[80];
+			 T46 = T44 * T45;
+			 T9l = T44 * T48;
+			 T47 = W[81];
+			 T49 = FMA(T47, T48, T46);
+			 T9m = FNMS(T47, T45, T9l);
+		    }
+		    {
+			 E T4c, T4f, T4d, T9q, T4b, T4e;
+			 T4c = ri[WS(rs, 57)];
+			 T4f = ii[WS(rs, 57)];
+			 T4b = W[112];
+			 T4d = T4b * T4c;
+			 T9q = T4b * T4f;
+			 T4e = W[113];
+			 T4g = FMA(T4e, T4f, T4d);
+			 T9r = FNMS(T4e, T4c, T9q);
+		    }
+		    {
+			 E T4a, T4n, TfJ, TfK;
+			 T4a = T43 + T49;
+			 T4n = T4g + T4m;
+			 T4o = T4a + T4n;
+			 Tfu = T4n - T4a;
+			 TfJ = T9k + T9m;
+			 TfK = T9r + T9t;
+			 TfL = TfJ - TfK;
+			 ThI = TfJ + TfK;
+			 {
+			      E T9o, Tac, T9v, Tab;
+			      {
+				   E T9i, T9n, T9p, T9u;
+				   T9i = T43 - T49;
+				   T9n = T9k - T9m;
+				   T9o = T9i + T9n;
+				   Tac = T9n - T9i;
+				   T9p = T4g - T4m;
+				   T9u = T9r - T9t;
+				   T9v = T9p - T9u;
+				   Tab = T9p + T9u;
+			      }
+			      T9w = T9o - T9v;
+			      Tdf = T9o + T9v;
+			      Tad = Tab - Tac;
+			      Td4 = Tac + Tab;
+			 }
+		    }
+	       }
+	       {
+		    E T5Q, Tat, T69, TaC, T5W, Tav, T63, TaA;
+		    {
+			 E T5M, T5P, T5N, Tas, T5L, T5O;
+			 T5M = ri[WS(rs, 7)];
+			 T5P = ii[WS(rs, 7)];
+			 T5L = W[12];
+			 T5N = T5L * T5M;
+			 Tas = T5L * T5P;
+			 T5O = W[13];
+			 T5Q = FMA(T5O, T5P, T5N);
+			 Tat = FNMS(T5O, T5M, Tas);
+		    }
+		    {
+			 E T65, T68, T66, TaB, T64, T67;
+			 T65 = ri[WS(rs, 23)];
+			 T68 = ii[WS(rs, 23)];
+			 T64 = W[44];
+			 T66 = T64 * T65;
+			 TaB = T64 * T68;
+			 T67 = W[45];
+			 T69 = FMA(T67, T68, T66);
+			 TaC = FNMS(T67, T65, TaB);
+		    }
+		    {
+			 E T5S, T5V, T5T, Tau, T5R, T5U;
+			 T5S = ri[WS(rs, 39)];
+			 T5V = ii[WS(rs, 39)];
+			 T5R = W[76];
+			 T5T = T5R * T5S;
+			 Tau = T5R * T5V;
+			 T5U = W[77];
+			 T5W = FMA(T5U, T5V, T5T);
+			 Tav = FNMS(T5U, T5S, Tau);
+		    }
+		    {
+			 E T5Z, T62, T60, Taz, T5Y, T61;
+			 T5Z = ri[WS(rs, 55)];
+			 T62 = ii[WS(rs, 55)];
+			 T5Y = W[108];
+			 T60 = T5Y * T5Z;
+			 Taz = T5Y * T62;
+			 T61 = W[109];
+			 T63 = FMA(T61, T62, T60);
+			 TaA = FNMS(T61, T5Z, Taz);
+		    }
+		    {
+			 E T5X, T6a, Tga, Tgb;
+			 T5X = T5Q + T5W;
+			 T6a = T63 + T69;
+			 T6b = T5X + T6a;
+			 TfV = T6a - T5X;
+			 Tga = Tat + Tav;
+			 Tgb = TaA + TaC;
+			 Tgc = Tga - Tgb;
+			 ThT = Tga + Tgb;
+			 {
+			      E Tax, Tbl, TaE, Tbk;
+			      {
+				   E Tar, Taw, Tay, TaD;
+				   Tar = T5Q - T5W;
+				   Taw = Tat - Tav;
+				   Tax = Tar + Taw;
+				   Tbl = Taw - Tar;
+				   Tay = T63 - T69;
+				   TaD = TaA - TaC;
+				   TaE = Tay - TaD;
+				   Tbk = Tay + TaD;
+			      }
+			      TaF = Tax - TaE;
+			      Tdy = Tax + TaE;
+			      Tbm = Tbk - Tbl;
+			      Tdn = Tbl + Tbk;
+			 }
+		    }
+	       }
+	       {
+		    E T4v, T9V, T4O, T9R, T4B, T9X, T4I, T9P;
+		    {
+			 E T4r, T4u, T4s, T9U, T4q, T4t;
+			 T4r = ri[WS(rs, 5)];
+			 T4u = ii[WS(rs, 5)];
+			 T4q = W[8];
+			 T4s = T4q * T4r;
+			 T9U = T4q * T4u;
+			 T4t = W[9];
+			 T4v = FMA(T4t, T4u, T4s);
+			 T9V = FNMS(T4t, T4r, T9U);
+		    }
+		    {
+			 E T4K, T4N, T4L, T9Q, T4J, T4M;
+			 T4K = ri[WS(rs, 53)];
+			 T4N = ii[WS(rs, 53)];
+			 T4J = W[104];
+			 T4L = T4J * T4K;
+			 T9Q = T4J * T4N;
+			 T4M = W[105];
+			 T4O = FMA(T4M, T4N, T4L);
+			 T9R = FNMS(T4M, T4K, T9Q);
+		    }
+		    {
+			 E T4x, T4A, T4y, T9W, T4w, T4z;
+			 T4x = ri[WS(rs, 37)];
+			 T4A = ii[WS(rs, 37)];
+			 T4w = W[72];
+			 T4y = T4w * T4x;
+			 T9W = T4w * T4A;
+			 T4z = W[73];
+			 T4B = FMA(T4z, T4A, T4y);
+			 T9X = FNMS(T4z, T4x, T9W);
+		    }
+		    {
+			 E T4E, T4H, T4F, T9O, T4D, T4G;
+			 T4E = ri[WS(rs, 21)];
+			 T4H = ii[WS(rs, 21)];
+			 T4D = W[40];
+			 T4F = T4D * T4E;
+			 T9O = T4D * T4H;
+			 T4G = W[41];
+			 T4I = FMA(T4G, T4H, T4F);
+			 T9P = FNMS(T4G, T4E, T9O);
+		    }
+		    {
+			 E T4C, T4P, Tfz, Tfw, Tfx, Tfy;
+			 T4C = T4v + T4B;
+			 T4P = T4I + T4O;
+			 Tfz = T4C - T4P;
+			 Tfw = T9V + T9X;
+			 Tfx = T9P + T9R;
+			 Tfy = Tfw - Tfx;
+			 T4Q = T4C + T4P;
+			 ThN = Tfw + Tfx;
+			 TfA = Tfy - Tfz;
+			 TfN = Tfz + Tfy;
+		    }
+		    {
+			 E T9T, Td7, Ta0, Td6;
+			 {
+			      E T9N, T9S, T9Y, T9Z;
+			      T9N = T4v - T4B;
+			      T9S = T9P - T9R;
+			      T9T = T9N - T9S;
+			      Td7 = T9N + T9S;
+			      T9Y = T9V - T9X;
+			      T9Z = T4I - T4O;
+			      Ta0 = T9Y + T9Z;
+			      Td6 = T9Y - T9Z;
+			 }
+			 Ta1 = FNMS(KP414213562, Ta0, T9T);
+			 Tdh = FMA(KP414213562, Td6, Td7);
+			 Taf = FMA(KP414213562, T9T, Ta0);
+			 Td8 = FNMS(KP414213562, Td7, Td6);
+		    }
+	       }
+	       {
+		    E T4W, T9G, T5f, T9C, T52, T9I, T59, T9A;
+		    {
+			 E T4S, T4V, T4T, T9F, T4R, T4U;
+			 T4S = ri[WS(rs, 61)];
+			 T4V = ii[WS(rs, 61)];
+			 T4R = W[120];
+			 T4T = T4R * T4S;
+			 T9F = T4R * T4V;
+			 T4U = W[121];
+			 T4W = FMA(T4U, T4V, T4T);
+			 T9G = FNMS(T4U, T4S, T9F);
+		    }
+		    {
+			 E T5b, T5e, T5c, T9B, T5a, T5d;
+			 T5b = ri[WS(rs, 45)];
+			 T5e = ii[WS(rs, 45)];
+			 T5a = W[88];
+			 T5c = T5a * T5b;
+			 T9B = T5a * T5e;
+			 T5d = W[89];
+			 T5f = FMA(T5d, T5e, T5c);
+			 T9C = FNMS(T5d, T5b, T9B);
+		    }
+		    {
+			 E T4Y, T51, T4Z, T9H, T4X, T50;
+			 T4Y = ri[WS(rs, 29)];
+			 T51 = ii[WS(rs, 29)];
+			 T4X = W[56];
+			 T4Z = T4X * T4Y;
+			 T9H = T4X * T51;
+			 T50 = W[57];
+			 T52 = FMA(T50, T51, T4Z);
+			 T9I = FNMS(T50, T4Y, T9H);
+		    }
+		    {
+			 E T55, T58, T56, T9z, T54, T57;
+			 T55 = ri[WS(rs, 13)];
+			 T58 = ii[WS(rs, 13)];
+			 T54 = W[24];
+			 T56 = T54 * T55;
+			 T9z = T54 * T58;
+			 T57 = W[25];
+			 T59 = FMA(T57, T58, T56);
+			 T9A = FNMS(T57, T55, T9z);
+		    }
+		    {
+			 E T53, T5g, TfB, TfC, TfD, TfE;
+			 T53 = T4W + T52;
+			 T5g = T59 + T5f;
+			 TfB = T53 - T5g;
+			 TfC = T9G + T9I;
+			 TfD = T9A + T9C;
+			 TfE = TfC - TfD;
+			 T5h = T53 + T5g;
+			 ThO = TfC + TfD;
+			 TfF = TfB + TfE;
+			 TfO = TfB - TfE;
+		    }
+		    {
+			 E T9E, Tda, T9L, Td9;
+			 {
+			      E T9y, T9D, T9J, T9K;
+			      T9y = T4W - T52;
+			      T9D = T9A - T9C;
+			      T9E = T9y - T9D;
+			      Tda = T9y + T9D;
+			      T9J = T9G - T9I;
+			      T9K = T59 - T5f;
+			      T9L = T9J + T9K;
+			      Td9 = T9J - T9K;
+			 }
+			 T9M = FMA(KP414213562, T9L, T9E);
+			 Tdi = FNMS(KP414213562, Td9, Tda);
+			 Tag = FNMS(KP414213562, T9E, T9L);
+			 Tdb = FMA(KP414213562, Tda, Td9);
+		    }
+	       }
+	       {
+		    E T6i, Tb4, T6B, Tb0, T6o, Tb6, T6v, TaY;
+		    {
+			 E T6e, T6h, T6f, Tb3, T6d, T6g;
+			 T6e = ri[WS(rs, 3)];
+			 T6h = ii[WS(rs, 3)];
+			 T6d = W[4];
+			 T6f = T6d * T6e;
+			 Tb3 = T6d * T6h;
+			 T6g = W[5];
+			 T6i = FMA(T6g, T6h, T6f);
+			 Tb4 = FNMS(T6g, T6e, Tb3);
+		    }
+		    {
+			 E T6x, T6A, T6y, TaZ, T6w, T6z;
+			 T6x = ri[WS(rs, 51)];
+			 T6A = ii[WS(rs, 51)];
+			 T6w = W[100];
+			 T6y = T6w * T6x;
+			 TaZ = T6w * T6A;
+			 T6z = W[101];
+			 T6B = FMA(T6z, T6A, T6y);
+			 Tb0 = FNMS(T6z, T6x, TaZ);
+		    }
+		    {
+			 E T6k, T6n, T6l, Tb5, T6j, T6m;
+			 T6k = ri[WS(rs, 35)];
+			 T6n = ii[WS(rs, 35)];
+			 T6j = W[68];
+			 T6l = T6j * T6k;
+			 Tb5 = T6j * T6n;
+			 T6m = W[69];
+			 T6o = FMA(T6m, T6n, T6l);
+			 Tb6 = FNMS(T6m, T6k, Tb5);
+		    }
+		    {
+			 E T6r, T6u, T6s, TaX, T6q, T6t;
+			 T6r = ri[WS(rs, 19)];
+			 T6u = ii[WS(rs, 19)];
+			 T6q = W[36];
+			 T6s = T6q * T6r;
+			 TaX = T6q * T6u;
+			 T6t = W[37];
+			 T6v = FMA(T6t, T6u, T6s);
+			 TaY = FNMS(T6t, T6r, TaX);
+		    }
+		    {
+			 E T6p, T6C, Tg0, TfX, TfY, TfZ;
+			 T6p = T6i + T6o;
+			 T6C = T6v + T6B;
+			 Tg0 = T6p - T6C;
+			 TfX = Tb4 + Tb6;
+			 TfY = TaY + Tb0;
+			 TfZ = TfX - TfY;
+			 T6D = T6p + T6C;
+			 ThY = TfX + TfY;
+			 Tg1 = TfZ - Tg0;
+			 Tge = Tg0 + TfZ;
+		    }
+		    {
+			 E Tb2, Tdq, Tb9, Tdp;
+			 {
+			      E TaW, Tb1, Tb7, Tb8;
+			      TaW = T6i - T6o;
+			      Tb1 = TaY - Tb0;
+			      Tb2 = TaW - Tb1;
+			      Tdq = TaW + Tb1;
+			      Tb7 = Tb4 - Tb6;
+			      Tb8 = T6v - T6B;
+			      Tb9 = Tb7 + Tb8;
+			      Tdp = Tb7 - Tb8;
+			 }
+			 Tba = FNMS(KP414213562, Tb9, Tb2);
+			 TdA = FMA(KP414213562, Tdp, Tdq);
+			 Tbo = FMA(KP414213562, Tb2, Tb9);
+			 Tdr = FNMS(KP414213562, Tdq, Tdp);
+		    }
+	       }
+	       {
+		    E T6J, TaP, T72, TaL, T6P, TaR, T6W, TaJ;
+		    {
+			 E T6F, T6I, T6G, TaO, T6E, T6H;
+			 T6F = ri[WS(rs, 59)];
+			 T6I = ii[WS(rs, 59)];
+			 T6E = W[116];
+			 T6G = T6E * T6F;
+			 TaO = T6E * T6I;
+			 T6H = W[117];
+			 T6J = FMA(T6H, T6I, T6G);
+			 TaP = FNMS(T6H, T6F, TaO);
+		    }
+		    {
+			 E T6Y, T71, T6Z, TaK, T6X, T70;
+			 T6Y = ri[WS(rs, 43)];
+			 T71 = ii[WS(rs, 43)];
+			 T6X = W[84];
+			 T6Z = T6X * T6Y;
+			 TaK = T6X * T71;
+			 T70 = W[85];
+			 T72 = FMA(T70, T71, T6Z);
+			 TaL = FNMS(T70, T6Y, TaK);
+		    }
+		    {
+			 E T6L, T6O, T6M, TaQ, T6K, T6N;
+			 T6L = ri[WS(rs, 27)];
+			 T6O = ii[WS(rs, 27)];
+			 T6K = W[52];
+			 T6M = T6K * T6L;
+			 TaQ = T6K * T6O;
+			 T6N = W[53];
+			 T6P = FMA(T6N, T6O, T6M);
+			 TaR = FNMS(T6N, T6L, TaQ);
+		    }
+		    {
+			 E T6S, T6V, T6T, TaI, T6R, T6U;
+			 T6S = ri[WS(rs, 11)];
+			 T6V = ii[WS(rs, 11)];
+			 T6R = W[20];
+			 T6T = T6R * T6S;
+			 TaI = T6R * T6V;
+			 T6U = W[21];
+			 T6W = FMA(T6U, T6V, T6T);
+			 TaJ = FNMS(T6U, T6S, TaI);
+		    }
+		    {
+			 E T6Q, T73, Tg2, Tg3, Tg4, Tg5;
+			 T6Q = T6J + T6P;
+			 T73 = T6W + T72;
+			 Tg2 = T6Q - T73;
+			 Tg3 = TaP + TaR;
+			 Tg4 = TaJ + TaL;
+			 Tg5 = Tg3 - Tg4;
+			 T74 = T6Q + T73;
+			 ThZ = Tg3 + Tg4;
+			 Tg6 = Tg2 + Tg5;
+			 Tgf = Tg2 - Tg5;
+		    }
+		    {
+			 E TaN, Tdt, TaU, Tds;
+			 {
+			      E TaH, TaM, TaS, TaT;
+			      TaH = T6J - T6P;
+			      TaM = TaJ - TaL;
+			      TaN = TaH - TaM;
+			      Tdt = TaH + TaM;
+			      TaS = TaP - TaR;
+			      TaT = T6W - T72;
+			      TaU = TaS + TaT;
+			      Tds = TaS - TaT;
+			 }
+			 TaV = FMA(KP414213562, TaU, TaN);
+			 TdB = FNMS(KP414213562, Tds, Tdt);
+			 Tbp = FNMS(KP414213562, TaN, TaU);
+			 Tdu = FMA(KP414213562, Tdt, Tds);
+		    }
+	       }
+	       {
+		    E T1I, Tio, T3v, Tj1, TiX, Tj2, Tir, TiN, T76, TiK, TiC, TiG, T5j, TiJ, Tix;
+		    E TiF;
+		    {
+			 E TO, T1H, Tip, Tiq;
+			 TO = Tm + TN;
+			 T1H = T1f + T1G;
+			 T1I = TO + T1H;
+			 Tio = TO - T1H;
+			 {
+			      E T2B, T3u, TiO, TiW;
+			      T2B = T29 + T2A;
+			      T3u = T32 + T3t;
+			      T3v = T2B + T3u;
+			      Tj1 = T3u - T2B;
+			      TiO = Thr + Ths;
+			      TiW = TiP + TiV;
+			      TiX = TiO + TiW;
+			      Tj2 = TiW - TiO;
+			 }
+			 Tip = Thv + Thw;
+			 Tiq = ThB + ThC;
+			 Tir = Tip - Tiq;
+			 TiN = Tip + Tiq;
+			 {
+			      E T6c, T75, Tiy, Tiz, TiA, TiB;
+			      T6c = T5K + T6b;
+			      T75 = T6D + T74;
+			      Tiy = T6c - T75;
+			      Tiz = ThS + ThT;
+			      TiA = ThY + ThZ;
+			      TiB = Tiz - TiA;
+			      T76 = T6c + T75;
+			      TiK = Tiz + TiA;
+			      TiC = Tiy - TiB;
+			      TiG = Tiy + TiB;
+			 }
+			 {
+			      E T4p, T5i, Tit, Tiu, Tiv, Tiw;
+			      T4p = T3X + T4o;
+			      T5i = T4Q + T5h;
+			      Tit = T4p - T5i;
+			      Tiu = ThH + ThI;
+			      Tiv = ThN + ThO;
+			      Tiw = Tiu - Tiv;
+			      T5j = T4p + T5i;
+			      TiJ = Tiu + Tiv;
+			      Tix = Tit + Tiw;
+			      TiF = Tiw - Tit;
+			 }
+		    }
+		    {
+			 E T3w, T77, TiM, TiY;
+			 T3w = T1I + T3v;
+			 T77 = T5j + T76;
+			 ri[WS(rs, 32)] = T3w - T77;
+			 ri[0] = T3w + T77;
+			 TiM = TiJ + TiK;
+			 TiY = TiN + TiX;
+			 ii[0] = TiM + TiY;
+			 ii[WS(rs, 32)] = TiY - TiM;
+		    }
+		    {
+			 E Tis, TiD, Tj3, Tj4;
+			 Tis = Tio + Tir;
+			 TiD = Tix + TiC;
+			 ri[WS(rs, 40)] = FNMS(KP707106781, TiD, Tis);
+			 ri[WS(rs, 8)] = FMA(KP707106781, TiD, Tis);
+			 Tj3 = Tj1 + Tj2;
+			 Tj4 = TiF + TiG;
+			 ii[WS(rs, 8)] = FMA(KP707106781, Tj4, Tj3);
+			 ii[WS(rs, 40)] = FNMS(KP707106781, Tj4, Tj3);
+		    }
+		    {
+			 E TiE, TiH, Tj5, Tj6;
+			 TiE = Tio - Tir;
+			 TiH = TiF - TiG;
+			 ri[WS(rs, 56)] = FNMS(KP707106781, TiH, TiE);
+			 ri[WS(rs, 24)] = FMA(KP707106781, TiH, TiE);
+			 Tj5 = Tj2 - Tj1;
+			 Tj6 = TiC - Tix;
+			 ii[WS(rs, 24)] = FMA(KP707106781, Tj6, Tj5);
+			 ii[WS(rs, 56)] = FNMS(KP707106781, Tj6, Tj5);
+		    }
+		    {
+			 E TiI, TiL, TiZ, Tj0;
+			 TiI = T1I - T3v;
+			 TiL = TiJ - TiK;
+			 ri[WS(rs, 48)] = TiI - TiL;
+			 ri[WS(rs, 16)] = TiI + TiL;
+			 TiZ = T76 - T5j;
+			 Tj0 = TiX - TiN;
+			 ii[WS(rs, 16)] = TiZ + Tj0;
+			 ii[WS(rs, 48)] = Tj0 - TiZ;
+		    }
+	       }
+	       {
+		    E Thu, Ti8, Tj9, Tjf, ThF, Tjg, Tib, Tja, ThR, Til, Ti5, Tif, Ti2, Tim, Ti6;
+		    E Tii;
+		    {
+			 E Thq, Tht, Tj7, Tj8;
+			 Thq = Tm - TN;
+			 Tht = Thr - Ths;
+			 Thu = Thq - Tht;
+			 Ti8 = Thq + Tht;
+			 Tj7 = T1G - T1f;
+			 Tj8 = TiV - TiP;
+			 Tj9 = Tj7 + Tj8;
+			 Tjf = Tj8 - Tj7;
+		    }
+		    {
+			 E Thz, Ti9, ThE, Tia;
+			 {
+			      E Thx, Thy, ThA, ThD;
+			      Thx = Thv - Thw;
+			      Thy = T29 - T2A;
+			      Thz = Thx - Thy;
+			      Ti9 = Thy + Thx;
+			      ThA = T32 - T3t;
+			      ThD = ThB - ThC;
+			      ThE = ThA + ThD;
+			      Tia = ThA - ThD;
+			 }
+			 ThF = Thz - ThE;
+			 Tjg = Tia - Ti9;
+			 Tib = Ti9 + Tia;
+			 Tja = Thz + ThE;
+		    }
+		    {
+			 E ThL, Tie, ThQ, Tid;
+			 {
+			      E ThJ, ThK, ThM, ThP;
+			      ThJ = ThH - ThI;
+			      ThK = T5h - T4Q;
+			      ThL = ThJ - ThK;
+			      Tie = ThJ + ThK;
+			      ThM = T3X - T4o;
+			      ThP = ThN - ThO;
+			      ThQ = ThM - ThP;
+			      Tid = ThM + ThP;
+			 }
+			 ThR = FMA(KP414213562, ThQ, ThL);
+			 Til = FNMS(KP414213562, Tid, Tie);
+			 Ti5 = FNMS(KP414213562, ThL, ThQ);
+			 Tif = FMA(KP414213562, Tie, Tid);
+		    }
+		    {
+			 E ThW, Tih, Ti1, Tig;
+			 {
+			      E ThU, ThV, ThX, Ti0;
+			      ThU = ThS - ThT;
+			      ThV = T74 - T6D;
+			      ThW = ThU - ThV;
+			      Tih = ThU + ThV;
+			      ThX = T5K - T6b;
+			      Ti0 = ThY - ThZ;
+			      Ti1 = ThX - Ti0;
+			      Tig = ThX + Ti0;
+			 }
+			 Ti2 = FNMS(KP414213562, Ti1, ThW);
+			 Tim = FMA(KP414213562, Tig, Tih);
+			 Ti6 = FMA(KP414213562, ThW, Ti1);
+			 Tii = FNMS(KP414213562, Tih, Tig);
+		    }
+		    {
+			 E ThG, Ti3, Tjh, Tji;
+			 ThG = FMA(KP707106781, ThF, Thu);
+			 Ti3 = ThR - Ti2;
+			 ri[WS(rs, 44)] = FNMS(KP923879532, Ti3, ThG);
+			 ri[WS(rs, 12)] = FMA(KP923879532, Ti3, ThG);
+			 Tjh = FMA(KP707106781, Tjg, Tjf);
+			 Tji = Ti6 - Ti5;
+			 ii[WS(rs, 12)] = FMA(KP923879532, Tji, Tjh);
+			 ii[WS(rs, 44)] = FNMS(KP923879532, Tji, Tjh);
+		    }
+		    {
+			 E Ti4, Ti7, Tjj, Tjk;
+			 Ti4 = FNMS(KP707106781, ThF, Thu);
+			 Ti7 = Ti5 + Ti6;
+			 ri[WS(rs, 28)] = FNMS(KP923879532, Ti7, Ti4);
+			 ri[WS(rs, 60)] = FMA(KP923879532, Ti7, Ti4);
+			 Tjj = FNMS(KP707106781, Tjg, Tjf);
+			 Tjk = ThR + Ti2;
+			 ii[WS(rs, 28)] = FNMS(KP923879532, Tjk, Tjj);
+			 ii[WS(rs, 60)] = FMA(KP923879532, Tjk, Tjj);
+		    }
+		    {
+			 E Tic, Tij, Tjb, Tjc;
+			 Tic = FMA(KP707106781, Tib, Ti8);
+			 Tij = Tif + Tii;
+			 ri[WS(rs, 36)] = FNMS(KP923879532, Tij, Tic);
+			 ri[WS(rs, 4)] = FMA(KP923879532, Tij, Tic);
+			 Tjb = FMA(KP707106781, Tja, Tj9);
+			 Tjc = Til + Tim;
+			 ii[WS(rs, 4)] = FMA(KP923879532, Tjc, Tjb);
+			 ii[WS(rs, 36)] = FNMS(KP923879532, Tjc, Tjb);
+		    }
+		    {
+			 E Tik, Tin, Tjd, Tje;
+			 Tik = FNMS(KP707106781, Tib, Ti8);
+			 Tin = Til - Tim;
+			 ri[WS(rs, 52)] = FNMS(KP923879532, Tin, Tik);
+			 ri[WS(rs, 20)] = FMA(KP923879532, Tin, Tik);
+			 Tjd = FNMS(KP707106781, Tja, Tj9);
+			 Tje = Tii - Tif;
+			 ii[WS(rs, 20)] = FMA(KP923879532, Tje, Tjd);
+			 ii[WS(rs, 52)] = FNMS(KP923879532, Tje, Tjd);
+		    }
+	       }
+	       {
+		    E Tf2, TjJ, Tgo, TjD, TgI, Tjv, Tha, Tjp, Tfp, Tjw, Tgr, Tjq, Th4, Tho, Th8;
+		    E Thk, TfR, TgB, Tgl, Tgv, TgP, TjK, Thd, TjE, TgX, Thn, Th7, Thh, Tgi, TgC;
+		    E Tgm, Tgy;
+		    {
+			 E TeQ, TjB, Tf1, TjC, TeV, Tf0;
+			 TeQ = TeM + TeP;
+			 TjB = Tjm - Tjl;
+			 TeV = TeR + TeU;
+			 Tf0 = TeW - TeZ;
+			 Tf1 = TeV + Tf0;
+			 TjC = Tf0 - TeV;
+			 Tf2 = FNMS(KP707106781, Tf1, TeQ);
+			 TjJ = FNMS(KP707106781, TjC, TjB);
+			 Tgo = FMA(KP707106781, Tf1, TeQ);
+			 TjD = FMA(KP707106781, TjC, TjB);
+		    }
+		    {
+			 E TgE, Tjn, TgH, Tjo, TgF, TgG;
+			 TgE = TeM - TeP;
+			 Tjn = Tjl + Tjm;
+			 TgF = TeU - TeR;
+			 TgG = TeW + TeZ;
+			 TgH = TgF - TgG;
+			 Tjo = TgF + TgG;
+			 TgI = FMA(KP707106781, TgH, TgE);
+			 Tjv = FNMS(KP707106781, Tjo, Tjn);
+			 Tha = FNMS(KP707106781, TgH, TgE);
+			 Tjp = FMA(KP707106781, Tjo, Tjn);
+		    }
+		    {
+			 E Tfd, Tgp, Tfo, Tgq;
+			 {
+			      E Tf7, Tfc, Tfi, Tfn;
+			      Tf7 = Tf5 + Tf6;
+			      Tfc = Tf8 + Tfb;
+			      Tfd = FNMS(KP414213562, Tfc, Tf7);
+			      Tgp = FMA(KP414213562, Tf7, Tfc);
+			      Tfi = Tfg + Tfh;
+			      Tfn = Tfj + Tfm;
+			      Tfo = FMA(KP414213562, Tfn, Tfi);
+			      Tgq = FNMS(KP414213562, Tfi, Tfn);
+			 }
+			 Tfp = Tfd - Tfo;
+			 Tjw = Tgq - Tgp;
+			 Tgr = Tgp + Tgq;
+			 Tjq = Tfd + Tfo;
+		    }
+		    {
+			 E Th0, Thj, Th3, Thi;
+			 {
+			      E TgY, TgZ, Th1, Th2;
+			      TgY = Tg9 - Tgc;
+			      TgZ = Tg6 - Tg1;
+			      Th0 = FNMS(KP707106781, TgZ, TgY);
+			      Thj = FMA(KP707106781, TgZ, TgY);
+			      Th1 = TfU - TfV;
+			      Th2 = Tge - Tgf;
+			      Th3 = FNMS(KP707106781, Th2, Th1);
+			      Thi = FMA(KP707106781, Th2, Th1);
+			 }
+			 Th4 = FNMS(KP668178637, Th3, Th0);
+			 Tho = FMA(KP198912367, Thi, Thj);
+			 Th8 = FMA(KP668178637, Th0, Th3);
+			 Thk = FNMS(KP198912367, Thj, Thi);
+		    }
+		    {
+			 E TfH, Tgu, TfQ, Tgt;
+			 {
+			      E Tfv, TfG, TfM, TfP;
+			      Tfv = Tft + Tfu;
+			      TfG = TfA + TfF;
+			      TfH = FNMS(KP707106781, TfG, Tfv);
+			      Tgu = FMA(KP707106781, TfG, Tfv);
+			      TfM = TfI + TfL;
+			      TfP = TfN + TfO;
+			      TfQ = FNMS(KP707106781, TfP, TfM);
+			      Tgt = FMA(KP707106781, TfP, TfM);
+			 }
+			 TfR = FMA(KP668178637, TfQ, TfH);
+			 TgB = FNMS(KP198912367, Tgt, Tgu);
+			 Tgl = FNMS(KP668178637, TfH, TfQ);
+			 Tgv = FMA(KP198912367, Tgu, Tgt);
+		    }
+		    {
+			 E TgL, Thb, TgO, Thc;
+			 {
+			      E TgJ, TgK, TgM, TgN;
+			      TgJ = Tf5 - Tf6;
+			      TgK = Tf8 - Tfb;
+			      TgL = FMA(KP414213562, TgK, TgJ);
+			      Thb = FNMS(KP414213562, TgJ, TgK);
+			      TgM = Tfg - Tfh;
+			      TgN = Tfj - Tfm;
+			      TgO = FNMS(KP414213562, TgN, TgM);
+			      Thc = FMA(KP414213562, TgM, TgN);
+			 }
+			 TgP = TgL - TgO;
+			 TjK = TgL + TgO;
+			 Thd = Thb + Thc;
+			 TjE = Thc - Thb;
+		    }
+		    {
+			 E TgT, Thg, TgW, Thf;
+			 {
+			      E TgR, TgS, TgU, TgV;
+			      TgR = TfI - TfL;
+			      TgS = TfF - TfA;
+			      TgT = FNMS(KP707106781, TgS, TgR);
+			      Thg = FMA(KP707106781, TgS, TgR);
+			      TgU = Tft - Tfu;
+			      TgV = TfN - TfO;
+			      TgW = FNMS(KP707106781, TgV, TgU);
+			      Thf = FMA(KP707106781, TgV, TgU);
+			 }
+			 TgX = FMA(KP668178637, TgW, TgT);
+			 Thn = FNMS(KP198912367, Thf, Thg);
+			 Th7 = FNMS(KP668178637, TgT, TgW);
+			 Thh = FMA(KP198912367, Thg, Thf);
+		    }
+		    {
+			 E Tg8, Tgx, Tgh, Tgw;
+			 {
+			      E TfW, Tg7, Tgd, Tgg;
+			      TfW = TfU + TfV;
+			      Tg7 = Tg1 + Tg6;
+			      Tg8 = FNMS(KP707106781, Tg7, TfW);
+			      Tgx = FMA(KP707106781, Tg7, TfW);
+			      Tgd = Tg9 + Tgc;
+			      Tgg = Tge + Tgf;
+			      Tgh = FNMS(KP707106781, Tgg, Tgd);
+			      Tgw = FMA(KP707106781, Tgg, Tgd);
+			 }
+			 Tgi = FNMS(KP668178637, Tgh, Tg8);
+			 TgC = FMA(KP198912367, Tgw, Tgx);
+			 Tgm = FMA(KP668178637, Tg8, Tgh);
+			 Tgy = FNMS(KP198912367, Tgx, Tgw);
+		    }
+		    {
+			 E Tfq, Tgj, Tjx, Tjy;
+			 Tfq = FMA(KP923879532, Tfp, Tf2);
+			 Tgj = TfR - Tgi;
+			 ri[WS(rs, 42)] = FNMS(KP831469612, Tgj, Tfq);
+			 ri[WS(rs, 10)] = FMA(KP831469612, Tgj, Tfq);
+			 Tjx = FMA(KP923879532, Tjw, Tjv);
+			 Tjy = Tgm - Tgl;
+			 ii[WS(rs, 10)] = FMA(KP831469612, Tjy, Tjx);
+			 ii[WS(rs, 42)] = FNMS(KP831469612, Tjy, Tjx);
+		    }
+		    {
+			 E Tgk, Tgn, Tjz, TjA;
+			 Tgk = FNMS(KP923879532, Tfp, Tf2);
+			 Tgn = Tgl + Tgm;
+			 ri[WS(rs, 26)] = FNMS(KP831469612, Tgn, Tgk);
+			 ri[WS(rs, 58)] = FMA(KP831469612, Tgn, Tgk);
+			 Tjz = FNMS(KP923879532, Tjw, Tjv);
+			 TjA = TfR + Tgi;
+			 ii[WS(rs, 26)] = FNMS(KP831469612, TjA, Tjz);
+			 ii[WS(rs, 58)] = FMA(KP831469612, TjA, Tjz);
+		    }
+		    {
+			 E Tgs, Tgz, Tjr, Tjs;
+			 Tgs = FMA(KP923879532, Tgr, Tgo);
+			 Tgz = Tgv + Tgy;
+			 ri[WS(rs, 34)] = FNMS(KP980785280, Tgz, Tgs);
+			 ri[WS(rs, 2)] = FMA(KP980785280, Tgz, Tgs);
+			 Tjr = FMA(KP923879532, Tjq, Tjp);
+			 Tjs = TgB + TgC;
+			 ii[WS(rs, 2)] = FMA(KP980785280, Tjs, Tjr);
+			 ii[WS(rs, 34)] = FNMS(KP980785280, Tjs, Tjr);
+		    }
+		    {
+			 E TgA, TgD, Tjt, Tju;
+			 TgA = FNMS(KP923879532, Tgr, Tgo);
+			 TgD = TgB - TgC;
+			 ri[WS(rs, 50)] = FNMS(KP980785280, TgD, TgA);
+			 ri[WS(rs, 18)] = FMA(KP980785280, TgD, TgA);
+			 Tjt = FNMS(KP923879532, Tjq, Tjp);
+			 Tju = Tgy - Tgv;
+			 ii[WS(rs, 18)] = FMA(KP980785280, Tju, Tjt);
+			 ii[WS(rs, 50)] = FNMS(KP980785280, Tju, Tjt);
+		    }
+		    {
+			 E TgQ, Th5, TjF, TjG;
+			 TgQ = FMA(KP923879532, TgP, TgI);
+			 Th5 = TgX + Th4;
+			 ri[WS(rs, 38)] = FNMS(KP831469612, Th5, TgQ);
+			 ri[WS(rs, 6)] = FMA(KP831469612, Th5, TgQ);
+			 TjF = FMA(KP923879532, TjE, TjD);
+			 TjG = Th7 + Th8;
+			 ii[WS(rs, 6)] = FMA(KP831469612, TjG, TjF);
+			 ii[WS(rs, 38)] = FNMS(KP831469612, TjG, TjF);
+		    }
+		    {
+			 E Th6, Th9, TjH, TjI;
+			 Th6 = FNMS(KP923879532, TgP, TgI);
+			 Th9 = Th7 - Th8;
+			 ri[WS(rs, 54)] = FNMS(KP831469612, Th9, Th6);
+			 ri[WS(rs, 22)] = FMA(KP831469612, Th9, Th6);
+			 TjH = FNMS(KP923879532, TjE, TjD);
+			 TjI = Th4 - TgX;
+			 ii[WS(rs, 22)] = FMA(KP831469612, TjI, TjH);
+			 ii[WS(rs, 54)] = FNMS(KP831469612, TjI, TjH);
+		    }
+		    {
+			 E The, Thl, TjL, TjM;
+			 The = FNMS(KP923879532, Thd, Tha);
+			 Thl = Thh - Thk;
+			 ri[WS(rs, 46)] = FNMS(KP980785280, Thl, The);
+			 ri[WS(rs, 14)] = FMA(KP980785280, Thl, The);
+			 TjL = FNMS(KP923879532, TjK, TjJ);
+			 TjM = Tho - Thn;
+			 ii[WS(rs, 14)] = FMA(KP980785280, TjM, TjL);
+			 ii[WS(rs, 46)] = FNMS(KP980785280, TjM, TjL);
+		    }
+		    {
+			 E Thm, Thp, TjN, TjO;
+			 Thm = FMA(KP923879532, Thd, Tha);
+			 Thp = Thn + Tho;
+			 ri[WS(rs, 30)] = FNMS(KP980785280, Thp, Thm);
+			 ri[WS(rs, 62)] = FMA(KP980785280, Thp, Thm);
+			 TjN = FMA(KP923879532, TjK, TjJ);
+			 TjO = Thh + Thk;
+			 ii[WS(rs, 30)] = FNMS(KP980785280, TjO, TjN);
+			 ii[WS(rs, 62)] = FMA(KP980785280, TjO, TjN);
+		    }
+	       }
+	       {
+		    E T99, Tkw, TbB, Tkq, Taj, TbL, Tbv, TbF, Tce, Tcy, Tci, Tcu, Tc7, Tcx, Tch;
+		    E Tcr, TbZ, TkK, Tcn, TkE, Tbs, TbM, Tbw, TbI, T80, TkD, TkJ, Tby, TbS, Tkp;
+		    E Tkv, Tck;
+		    {
+			 E T8z, Tbz, T98, TbA;
+			 {
+			      E T8n, T8y, T8W, T97;
+			      T8n = FNMS(KP707106781, T8m, T87);
+			      T8y = FNMS(KP707106781, T8x, T8u);
+			      T8z = FNMS(KP668178637, T8y, T8n);
+			      Tbz = FMA(KP668178637, T8n, T8y);
+			      T8W = FNMS(KP707106781, T8V, T8G);
+			      T97 = FNMS(KP707106781, T96, T93);
+			      T98 = FMA(KP668178637, T97, T8W);
+			      TbA = FNMS(KP668178637, T8W, T97);
+			 }
+			 T99 = T8z - T98;
+			 Tkw = TbA - Tbz;
+			 TbB = Tbz + TbA;
+			 Tkq = T8z + T98;
+		    }
+		    {
+			 E Ta3, TbE, Tai, TbD;
+			 {
+			      E T9x, Ta2, Tae, Tah;
+			      T9x = FNMS(KP707106781, T9w, T9h);
+			      Ta2 = T9M - Ta1;
+			      Ta3 = FNMS(KP923879532, Ta2, T9x);
+			      TbE = FMA(KP923879532, Ta2, T9x);
+			      Tae = FNMS(KP707106781, Tad, Taa);
+			      Tah = Taf - Tag;
+			      Tai = FNMS(KP923879532, Tah, Tae);
+			      TbD = FMA(KP923879532, Tah, Tae);
+			 }
+			 Taj = FMA(KP534511135, Tai, Ta3);
+			 TbL = FNMS(KP303346683, TbD, TbE);
+			 Tbv = FNMS(KP534511135, Ta3, Tai);
+			 TbF = FMA(KP303346683, TbE, TbD);
+		    }
+		    {
+			 E Tca, Tct, Tcd, Tcs;
+			 {
+			      E Tc8, Tc9, Tcb, Tcc;
+			      Tc8 = FMA(KP707106781, Tbm, Tbj);
+			      Tc9 = Tba + TaV;
+			      Tca = FNMS(KP923879532, Tc9, Tc8);
+			      Tct = FMA(KP923879532, Tc9, Tc8);
+			      Tcb = FMA(KP707106781, TaF, Taq);
+			      Tcc = Tbo + Tbp;
+			      Tcd = FNMS(KP923879532, Tcc, Tcb);
+			      Tcs = FMA(KP923879532, Tcc, Tcb);
+			 }
+			 Tce = FNMS(KP820678790, Tcd, Tca);
+			 Tcy = FMA(KP098491403, Tcs, Tct);
+			 Tci = FMA(KP820678790, Tca, Tcd);
+			 Tcu = FNMS(KP098491403, Tct, Tcs);
+		    }
+		    {
+			 E Tc3, Tcq, Tc6, Tcp;
+			 {
+			      E Tc1, Tc2, Tc4, Tc5;
+			      Tc1 = FMA(KP707106781, Tad, Taa);
+			      Tc2 = Ta1 + T9M;
+			      Tc3 = FNMS(KP923879532, Tc2, Tc1);
+			      Tcq = FMA(KP923879532, Tc2, Tc1);
+			      Tc4 = FMA(KP707106781, T9w, T9h);
+			      Tc5 = Taf + Tag;
+			      Tc6 = FNMS(KP923879532, Tc5, Tc4);
+			      Tcp = FMA(KP923879532, Tc5, Tc4);
+			 }
+			 Tc7 = FMA(KP820678790, Tc6, Tc3);
+			 Tcx = FNMS(KP098491403, Tcp, Tcq);
+			 Tch = FNMS(KP820678790, Tc3, Tc6);
+			 Tcr = FMA(KP098491403, Tcq, Tcp);
+		    }
+		    {
+			 E TbV, Tcl, TbY, Tcm;
+			 {
+			      E TbT, TbU, TbW, TbX;
+			      TbT = FMA(KP707106781, T8m, T87);
+			      TbU = FMA(KP707106781, T8x, T8u);
+			      TbV = FMA(KP198912367, TbU, TbT);
+			      Tcl = FNMS(KP198912367, TbT, TbU);
+			      TbW = FMA(KP707106781, T8V, T8G);
+			      TbX = FMA(KP707106781, T96, T93);
+			      TbY = FNMS(KP198912367, TbX, TbW);
+			      Tcm = FMA(KP198912367, TbW, TbX);
+			 }
+			 TbZ = TbV - TbY;
+			 TkK = TbV + TbY;
+			 Tcn = Tcl + Tcm;
+			 TkE = Tcm - Tcl;
+		    }
+		    {
+			 E Tbc, TbH, Tbr, TbG;
+			 {
+			      E TaG, Tbb, Tbn, Tbq;
+			      TaG = FNMS(KP707106781, TaF, Taq);
+			      Tbb = TaV - Tba;
+			      Tbc = FNMS(KP923879532, Tbb, TaG);
+			      TbH = FMA(KP923879532, Tbb, TaG);
+			      Tbn = FNMS(KP707106781, Tbm, Tbj);
+			      Tbq = Tbo - Tbp;
+			      Tbr = FNMS(KP923879532, Tbq, Tbn);
+			      TbG = FMA(KP923879532, Tbq, Tbn);
+			 }
+			 Tbs = FNMS(KP534511135, Tbr, Tbc);
+			 TbM = FMA(KP303346683, TbG, TbH);
+			 Tbw = FMA(KP534511135, Tbc, Tbr);
+			 TbI = FNMS(KP303346683, TbH, TbG);
+		    }
+		    {
+			 E T7u, TbO, Tkn, TkB, T7Z, TkC, TbR, Tko, T7t, Tkm;
+			 T7t = T7l - T7s;
+			 T7u = FMA(KP707106781, T7t, T7e);
+			 TbO = FNMS(KP707106781, T7t, T7e);
+			 Tkm = TcC - TcB;
+			 Tkn = FMA(KP707106781, Tkm, Tkl);
+			 TkB = FNMS(KP707106781, Tkm, Tkl);
+			 {
+			      E T7J, T7Y, TbP, TbQ;
+			      T7J = FMA(KP414213562, T7I, T7B);
+			      T7Y = FNMS(KP414213562, T7X, T7Q);
+			      T7Z = T7J - T7Y;
+			      TkC = T7J + T7Y;
+			      TbP = FNMS(KP414213562, T7B, T7I);
+			      TbQ = FMA(KP414213562, T7Q, T7X);
+			      TbR = TbP + TbQ;
+			      Tko = TbQ - TbP;
+			 }
+			 T80 = FNMS(KP923879532, T7Z, T7u);
+			 TkD = FNMS(KP923879532, TkC, TkB);
+			 TkJ = FMA(KP923879532, TkC, TkB);
+			 Tby = FMA(KP923879532, T7Z, T7u);
+			 TbS = FNMS(KP923879532, TbR, TbO);
+			 Tkp = FMA(KP923879532, Tko, Tkn);
+			 Tkv = FNMS(KP923879532, Tko, Tkn);
+			 Tck = FMA(KP923879532, TbR, TbO);
+		    }
+		    {
+			 E T9a, Tbt, Tkx, Tky;
+			 T9a = FMA(KP831469612, T99, T80);
+			 Tbt = Taj - Tbs;
+			 ri[WS(rs, 43)] = FNMS(KP881921264, Tbt, T9a);
+			 ri[WS(rs, 11)] = FMA(KP881921264, Tbt, T9a);
+			 Tkx = FMA(KP831469612, Tkw, Tkv);
+			 Tky = Tbw - Tbv;
+			 ii[WS(rs, 11)] = FMA(KP881921264, Tky, Tkx);
+			 ii[WS(rs, 43)] = FNMS(KP881921264, Tky, Tkx);
+		    }
+		    {
+			 E Tbu, Tbx, Tkz, TkA;
+			 Tbu = FNMS(KP831469612, T99, T80);
+			 Tbx = Tbv + Tbw;
+			 ri[WS(rs, 27)] = FNMS(KP881921264, Tbx, Tbu);
+			 ri[WS(rs, 59)] = FMA(KP881921264, Tbx, Tbu);
+			 Tkz = FNMS(KP831469612, Tkw, Tkv);
+			 TkA = Taj + Tbs;
+			 ii[WS(rs, 27)] = FNMS(KP881921264, TkA, Tkz);
+			 ii[WS(rs, 59)] = FMA(KP881921264, TkA, Tkz);
+		    }
+		    {
+			 E TbC, TbJ, Tkr, Tks;
+			 TbC = FMA(KP831469612, TbB, Tby);
+			 TbJ = TbF + TbI;
+			 ri[WS(rs, 35)] = FNMS(KP956940335, TbJ, TbC);
+			 ri[WS(rs, 3)] = FMA(KP956940335, TbJ, TbC);
+			 Tkr = FMA(KP831469612, Tkq, Tkp);
+			 Tks = TbL + TbM;
+			 ii[WS(rs, 3)] = FMA(KP956940335, Tks, Tkr);
+			 ii[WS(rs, 35)] = FNMS(KP956940335, Tks, Tkr);
+		    }
+		    {
+			 E TbK, TbN, Tkt, Tku;
+			 TbK = FNMS(KP831469612, TbB, Tby);
+			 TbN = TbL - TbM;
+			 ri[WS(rs, 51)] = FNMS(KP956940335, TbN, TbK);
+			 ri[WS(rs, 19)] = FMA(KP956940335, TbN, TbK);
+			 Tkt = FNMS(KP831469612, Tkq, Tkp);
+			 Tku = TbI - TbF;
+			 ii[WS(rs, 19)] = FMA(KP956940335, Tku, Tkt);
+			 ii[WS(rs, 51)] = FNMS(KP956940335, Tku, Tkt);
+		    }
+		    {
+			 E Tc0, Tcf, TkF, TkG;
+			 Tc0 = FMA(KP980785280, TbZ, TbS);
+			 Tcf = Tc7 + Tce;
+			 ri[WS(rs, 39)] = FNMS(KP773010453, Tcf, Tc0);
+			 ri[WS(rs, 7)] = FMA(KP773010453, Tcf, Tc0);
+			 TkF = FMA(KP980785280, TkE, TkD);
+			 TkG = Tch + Tci;
+			 ii[WS(rs, 7)] = FMA(KP773010453, TkG, TkF);
+			 ii[WS(rs, 39)] = FNMS(KP773010453, TkG, TkF);
+		    }
+		    {
+			 E Tcg, Tcj, TkH, TkI;
+			 Tcg = FNMS(KP980785280, TbZ, TbS);
+			 Tcj = Tch - Tci;
+			 ri[WS(rs, 55)] = FNMS(KP773010453, Tcj, Tcg);
+			 ri[WS(rs, 23)] = FMA(KP773010453, Tcj, Tcg);
+			 TkH = FNMS(KP980785280, TkE, TkD);
+			 TkI = Tce - Tc7;
+			 ii[WS(rs, 23)] = FMA(KP773010453, TkI, TkH);
+			 ii[WS(rs, 55)] = FNMS(KP773010453, TkI, TkH);
+		    }
+		    {
+			 E Tco, Tcv, TkL, TkM;
+			 Tco = FNMS(KP980785280, Tcn, Tck);
+			 Tcv = Tcr - Tcu;
+			 ri[WS(rs, 47)] = FNMS(KP995184726, Tcv, Tco);
+			 ri[WS(rs, 15)] = FMA(KP995184726, Tcv, Tco);
+			 TkL = FNMS(KP980785280, TkK, TkJ);
+			 TkM = Tcy - Tcx;
+			 ii[WS(rs, 15)] = FMA(KP995184726, TkM, TkL);
+			 ii[WS(rs, 47)] = FNMS(KP995184726, TkM, TkL);
+		    }
+		    {
+			 E Tcw, Tcz, TkN, TkO;
+			 Tcw = FMA(KP980785280, Tcn, Tck);
+			 Tcz = Tcx + Tcy;
+			 ri[WS(rs, 31)] = FNMS(KP995184726, Tcz, Tcw);
+			 ri[WS(rs, 63)] = FMA(KP995184726, Tcz, Tcw);
+			 TkN = FMA(KP980785280, TkK, TkJ);
+			 TkO = Tcr + Tcu;
+			 ii[WS(rs, 31)] = FNMS(KP995184726, TkO, TkN);
+			 ii[WS(rs, 63)] = FMA(KP995184726, TkO, TkN);
+		    }
+	       }
+	       {
+		    E Td1, Tk2, TdN, TjW, Tdl, TdX, TdH, TdR, Teq, TeK, Teu, TeG, Tej, TeJ, Tet;
+		    E TeD, Teb, Tkg, Tez, Tka, TdE, TdY, TdI, TdU, TcM, Tk9, Tkf, TdK, Te4, TjV;
+		    E Tk1, Tew;
+		    {
+			 E TcT, TdL, Td0, TdM;
+			 {
+			      E TcP, TcS, TcW, TcZ;
+			      TcP = FMA(KP707106781, TcO, TcN);
+			      TcS = FMA(KP707106781, TcR, TcQ);
+			      TcT = FNMS(KP198912367, TcS, TcP);
+			      TdL = FMA(KP198912367, TcP, TcS);
+			      TcW = FMA(KP707106781, TcV, TcU);
+			      TcZ = FMA(KP707106781, TcY, TcX);
+			      Td0 = FMA(KP198912367, TcZ, TcW);
+			      TdM = FNMS(KP198912367, TcW, TcZ);
+			 }
+			 Td1 = TcT - Td0;
+			 Tk2 = TdM - TdL;
+			 TdN = TdL + TdM;
+			 TjW = TcT + Td0;
+		    }
+		    {
+			 E Tdd, TdQ, Tdk, TdP;
+			 {
+			      E Td5, Tdc, Tdg, Tdj;
+			      Td5 = FMA(KP707106781, Td4, Td3);
+			      Tdc = Td8 + Tdb;
+			      Tdd = FNMS(KP923879532, Tdc, Td5);
+			      TdQ = FMA(KP923879532, Tdc, Td5);
+			      Tdg = FMA(KP707106781, Tdf, Tde);
+			      Tdj = Tdh + Tdi;
+			      Tdk = FNMS(KP923879532, Tdj, Tdg);
+			      TdP = FMA(KP923879532, Tdj, Tdg);
+			 }
+			 Tdl = FMA(KP820678790, Tdk, Tdd);
+			 TdX = FNMS(KP098491403, TdP, TdQ);
+			 TdH = FNMS(KP820678790, Tdd, Tdk);
+			 TdR = FMA(KP098491403, TdQ, TdP);
+		    }
+		    {
+			 E Tem, TeF, Tep, TeE;
+			 {
+			      E Tek, Tel, Ten, Teo;
+			      Tek = FNMS(KP707106781, Tdy, Tdx);
+			      Tel = Tdu - Tdr;
+			      Tem = FNMS(KP923879532, Tel, Tek);
+			      TeF = FMA(KP923879532, Tel, Tek);
+			      Ten = FNMS(KP707106781, Tdn, Tdm);
+			      Teo = TdA - TdB;
+			      Tep = FNMS(KP923879532, Teo, Ten);
+			      TeE = FMA(KP923879532, Teo, Ten);
+			 }
+			 Teq = FNMS(KP534511135, Tep, Tem);
+			 TeK = FMA(KP303346683, TeE, TeF);
+			 Teu = FMA(KP534511135, Tem, Tep);
+			 TeG = FNMS(KP303346683, TeF, TeE);
+		    }
+		    {
+			 E Tef, TeC, Tei, TeB;
+			 {
+			      E Ted, Tee, Teg, Teh;
+			      Ted = FNMS(KP707106781, Tdf, Tde);
+			      Tee = Tdb - Td8;
+			      Tef = FNMS(KP923879532, Tee, Ted);
+			      TeC = FMA(KP923879532, Tee, Ted);
+			      Teg = FNMS(KP707106781, Td4, Td3);
+			      Teh = Tdh - Tdi;
+			      Tei = FNMS(KP923879532, Teh, Teg);
+			      TeB = FMA(KP923879532, Teh, Teg);
+			 }
+			 Tej = FMA(KP534511135, Tei, Tef);
+			 TeJ = FNMS(KP303346683, TeB, TeC);
+			 Tet = FNMS(KP534511135, Tef, Tei);
+			 TeD = FMA(KP303346683, TeC, TeB);
+		    }
+		    {
+			 E Te7, Tex, Tea, Tey;
+			 {
+			      E Te5, Te6, Te8, Te9;
+			      Te5 = FNMS(KP707106781, TcO, TcN);
+			      Te6 = FNMS(KP707106781, TcR, TcQ);
+			      Te7 = FMA(KP668178637, Te6, Te5);
+			      Tex = FNMS(KP668178637, Te5, Te6);
+			      Te8 = FNMS(KP707106781, TcV, TcU);
+			      Te9 = FNMS(KP707106781, TcY, TcX);
+			      Tea = FNMS(KP668178637, Te9, Te8);
+			      Tey = FMA(KP668178637, Te8, Te9);
+			 }
+			 Teb = Te7 - Tea;
+			 Tkg = Te7 + Tea;
+			 Tez = Tex + Tey;
+			 Tka = Tey - Tex;
+		    }
+		    {
+			 E Tdw, TdT, TdD, TdS;
+			 {
+			      E Tdo, Tdv, Tdz, TdC;
+			      Tdo = FMA(KP707106781, Tdn, Tdm);
+			      Tdv = Tdr + Tdu;
+			      Tdw = FNMS(KP923879532, Tdv, Tdo);
+			      TdT = FMA(KP923879532, Tdv, Tdo);
+			      Tdz = FMA(KP707106781, Tdy, Tdx);
+			      TdC = TdA + TdB;
+			      TdD = FNMS(KP923879532, TdC, Tdz);
+			      TdS = FMA(KP923879532, TdC, Tdz);
+			 }
+			 TdE = FNMS(KP820678790, TdD, Tdw);
+			 TdY = FMA(KP098491403, TdS, TdT);
+			 TdI = FMA(KP820678790, Tdw, TdD);
+			 TdU = FNMS(KP098491403, TdT, TdS);
+		    }
+		    {
+			 E TcE, Te0, TjT, Tk7, TcL, Tk8, Te3, TjU, TcD, TjS;
+			 TcD = TcB + TcC;
+			 TcE = FMA(KP707106781, TcD, TcA);
+			 Te0 = FNMS(KP707106781, TcD, TcA);
+			 TjS = T7l + T7s;
+			 TjT = FMA(KP707106781, TjS, TjR);
+			 Tk7 = FNMS(KP707106781, TjS, TjR);
+			 {
+			      E TcH, TcK, Te1, Te2;
+			      TcH = FMA(KP414213562, TcG, TcF);
+			      TcK = FNMS(KP414213562, TcJ, TcI);
+			      TcL = TcH + TcK;
+			      Tk8 = TcK - TcH;
+			      Te1 = FNMS(KP414213562, TcF, TcG);
+			      Te2 = FMA(KP414213562, TcI, TcJ);
+			      Te3 = Te1 - Te2;
+			      TjU = Te1 + Te2;
+			 }
+			 TcM = FNMS(KP923879532, TcL, TcE);
+			 Tk9 = FMA(KP923879532, Tk8, Tk7);
+			 Tkf = FNMS(KP923879532, Tk8, Tk7);
+			 TdK = FMA(KP923879532, TcL, TcE);
+			 Te4 = FMA(KP923879532, Te3, Te0);
+			 TjV = FMA(KP923879532, TjU, TjT);
+			 Tk1 = FNMS(KP923879532, TjU, TjT);
+			 Tew = FNMS(KP923879532, Te3, Te0);
+		    }
+		    {
+			 E Td2, TdF, Tk3, Tk4;
+			 Td2 = FMA(KP980785280, Td1, TcM);
+			 TdF = Tdl - TdE;
+			 ri[WS(rs, 41)] = FNMS(KP773010453, TdF, Td2);
+			 ri[WS(rs, 9)] = FMA(KP773010453, TdF, Td2);
+			 Tk3 = FMA(KP980785280, Tk2, Tk1);
+			 Tk4 = TdI - TdH;
+			 ii[WS(rs, 9)] = FMA(KP773010453, Tk4, Tk3);
+			 ii[WS(rs, 41)] = FNMS(KP773010453, Tk4, Tk3);
+		    }
+		    {
+			 E TdG, TdJ, Tk5, Tk6;
+			 TdG = FNMS(KP980785280, Td1, TcM);
+			 TdJ = TdH + TdI;
+			 ri[WS(rs, 25)] = FNMS(KP773010453, TdJ, TdG);
+			 ri[WS(rs, 57)] = FMA(KP773010453, TdJ, TdG);
+			 Tk5 = FNMS(KP980785280, Tk2, Tk1);
+			 Tk6 = Tdl + TdE;
+			 ii[WS(rs, 25)] = FNMS(KP773010453, Tk6, Tk5);
+			 ii[WS(rs, 57)] = FMA(KP773010453, Tk6, Tk5);
+		    }
+		    {
+			 E TdO, TdV, TjX, TjY;
+			 TdO = FMA(KP980785280, TdN, TdK);
+			 TdV = TdR + TdU;
+			 ri[WS(rs, 33)] = FNMS(KP995184726, TdV, TdO);
+			 ri[WS(rs, 1)] = FMA(KP995184726, TdV, TdO);
+			 TjX = FMA(KP980785280, TjW, TjV);
+			 TjY = TdX + TdY;
+			 ii[WS(rs, 1)] = FMA(KP995184726, TjY, TjX);
+			 ii[WS(rs, 33)] = FNMS(KP995184726, TjY, TjX);
+		    }
+		    {
+			 E TdW, TdZ, TjZ, Tk0;
+			 TdW = FNMS(KP980785280, TdN, TdK);
+			 TdZ = TdX - TdY;
+			 ri[WS(rs, 49)] = FNMS(KP995184726, TdZ, TdW);
+			 ri[WS(rs, 17)] = FMA(KP995184726, TdZ, TdW);
+			 TjZ = FNMS(KP980785280, TjW, TjV);
+			 Tk0 = TdU - TdR;
+			 ii[WS(rs, 17)] = FMA(KP995184726, Tk0, TjZ);
+			 ii[WS(rs, 49)] = FNMS(KP995184726, Tk0, TjZ);
+		    }
+		    {
+			 E Tec, Ter, Tkb, Tkc;
+			 Tec = FMA(KP831469612, Teb, Te4);
+			 Ter = Tej + Teq;
+			 ri[WS(rs, 37)] = FNMS(KP881921264, Ter, Tec);
+			 ri[WS(rs, 5)] = FMA(KP881921264, Ter, Tec);
+			 Tkb = FMA(KP831469612, Tka, Tk9);
+			 Tkc = Tet + Teu;
+			 ii[WS(rs, 5)] = FMA(KP881921264, Tkc, Tkb);
+			 ii[WS(rs, 37)] = FNMS(KP881921264, Tkc, Tkb);
+		    }
+		    {
+			 E Tes, Tev, Tkd, Tke;
+			 Tes = FNMS(KP831469612, Teb, Te4);
+			 Tev = Tet - Teu;
+			 ri[WS(rs, 53)] = FNMS(KP881921264, Tev, Tes);
+			 ri[WS(rs, 21)] = FMA(KP881921264, Tev, Tes);
+			 Tkd = FNMS(KP831469612, Tka, Tk9);
+			 Tke = Teq - Tej;
+			 ii[WS(rs, 21)] = FMA(KP881921264, Tke, Tkd);
+			 ii[WS(rs, 53)] = FNMS(KP881921264, Tke, Tkd);
+		    }
+		    {
+			 E TeA, TeH, Tkh, Tki;
+			 TeA = FNMS(KP831469612, Tez, Tew);
+			 TeH = TeD - TeG;
+			 ri[WS(rs, 45)] = FNMS(KP956940335, TeH, TeA);
+			 ri[WS(rs, 13)] = FMA(KP956940335, TeH, TeA);
+			 Tkh = FNMS(KP831469612, Tkg, Tkf);
+			 Tki = TeK - TeJ;
+			 ii[WS(rs, 13)] = FMA(KP956940335, Tki, Tkh);
+			 ii[WS(rs, 45)] = FNMS(KP956940335, Tki, Tkh);
+		    }
+		    {
+			 E TeI, TeL, Tkj, Tkk;
+			 TeI = FMA(KP831469612, Tez, Tew);
+			 TeL = TeJ + TeK;
+			 ri[WS(rs, 29)] = FNMS(KP956940335, TeL, TeI);
+			 ri[WS(rs, 61)] = FMA(KP956940335, TeL, TeI);
+			 Tkj = FMA(KP831469612, Tkg, Tkf);
+			 Tkk = TeD + TeG;
+			 ii[WS(rs, 29)] = FNMS(KP956940335, Tkk, Tkj);
+			 ii[WS(rs, 61)] = FMA(KP956940335, Tkk, Tkj);
+		    }
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_FULL, 0, 64 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 64, "t1_64", twinstr, &GENUS, { 520, 126, 518, 0 }, 0, 0, 0 };
+
+void X(codelet_t1_64) (planner *p) {
+     X(kdft_dit_register) (p, t1_64, &desc);
+}
+#else
+
+/* Generated by: ../../../genfft/gen_twiddle.native -compact -variables 4 -pipeline-latency 4 -n 64 -name t1_64 -include dft/scalar/t.h */
+
+/*
+ * This function contains 1038 FP additions, 500 FP multiplications,
+ * (or, 808 additions, 270 multiplications, 230 fused multiply/add),
+ * 176 stack variables, 15 constants, and 256 memory accesses
+ */
+#include "dft/scalar/t.h"
+
+static void t1_64(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 126); m < me; m = m + 1, ri = ri + ms, ii = ii + ms, W = W + 126, MAKE_VOLATILE_STRIDE(128, rs)) {
+	       E Tj, TcL, ThT, Tin, T6b, Taz, TgT, Thn, TG, Thm, TcO, TgO, T6m, ThQ, TaC;
+	       E Tim, T14, Tfq, T6y, T9O, TaG, Tc0, TcU, TeE, T1r, Tfr, T6J, T9P, TaJ, Tc1;
+	       E TcZ, TeF, T1Q, T2d, Tfx, Tfu, Tfv, Tfw, T6Q, TaM, Tdb, TeJ, T71, TaQ, T7a;
+	       E TaN, Td6, TeI, T77, TaP, T2B, T2Y, Tfz, TfA, TfB, TfC, T7h, TaW, Tdm, TeM;
+	       E T7s, TaU, T7B, TaX, Tdh, TeL, T7y, TaT, T5j, TfR, Tec, Tf0, TfY, Tgy, T8D;
+	       E Tbl, T8O, Tbx, T9l, Tbm, TdV, TeX, T9i, Tbw, T3M, TfL, TdL, TeQ, TfI, Tgt;
+	       E T7K, Tb2, T7V, Tbe, T8s, Tb3, Tdu, TeT, T8p, Tbd, T4x, TfJ, TdE, TdM, TfO;
+	       E Tgu, T87, T8v, T8i, T8u, Tba, Tbg, Tdz, TdN, Tb7, Tbh, T64, TfZ, Te5, Ted;
+	       E TfU, Tgz, T90, T9o, T9b, T9n, Tbt, Tbz, Te0, Tee, Tbq, TbA;
+	       {
+		    E T1, TgR, T6, TgQ, Tc, T68, Th, T69;
+		    T1 = ri[0];
+		    TgR = ii[0];
+		    {
+			 E T3, T5, T2, T4;
+			 T3 = ri[WS(rs, 32)];
+			 T5 = ii[WS(rs, 32)];
+			 T2 = W[62];
+			 T4 = W[63];
+			 T6 = FMA(T2, T3, T4 * T5);
+			 TgQ = FNMS(T4, T3, T2 * T5);
+		    }
+		    {
+			 E T9, Tb, T8, Ta;
+			 T9 = ri[WS(rs, 16)];
+			 Tb = ii[WS(rs, 16)];
+			 T8 = W[30];
+			 Ta = W[31];
+			 Tc = FMA(T8, T9, Ta * Tb);
+			 T68 = FNMS(Ta, T9, T8 * Tb);
+		    }
+		    {
+			 E Te, Tg, Td, Tf;
+			 Te = ri[WS(rs, 48)];
+			 Tg = ii[WS(rs, 48)];
+			 Td = W[94];
+			 Tf = W[95];
+			 Th = FMA(Td, Te, Tf * Tg);
+			 T69 = FNMS(Tf, Te, Td * Tg);
+		    }
+		    {
+			 E T7, Ti, ThR, ThS;
+			 T7 = T1 + T6;
+			 Ti = Tc + Th;
+			 Tj = T7 + Ti;
+			 TcL = T7 - Ti;
+			 ThR = TgR - TgQ;
+			 ThS = Tc - Th;
+			 ThT = ThR - ThS;
+			 Tin = ThS + ThR;
+		    }
+		    {
+			 E T67, T6a, TgP, TgS;
+			 T67 = T1 - T6;
+			 T6a = T68 - T69;
+			 T6b = T67 - T6a;
+			 Taz = T67 + T6a;
+			 TgP = T68 + T69;
+			 TgS = TgQ + TgR;
+			 TgT = TgP + TgS;
+			 Thn = TgS - TgP;
+		    }
+	       }
+	       {
+		    E To, T6c, Tt, T6d, T6e, T6f, Tz, T6i, TE, T6j, T6h, T6k;
+		    {
+			 E Tl, Tn, Tk, Tm;
+			 Tl = ri[WS(rs, 8)];
+			 Tn = ii[WS(rs, 8)];
+			 Tk = W[14];
+			 Tm = W[15];
+			 To = FMA(Tk, Tl, Tm * Tn);
+			 T6c = FNMS(Tm, Tl, Tk * Tn);
+		    }
+		    {
+			 E Tq, Ts, Tp, Tr;
+			 Tq = ri[WS(rs, 40)];
+			 Ts = ii[WS(rs, 40)];
+			 Tp = W[78];
+			 Tr = W[79];
+			 Tt = FMA(Tp, Tq, Tr * Ts);
+			 T6d = FNMS(Tr, Tq, Tp * Ts);
+		    }
+		    T6e = T6c - T6d;
+		    T6f = To - Tt;
+		    {
+			 E Tw, Ty, Tv, Tx;
+			 Tw = ri[WS(rs, 56)];
+			 Ty = ii[WS(rs, 56)];
+			 Tv = W[110];
+			 Tx = W[111];
+			 Tz = FMA(Tv, Tw, Tx * Ty);
+			 T6i = FNMS(Tx, Tw, Tv * Ty);
+		    }
+		    {
+			 E TB, TD, TA, TC;
+			 TB = ri[WS(rs, 24)];
+			 TD = ii[WS(rs, 24)];
+			 TA = W[46];
+			 TC = W[47];
+			 TE = FMA(TA, TB, TC * TD);
+			 T6j = FNMS(TC, TB, TA * TD);
+		    }
+		    T6h = Tz - TE;
+		    T6k = T6i - T6j;
+		    {
+			 E Tu, TF, TcM, TcN;
+			 Tu = To + Tt;
+			 TF = Tz + TE;
+			 TG = Tu + TF;
+			 Thm = TF - Tu;
+			 TcM = T6c + T6d;
+			 TcN = T6i + T6j;
+			 TcO = TcM - TcN;
+			 TgO = TcM + TcN;
+		    }
+		    {
+			 E T6g, T6l, TaA, TaB;
+			 T6g = T6e - T6f;
+			 T6l = T6h + T6k;
+			 T6m = KP707106781 * (T6g - T6l);
+			 ThQ = KP707106781 * (T6g + T6l);
+			 TaA = T6f + T6e;
+			 TaB = T6h - T6k;
+			 TaC = KP707106781 * (TaA + TaB);
+			 Tim = KP707106781 * (TaB - TaA);
+		    }
+	       }
+	       {
+		    E TS, TcQ, T6q, T6t, T13, TcR, T6r, T6w, T6s, T6x;
+		    {
+			 E TM, T6o, TR, T6p;
+			 {
+			      E TJ, TL, TI, TK;
+			      TJ = ri[WS(rs, 4)];
+			      TL = ii[WS(rs, 4)];
+			      TI = W[6];
+			      TK = W[7];
+			      TM = FMA(TI, TJ, TK * TL);
+			      T6o = FNMS(TK, TJ, TI * TL);
+			 }
+			 {
+			      E TO, TQ, TN, TP;
+			      TO = ri[WS(rs, 36)];
+			      TQ = ii[WS(rs, 36)];
+			      TN = W[70];
+			      TP = W[71];
+			      TR = FMA(TN, TO, TP * TQ);
+			      T6p = FNMS(TP, TO, TN * TQ);
+			 }
+			 TS = TM + TR;
+			 TcQ = T6o + T6p;
+			 T6q = T6o - T6p;
+			 T6t = TM - TR;
+		    }
+		    {
+			 E TX, T6u, T12, T6v;
+			 {
+			      E TU, TW, TT, TV;
+			      TU = ri[WS(rs, 20)];
+			      TW = ii[WS(rs, 20)];
+			      TT = W[38];
+			      TV = W[39];
+			      TX = FMA(TT, TU, TV * TW);
+			      T6u = FNMS(TV, TU, TT * TW);
+			 }
+			 {
+			      E TZ, T11, TY, T10;
+			      TZ = ri[WS(rs, 52)];
+			      T11 = ii[WS(rs, 52)];
+			      TY = W[102];
+			      T10 = W[103];
+			      T12 = FMA(TY, TZ, T10 * T11);
+			      T6v = FNMS(T10, TZ, TY * T11);
+			 }
+			 T13 = TX + T12;
+			 TcR = T6u + T6v;
+			 T6r = TX - T12;
+			 T6w = T6u - T6v;
+		    }
+		    T14 = TS + T13;
+		    Tfq = TcQ + TcR;
+		    T6s = T6q + T6r;
+		    T6x = T6t - T6w;
+		    T6y = FNMS(KP923879532, T6x, KP382683432 * T6s);
+		    T9O = FMA(KP923879532, T6s, KP382683432 * T6x);
+		    {
+			 E TaE, TaF, TcS, TcT;
+			 TaE = T6q - T6r;
+			 TaF = T6t + T6w;
+			 TaG = FNMS(KP382683432, TaF, KP923879532 * TaE);
+			 Tc0 = FMA(KP382683432, TaE, KP923879532 * TaF);
+			 TcS = TcQ - TcR;
+			 TcT = TS - T13;
+			 TcU = TcS - TcT;
+			 TeE = TcT + TcS;
+		    }
+	       }
+	       {
+		    E T1f, TcW, T6B, T6E, T1q, TcX, T6C, T6H, T6D, T6I;
+		    {
+			 E T19, T6z, T1e, T6A;
+			 {
+			      E T16, T18, T15, T17;
+			      T16 = ri[WS(rs, 60)];
+			      T18 = ii[WS(rs, 60)];
+			      T15 = W[118];
+			      T17 = W[119];
+			      T19 = FMA(T15, T16, T17 * T18);
+			      T6z = FNMS(T17, T16, T15 * T18);
+			 }
+			 {
+			      E T1b, T1d, T1a, T1c;
+			      T1b = ri[WS(rs, 28)];
+			      T1d = ii[WS(rs, 28)];
+			      T1a = W[54];
+			      T1c = W[55];
+			      T1e = FMA(T1a, T1b, T1c * T1d);
+			      T6A = FNMS(T1c, T1b, T1a * T1d);
+			 }
+			 T1f = T19 + T1e;
+			 TcW = T6z + T6A;
+			 T6B = T6z - T6A;
+			 T6E = T19 - T1e;
+		    }
+		    {
+			 E T1k, T6F, T1p, T6G;
+			 {
+			      E T1h, T1j, T1g, T1i;
+			      T1h = ri[WS(rs, 12)];
+			      T1j = ii[WS(rs, 12)];
+			      T1g = W[22];
+			      T1i = W[23];
+			      T1k = FMA(T1g, T1h, T1i * T1j);
+			      T6F = FNMS(T1i, T1h, T1g * T1j);
+			 }
+			 {
+			      E T1m, T1o, T1l, T1n;
+			      T1m = ri[WS(rs, 44)];
+			      T1o = ii[WS(rs, 44)];
+			      T1l = W[86];
+			      T1n = W[87];
+			      T1p = FMA(T1l, T1m, T1n * T1o);
+			      T6G = FNMS(T1n, T1m, T1l * T1o);
+			 }
+			 T1q = T1k + T1p;
+			 TcX = T6F + T6G;
+			 T6C = T1k - T1p;
+			 T6H = T6F - T6G;
+		    }
+		    T1r = T1f + T1q;
+		    Tfr = TcW + TcX;
+		    T6D = T6B + T6C;
+		    T6I = T6E - T6H;
+		    T6J = FMA(KP382683432, T6D, KP923879532 * T6I);
+		    T9P = FNMS(KP923879532, T6D, KP382683432 * T6I);
+		    {
+			 E TaH, TaI, TcV, TcY;
+			 TaH = T6B - T6C;
+			 TaI = T6E + T6H;
+			 TaJ = FMA(KP923879532, TaH, KP382683432 * TaI);
+			 Tc1 = FNMS(KP382683432, TaH, KP923879532 * TaI);
+			 TcV = T1f - T1q;
+			 TcY = TcW - TcX;
+			 TcZ = TcV + TcY;
+			 TeF = TcV - TcY;
+		    }
+	       }
+	       {
+		    E T1y, T6M, T1D, T6N, T1E, Td2, T1J, T74, T1O, T75, T1P, Td3, T21, Td8, T6W;
+		    E T6Z, T2c, Td9, T6R, T6U;
+		    {
+			 E T1v, T1x, T1u, T1w;
+			 T1v = ri[WS(rs, 2)];
+			 T1x = ii[WS(rs, 2)];
+			 T1u = W[2];
+			 T1w = W[3];
+			 T1y = FMA(T1u, T1v, T1w * T1x);
+			 T6M = FNMS(T1w, T1v, T1u * T1x);
+		    }
+		    {
+			 E T1A, T1C, T1z, T1B;
+			 T1A = ri[WS(rs, 34)];
+			 T1C = ii[WS(rs, 34)];
+			 T1z = W[66];
+			 T1B = W[67];
+			 T1D = FMA(T1z, T1A, T1B * T1C);
+			 T6N = FNMS(T1B, T1A, T1z * T1C);
+		    }
+		    T1E = T1y + T1D;
+		    Td2 = T6M + T6N;
+		    {
+			 E T1G, T1I, T1F, T1H;
+			 T1G = ri[WS(rs, 18)];
+			 T1I = ii[WS(rs, 18)];
+			 T1F = W[34];
+			 T1H = W[35];
+			 T1J = FMA(T1F, T1G, T1H * T1I);
+			 T74 = FNMS(T1H, T1G, T1F * T1I);
+		    }
+		    {
+			 E T1L, T1N, T1K, T1M;
+			 T1L = ri[WS(rs, 50)];
+			 T1N = ii[WS(rs, 50)];
+			 T1K = W[98];
+			 T1M = W[99];
+			 T1O = FMA(T1K, T1L, T1M * T1N);
+			 T75 = FNMS(T1M, T1L, T1K * T1N);
+		    }
+		    T1P = T1J + T1O;
+		    Td3 = T74 + T75;
+		    {
+			 E T1V, T6X, T20, T6Y;
+			 {
+			      E T1S, T1U, T1R, T1T;
+			      T1S = ri[WS(rs, 10)];
+			      T1U = ii[WS(rs, 10)];
+			      T1R = W[18];
+			      T1T = W[19];
+			      T1V = FMA(T1R, T1S, T1T * T1U);
+			      T6X = FNMS(T1T, T1S, T1R * T1U);
+			 }
+			 {
+			      E T1X, T1Z, T1W, T1Y;
+			      T1X = ri[WS(rs, 42)];
+			      T1Z = ii[WS(rs, 42)];
+			      T1W = W[82];
+			      T1Y = W[83];
+			      T20 = FMA(T1W, T1X, T1Y * T1Z);
+			      T6Y = FNMS(T1Y, T1X, T1W * T1Z);
+			 }
+			 T21 = T1V + T20;
+			 Td8 = T6X + T6Y;
+			 T6W = T1V - T20;
+			 T6Z = T6X - T6Y;
+		    }
+		    {
+			 E T26, T6S, T2b, T6T;
+			 {
+			      E T23, T25, T22, T24;
+			      T23 = ri[WS(rs, 58)];
+			      T25 = ii[WS(rs, 58)];
+			      T22 = W[114];
+			      T24 = W[115];
+			      T26 = FMA(T22, T23, T24 * T25);
+			      T6S = FNMS(T24, T23, T22 * T25);
+			 }
+			 {
+			      E T28, T2a, T27, T29;
+			      T28 = ri[WS(rs, 26)];
+			      T2a = ii[WS(rs, 26)];
+			      T27 = W[50];
+			      T29 = W[51];
+			      T2b = FMA(T27, T28, T29 * T2a);
+			      T6T = FNMS(T29, T28, T27 * T2a);
+			 }
+			 T2c = T26 + T2b;
+			 Td9 = T6S + T6T;
+			 T6R = T26 - T2b;
+			 T6U = T6S - T6T;
+		    }
+		    T1Q = T1E + T1P;
+		    T2d = T21 + T2c;
+		    Tfx = T1Q - T2d;
+		    Tfu = Td2 + Td3;
+		    Tfv = Td8 + Td9;
+		    Tfw = Tfu - Tfv;
+		    {
+			 E T6O, T6P, Td7, Tda;
+			 T6O = T6M - T6N;
+			 T6P = T1J - T1O;
+			 T6Q = T6O + T6P;
+			 TaM = T6O - T6P;
+			 Td7 = T1E - T1P;
+			 Tda = Td8 - Td9;
+			 Tdb = Td7 - Tda;
+			 TeJ = Td7 + Tda;
+		    }
+		    {
+			 E T6V, T70, T78, T79;
+			 T6V = T6R - T6U;
+			 T70 = T6W + T6Z;
+			 T71 = KP707106781 * (T6V - T70);
+			 TaQ = KP707106781 * (T70 + T6V);
+			 T78 = T6Z - T6W;
+			 T79 = T6R + T6U;
+			 T7a = KP707106781 * (T78 - T79);
+			 TaN = KP707106781 * (T78 + T79);
+		    }
+		    {
+			 E Td4, Td5, T73, T76;
+			 Td4 = Td2 - Td3;
+			 Td5 = T2c - T21;
+			 Td6 = Td4 - Td5;
+			 TeI = Td4 + Td5;
+			 T73 = T1y - T1D;
+			 T76 = T74 - T75;
+			 T77 = T73 - T76;
+			 TaP = T73 + T76;
+		    }
+	       }
+	       {
+		    E T2j, T7d, T2o, T7e, T2p, Tdd, T2u, T7v, T2z, T7w, T2A, Tde, T2M, Tdj, T7n;
+		    E T7q, T2X, Tdk, T7i, T7l;
+		    {
+			 E T2g, T2i, T2f, T2h;
+			 T2g = ri[WS(rs, 62)];
+			 T2i = ii[WS(rs, 62)];
+			 T2f = W[122];
+			 T2h = W[123];
+			 T2j = FMA(T2f, T2g, T2h * T2i);
+			 T7d = FNMS(T2h, T2g, T2f * T2i);
+		    }
+		    {
+			 E T2l, T2n, T2k, T2m;
+			 T2l = ri[WS(rs, 30)];
+			 T2n = ii[WS(rs, 30)];
+			 T2k = W[58];
+			 T2m = W[59];
+			 T2o = FMA(T2k, T2l, T2m * T2n);
+			 T7e = FNMS(T2m, T2l, T2k * T2n);
+		    }
+		    T2p = T2j + T2o;
+		    Tdd = T7d + T7e;
+		    {
+			 E T2r, T2t, T2q, T2s;
+			 T2r = ri[WS(rs, 14)];
+			 T2t = ii[WS(rs, 14)];
+			 T2q = W[26];
+			 T2s = W[27];
+			 T2u = FMA(T2q, T2r, T2s * T2t);
+			 T7v = FNMS(T2s, T2r, T2q * T2t);
+		    }
+		    {
+			 E T2w, T2y, T2v, T2x;
+			 T2w = ri[WS(rs, 46)];
+			 T2y = ii[WS(rs, 46)];
+			 T2v = W[90];
+			 T2x = W[91];
+			 T2z = FMA(T2v, T2w, T2x * T2y);
+			 T7w = FNMS(T2x, T2w, T2v * T2y);
+		    }
+		    T2A = T2u + T2z;
+		    Tde = T7v + T7w;
+		    {
+			 E T2G, T7o, T2L, T7p;
+			 {
+			      E T2D, T2F, T2C, T2E;
+			      T2D = ri[WS(rs, 6)];
+			      T2F = ii[WS(rs, 6)];
+			      T2C = W[10];
+			      T2E = W[11];
+			      T2G = FMA(T2C, T2D, T2E * T2F);
+			      T7o = FNMS(T2E, T2D, T2C * T2F);
+			 }
+			 {
+			      E T2I, T2K, T2H, T2J;
+			      T2I = ri[WS(rs, 38)];
+			      T2K = ii[WS(rs, 38)];
+			      T2H = W[74];
+			      T2J = W[75];
+			      T2L = FMA(T2H, T2I, T2J * T2K);
+			      T7p = FNMS(T2J, T2I, T2H * T2K);
+			 }
+			 T2M = T2G + T2L;
+			 Tdj = T7o + T7p;
+			 T7n = T2G - T2L;
+			 T7q = T7o - T7p;
+		    }
+		    {
+			 E T2R, T7j, T2W, T7k;
+			 {
+			      E T2O, T2Q, T2N, T2P;
+			      T2O = ri[WS(rs, 54)];
+			      T2Q = ii[WS(rs, 54)];
+			      T2N = W[106];
+			      T2P = W[107];
+			      T2R = FMA(T2N, T2O, T2P * T2Q);
+			      T7j = FNMS(T2P, T2O, T2N * T2Q);
+			 }
+			 {
+			      E T2T, T2V, T2S, T2U;
+			      T2T = ri[WS(rs, 22)];
+			      T2V = ii[WS(rs, 22)];
+			      T2S = W[42];
+			      T2U = W[43];
+			      T2W = FMA(T2S, T2T, T2U * T2V);
+			      T7k = FNMS(T2U, T2T, T2S * T2V);
+			 }
+			 T2X = T2R + T2W;
+			 Tdk = T7j + T7k;
+			 T7i = T2R - T2W;
+			 T7l = T7j - T7k;
+		    }
+		    T2B = T2p + T2A;
+		    T2Y = T2M + T2X;
+		    Tfz = T2B - T2Y;
+		    TfA = Tdd + Tde;
+		    TfB = Tdj + Tdk;
+		    TfC = TfA - TfB;
+		    {
+			 E T7f, T7g, Tdi, Tdl;
+			 T7f = T7d - T7e;
+			 T7g = T2u - T2z;
+			 T7h = T7f + T7g;
+			 TaW = T7f - T7g;
+			 Tdi = T2p - T2A;
+			 Tdl = Tdj - Tdk;
+			 Tdm = Tdi - Tdl;
+			 TeM = Tdi + Tdl;
+		    }
+		    {
+			 E T7m, T7r, T7z, T7A;
+			 T7m = T7i - T7l;
+			 T7r = T7n + T7q;
+			 T7s = KP707106781 * (T7m - T7r);
+			 TaU = KP707106781 * (T7r + T7m);
+			 T7z = T7q - T7n;
+			 T7A = T7i + T7l;
+			 T7B = KP707106781 * (T7z - T7A);
+			 TaX = KP707106781 * (T7z + T7A);
+		    }
+		    {
+			 E Tdf, Tdg, T7u, T7x;
+			 Tdf = Tdd - Tde;
+			 Tdg = T2X - T2M;
+			 Tdh = Tdf - Tdg;
+			 TeL = Tdf + Tdg;
+			 T7u = T2j - T2o;
+			 T7x = T7v - T7w;
+			 T7y = T7u - T7x;
+			 TaT = T7u + T7x;
+		    }
+	       }
+	       {
+		    E T4D, T9e, T4I, T9f, T4J, Te8, T4O, T8A, T4T, T8B, T4U, Te9, T56, TdS, T8G;
+		    E T8H, T5h, TdT, T8J, T8M;
+		    {
+			 E T4A, T4C, T4z, T4B;
+			 T4A = ri[WS(rs, 63)];
+			 T4C = ii[WS(rs, 63)];
+			 T4z = W[124];
+			 T4B = W[125];
+			 T4D = FMA(T4z, T4A, T4B * T4C);
+			 T9e = FNMS(T4B, T4A, T4z * T4C);
+		    }
+		    {
+			 E T4F, T4H, T4E, T4G;
+			 T4F = ri[WS(rs, 31)];
+			 T4H = ii[WS(rs, 31)];
+			 T4E = W[60];
+			 T4G = W[61];
+			 T4I = FMA(T4E, T4F, T4G * T4H);
+			 T9f = FNMS(T4G, T4F, T4E * T4H);
+		    }
+		    T4J = T4D + T4I;
+		    Te8 = T9e + T9f;
+		    {
+			 E T4L, T4N, T4K, T4M;
+			 T4L = ri[WS(rs, 15)];
+			 T4N = ii[WS(rs, 15)];
+			 T4K = W[28];
+			 T4M = W[29];
+			 T4O = FMA(T4K, T4L, T4M * T4N);
+			 T8A = FNMS(T4M, T4L, T4K * T4N);
+		    }
+		    {
+			 E T4Q, T4S, T4P, T4R;
+			 T4Q = ri[WS(rs, 47)];
+			 T4S = ii[WS(rs, 47)];
+			 T4P = W[92];
+			 T4R = W[93];
+			 T4T = FMA(T4P, T4Q, T4R * T4S);
+			 T8B = FNMS(T4R, T4Q, T4P * T4S);
+		    }
+		    T4U = T4O + T4T;
+		    Te9 = T8A + T8B;
+		    {
+			 E T50, T8E, T55, T8F;
+			 {
+			      E T4X, T4Z, T4W, T4Y;
+			      T4X = ri[WS(rs, 7)];
+			      T4Z = ii[WS(rs, 7)];
+			      T4W = W[12];
+			      T4Y = W[13];
+			      T50 = FMA(T4W, T4X, T4Y * T4Z);
+			      T8E = FNMS(T4Y, T4X, T4W * T4Z);
+			 }
+			 {
+			      E T52, T54, T51, T53;
+			      T52 = ri[WS(rs, 39)];
+			      T54 = ii[WS(rs, 39)];
+			      T51 = W[76];
+			      T53 = W[77];
+			      T55 = FMA(T51, T52, T53 * T54);
+			      T8F = FNMS(T53, T52, T51 * T54);
+			 }
+			 T56 = T50 + T55;
+			 TdS = T8E + T8F;
+			 T8G = T8E - T8F;
+			 T8H = T50 - T55;
+		    }
+		    {
+			 E T5b, T8K, T5g, T8L;
+			 {
+			      E T58, T5a, T57, T59;
+			      T58 = ri[WS(rs, 55)];
+			      T5a = ii[WS(rs, 55)];
+			      T57 = W[108];
+			      T59 = W[109];
+			      T5b = FMA(T57, T58, T59 * T5a);
+			      T8K = FNMS(T59, T58, T57 * T5a);
+			 }
+			 {
+			      E T5d, T5f, T5c, T5e;
+			      T5d = ri[WS(rs, 23)];
+			      T5f = ii[WS(rs, 23)];
+			      T5c = W[44];
+			      T5e = W[45];
+			      T5g = FMA(T5c, T5d, T5e * T5f);
+			      T8L = FNMS(T5e, T5d, T5c * T5f);
+			 }
+			 T5h = T5b + T5g;
+			 TdT = T8K + T8L;
+			 T8J = T5b - T5g;
+			 T8M = T8K - T8L;
+		    }
+		    {
+			 E T4V, T5i, Tea, Teb;
+			 T4V = T4J + T4U;
+			 T5i = T56 + T5h;
+			 T5j = T4V + T5i;
+			 TfR = T4V - T5i;
+			 Tea = Te8 - Te9;
+			 Teb = T5h - T56;
+			 Tec = Tea - Teb;
+			 Tf0 = Tea + Teb;
+		    }
+		    {
+			 E TfW, TfX, T8z, T8C;
+			 TfW = Te8 + Te9;
+			 TfX = TdS + TdT;
+			 TfY = TfW - TfX;
+			 Tgy = TfW + TfX;
+			 T8z = T4D - T4I;
+			 T8C = T8A - T8B;
+			 T8D = T8z - T8C;
+			 Tbl = T8z + T8C;
+		    }
+		    {
+			 E T8I, T8N, T9j, T9k;
+			 T8I = T8G - T8H;
+			 T8N = T8J + T8M;
+			 T8O = KP707106781 * (T8I - T8N);
+			 Tbx = KP707106781 * (T8I + T8N);
+			 T9j = T8J - T8M;
+			 T9k = T8H + T8G;
+			 T9l = KP707106781 * (T9j - T9k);
+			 Tbm = KP707106781 * (T9k + T9j);
+		    }
+		    {
+			 E TdR, TdU, T9g, T9h;
+			 TdR = T4J - T4U;
+			 TdU = TdS - TdT;
+			 TdV = TdR - TdU;
+			 TeX = TdR + TdU;
+			 T9g = T9e - T9f;
+			 T9h = T4O - T4T;
+			 T9i = T9g + T9h;
+			 Tbw = T9g - T9h;
+		    }
+	       }
+	       {
+		    E T36, T7G, T3b, T7H, T3c, Tdq, T3h, T8m, T3m, T8n, T3n, Tdr, T3z, TdI, T7Q;
+		    E T7T, T3K, TdJ, T7L, T7O;
+		    {
+			 E T33, T35, T32, T34;
+			 T33 = ri[WS(rs, 1)];
+			 T35 = ii[WS(rs, 1)];
+			 T32 = W[0];
+			 T34 = W[1];
+			 T36 = FMA(T32, T33, T34 * T35);
+			 T7G = FNMS(T34, T33, T32 * T35);
+		    }
+		    {
+			 E T38, T3a, T37, T39;
+			 T38 = ri[WS(rs, 33)];
+			 T3a = ii[WS(rs, 33)];
+			 T37 = W[64];
+			 T39 = W[65];
+			 T3b = FMA(T37, T38, T39 * T3a);
+			 T7H = FNMS(T39, T38, T37 * T3a);
+		    }
+		    T3c = T36 + T3b;
+		    Tdq = T7G + T7H;
+		    {
+			 E T3e, T3g, T3d, T3f;
+			 T3e = ri[WS(rs, 17)];
+			 T3g = ii[WS(rs, 17)];
+			 T3d = W[32];
+			 T3f = W[33];
+			 T3h = FMA(T3d, T3e, T3f * T3g);
+			 T8m = FNMS(T3f, T3e, T3d * T3g);
+		    }
+		    {
+			 E T3j, T3l, T3i, T3k;
+			 T3j = ri[WS(rs, 49)];
+			 T3l = ii[WS(rs, 49)];
+			 T3i = W[96];
+			 T3k = W[97];
+			 T3m = FMA(T3i, T3j, T3k * T3l);
+			 T8n = FNMS(T3k, T3j, T3i * T3l);
+		    }
+		    T3n = T3h + T3m;
+		    Tdr = T8m + T8n;
+		    {
+			 E T3t, T7R, T3y, T7S;
+			 {
+			      E T3q, T3s, T3p, T3r;
+			      T3q = ri[WS(rs, 9)];
+			      T3s = ii[WS(rs, 9)];
+			      T3p = W[16];
+			      T3r = W[17];
+			      T3t = FMA(T3p, T3q, T3r * T3s);
+			      T7R = FNMS(T3r, T3q, T3p * T3s);
+			 }
+			 {
+			      E T3v, T3x, T3u, T3w;
+			      T3v = ri[WS(rs, 41)];
+			      T3x = ii[WS(rs, 41)];
+			      T3u = W[80];
+			      T3w = W[81];
+			      T3y = FMA(T3u, T3v, T3w * T3x);
+			      T7S = FNMS(T3w, T3v, T3u * T3x);
+			 }
+			 T3z = T3t + T3y;
+			 TdI = T7R + T7S;
+			 T7Q = T3t - T3y;
+			 T7T = T7R - T7S;
+		    }
+		    {
+			 E T3E, T7M, T3J, T7N;
+			 {
+			      E T3B, T3D, T3A, T3C;
+			      T3B = ri[WS(rs, 57)];
+			      T3D = ii[WS(rs, 57)];
+			      T3A = W[112];
+			      T3C = W[113];
+			      T3E = FMA(T3A, T3B, T3C * T3D);
+			      T7M = FNMS(T3C, T3B, T3A * T3D);
+			 }
+			 {
+			      E T3G, T3I, T3F, T3H;
+			      T3G = ri[WS(rs, 25)];
+			      T3I = ii[WS(rs, 25)];
+			      T3F = W[48];
+			      T3H = W[49];
+			      T3J = FMA(T3F, T3G, T3H * T3I);
+			      T7N = FNMS(T3H, T3G, T3F * T3I);
+			 }
+			 T3K = T3E + T3J;
+			 TdJ = T7M + T7N;
+			 T7L = T3E - T3J;
+			 T7O = T7M - T7N;
+		    }
+		    {
+			 E T3o, T3L, TdH, TdK;
+			 T3o = T3c + T3n;
+			 T3L = T3z + T3K;
+			 T3M = T3o + T3L;
+			 TfL = T3o - T3L;
+			 TdH = T3c - T3n;
+			 TdK = TdI - TdJ;
+			 TdL = TdH - TdK;
+			 TeQ = TdH + TdK;
+		    }
+		    {
+			 E TfG, TfH, T7I, T7J;
+			 TfG = Tdq + Tdr;
+			 TfH = TdI + TdJ;
+			 TfI = TfG - TfH;
+			 Tgt = TfG + TfH;
+			 T7I = T7G - T7H;
+			 T7J = T3h - T3m;
+			 T7K = T7I + T7J;
+			 Tb2 = T7I - T7J;
+		    }
+		    {
+			 E T7P, T7U, T8q, T8r;
+			 T7P = T7L - T7O;
+			 T7U = T7Q + T7T;
+			 T7V = KP707106781 * (T7P - T7U);
+			 Tbe = KP707106781 * (T7U + T7P);
+			 T8q = T7T - T7Q;
+			 T8r = T7L + T7O;
+			 T8s = KP707106781 * (T8q - T8r);
+			 Tb3 = KP707106781 * (T8q + T8r);
+		    }
+		    {
+			 E Tds, Tdt, T8l, T8o;
+			 Tds = Tdq - Tdr;
+			 Tdt = T3K - T3z;
+			 Tdu = Tds - Tdt;
+			 TeT = Tds + Tdt;
+			 T8l = T36 - T3b;
+			 T8o = T8m - T8n;
+			 T8p = T8l - T8o;
+			 Tbd = T8l + T8o;
+		    }
+	       }
+	       {
+		    E T3X, TdB, T8a, T8d, T4v, Tdx, T80, T85, T48, TdC, T8b, T8g, T4k, Tdw, T7X;
+		    E T84;
+		    {
+			 E T3R, T88, T3W, T89;
+			 {
+			      E T3O, T3Q, T3N, T3P;
+			      T3O = ri[WS(rs, 5)];
+			      T3Q = ii[WS(rs, 5)];
+			      T3N = W[8];
+			      T3P = W[9];
+			      T3R = FMA(T3N, T3O, T3P * T3Q);
+			      T88 = FNMS(T3P, T3O, T3N * T3Q);
+			 }
+			 {
+			      E T3T, T3V, T3S, T3U;
+			      T3T = ri[WS(rs, 37)];
+			      T3V = ii[WS(rs, 37)];
+			      T3S = W[72];
+			      T3U = W[73];
+			      T3W = FMA(T3S, T3T, T3U * T3V);
+			      T89 = FNMS(T3U, T3T, T3S * T3V);
+			 }
+			 T3X = T3R + T3W;
+			 TdB = T88 + T89;
+			 T8a = T88 - T89;
+			 T8d = T3R - T3W;
+		    }
+		    {
+			 E T4p, T7Y, T4u, T7Z;
+			 {
+			      E T4m, T4o, T4l, T4n;
+			      T4m = ri[WS(rs, 13)];
+			      T4o = ii[WS(rs, 13)];
+			      T4l = W[24];
+			      T4n = W[25];
+			      T4p = FMA(T4l, T4m, T4n * T4o);
+			      T7Y = FNMS(T4n, T4m, T4l * T4o);
+			 }
+			 {
+			      E T4r, T4t, T4q, T4s;
+			      T4r = ri[WS(rs, 45)];
+			      T4t = ii[WS(rs, 45)];
+			      T4q = W[88];
+			      T4s = W[89];
+			      T4u = FMA(T4q, T4r, T4s * T4t);
+			      T7Z = FNMS(T4s, T4r, T4q * T4t);
+			 }
+			 T4v = T4p + T4u;
+			 Tdx = T7Y + T7Z;
+			 T80 = T7Y - T7Z;
+			 T85 = T4p - T4u;
+		    }
+		    {
+			 E T42, T8e, T47, T8f;
+			 {
+			      E T3Z, T41, T3Y, T40;
+			      T3Z = ri[WS(rs, 21)];
+			      T41 = ii[WS(rs, 21)];
+			      T3Y = W[40];
+			      T40 = W[41];
+			      T42 = FMA(T3Y, T3Z, T40 * T41);
+			      T8e = FNMS(T40, T3Z, T3Y * T41);
+			 }
+			 {
+			      E T44, T46, T43, T45;
+			      T44 = ri[WS(rs, 53)];
+			      T46 = ii[WS(rs, 53)];
+			      T43 = W[104];
+			      T45 = W[105];
+			      T47 = FMA(T43, T44, T45 * T46);
+			      T8f = FNMS(T45, T44, T43 * T46);
+			 }
+			 T48 = T42 + T47;
+			 TdC = T8e + T8f;
+			 T8b = T42 - T47;
+			 T8g = T8e - T8f;
+		    }
+		    {
+			 E T4e, T82, T4j, T83;
+			 {
+			      E T4b, T4d, T4a, T4c;
+			      T4b = ri[WS(rs, 61)];
+			      T4d = ii[WS(rs, 61)];
+			      T4a = W[120];
+			      T4c = W[121];
+			      T4e = FMA(T4a, T4b, T4c * T4d);
+			      T82 = FNMS(T4c, T4b, T4a * T4d);
+			 }
+			 {
+			      E T4g, T4i, T4f, T4h;
+			      T4g = ri[WS(rs, 29)];
+			      T4i = ii[WS(rs, 29)];
+			      T4f = W[56];
+			      T4h = W[57];
+			      T4j = FMA(T4f, T4g, T4h * T4i);
+			      T83 = FNMS(T4h, T4g, T4f * T4i);
+			 }
+			 T4k = T4e + T4j;
+			 Tdw = T82 + T83;
+			 T7X = T4e - T4j;
+			 T84 = T82 - T83;
+		    }
+		    {
+			 E T49, T4w, TdA, TdD;
+			 T49 = T3X + T48;
+			 T4w = T4k + T4v;
+			 T4x = T49 + T4w;
+			 TfJ = T4w - T49;
+			 TdA = T3X - T48;
+			 TdD = TdB - TdC;
+			 TdE = TdA + TdD;
+			 TdM = TdD - TdA;
+		    }
+		    {
+			 E TfM, TfN, T81, T86;
+			 TfM = TdB + TdC;
+			 TfN = Tdw + Tdx;
+			 TfO = TfM - TfN;
+			 Tgu = TfM + TfN;
+			 T81 = T7X - T80;
+			 T86 = T84 + T85;
+			 T87 = FNMS(KP923879532, T86, KP382683432 * T81);
+			 T8v = FMA(KP382683432, T86, KP923879532 * T81);
+		    }
+		    {
+			 E T8c, T8h, Tb8, Tb9;
+			 T8c = T8a + T8b;
+			 T8h = T8d - T8g;
+			 T8i = FMA(KP923879532, T8c, KP382683432 * T8h);
+			 T8u = FNMS(KP923879532, T8h, KP382683432 * T8c);
+			 Tb8 = T8a - T8b;
+			 Tb9 = T8d + T8g;
+			 Tba = FMA(KP382683432, Tb8, KP923879532 * Tb9);
+			 Tbg = FNMS(KP382683432, Tb9, KP923879532 * Tb8);
+		    }
+		    {
+			 E Tdv, Tdy, Tb5, Tb6;
+			 Tdv = T4k - T4v;
+			 Tdy = Tdw - Tdx;
+			 Tdz = Tdv - Tdy;
+			 TdN = Tdv + Tdy;
+			 Tb5 = T7X + T80;
+			 Tb6 = T84 - T85;
+			 Tb7 = FNMS(KP382683432, Tb6, KP923879532 * Tb5);
+			 Tbh = FMA(KP923879532, Tb6, KP382683432 * Tb5);
+		    }
+	       }
+	       {
+		    E T5u, TdW, T8S, T8V, T62, Te3, T94, T99, T5F, TdX, T8T, T8Y, T5R, Te2, T93;
+		    E T96;
+		    {
+			 E T5o, T8Q, T5t, T8R;
+			 {
+			      E T5l, T5n, T5k, T5m;
+			      T5l = ri[WS(rs, 3)];
+			      T5n = ii[WS(rs, 3)];
+			      T5k = W[4];
+			      T5m = W[5];
+			      T5o = FMA(T5k, T5l, T5m * T5n);
+			      T8Q = FNMS(T5m, T5l, T5k * T5n);
+			 }
+			 {
+			      E T5q, T5s, T5p, T5r;
+			      T5q = ri[WS(rs, 35)];
+			      T5s = ii[WS(rs, 35)];
+			      T5p = W[68];
+			      T5r = W[69];
+			      T5t = FMA(T5p, T5q, T5r * T5s);
+			      T8R = FNMS(T5r, T5q, T5p * T5s);
+			 }
+			 T5u = T5o + T5t;
+			 TdW = T8Q + T8R;
+			 T8S = T8Q - T8R;
+			 T8V = T5o - T5t;
+		    }
+		    {
+			 E T5W, T97, T61, T98;
+			 {
+			      E T5T, T5V, T5S, T5U;
+			      T5T = ri[WS(rs, 11)];
+			      T5V = ii[WS(rs, 11)];
+			      T5S = W[20];
+			      T5U = W[21];
+			      T5W = FMA(T5S, T5T, T5U * T5V);
+			      T97 = FNMS(T5U, T5T, T5S * T5V);
+			 }
+			 {
+			      E T5Y, T60, T5X, T5Z;
+			      T5Y = ri[WS(rs, 43)];
+			      T60 = ii[WS(rs, 43)];
+			      T5X = W[84];
+			      T5Z = W[85];
+			      T61 = FMA(T5X, T5Y, T5Z * T60);
+			      T98 = FNMS(T5Z, T5Y, T5X * T60);
+			 }
+			 T62 = T5W + T61;
+			 Te3 = T97 + T98;
+			 T94 = T5W - T61;
+			 T99 = T97 - T98;
+		    }
+		    {
+			 E T5z, T8W, T5E, T8X;
+			 {
+			      E T5w, T5y, T5v, T5x;
+			      T5w = ri[WS(rs, 19)];
+			      T5y = ii[WS(rs, 19)];
+			      T5v = W[36];
+			      T5x = W[37];
+			      T5z = FMA(T5v, T5w, T5x * T5y);
+			      T8W = FNMS(T5x, T5w, T5v * T5y);
+			 }
+			 {
+			      E T5B, T5D, T5A, T5C;
+			      T5B = ri[WS(rs, 51)];
+			      T5D = ii[WS(rs, 51)];
+			      T5A = W[100];
+			      T5C = W[101];
+			      T5E = FMA(T5A, T5B, T5C * T5D);
+			      T8X = FNMS(T5C, T5B, T5A * T5D);
+			 }
+			 T5F = T5z + T5E;
+			 TdX = T8W + T8X;
+			 T8T = T5z - T5E;
+			 T8Y = T8W - T8X;
+		    }
+		    {
+			 E T5L, T91, T5Q, T92;
+			 {
+			      E T5I, T5K, T5H, T5J;
+			      T5I = ri[WS(rs, 59)];
+			      T5K = ii[WS(rs, 59)];
+			      T5H = W[116];
+			      T5J = W[117];
+			      T5L = FMA(T5H, T5I, T5J * T5K);
+			      T91 = FNMS(T5J, T5I, T5H * T5K);
+			 }
+			 {
+			      E T5N, T5P, T5M, T5O;
+			      T5N = ri[WS(rs, 27)];
+			      T5P = ii[WS(rs, 27)];
+			      T5M = W[52];
+			      T5O = W[53];
+			      T5Q = FMA(T5M, T5N, T5O * T5P);
+			      T92 = FNMS(T5O, T5N, T5M * T5P);
+			 }
+			 T5R = T5L + T5Q;
+			 Te2 = T91 + T92;
+			 T93 = T91 - T92;
+			 T96 = T5L - T5Q;
+		    }
+		    {
+			 E T5G, T63, Te1, Te4;
+			 T5G = T5u + T5F;
+			 T63 = T5R + T62;
+			 T64 = T5G + T63;
+			 TfZ = T63 - T5G;
+			 Te1 = T5R - T62;
+			 Te4 = Te2 - Te3;
+			 Te5 = Te1 + Te4;
+			 Ted = Te1 - Te4;
+		    }
+		    {
+			 E TfS, TfT, T8U, T8Z;
+			 TfS = TdW + TdX;
+			 TfT = Te2 + Te3;
+			 TfU = TfS - TfT;
+			 Tgz = TfS + TfT;
+			 T8U = T8S + T8T;
+			 T8Z = T8V - T8Y;
+			 T90 = FNMS(KP923879532, T8Z, KP382683432 * T8U);
+			 T9o = FMA(KP923879532, T8U, KP382683432 * T8Z);
+		    }
+		    {
+			 E T95, T9a, Tbr, Tbs;
+			 T95 = T93 + T94;
+			 T9a = T96 - T99;
+			 T9b = FMA(KP382683432, T95, KP923879532 * T9a);
+			 T9n = FNMS(KP923879532, T95, KP382683432 * T9a);
+			 Tbr = T93 - T94;
+			 Tbs = T96 + T99;
+			 Tbt = FMA(KP923879532, Tbr, KP382683432 * Tbs);
+			 Tbz = FNMS(KP382683432, Tbr, KP923879532 * Tbs);
+		    }
+		    {
+			 E TdY, TdZ, Tbo, Tbp;
+			 TdY = TdW - TdX;
+			 TdZ = T5u - T5F;
+			 Te0 = TdY - TdZ;
+			 Tee = TdZ + TdY;
+			 Tbo = T8S - T8T;
+			 Tbp = T8V + T8Y;
+			 Tbq = FNMS(KP382683432, Tbp, KP923879532 * Tbo);
+			 TbA = FMA(KP382683432, Tbo, KP923879532 * Tbp);
+		    }
+	       }
+	       {
+		    E T1t, Tgn, TgK, TgL, TgV, Th1, T30, Th0, T66, TgX, Tgw, TgE, TgB, TgF, Tgq;
+		    E TgM;
+		    {
+			 E TH, T1s, TgI, TgJ;
+			 TH = Tj + TG;
+			 T1s = T14 + T1r;
+			 T1t = TH + T1s;
+			 Tgn = TH - T1s;
+			 TgI = Tgt + Tgu;
+			 TgJ = Tgy + Tgz;
+			 TgK = TgI - TgJ;
+			 TgL = TgI + TgJ;
+		    }
+		    {
+			 E TgN, TgU, T2e, T2Z;
+			 TgN = Tfq + Tfr;
+			 TgU = TgO + TgT;
+			 TgV = TgN + TgU;
+			 Th1 = TgU - TgN;
+			 T2e = T1Q + T2d;
+			 T2Z = T2B + T2Y;
+			 T30 = T2e + T2Z;
+			 Th0 = T2Z - T2e;
+		    }
+		    {
+			 E T4y, T65, Tgs, Tgv;
+			 T4y = T3M + T4x;
+			 T65 = T5j + T64;
+			 T66 = T4y + T65;
+			 TgX = T65 - T4y;
+			 Tgs = T3M - T4x;
+			 Tgv = Tgt - Tgu;
+			 Tgw = Tgs + Tgv;
+			 TgE = Tgv - Tgs;
+		    }
+		    {
+			 E Tgx, TgA, Tgo, Tgp;
+			 Tgx = T5j - T64;
+			 TgA = Tgy - Tgz;
+			 TgB = Tgx - TgA;
+			 TgF = Tgx + TgA;
+			 Tgo = Tfu + Tfv;
+			 Tgp = TfA + TfB;
+			 Tgq = Tgo - Tgp;
+			 TgM = Tgo + Tgp;
+		    }
+		    {
+			 E T31, TgW, TgH, TgY;
+			 T31 = T1t + T30;
+			 ri[WS(rs, 32)] = T31 - T66;
+			 ri[0] = T31 + T66;
+			 TgW = TgM + TgV;
+			 ii[0] = TgL + TgW;
+			 ii[WS(rs, 32)] = TgW - TgL;
+			 TgH = T1t - T30;
+			 ri[WS(rs, 48)] = TgH - TgK;
+			 ri[WS(rs, 16)] = TgH + TgK;
+			 TgY = TgV - TgM;
+			 ii[WS(rs, 16)] = TgX + TgY;
+			 ii[WS(rs, 48)] = TgY - TgX;
+		    }
+		    {
+			 E Tgr, TgC, TgZ, Th2;
+			 Tgr = Tgn + Tgq;
+			 TgC = KP707106781 * (Tgw + TgB);
+			 ri[WS(rs, 40)] = Tgr - TgC;
+			 ri[WS(rs, 8)] = Tgr + TgC;
+			 TgZ = KP707106781 * (TgE + TgF);
+			 Th2 = Th0 + Th1;
+			 ii[WS(rs, 8)] = TgZ + Th2;
+			 ii[WS(rs, 40)] = Th2 - TgZ;
+		    }
+		    {
+			 E TgD, TgG, Th3, Th4;
+			 TgD = Tgn - Tgq;
+			 TgG = KP707106781 * (TgE - TgF);
+			 ri[WS(rs, 56)] = TgD - TgG;
+			 ri[WS(rs, 24)] = TgD + TgG;
+			 Th3 = KP707106781 * (TgB - Tgw);
+			 Th4 = Th1 - Th0;
+			 ii[WS(rs, 24)] = Th3 + Th4;
+			 ii[WS(rs, 56)] = Th4 - Th3;
+		    }
+	       }
+	       {
+		    E Tft, Tg7, Tgh, Tgl, Th9, Thf, TfE, Th6, TfQ, Tg4, Tga, The, Tge, Tgk, Tg1;
+		    E Tg5;
+		    {
+			 E Tfp, Tfs, Tgf, Tgg;
+			 Tfp = Tj - TG;
+			 Tfs = Tfq - Tfr;
+			 Tft = Tfp - Tfs;
+			 Tg7 = Tfp + Tfs;
+			 Tgf = TfR + TfU;
+			 Tgg = TfY + TfZ;
+			 Tgh = FNMS(KP382683432, Tgg, KP923879532 * Tgf);
+			 Tgl = FMA(KP923879532, Tgg, KP382683432 * Tgf);
+		    }
+		    {
+			 E Th7, Th8, Tfy, TfD;
+			 Th7 = T1r - T14;
+			 Th8 = TgT - TgO;
+			 Th9 = Th7 + Th8;
+			 Thf = Th8 - Th7;
+			 Tfy = Tfw - Tfx;
+			 TfD = Tfz + TfC;
+			 TfE = KP707106781 * (Tfy - TfD);
+			 Th6 = KP707106781 * (Tfy + TfD);
+		    }
+		    {
+			 E TfK, TfP, Tg8, Tg9;
+			 TfK = TfI - TfJ;
+			 TfP = TfL - TfO;
+			 TfQ = FMA(KP923879532, TfK, KP382683432 * TfP);
+			 Tg4 = FNMS(KP923879532, TfP, KP382683432 * TfK);
+			 Tg8 = Tfx + Tfw;
+			 Tg9 = Tfz - TfC;
+			 Tga = KP707106781 * (Tg8 + Tg9);
+			 The = KP707106781 * (Tg9 - Tg8);
+		    }
+		    {
+			 E Tgc, Tgd, TfV, Tg0;
+			 Tgc = TfI + TfJ;
+			 Tgd = TfL + TfO;
+			 Tge = FMA(KP382683432, Tgc, KP923879532 * Tgd);
+			 Tgk = FNMS(KP382683432, Tgd, KP923879532 * Tgc);
+			 TfV = TfR - TfU;
+			 Tg0 = TfY - TfZ;
+			 Tg1 = FNMS(KP923879532, Tg0, KP382683432 * TfV);
+			 Tg5 = FMA(KP382683432, Tg0, KP923879532 * TfV);
+		    }
+		    {
+			 E TfF, Tg2, Thd, Thg;
+			 TfF = Tft + TfE;
+			 Tg2 = TfQ + Tg1;
+			 ri[WS(rs, 44)] = TfF - Tg2;
+			 ri[WS(rs, 12)] = TfF + Tg2;
+			 Thd = Tg4 + Tg5;
+			 Thg = The + Thf;
+			 ii[WS(rs, 12)] = Thd + Thg;
+			 ii[WS(rs, 44)] = Thg - Thd;
+		    }
+		    {
+			 E Tg3, Tg6, Thh, Thi;
+			 Tg3 = Tft - TfE;
+			 Tg6 = Tg4 - Tg5;
+			 ri[WS(rs, 60)] = Tg3 - Tg6;
+			 ri[WS(rs, 28)] = Tg3 + Tg6;
+			 Thh = Tg1 - TfQ;
+			 Thi = Thf - The;
+			 ii[WS(rs, 28)] = Thh + Thi;
+			 ii[WS(rs, 60)] = Thi - Thh;
+		    }
+		    {
+			 E Tgb, Tgi, Th5, Tha;
+			 Tgb = Tg7 + Tga;
+			 Tgi = Tge + Tgh;
+			 ri[WS(rs, 36)] = Tgb - Tgi;
+			 ri[WS(rs, 4)] = Tgb + Tgi;
+			 Th5 = Tgk + Tgl;
+			 Tha = Th6 + Th9;
+			 ii[WS(rs, 4)] = Th5 + Tha;
+			 ii[WS(rs, 36)] = Tha - Th5;
+		    }
+		    {
+			 E Tgj, Tgm, Thb, Thc;
+			 Tgj = Tg7 - Tga;
+			 Tgm = Tgk - Tgl;
+			 ri[WS(rs, 52)] = Tgj - Tgm;
+			 ri[WS(rs, 20)] = Tgj + Tgm;
+			 Thb = Tgh - Tge;
+			 Thc = Th9 - Th6;
+			 ii[WS(rs, 20)] = Thb + Thc;
+			 ii[WS(rs, 52)] = Thc - Thb;
+		    }
+	       }
+	       {
+		    E Td1, Ten, Tdo, ThA, ThD, ThJ, Teq, ThI, Teh, TeB, Tel, Tex, TdQ, TeA, Tek;
+		    E Teu;
+		    {
+			 E TcP, Td0, Teo, Tep;
+			 TcP = TcL - TcO;
+			 Td0 = KP707106781 * (TcU - TcZ);
+			 Td1 = TcP - Td0;
+			 Ten = TcP + Td0;
+			 {
+			      E Tdc, Tdn, ThB, ThC;
+			      Tdc = FNMS(KP923879532, Tdb, KP382683432 * Td6);
+			      Tdn = FMA(KP382683432, Tdh, KP923879532 * Tdm);
+			      Tdo = Tdc - Tdn;
+			      ThA = Tdc + Tdn;
+			      ThB = KP707106781 * (TeF - TeE);
+			      ThC = Thn - Thm;
+			      ThD = ThB + ThC;
+			      ThJ = ThC - ThB;
+			 }
+			 Teo = FMA(KP923879532, Td6, KP382683432 * Tdb);
+			 Tep = FNMS(KP923879532, Tdh, KP382683432 * Tdm);
+			 Teq = Teo + Tep;
+			 ThI = Tep - Teo;
+			 {
+			      E Te7, Tev, Teg, Tew, Te6, Tef;
+			      Te6 = KP707106781 * (Te0 - Te5);
+			      Te7 = TdV - Te6;
+			      Tev = TdV + Te6;
+			      Tef = KP707106781 * (Ted - Tee);
+			      Teg = Tec - Tef;
+			      Tew = Tec + Tef;
+			      Teh = FNMS(KP980785280, Teg, KP195090322 * Te7);
+			      TeB = FMA(KP831469612, Tew, KP555570233 * Tev);
+			      Tel = FMA(KP195090322, Teg, KP980785280 * Te7);
+			      Tex = FNMS(KP555570233, Tew, KP831469612 * Tev);
+			 }
+			 {
+			      E TdG, Tes, TdP, Tet, TdF, TdO;
+			      TdF = KP707106781 * (Tdz - TdE);
+			      TdG = Tdu - TdF;
+			      Tes = Tdu + TdF;
+			      TdO = KP707106781 * (TdM - TdN);
+			      TdP = TdL - TdO;
+			      Tet = TdL + TdO;
+			      TdQ = FMA(KP980785280, TdG, KP195090322 * TdP);
+			      TeA = FNMS(KP555570233, Tet, KP831469612 * Tes);
+			      Tek = FNMS(KP980785280, TdP, KP195090322 * TdG);
+			      Teu = FMA(KP555570233, Tes, KP831469612 * Tet);
+			 }
+		    }
+		    {
+			 E Tdp, Tei, ThH, ThK;
+			 Tdp = Td1 + Tdo;
+			 Tei = TdQ + Teh;
+			 ri[WS(rs, 46)] = Tdp - Tei;
+			 ri[WS(rs, 14)] = Tdp + Tei;
+			 ThH = Tek + Tel;
+			 ThK = ThI + ThJ;
+			 ii[WS(rs, 14)] = ThH + ThK;
+			 ii[WS(rs, 46)] = ThK - ThH;
+		    }
+		    {
+			 E Tej, Tem, ThL, ThM;
+			 Tej = Td1 - Tdo;
+			 Tem = Tek - Tel;
+			 ri[WS(rs, 62)] = Tej - Tem;
+			 ri[WS(rs, 30)] = Tej + Tem;
+			 ThL = Teh - TdQ;
+			 ThM = ThJ - ThI;
+			 ii[WS(rs, 30)] = ThL + ThM;
+			 ii[WS(rs, 62)] = ThM - ThL;
+		    }
+		    {
+			 E Ter, Tey, Thz, ThE;
+			 Ter = Ten + Teq;
+			 Tey = Teu + Tex;
+			 ri[WS(rs, 38)] = Ter - Tey;
+			 ri[WS(rs, 6)] = Ter + Tey;
+			 Thz = TeA + TeB;
+			 ThE = ThA + ThD;
+			 ii[WS(rs, 6)] = Thz + ThE;
+			 ii[WS(rs, 38)] = ThE - Thz;
+		    }
+		    {
+			 E Tez, TeC, ThF, ThG;
+			 Tez = Ten - Teq;
+			 TeC = TeA - TeB;
+			 ri[WS(rs, 54)] = Tez - TeC;
+			 ri[WS(rs, 22)] = Tez + TeC;
+			 ThF = Tex - Teu;
+			 ThG = ThD - ThA;
+			 ii[WS(rs, 22)] = ThF + ThG;
+			 ii[WS(rs, 54)] = ThG - ThF;
+		    }
+	       }
+	       {
+		    E TeH, Tf9, TeO, Thk, Thp, Thv, Tfc, Thu, Tf3, Tfn, Tf7, Tfj, TeW, Tfm, Tf6;
+		    E Tfg;
+		    {
+			 E TeD, TeG, Tfa, Tfb;
+			 TeD = TcL + TcO;
+			 TeG = KP707106781 * (TeE + TeF);
+			 TeH = TeD - TeG;
+			 Tf9 = TeD + TeG;
+			 {
+			      E TeK, TeN, Thl, Tho;
+			      TeK = FNMS(KP382683432, TeJ, KP923879532 * TeI);
+			      TeN = FMA(KP923879532, TeL, KP382683432 * TeM);
+			      TeO = TeK - TeN;
+			      Thk = TeK + TeN;
+			      Thl = KP707106781 * (TcU + TcZ);
+			      Tho = Thm + Thn;
+			      Thp = Thl + Tho;
+			      Thv = Tho - Thl;
+			 }
+			 Tfa = FMA(KP382683432, TeI, KP923879532 * TeJ);
+			 Tfb = FNMS(KP382683432, TeL, KP923879532 * TeM);
+			 Tfc = Tfa + Tfb;
+			 Thu = Tfb - Tfa;
+			 {
+			      E TeZ, Tfh, Tf2, Tfi, TeY, Tf1;
+			      TeY = KP707106781 * (Tee + Ted);
+			      TeZ = TeX - TeY;
+			      Tfh = TeX + TeY;
+			      Tf1 = KP707106781 * (Te0 + Te5);
+			      Tf2 = Tf0 - Tf1;
+			      Tfi = Tf0 + Tf1;
+			      Tf3 = FNMS(KP831469612, Tf2, KP555570233 * TeZ);
+			      Tfn = FMA(KP195090322, Tfh, KP980785280 * Tfi);
+			      Tf7 = FMA(KP831469612, TeZ, KP555570233 * Tf2);
+			      Tfj = FNMS(KP195090322, Tfi, KP980785280 * Tfh);
+			 }
+			 {
+			      E TeS, Tfe, TeV, Tff, TeR, TeU;
+			      TeR = KP707106781 * (TdE + Tdz);
+			      TeS = TeQ - TeR;
+			      Tfe = TeQ + TeR;
+			      TeU = KP707106781 * (TdM + TdN);
+			      TeV = TeT - TeU;
+			      Tff = TeT + TeU;
+			      TeW = FMA(KP555570233, TeS, KP831469612 * TeV);
+			      Tfm = FNMS(KP195090322, Tfe, KP980785280 * Tff);
+			      Tf6 = FNMS(KP831469612, TeS, KP555570233 * TeV);
+			      Tfg = FMA(KP980785280, Tfe, KP195090322 * Tff);
+			 }
+		    }
+		    {
+			 E TeP, Tf4, Tht, Thw;
+			 TeP = TeH + TeO;
+			 Tf4 = TeW + Tf3;
+			 ri[WS(rs, 42)] = TeP - Tf4;
+			 ri[WS(rs, 10)] = TeP + Tf4;
+			 Tht = Tf6 + Tf7;
+			 Thw = Thu + Thv;
+			 ii[WS(rs, 10)] = Tht + Thw;
+			 ii[WS(rs, 42)] = Thw - Tht;
+		    }
+		    {
+			 E Tf5, Tf8, Thx, Thy;
+			 Tf5 = TeH - TeO;
+			 Tf8 = Tf6 - Tf7;
+			 ri[WS(rs, 58)] = Tf5 - Tf8;
+			 ri[WS(rs, 26)] = Tf5 + Tf8;
+			 Thx = Tf3 - TeW;
+			 Thy = Thv - Thu;
+			 ii[WS(rs, 26)] = Thx + Thy;
+			 ii[WS(rs, 58)] = Thy - Thx;
+		    }
+		    {
+			 E Tfd, Tfk, Thj, Thq;
+			 Tfd = Tf9 + Tfc;
+			 Tfk = Tfg + Tfj;
+			 ri[WS(rs, 34)] = Tfd - Tfk;
+			 ri[WS(rs, 2)] = Tfd + Tfk;
+			 Thj = Tfm + Tfn;
+			 Thq = Thk + Thp;
+			 ii[WS(rs, 2)] = Thj + Thq;
+			 ii[WS(rs, 34)] = Thq - Thj;
+		    }
+		    {
+			 E Tfl, Tfo, Thr, Ths;
+			 Tfl = Tf9 - Tfc;
+			 Tfo = Tfm - Tfn;
+			 ri[WS(rs, 50)] = Tfl - Tfo;
+			 ri[WS(rs, 18)] = Tfl + Tfo;
+			 Thr = Tfj - Tfg;
+			 Ths = Thp - Thk;
+			 ii[WS(rs, 18)] = Thr + Ths;
+			 ii[WS(rs, 50)] = Ths - Thr;
+		    }
+	       }
+	       {
+		    E T6L, T9x, TiD, TiJ, T7E, TiI, T9A, TiA, T8y, T9K, T9u, T9E, T9r, T9L, T9v;
+		    E T9H;
+		    {
+			 E T6n, T6K, TiB, TiC;
+			 T6n = T6b - T6m;
+			 T6K = T6y - T6J;
+			 T6L = T6n - T6K;
+			 T9x = T6n + T6K;
+			 TiB = T9P - T9O;
+			 TiC = Tin - Tim;
+			 TiD = TiB + TiC;
+			 TiJ = TiC - TiB;
+		    }
+		    {
+			 E T7c, T9y, T7D, T9z;
+			 {
+			      E T72, T7b, T7t, T7C;
+			      T72 = T6Q - T71;
+			      T7b = T77 - T7a;
+			      T7c = FNMS(KP980785280, T7b, KP195090322 * T72);
+			      T9y = FMA(KP980785280, T72, KP195090322 * T7b);
+			      T7t = T7h - T7s;
+			      T7C = T7y - T7B;
+			      T7D = FMA(KP195090322, T7t, KP980785280 * T7C);
+			      T9z = FNMS(KP980785280, T7t, KP195090322 * T7C);
+			 }
+			 T7E = T7c - T7D;
+			 TiI = T9z - T9y;
+			 T9A = T9y + T9z;
+			 TiA = T7c + T7D;
+		    }
+		    {
+			 E T8k, T9C, T8x, T9D;
+			 {
+			      E T7W, T8j, T8t, T8w;
+			      T7W = T7K - T7V;
+			      T8j = T87 - T8i;
+			      T8k = T7W - T8j;
+			      T9C = T7W + T8j;
+			      T8t = T8p - T8s;
+			      T8w = T8u - T8v;
+			      T8x = T8t - T8w;
+			      T9D = T8t + T8w;
+			 }
+			 T8y = FMA(KP995184726, T8k, KP098017140 * T8x);
+			 T9K = FNMS(KP634393284, T9D, KP773010453 * T9C);
+			 T9u = FNMS(KP995184726, T8x, KP098017140 * T8k);
+			 T9E = FMA(KP634393284, T9C, KP773010453 * T9D);
+		    }
+		    {
+			 E T9d, T9F, T9q, T9G;
+			 {
+			      E T8P, T9c, T9m, T9p;
+			      T8P = T8D - T8O;
+			      T9c = T90 - T9b;
+			      T9d = T8P - T9c;
+			      T9F = T8P + T9c;
+			      T9m = T9i - T9l;
+			      T9p = T9n - T9o;
+			      T9q = T9m - T9p;
+			      T9G = T9m + T9p;
+			 }
+			 T9r = FNMS(KP995184726, T9q, KP098017140 * T9d);
+			 T9L = FMA(KP773010453, T9G, KP634393284 * T9F);
+			 T9v = FMA(KP098017140, T9q, KP995184726 * T9d);
+			 T9H = FNMS(KP634393284, T9G, KP773010453 * T9F);
+		    }
+		    {
+			 E T7F, T9s, TiH, TiK;
+			 T7F = T6L + T7E;
+			 T9s = T8y + T9r;
+			 ri[WS(rs, 47)] = T7F - T9s;
+			 ri[WS(rs, 15)] = T7F + T9s;
+			 TiH = T9u + T9v;
+			 TiK = TiI + TiJ;
+			 ii[WS(rs, 15)] = TiH + TiK;
+			 ii[WS(rs, 47)] = TiK - TiH;
+		    }
+		    {
+			 E T9t, T9w, TiL, TiM;
+			 T9t = T6L - T7E;
+			 T9w = T9u - T9v;
+			 ri[WS(rs, 63)] = T9t - T9w;
+			 ri[WS(rs, 31)] = T9t + T9w;
+			 TiL = T9r - T8y;
+			 TiM = TiJ - TiI;
+			 ii[WS(rs, 31)] = TiL + TiM;
+			 ii[WS(rs, 63)] = TiM - TiL;
+		    }
+		    {
+			 E T9B, T9I, Tiz, TiE;
+			 T9B = T9x + T9A;
+			 T9I = T9E + T9H;
+			 ri[WS(rs, 39)] = T9B - T9I;
+			 ri[WS(rs, 7)] = T9B + T9I;
+			 Tiz = T9K + T9L;
+			 TiE = TiA + TiD;
+			 ii[WS(rs, 7)] = Tiz + TiE;
+			 ii[WS(rs, 39)] = TiE - Tiz;
+		    }
+		    {
+			 E T9J, T9M, TiF, TiG;
+			 T9J = T9x - T9A;
+			 T9M = T9K - T9L;
+			 ri[WS(rs, 55)] = T9J - T9M;
+			 ri[WS(rs, 23)] = T9J + T9M;
+			 TiF = T9H - T9E;
+			 TiG = TiD - TiA;
+			 ii[WS(rs, 23)] = TiF + TiG;
+			 ii[WS(rs, 55)] = TiG - TiF;
+		    }
+	       }
+	       {
+		    E TaL, TbJ, Ti9, Tif, Tb0, Tie, TbM, Ti6, Tbk, TbW, TbG, TbQ, TbD, TbX, TbH;
+		    E TbT;
+		    {
+			 E TaD, TaK, Ti7, Ti8;
+			 TaD = Taz - TaC;
+			 TaK = TaG - TaJ;
+			 TaL = TaD - TaK;
+			 TbJ = TaD + TaK;
+			 Ti7 = Tc1 - Tc0;
+			 Ti8 = ThT - ThQ;
+			 Ti9 = Ti7 + Ti8;
+			 Tif = Ti8 - Ti7;
+		    }
+		    {
+			 E TaS, TbK, TaZ, TbL;
+			 {
+			      E TaO, TaR, TaV, TaY;
+			      TaO = TaM - TaN;
+			      TaR = TaP - TaQ;
+			      TaS = FNMS(KP831469612, TaR, KP555570233 * TaO);
+			      TbK = FMA(KP555570233, TaR, KP831469612 * TaO);
+			      TaV = TaT - TaU;
+			      TaY = TaW - TaX;
+			      TaZ = FMA(KP831469612, TaV, KP555570233 * TaY);
+			      TbL = FNMS(KP831469612, TaY, KP555570233 * TaV);
+			 }
+			 Tb0 = TaS - TaZ;
+			 Tie = TbL - TbK;
+			 TbM = TbK + TbL;
+			 Ti6 = TaS + TaZ;
+		    }
+		    {
+			 E Tbc, TbO, Tbj, TbP;
+			 {
+			      E Tb4, Tbb, Tbf, Tbi;
+			      Tb4 = Tb2 - Tb3;
+			      Tbb = Tb7 - Tba;
+			      Tbc = Tb4 - Tbb;
+			      TbO = Tb4 + Tbb;
+			      Tbf = Tbd - Tbe;
+			      Tbi = Tbg - Tbh;
+			      Tbj = Tbf - Tbi;
+			      TbP = Tbf + Tbi;
+			 }
+			 Tbk = FMA(KP956940335, Tbc, KP290284677 * Tbj);
+			 TbW = FNMS(KP471396736, TbP, KP881921264 * TbO);
+			 TbG = FNMS(KP956940335, Tbj, KP290284677 * Tbc);
+			 TbQ = FMA(KP471396736, TbO, KP881921264 * TbP);
+		    }
+		    {
+			 E Tbv, TbR, TbC, TbS;
+			 {
+			      E Tbn, Tbu, Tby, TbB;
+			      Tbn = Tbl - Tbm;
+			      Tbu = Tbq - Tbt;
+			      Tbv = Tbn - Tbu;
+			      TbR = Tbn + Tbu;
+			      Tby = Tbw - Tbx;
+			      TbB = Tbz - TbA;
+			      TbC = Tby - TbB;
+			      TbS = Tby + TbB;
+			 }
+			 TbD = FNMS(KP956940335, TbC, KP290284677 * Tbv);
+			 TbX = FMA(KP881921264, TbS, KP471396736 * TbR);
+			 TbH = FMA(KP290284677, TbC, KP956940335 * Tbv);
+			 TbT = FNMS(KP471396736, TbS, KP881921264 * TbR);
+		    }
+		    {
+			 E Tb1, TbE, Tid, Tig;
+			 Tb1 = TaL + Tb0;
+			 TbE = Tbk + TbD;
+			 ri[WS(rs, 45)] = Tb1 - TbE;
+			 ri[WS(rs, 13)] = Tb1 + TbE;
+			 Tid = TbG + TbH;
+			 Tig = Tie + Tif;
+			 ii[WS(rs, 13)] = Tid + Tig;
+			 ii[WS(rs, 45)] = Tig - Tid;
+		    }
+		    {
+			 E TbF, TbI, Tih, Tii;
+			 TbF = TaL - Tb0;
+			 TbI = TbG - TbH;
+			 ri[WS(rs, 61)] = TbF - TbI;
+			 ri[WS(rs, 29)] = TbF + TbI;
+			 Tih = TbD - Tbk;
+			 Tii = Tif - Tie;
+			 ii[WS(rs, 29)] = Tih + Tii;
+			 ii[WS(rs, 61)] = Tii - Tih;
+		    }
+		    {
+			 E TbN, TbU, Ti5, Tia;
+			 TbN = TbJ + TbM;
+			 TbU = TbQ + TbT;
+			 ri[WS(rs, 37)] = TbN - TbU;
+			 ri[WS(rs, 5)] = TbN + TbU;
+			 Ti5 = TbW + TbX;
+			 Tia = Ti6 + Ti9;
+			 ii[WS(rs, 5)] = Ti5 + Tia;
+			 ii[WS(rs, 37)] = Tia - Ti5;
+		    }
+		    {
+			 E TbV, TbY, Tib, Tic;
+			 TbV = TbJ - TbM;
+			 TbY = TbW - TbX;
+			 ri[WS(rs, 53)] = TbV - TbY;
+			 ri[WS(rs, 21)] = TbV + TbY;
+			 Tib = TbT - TbQ;
+			 Tic = Ti9 - Ti6;
+			 ii[WS(rs, 21)] = Tib + Tic;
+			 ii[WS(rs, 53)] = Tic - Tib;
+		    }
+	       }
+	       {
+		    E Tc3, Tcv, ThV, Ti1, Tca, Ti0, Tcy, ThO, Tci, TcI, Tcs, TcC, Tcp, TcJ, Tct;
+		    E TcF;
+		    {
+			 E TbZ, Tc2, ThP, ThU;
+			 TbZ = Taz + TaC;
+			 Tc2 = Tc0 + Tc1;
+			 Tc3 = TbZ - Tc2;
+			 Tcv = TbZ + Tc2;
+			 ThP = TaG + TaJ;
+			 ThU = ThQ + ThT;
+			 ThV = ThP + ThU;
+			 Ti1 = ThU - ThP;
+		    }
+		    {
+			 E Tc6, Tcw, Tc9, Tcx;
+			 {
+			      E Tc4, Tc5, Tc7, Tc8;
+			      Tc4 = TaM + TaN;
+			      Tc5 = TaP + TaQ;
+			      Tc6 = FNMS(KP195090322, Tc5, KP980785280 * Tc4);
+			      Tcw = FMA(KP980785280, Tc5, KP195090322 * Tc4);
+			      Tc7 = TaT + TaU;
+			      Tc8 = TaW + TaX;
+			      Tc9 = FMA(KP195090322, Tc7, KP980785280 * Tc8);
+			      Tcx = FNMS(KP195090322, Tc8, KP980785280 * Tc7);
+			 }
+			 Tca = Tc6 - Tc9;
+			 Ti0 = Tcx - Tcw;
+			 Tcy = Tcw + Tcx;
+			 ThO = Tc6 + Tc9;
+		    }
+		    {
+			 E Tce, TcA, Tch, TcB;
+			 {
+			      E Tcc, Tcd, Tcf, Tcg;
+			      Tcc = Tbd + Tbe;
+			      Tcd = Tba + Tb7;
+			      Tce = Tcc - Tcd;
+			      TcA = Tcc + Tcd;
+			      Tcf = Tb2 + Tb3;
+			      Tcg = Tbg + Tbh;
+			      Tch = Tcf - Tcg;
+			      TcB = Tcf + Tcg;
+			 }
+			 Tci = FMA(KP634393284, Tce, KP773010453 * Tch);
+			 TcI = FNMS(KP098017140, TcA, KP995184726 * TcB);
+			 Tcs = FNMS(KP773010453, Tce, KP634393284 * Tch);
+			 TcC = FMA(KP995184726, TcA, KP098017140 * TcB);
+		    }
+		    {
+			 E Tcl, TcD, Tco, TcE;
+			 {
+			      E Tcj, Tck, Tcm, Tcn;
+			      Tcj = Tbl + Tbm;
+			      Tck = TbA + Tbz;
+			      Tcl = Tcj - Tck;
+			      TcD = Tcj + Tck;
+			      Tcm = Tbw + Tbx;
+			      Tcn = Tbq + Tbt;
+			      Tco = Tcm - Tcn;
+			      TcE = Tcm + Tcn;
+			 }
+			 Tcp = FNMS(KP773010453, Tco, KP634393284 * Tcl);
+			 TcJ = FMA(KP098017140, TcD, KP995184726 * TcE);
+			 Tct = FMA(KP773010453, Tcl, KP634393284 * Tco);
+			 TcF = FNMS(KP098017140, TcE, KP995184726 * TcD);
+		    }
+		    {
+			 E Tcb, Tcq, ThZ, Ti2;
+			 Tcb = Tc3 + Tca;
+			 Tcq = Tci + Tcp;
+			 ri[WS(rs, 41)] = Tcb - Tcq;
+			 ri[WS(rs, 9)] = Tcb + Tcq;
+			 ThZ = Tcs + Tct;
+			 Ti2 = Ti0 + Ti1;
+			 ii[WS(rs, 9)] = ThZ + Ti2;
+			 ii[WS(rs, 41)] = Ti2 - ThZ;
+		    }
+		    {
+			 E Tcr, Tcu, Ti3, Ti4;
+			 Tcr = Tc3 - Tca;
+			 Tcu = Tcs - Tct;
+			 ri[WS(rs, 57)] = Tcr - Tcu;
+			 ri[WS(rs, 25)] = Tcr + Tcu;
+			 Ti3 = Tcp - Tci;
+			 Ti4 = Ti1 - Ti0;
+			 ii[WS(rs, 25)] = Ti3 + Ti4;
+			 ii[WS(rs, 57)] = Ti4 - Ti3;
+		    }
+		    {
+			 E Tcz, TcG, ThN, ThW;
+			 Tcz = Tcv + Tcy;
+			 TcG = TcC + TcF;
+			 ri[WS(rs, 33)] = Tcz - TcG;
+			 ri[WS(rs, 1)] = Tcz + TcG;
+			 ThN = TcI + TcJ;
+			 ThW = ThO + ThV;
+			 ii[WS(rs, 1)] = ThN + ThW;
+			 ii[WS(rs, 33)] = ThW - ThN;
+		    }
+		    {
+			 E TcH, TcK, ThX, ThY;
+			 TcH = Tcv - Tcy;
+			 TcK = TcI - TcJ;
+			 ri[WS(rs, 49)] = TcH - TcK;
+			 ri[WS(rs, 17)] = TcH + TcK;
+			 ThX = TcF - TcC;
+			 ThY = ThV - ThO;
+			 ii[WS(rs, 17)] = ThX + ThY;
+			 ii[WS(rs, 49)] = ThY - ThX;
+		    }
+	       }
+	       {
+		    E T9R, Taj, Tip, Tiv, T9Y, Tiu, Tam, Tik, Ta6, Taw, Tag, Taq, Tad, Tax, Tah;
+		    E Tat;
+		    {
+			 E T9N, T9Q, Til, Tio;
+			 T9N = T6b + T6m;
+			 T9Q = T9O + T9P;
+			 T9R = T9N - T9Q;
+			 Taj = T9N + T9Q;
+			 Til = T6y + T6J;
+			 Tio = Tim + Tin;
+			 Tip = Til + Tio;
+			 Tiv = Tio - Til;
+		    }
+		    {
+			 E T9U, Tak, T9X, Tal;
+			 {
+			      E T9S, T9T, T9V, T9W;
+			      T9S = T6Q + T71;
+			      T9T = T77 + T7a;
+			      T9U = FNMS(KP555570233, T9T, KP831469612 * T9S);
+			      Tak = FMA(KP555570233, T9S, KP831469612 * T9T);
+			      T9V = T7h + T7s;
+			      T9W = T7y + T7B;
+			      T9X = FMA(KP831469612, T9V, KP555570233 * T9W);
+			      Tal = FNMS(KP555570233, T9V, KP831469612 * T9W);
+			 }
+			 T9Y = T9U - T9X;
+			 Tiu = Tal - Tak;
+			 Tam = Tak + Tal;
+			 Tik = T9U + T9X;
+		    }
+		    {
+			 E Ta2, Tao, Ta5, Tap;
+			 {
+			      E Ta0, Ta1, Ta3, Ta4;
+			      Ta0 = T8p + T8s;
+			      Ta1 = T8i + T87;
+			      Ta2 = Ta0 - Ta1;
+			      Tao = Ta0 + Ta1;
+			      Ta3 = T7K + T7V;
+			      Ta4 = T8u + T8v;
+			      Ta5 = Ta3 - Ta4;
+			      Tap = Ta3 + Ta4;
+			 }
+			 Ta6 = FMA(KP471396736, Ta2, KP881921264 * Ta5);
+			 Taw = FNMS(KP290284677, Tao, KP956940335 * Tap);
+			 Tag = FNMS(KP881921264, Ta2, KP471396736 * Ta5);
+			 Taq = FMA(KP956940335, Tao, KP290284677 * Tap);
+		    }
+		    {
+			 E Ta9, Tar, Tac, Tas;
+			 {
+			      E Ta7, Ta8, Taa, Tab;
+			      Ta7 = T8D + T8O;
+			      Ta8 = T9o + T9n;
+			      Ta9 = Ta7 - Ta8;
+			      Tar = Ta7 + Ta8;
+			      Taa = T9i + T9l;
+			      Tab = T90 + T9b;
+			      Tac = Taa - Tab;
+			      Tas = Taa + Tab;
+			 }
+			 Tad = FNMS(KP881921264, Tac, KP471396736 * Ta9);
+			 Tax = FMA(KP290284677, Tar, KP956940335 * Tas);
+			 Tah = FMA(KP881921264, Ta9, KP471396736 * Tac);
+			 Tat = FNMS(KP290284677, Tas, KP956940335 * Tar);
+		    }
+		    {
+			 E T9Z, Tae, Tit, Tiw;
+			 T9Z = T9R + T9Y;
+			 Tae = Ta6 + Tad;
+			 ri[WS(rs, 43)] = T9Z - Tae;
+			 ri[WS(rs, 11)] = T9Z + Tae;
+			 Tit = Tag + Tah;
+			 Tiw = Tiu + Tiv;
+			 ii[WS(rs, 11)] = Tit + Tiw;
+			 ii[WS(rs, 43)] = Tiw - Tit;
+		    }
+		    {
+			 E Taf, Tai, Tix, Tiy;
+			 Taf = T9R - T9Y;
+			 Tai = Tag - Tah;
+			 ri[WS(rs, 59)] = Taf - Tai;
+			 ri[WS(rs, 27)] = Taf + Tai;
+			 Tix = Tad - Ta6;
+			 Tiy = Tiv - Tiu;
+			 ii[WS(rs, 27)] = Tix + Tiy;
+			 ii[WS(rs, 59)] = Tiy - Tix;
+		    }
+		    {
+			 E Tan, Tau, Tij, Tiq;
+			 Tan = Taj + Tam;
+			 Tau = Taq + Tat;
+			 ri[WS(rs, 35)] = Tan - Tau;
+			 ri[WS(rs, 3)] = Tan + Tau;
+			 Tij = Taw + Tax;
+			 Tiq = Tik + Tip;
+			 ii[WS(rs, 3)] = Tij + Tiq;
+			 ii[WS(rs, 35)] = Tiq - Tij;
+		    }
+		    {
+			 E Tav, Tay, Tir, Tis;
+			 Tav = Taj - Tam;
+			 Tay = Taw - Tax;
+			 ri[WS(rs, 51)] = Tav - Tay;
+			 ri[WS(rs, 19)] = Tav + Tay;
+			 Tir = Tat - Taq;
+			 Tis = Tip - Tik;
+			 ii[WS(rs, 19)] = Tir + Tis;
+			 ii[WS(rs, 51)] = Tis - Tir;
+		    }
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_FULL, 0, 64 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 64, "t1_64", twinstr, &GENUS, { 808, 270, 230, 0 }, 0, 0, 0 };
+
+void X(codelet_t1_64) (planner *p) {
+     X(kdft_dit_register) (p, t1_64, &desc);
+}
+#endif
@@ -0,0 +1,1620 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:44:38 EDT 2021 */
+
+#include "dft/codelet-dft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_twiddle.native -fma -compact -variables 4 -pipeline-latency 4 -twiddle-log3 -precompute-twiddles -n 25 -name t2_25 -include dft/scalar/t.h */
+
+/*
+ * This function contains 440 FP additions, 434 FP multiplications,
+ * (or, 84 additions, 78 multiplications, 356 fused multiply/add),
+ * 186 stack variables, 47 constants, and 100 memory accesses
+ */
+#include "dft/scalar/t.h"
+
+static void t2_25(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DK(KP860541664, +0.860541664367944677098261680920518816412804187);
+     DK(KP560319534, +0.560319534973832390111614715371676131169633784);
+     DK(KP681693190, +0.681693190061530575150324149145440022633095390);
+     DK(KP949179823, +0.949179823508441261575555465843363271711583843);
+     DK(KP557913902, +0.557913902031834264187699648465567037992437152);
+     DK(KP249506682, +0.249506682107067890488084201715862638334226305);
+     DK(KP614372930, +0.614372930789563808870829930444362096004872855);
+     DK(KP621716863, +0.621716863012209892444754556304102309693593202);
+     DK(KP998026728, +0.998026728428271561952336806863450553336905220);
+     DK(KP906616052, +0.906616052148196230441134447086066874408359177);
+     DK(KP845997307, +0.845997307939530944175097360758058292389769300);
+     DK(KP968479752, +0.968479752739016373193524836781420152702090879);
+     DK(KP994076283, +0.994076283785401014123185814696322018529298887);
+     DK(KP772036680, +0.772036680810363904029489473607579825330539880);
+     DK(KP734762448, +0.734762448793050413546343770063151342619912334);
+     DK(KP062914667, +0.062914667253649757225485955897349402364686947);
+     DK(KP943557151, +0.943557151597354104399655195398983005179443399);
+     DK(KP803003575, +0.803003575438660414833440593570376004635464850);
+     DK(KP554608978, +0.554608978404018097464974850792216217022558774);
+     DK(KP248028675, +0.248028675328619457762448260696444630363259177);
+     DK(KP525970792, +0.525970792408939708442463226536226366643874659);
+     DK(KP726211448, +0.726211448929902658173535992263577167607493062);
+     DK(KP833417178, +0.833417178328688677408962550243238843138996060);
+     DK(KP921177326, +0.921177326965143320250447435415066029359282231);
+     DK(KP541454447, +0.541454447536312777046285590082819509052033189);
+     DK(KP242145790, +0.242145790282157779872542093866183953459003101);
+     DK(KP683113946, +0.683113946453479238701949862233725244439656928);
+     DK(KP559154169, +0.559154169276087864842202529084232643714075927);
+     DK(KP992114701, +0.992114701314477831049793042785778521453036709);
+     DK(KP968583161, +0.968583161128631119490168375464735813836012403);
+     DK(KP851038619, +0.851038619207379630836264138867114231259902550);
+     DK(KP912018591, +0.912018591466481957908415381764119056233607330);
+     DK(KP912575812, +0.912575812670962425556968549836277086778922727);
+     DK(KP470564281, +0.470564281212251493087595091036643380879947982);
+     DK(KP827271945, +0.827271945972475634034355757144307982555673741);
+     DK(KP126329378, +0.126329378446108174786050455341811215027378105);
+     DK(KP904730450, +0.904730450839922351881287709692877908104763647);
+     DK(KP831864738, +0.831864738706457140726048799369896829771167132);
+     DK(KP871714437, +0.871714437527667770979999223229522602943903653);
+     DK(KP549754652, +0.549754652192770074288023275540779861653779767);
+     DK(KP634619297, +0.634619297544148100711287640319130485732531031);
+     DK(KP939062505, +0.939062505817492352556001843133229685779824606);
+     DK(KP256756360, +0.256756360367726783319498520922669048172391148);
+     DK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DK(KP618033988, +0.618033988749894848204586834365638117720309180);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 8); m < me; m = m + 1, ri = ri + ms, ii = ii + ms, W = W + 8, MAKE_VOLATILE_STRIDE(50, rs)) {
+	       E T2, T8, T3, T6, Tk, Tm, T5, T7, T19, Tb, T1b, Tc, Tw, TT, T1j;
+	       E TE, T2p, T1c, T2U, TI, T11, T15, T2Q, T2M, T2m, T2i, T2e, Tn, Tr, TX;
+	       E T31, T35, T1l, T1m, T1q, TA, T1K, T1O, T2a, T27, T1g, T2x, T2t, Th, Td;
+	       E T1S, T2X, T1W;
+	       {
+		    E TS, TD, T2L, T10, TH, T2P, T14, T9, T1a, Tz, TW, T4, Ta, Tv, T1J;
+		    E T1N;
+		    T2 = W[0];
+		    T8 = W[4];
+		    T3 = W[2];
+		    T6 = W[3];
+		    T4 = T2 * T3;
+		    TS = T3 * T8;
+		    Ta = T2 * T6;
+		    Tv = T2 * T8;
+		    Tk = W[6];
+		    TD = T8 * Tk;
+		    T2L = T2 * Tk;
+		    T10 = T3 * Tk;
+		    Tm = W[7];
+		    TH = T8 * Tm;
+		    T2P = T2 * Tm;
+		    T14 = T3 * Tm;
+		    T5 = W[1];
+		    T7 = FNMS(T5, T6, T4);
+		    T19 = FMA(T5, T6, T4);
+		    T9 = T7 * T8;
+		    T1a = T19 * T8;
+		    Tb = FMA(T5, T3, Ta);
+		    T1b = FNMS(T5, T3, Ta);
+		    Tc = W[5];
+		    Tz = T2 * Tc;
+		    TW = T3 * Tc;
+		    Tw = FNMS(T5, Tc, Tv);
+		    TT = FMA(T6, Tc, TS);
+		    T1j = FMA(T5, Tc, Tv);
+		    TE = FMA(Tc, Tm, TD);
+		    T2p = FMA(T6, T8, TW);
+		    T1c = FNMS(T1b, Tc, T1a);
+		    T2U = FNMS(Tb, Tc, T9);
+		    TI = FNMS(Tc, Tk, TH);
+		    T11 = FMA(T6, Tm, T10);
+		    T15 = FNMS(T6, Tk, T14);
+		    T2Q = FNMS(T5, Tk, T2P);
+		    T2M = FMA(T5, Tm, T2L);
+		    {
+			 E T2h, T2d, Tl, Tq;
+			 T2m = FNMS(T6, Tc, TS);
+			 T2h = T19 * Tm;
+			 T2i = FNMS(T1b, Tk, T2h);
+			 T2d = T19 * Tk;
+			 T2e = FMA(T1b, Tm, T2d);
+			 Tl = T7 * Tk;
+			 Tn = FMA(Tb, Tm, Tl);
+			 Tq = T7 * Tm;
+			 Tr = FNMS(Tb, Tk, Tq);
+		    }
+		    {
+			 E T30, T34, T1k, T1p;
+			 T30 = TT * Tk;
+			 T34 = TT * Tm;
+			 TX = FNMS(T6, T8, TW);
+			 T31 = FMA(TX, Tm, T30);
+			 T35 = FNMS(TX, Tk, T34);
+			 T1k = T1j * Tk;
+			 T1p = T1j * Tm;
+			 T1l = FNMS(T5, T8, Tz);
+			 T1m = FMA(T1l, Tm, T1k);
+			 T1q = FNMS(T1l, Tk, T1p);
+		    }
+		    T1J = Tw * Tk;
+		    T1N = Tw * Tm;
+		    TA = FMA(T5, T8, Tz);
+		    T1K = FMA(TA, Tm, T1J);
+		    T1O = FNMS(TA, Tk, T1N);
+		    {
+			 E T1f, T2s, T2w, Tg, T1R, T1V;
+			 T1f = T19 * Tc;
+			 T2a = FNMS(T1b, T8, T1f);
+			 T27 = FMA(T1b, Tc, T1a);
+			 T2s = T27 * Tk;
+			 T2w = T27 * Tm;
+			 T1g = FMA(T1b, T8, T1f);
+			 T2x = FNMS(T2a, Tk, T2w);
+			 T2t = FMA(T2a, Tm, T2s);
+			 Tg = T7 * Tc;
+			 Th = FNMS(Tb, T8, Tg);
+			 Td = FMA(Tb, Tc, T9);
+			 T1R = Td * Tk;
+			 T1V = Td * Tm;
+			 T1S = FMA(Th, Tm, T1R);
+			 T2X = FMA(Tb, T8, Tg);
+			 T1W = FNMS(Th, Tk, T1V);
+		    }
+	       }
+	       {
+		    E T1, T7r, T4s, T6a, T7G, T86, TM, T4f, T4g, T7q, T7B, T7C, T5j, T6n, T5q;
+		    E T6k, T3a, T6m, T5g, T4a, T6j, T5n, T4z, T6z, T4G, T6C, T1v, T6y, T4w, T3t;
+		    E T6B, T4D, T4O, T6v, T4V, T6s, T21, T6r, T4S, T3H, T6u, T4L, T54, T6g, T5b;
+		    E T6d, T2C, T6f, T51, T3W, T6c, T58;
+		    {
+			 E Tj, T4j, TK, T4q, TC, T4o, Tt, T4l;
+			 T1 = ri[0];
+			 T7r = ii[0];
+			 {
+			      E Te, Tf, Ti, T4i;
+			      Te = ri[WS(rs, 5)];
+			      Tf = Td * Te;
+			      Ti = ii[WS(rs, 5)];
+			      T4i = Td * Ti;
+			      Tj = FMA(Th, Ti, Tf);
+			      T4j = FNMS(Th, Te, T4i);
+			 }
+			 {
+			      E TF, TG, TJ, T4p;
+			      TF = ri[WS(rs, 15)];
+			      TG = TE * TF;
+			      TJ = ii[WS(rs, 15)];
+			      T4p = TE * TJ;
+			      TK = FMA(TI, TJ, TG);
+			      T4q = FNMS(TI, TF, T4p);
+			 }
+			 {
+			      E Tx, Ty, TB, T4n;
+			      Tx = ri[WS(rs, 10)];
+			      Ty = Tw * Tx;
+			      TB = ii[WS(rs, 10)];
+			      T4n = Tw * TB;
+			      TC = FMA(TA, TB, Ty);
+			      T4o = FNMS(TA, Tx, T4n);
+			 }
+			 {
+			      E To, Tp, Ts, T4k;
+			      To = ri[WS(rs, 20)];
+			      Tp = Tn * To;
+			      Ts = ii[WS(rs, 20)];
+			      T4k = Tn * Ts;
+			      Tt = FMA(Tr, Ts, Tp);
+			      T4l = FNMS(Tr, To, T4k);
+			 }
+			 {
+			      E T4m, T4r, T7E, T7F;
+			      T4m = T4j - T4l;
+			      T4r = T4o - T4q;
+			      T4s = FMA(KP618033988, T4r, T4m);
+			      T6a = FNMS(KP618033988, T4m, T4r);
+			      T7E = Tj - Tt;
+			      T7F = TC - TK;
+			      T7G = FMA(KP618033988, T7F, T7E);
+			      T86 = FNMS(KP618033988, T7E, T7F);
+			 }
+			 {
+			      E Tu, TL, T7o, T7p;
+			      Tu = Tj + Tt;
+			      TL = TC + TK;
+			      TM = Tu + TL;
+			      T4f = FNMS(KP250000000, TM, T1);
+			      T4g = Tu - TL;
+			      T7o = T4j + T4l;
+			      T7p = T4o + T4q;
+			      T7q = T7o + T7p;
+			      T7B = FNMS(KP250000000, T7q, T7r);
+			      T7C = T7o - T7p;
+			 }
+		    }
+		    {
+			 E T2G, T3Y, T2Z, T37, T38, T45, T47, T48, T2K, T2S, T2T, T40, T42, T43;
+			 {
+			      E T2D, T2E, T2F, T3X;
+			      T2D = ri[WS(rs, 3)];
+			      T2E = T3 * T2D;
+			      T2F = ii[WS(rs, 3)];
+			      T3X = T3 * T2F;
+			      T2G = FMA(T6, T2F, T2E);
+			      T3Y = FNMS(T6, T2D, T3X);
+			 }
+			 {
+			      E T2V, T2W, T2Y, T44, T32, T33, T36, T46;
+			      T2V = ri[WS(rs, 13)];
+			      T2W = T2U * T2V;
+			      T2Y = ii[WS(rs, 13)];
+			      T44 = T2U * T2Y;
+			      T32 = ri[WS(rs, 18)];
+			      T33 = T31 * T32;
+			      T36 = ii[WS(rs, 18)];
+			      T46 = T31 * T36;
+			      T2Z = FMA(T2X, T2Y, T2W);
+			      T37 = FMA(T35, T36, T33);
+			      T38 = T2Z + T37;
+			      T45 = FNMS(T2X, T2V, T44);
+			      T47 = FNMS(T35, T32, T46);
+			      T48 = T45 + T47;
+			 }
+			 {
+			      E T2H, T2I, T2J, T3Z, T2N, T2O, T2R, T41;
+			      T2H = ri[WS(rs, 8)];
+			      T2I = T1j * T2H;
+			      T2J = ii[WS(rs, 8)];
+			      T3Z = T1j * T2J;
+			      T2N = ri[WS(rs, 23)];
+			      T2O = T2M * T2N;
+			      T2R = ii[WS(rs, 23)];
+			      T41 = T2M * T2R;
+			      T2K = FMA(T1l, T2J, T2I);
+			      T2S = FMA(T2Q, T2R, T2O);
+			      T2T = T2K + T2S;
+			      T40 = FNMS(T1l, T2H, T3Z);
+			      T42 = FNMS(T2Q, T2N, T41);
+			      T43 = T40 + T42;
+			 }
+			 {
+			      E T5h, T5i, T5o, T5p;
+			      T5h = T42 - T40;
+			      T5i = T47 - T45;
+			      T5j = FMA(KP618033988, T5i, T5h);
+			      T6n = FNMS(KP618033988, T5h, T5i);
+			      T5o = T2K - T2S;
+			      T5p = T2Z - T37;
+			      T5q = FMA(KP618033988, T5p, T5o);
+			      T6k = FNMS(KP618033988, T5o, T5p);
+			 }
+			 {
+			      E T5f, T39, T5e, T5m, T49, T5l;
+			      T5f = T38 - T2T;
+			      T39 = T2T + T38;
+			      T5e = FNMS(KP250000000, T39, T2G);
+			      T3a = T2G + T39;
+			      T6m = FMA(KP559016994, T5f, T5e);
+			      T5g = FNMS(KP559016994, T5f, T5e);
+			      T5m = T48 - T43;
+			      T49 = T43 + T48;
+			      T5l = FNMS(KP250000000, T49, T3Y);
+			      T4a = T3Y + T49;
+			      T6j = FMA(KP559016994, T5m, T5l);
+			      T5n = FNMS(KP559016994, T5m, T5l);
+			 }
+		    }
+		    {
+			 E TR, T3h, T1i, T1s, T1t, T3o, T3q, T3r, TZ, T17, T18, T3j, T3l, T3m;
+			 {
+			      E TO, TP, TQ, T3g;
+			      TO = ri[WS(rs, 1)];
+			      TP = T2 * TO;
+			      TQ = ii[WS(rs, 1)];
+			      T3g = T2 * TQ;
+			      TR = FMA(T5, TQ, TP);
+			      T3h = FNMS(T5, TO, T3g);
+			 }
+			 {
+			      E T1d, T1e, T1h, T3n, T1n, T1o, T1r, T3p;
+			      T1d = ri[WS(rs, 11)];
+			      T1e = T1c * T1d;
+			      T1h = ii[WS(rs, 11)];
+			      T3n = T1c * T1h;
+			      T1n = ri[WS(rs, 16)];
+			      T1o = T1m * T1n;
+			      T1r = ii[WS(rs, 16)];
+			      T3p = T1m * T1r;
+			      T1i = FMA(T1g, T1h, T1e);
+			      T1s = FMA(T1q, T1r, T1o);
+			      T1t = T1i + T1s;
+			      T3o = FNMS(T1g, T1d, T3n);
+			      T3q = FNMS(T1q, T1n, T3p);
+			      T3r = T3o + T3q;
+			 }
+			 {
+			      E TU, TV, TY, T3i, T12, T13, T16, T3k;
+			      TU = ri[WS(rs, 6)];
+			      TV = TT * TU;
+			      TY = ii[WS(rs, 6)];
+			      T3i = TT * TY;
+			      T12 = ri[WS(rs, 21)];
+			      T13 = T11 * T12;
+			      T16 = ii[WS(rs, 21)];
+			      T3k = T11 * T16;
+			      TZ = FMA(TX, TY, TV);
+			      T17 = FMA(T15, T16, T13);
+			      T18 = TZ + T17;
+			      T3j = FNMS(TX, TU, T3i);
+			      T3l = FNMS(T15, T12, T3k);
+			      T3m = T3j + T3l;
+			 }
+			 {
+			      E T4x, T4y, T4E, T4F;
+			      T4x = T3j - T3l;
+			      T4y = T3q - T3o;
+			      T4z = FNMS(KP618033988, T4y, T4x);
+			      T6z = FMA(KP618033988, T4x, T4y);
+			      T4E = T17 - TZ;
+			      T4F = T1s - T1i;
+			      T4G = FMA(KP618033988, T4F, T4E);
+			      T6C = FNMS(KP618033988, T4E, T4F);
+			 }
+			 {
+			      E T4v, T1u, T4u, T4C, T3s, T4B;
+			      T4v = T18 - T1t;
+			      T1u = T18 + T1t;
+			      T4u = FNMS(KP250000000, T1u, TR);
+			      T1v = TR + T1u;
+			      T6y = FNMS(KP559016994, T4v, T4u);
+			      T4w = FMA(KP559016994, T4v, T4u);
+			      T4C = T3m - T3r;
+			      T3s = T3m + T3r;
+			      T4B = FNMS(KP250000000, T3s, T3h);
+			      T3t = T3h + T3s;
+			      T6B = FNMS(KP559016994, T4C, T4B);
+			      T4D = FMA(KP559016994, T4C, T4B);
+			 }
+		    }
+		    {
+			 E T1z, T3v, T1Q, T1Y, T1Z, T3C, T3E, T3F, T1D, T1H, T1I, T3x, T3z, T3A;
+			 {
+			      E T1w, T1x, T1y, T3u;
+			      T1w = ri[WS(rs, 4)];
+			      T1x = T7 * T1w;
+			      T1y = ii[WS(rs, 4)];
+			      T3u = T7 * T1y;
+			      T1z = FMA(Tb, T1y, T1x);
+			      T3v = FNMS(Tb, T1w, T3u);
+			 }
+			 {
+			      E T1L, T1M, T1P, T3B, T1T, T1U, T1X, T3D;
+			      T1L = ri[WS(rs, 14)];
+			      T1M = T1K * T1L;
+			      T1P = ii[WS(rs, 14)];
+			      T3B = T1K * T1P;
+			      T1T = ri[WS(rs, 19)];
+			      T1U = T1S * T1T;
+			      T1X = ii[WS(rs, 19)];
+			      T3D = T1S * T1X;
+			      T1Q = FMA(T1O, T1P, T1M);
+			      T1Y = FMA(T1W, T1X, T1U);
+			      T1Z = T1Q + T1Y;
+			      T3C = FNMS(T1O, T1L, T3B);
+			      T3E = FNMS(T1W, T1T, T3D);
+			      T3F = T3C + T3E;
+			 }
+			 {
+			      E T1A, T1B, T1C, T3w, T1E, T1F, T1G, T3y;
+			      T1A = ri[WS(rs, 9)];
+			      T1B = T8 * T1A;
+			      T1C = ii[WS(rs, 9)];
+			      T3w = T8 * T1C;
+			      T1E = ri[WS(rs, 24)];
+			      T1F = Tk * T1E;
+			      T1G = ii[WS(rs, 24)];
+			      T3y = Tk * T1G;
+			      T1D = FMA(Tc, T1C, T1B);
+			      T1H = FMA(Tm, T1G, T1F);
+			      T1I = T1D + T1H;
+			      T3x = FNMS(Tc, T1A, T3w);
+			      T3z = FNMS(Tm, T1E, T3y);
+			      T3A = T3x + T3z;
+			 }
+			 {
+			      E T4M, T4N, T4T, T4U;
+			      T4M = T1H - T1D;
+			      T4N = T1Y - T1Q;
+			      T4O = FMA(KP618033988, T4N, T4M);
+			      T6v = FNMS(KP618033988, T4M, T4N);
+			      T4T = T3z - T3x;
+			      T4U = T3E - T3C;
+			      T4V = FMA(KP618033988, T4U, T4T);
+			      T6s = FNMS(KP618033988, T4T, T4U);
+			 }
+			 {
+			      E T4R, T20, T4Q, T4K, T3G, T4J;
+			      T4R = T1I - T1Z;
+			      T20 = T1I + T1Z;
+			      T4Q = FNMS(KP250000000, T20, T1z);
+			      T21 = T1z + T20;
+			      T6r = FNMS(KP559016994, T4R, T4Q);
+			      T4S = FMA(KP559016994, T4R, T4Q);
+			      T4K = T3F - T3A;
+			      T3G = T3A + T3F;
+			      T4J = FNMS(KP250000000, T3G, T3v);
+			      T3H = T3v + T3G;
+			      T6u = FMA(KP559016994, T4K, T4J);
+			      T4L = FNMS(KP559016994, T4K, T4J);
+			 }
+		    }
+		    {
+			 E T26, T3K, T2r, T2z, T2A, T3R, T3T, T3U, T2c, T2k, T2l, T3M, T3O, T3P;
+			 {
+			      E T23, T24, T25, T3J;
+			      T23 = ri[WS(rs, 2)];
+			      T24 = T19 * T23;
+			      T25 = ii[WS(rs, 2)];
+			      T3J = T19 * T25;
+			      T26 = FMA(T1b, T25, T24);
+			      T3K = FNMS(T1b, T23, T3J);
+			 }
+			 {
+			      E T2n, T2o, T2q, T3Q, T2u, T2v, T2y, T3S;
+			      T2n = ri[WS(rs, 12)];
+			      T2o = T2m * T2n;
+			      T2q = ii[WS(rs, 12)];
+			      T3Q = T2m * T2q;
+			      T2u = ri[WS(rs, 17)];
+			      T2v = T2t * T2u;
+			      T2y = ii[WS(rs, 17)];
+			      T3S = T2t * T2y;
+			      T2r = FMA(T2p, T2q, T2o);
+			      T2z = FMA(T2x, T2y, T2v);
+			      T2A = T2r + T2z;
+			      T3R = FNMS(T2p, T2n, T3Q);
+			      T3T = FNMS(T2x, T2u, T3S);
+			      T3U = T3R + T3T;
+			 }
+			 {
+			      E T28, T29, T2b, T3L, T2f, T2g, T2j, T3N;
+			      T28 = ri[WS(rs, 7)];
+			      T29 = T27 * T28;
+			      T2b = ii[WS(rs, 7)];
+			      T3L = T27 * T2b;
+			      T2f = ri[WS(rs, 22)];
+			      T2g = T2e * T2f;
+			      T2j = ii[WS(rs, 22)];
+			      T3N = T2e * T2j;
+			      T2c = FMA(T2a, T2b, T29);
+			      T2k = FMA(T2i, T2j, T2g);
+			      T2l = T2c + T2k;
+			      T3M = FNMS(T2a, T28, T3L);
+			      T3O = FNMS(T2i, T2f, T3N);
+			      T3P = T3M + T3O;
+			 }
+			 {
+			      E T52, T53, T59, T5a;
+			      T52 = T3O - T3M;
+			      T53 = T3R - T3T;
+			      T54 = FNMS(KP618033988, T53, T52);
+			      T6g = FMA(KP618033988, T52, T53);
+			      T59 = T2k - T2c;
+			      T5a = T2z - T2r;
+			      T5b = FMA(KP618033988, T5a, T59);
+			      T6d = FNMS(KP618033988, T59, T5a);
+			 }
+			 {
+			      E T50, T2B, T4Z, T57, T3V, T56;
+			      T50 = T2A - T2l;
+			      T2B = T2l + T2A;
+			      T4Z = FNMS(KP250000000, T2B, T26);
+			      T2C = T26 + T2B;
+			      T6f = FMA(KP559016994, T50, T4Z);
+			      T51 = FNMS(KP559016994, T50, T4Z);
+			      T57 = T3U - T3P;
+			      T3V = T3P + T3U;
+			      T56 = FNMS(KP250000000, T3V, T3K);
+			      T3W = T3K + T3V;
+			      T6c = FMA(KP559016994, T57, T56);
+			      T58 = FNMS(KP559016994, T57, T56);
+			 }
+		    }
+		    {
+			 E T4c, T4e, TN, T3c, T3d, T3e, T4d, T3f;
+			 {
+			      E T3I, T4b, T22, T3b;
+			      T3I = T3t - T3H;
+			      T4b = T3W - T4a;
+			      T4c = FMA(KP618033988, T4b, T3I);
+			      T4e = FNMS(KP618033988, T3I, T4b);
+			      TN = T1 + TM;
+			      T22 = T1v + T21;
+			      T3b = T2C + T3a;
+			      T3c = T22 + T3b;
+			      T3d = FNMS(KP250000000, T3c, TN);
+			      T3e = T22 - T3b;
+			 }
+			 ri[0] = TN + T3c;
+			 T4d = FNMS(KP559016994, T3e, T3d);
+			 ri[WS(rs, 10)] = FNMS(KP951056516, T4e, T4d);
+			 ri[WS(rs, 15)] = FMA(KP951056516, T4e, T4d);
+			 T3f = FMA(KP559016994, T3e, T3d);
+			 ri[WS(rs, 20)] = FNMS(KP951056516, T4c, T3f);
+			 ri[WS(rs, 5)] = FMA(KP951056516, T4c, T3f);
+		    }
+		    {
+			 E T7y, T7A, T7s, T7n, T7t, T7u, T7z, T7v;
+			 {
+			      E T7w, T7x, T7l, T7m;
+			      T7w = T1v - T21;
+			      T7x = T2C - T3a;
+			      T7y = FMA(KP618033988, T7x, T7w);
+			      T7A = FNMS(KP618033988, T7w, T7x);
+			      T7s = T7q + T7r;
+			      T7l = T3t + T3H;
+			      T7m = T3W + T4a;
+			      T7n = T7l + T7m;
+			      T7t = FNMS(KP250000000, T7n, T7s);
+			      T7u = T7l - T7m;
+			 }
+			 ii[0] = T7n + T7s;
+			 T7z = FNMS(KP559016994, T7u, T7t);
+			 ii[WS(rs, 10)] = FMA(KP951056516, T7A, T7z);
+			 ii[WS(rs, 15)] = FNMS(KP951056516, T7A, T7z);
+			 T7v = FMA(KP559016994, T7u, T7t);
+			 ii[WS(rs, 5)] = FNMS(KP951056516, T7y, T7v);
+			 ii[WS(rs, 20)] = FMA(KP951056516, T7y, T7v);
+		    }
+		    {
+			 E T4t, T5H, T7H, T7T, T5A, T5D, T7P, T7O, T7I, T7J, T7K, T4Y, T5t, T5u, T62;
+			 E T65, T81, T80, T7U, T7V, T7W, T5O, T5V, T5W, T4h, T7D;
+			 T4h = FMA(KP559016994, T4g, T4f);
+			 T4t = FMA(KP951056516, T4s, T4h);
+			 T5H = FNMS(KP951056516, T4s, T4h);
+			 T7D = FMA(KP559016994, T7C, T7B);
+			 T7H = FNMS(KP951056516, T7G, T7D);
+			 T7T = FMA(KP951056516, T7G, T7D);
+			 {
+			      E T4I, T5y, T5s, T5C, T4X, T5z, T5d, T5B;
+			      {
+				   E T4A, T4H, T5k, T5r;
+				   T4A = FMA(KP951056516, T4z, T4w);
+				   T4H = FMA(KP951056516, T4G, T4D);
+				   T4I = FMA(KP256756360, T4H, T4A);
+				   T5y = FNMS(KP256756360, T4A, T4H);
+				   T5k = FNMS(KP951056516, T5j, T5g);
+				   T5r = FNMS(KP951056516, T5q, T5n);
+				   T5s = FMA(KP939062505, T5r, T5k);
+				   T5C = FNMS(KP939062505, T5k, T5r);
+			      }
+			      {
+				   E T4P, T4W, T55, T5c;
+				   T4P = FMA(KP951056516, T4O, T4L);
+				   T4W = FNMS(KP951056516, T4V, T4S);
+				   T4X = FMA(KP634619297, T4W, T4P);
+				   T5z = FNMS(KP634619297, T4P, T4W);
+				   T55 = FNMS(KP951056516, T54, T51);
+				   T5c = FMA(KP951056516, T5b, T58);
+				   T5d = FMA(KP549754652, T5c, T55);
+				   T5B = FNMS(KP549754652, T55, T5c);
+			      }
+			      T5A = FMA(KP871714437, T5z, T5y);
+			      T5D = FNMS(KP831864738, T5C, T5B);
+			      T7P = FNMS(KP831864738, T5s, T5d);
+			      T7O = FNMS(KP871714437, T4X, T4I);
+			      T7I = FNMS(KP871714437, T5z, T5y);
+			      T7J = FMA(KP831864738, T5C, T5B);
+			      T7K = FMA(KP904730450, T7J, T7I);
+			      T4Y = FMA(KP871714437, T4X, T4I);
+			      T5t = FMA(KP831864738, T5s, T5d);
+			      T5u = FMA(KP904730450, T5t, T4Y);
+			 }
+			 {
+			      E T5K, T63, T5U, T61, T5N, T64, T5R, T60;
+			      {
+				   E T5I, T5J, T5S, T5T;
+				   T5I = FMA(KP951056516, T5j, T5g);
+				   T5J = FMA(KP951056516, T5q, T5n);
+				   T5K = FNMS(KP126329378, T5J, T5I);
+				   T63 = FMA(KP126329378, T5I, T5J);
+				   T5S = FNMS(KP951056516, T4O, T4L);
+				   T5T = FMA(KP951056516, T4V, T4S);
+				   T5U = FMA(KP827271945, T5T, T5S);
+				   T61 = FNMS(KP827271945, T5S, T5T);
+			      }
+			      {
+				   E T5L, T5M, T5P, T5Q;
+				   T5L = FNMS(KP951056516, T5b, T58);
+				   T5M = FMA(KP951056516, T54, T51);
+				   T5N = FNMS(KP470564281, T5M, T5L);
+				   T64 = FMA(KP470564281, T5L, T5M);
+				   T5P = FNMS(KP951056516, T4G, T4D);
+				   T5Q = FNMS(KP951056516, T4z, T4w);
+				   T5R = FMA(KP634619297, T5Q, T5P);
+				   T60 = FNMS(KP634619297, T5P, T5Q);
+			      }
+			      T62 = FMA(KP912575812, T61, T60);
+			      T65 = FNMS(KP912018591, T64, T63);
+			      T81 = FMA(KP912018591, T5N, T5K);
+			      T80 = FMA(KP912575812, T5U, T5R);
+			      T7U = FMA(KP912018591, T64, T63);
+			      T7V = FNMS(KP912575812, T61, T60);
+			      T7W = FMA(KP851038619, T7V, T7U);
+			      T5O = FNMS(KP912018591, T5N, T5K);
+			      T5V = FNMS(KP912575812, T5U, T5R);
+			      T5W = FNMS(KP851038619, T5V, T5O);
+			 }
+			 ri[WS(rs, 1)] = FMA(KP968583161, T5u, T4t);
+			 ii[WS(rs, 1)] = FMA(KP968583161, T7K, T7H);
+			 ri[WS(rs, 4)] = FNMS(KP992114701, T5W, T5H);
+			 ii[WS(rs, 4)] = FNMS(KP992114701, T7W, T7T);
+			 {
+			      E T5E, T5G, T5x, T5F, T5v, T5w;
+			      T5E = FMA(KP559154169, T5D, T5A);
+			      T5G = FNMS(KP683113946, T5A, T5D);
+			      T5v = FNMS(KP242145790, T5u, T4t);
+			      T5w = FNMS(KP904730450, T5t, T4Y);
+			      T5x = FMA(KP541454447, T5w, T5v);
+			      T5F = FNMS(KP541454447, T5w, T5v);
+			      ri[WS(rs, 6)] = FMA(KP921177326, T5E, T5x);
+			      ri[WS(rs, 16)] = FMA(KP833417178, T5G, T5F);
+			      ri[WS(rs, 21)] = FNMS(KP921177326, T5E, T5x);
+			      ri[WS(rs, 11)] = FNMS(KP833417178, T5G, T5F);
+			 }
+			 {
+			      E T7Q, T7S, T7N, T7R, T7L, T7M;
+			      T7Q = FMA(KP559154169, T7P, T7O);
+			      T7S = FNMS(KP683113946, T7O, T7P);
+			      T7L = FNMS(KP242145790, T7K, T7H);
+			      T7M = FNMS(KP904730450, T7J, T7I);
+			      T7N = FMA(KP541454447, T7M, T7L);
+			      T7R = FNMS(KP541454447, T7M, T7L);
+			      ii[WS(rs, 6)] = FNMS(KP921177326, T7Q, T7N);
+			      ii[WS(rs, 16)] = FNMS(KP833417178, T7S, T7R);
+			      ii[WS(rs, 21)] = FMA(KP921177326, T7Q, T7N);
+			      ii[WS(rs, 11)] = FMA(KP833417178, T7S, T7R);
+			 }
+			 {
+			      E T66, T68, T5Z, T67, T5X, T5Y;
+			      T66 = FNMS(KP726211448, T65, T62);
+			      T68 = FMA(KP525970792, T62, T65);
+			      T5X = FMA(KP248028675, T5W, T5H);
+			      T5Y = FMA(KP851038619, T5V, T5O);
+			      T5Z = FMA(KP554608978, T5Y, T5X);
+			      T67 = FNMS(KP554608978, T5Y, T5X);
+			      ri[WS(rs, 9)] = FNMS(KP803003575, T66, T5Z);
+			      ri[WS(rs, 19)] = FMA(KP943557151, T68, T67);
+			      ri[WS(rs, 24)] = FMA(KP803003575, T66, T5Z);
+			      ri[WS(rs, 14)] = FNMS(KP943557151, T68, T67);
+			 }
+			 {
+			      E T82, T84, T7Z, T83, T7X, T7Y;
+			      T82 = FMA(KP726211448, T81, T80);
+			      T84 = FNMS(KP525970792, T80, T81);
+			      T7X = FMA(KP248028675, T7W, T7T);
+			      T7Y = FNMS(KP851038619, T7V, T7U);
+			      T7Z = FMA(KP554608978, T7Y, T7X);
+			      T83 = FNMS(KP554608978, T7Y, T7X);
+			      ii[WS(rs, 9)] = FNMS(KP803003575, T82, T7Z);
+			      ii[WS(rs, 19)] = FNMS(KP943557151, T84, T83);
+			      ii[WS(rs, 24)] = FMA(KP803003575, T82, T7Z);
+			      ii[WS(rs, 14)] = FMA(KP943557151, T84, T83);
+			 }
+		    }
+		    {
+			 E T6b, T6T, T87, T8j, T6M, T6P, T8r, T8q, T8k, T8l, T8m, T6q, T6F, T6G, T7e;
+			 E T7h, T8f, T8e, T88, T89, T8a, T70, T77, T78, T69, T85;
+			 T69 = FNMS(KP559016994, T4g, T4f);
+			 T6b = FMA(KP951056516, T6a, T69);
+			 T6T = FNMS(KP951056516, T6a, T69);
+			 T85 = FNMS(KP559016994, T7C, T7B);
+			 T87 = FMA(KP951056516, T86, T85);
+			 T8j = FNMS(KP951056516, T86, T85);
+			 {
+			      E T6i, T6N, T6E, T6L, T6p, T6O, T6x, T6K;
+			      {
+				   E T6e, T6h, T6A, T6D;
+				   T6e = FMA(KP951056516, T6d, T6c);
+				   T6h = FMA(KP951056516, T6g, T6f);
+				   T6i = FMA(KP062914667, T6h, T6e);
+				   T6N = FNMS(KP062914667, T6e, T6h);
+				   T6A = FNMS(KP951056516, T6z, T6y);
+				   T6D = FMA(KP951056516, T6C, T6B);
+				   T6E = FMA(KP939062505, T6D, T6A);
+				   T6L = FNMS(KP939062505, T6A, T6D);
+			      }
+			      {
+				   E T6l, T6o, T6t, T6w;
+				   T6l = FNMS(KP951056516, T6k, T6j);
+				   T6o = FNMS(KP951056516, T6n, T6m);
+				   T6p = FNMS(KP827271945, T6o, T6l);
+				   T6O = FMA(KP827271945, T6l, T6o);
+				   T6t = FNMS(KP951056516, T6s, T6r);
+				   T6w = FMA(KP951056516, T6v, T6u);
+				   T6x = FNMS(KP126329378, T6w, T6t);
+				   T6K = FMA(KP126329378, T6t, T6w);
+			      }
+			      T6M = FMA(KP734762448, T6L, T6K);
+			      T6P = FNMS(KP772036680, T6O, T6N);
+			      T8r = FNMS(KP772036680, T6p, T6i);
+			      T8q = FMA(KP734762448, T6E, T6x);
+			      T8k = FMA(KP772036680, T6O, T6N);
+			      T8l = FNMS(KP734762448, T6L, T6K);
+			      T8m = FMA(KP994076283, T8l, T8k);
+			      T6q = FMA(KP772036680, T6p, T6i);
+			      T6F = FNMS(KP734762448, T6E, T6x);
+			      T6G = FNMS(KP994076283, T6F, T6q);
+			 }
+			 {
+			      E T6W, T7f, T76, T7d, T6Z, T7g, T73, T7c;
+			      {
+				   E T6U, T6V, T74, T75;
+				   T6U = FMA(KP951056516, T6k, T6j);
+				   T6V = FMA(KP951056516, T6n, T6m);
+				   T6W = FMA(KP062914667, T6V, T6U);
+				   T7f = FNMS(KP062914667, T6U, T6V);
+				   T74 = FMA(KP951056516, T6z, T6y);
+				   T75 = FNMS(KP951056516, T6C, T6B);
+				   T76 = FMA(KP549754652, T75, T74);
+				   T7d = FNMS(KP549754652, T74, T75);
+			      }
+			      {
+				   E T6X, T6Y, T71, T72;
+				   T6X = FNMS(KP951056516, T6d, T6c);
+				   T6Y = FNMS(KP951056516, T6g, T6f);
+				   T6Z = FMA(KP634619297, T6Y, T6X);
+				   T7g = FNMS(KP634619297, T6X, T6Y);
+				   T71 = FNMS(KP951056516, T6v, T6u);
+				   T72 = FMA(KP951056516, T6s, T6r);
+				   T73 = FNMS(KP470564281, T72, T71);
+				   T7c = FMA(KP470564281, T71, T72);
+			      }
+			      T7e = FMA(KP968479752, T7d, T7c);
+			      T7h = FNMS(KP845997307, T7g, T7f);
+			      T8f = FNMS(KP845997307, T6Z, T6W);
+			      T8e = FNMS(KP968479752, T76, T73);
+			      T88 = FMA(KP845997307, T7g, T7f);
+			      T89 = FNMS(KP968479752, T7d, T7c);
+			      T8a = FMA(KP906616052, T89, T88);
+			      T70 = FMA(KP845997307, T6Z, T6W);
+			      T77 = FMA(KP968479752, T76, T73);
+			      T78 = FMA(KP906616052, T77, T70);
+			 }
+			 ri[WS(rs, 3)] = FMA(KP998026728, T6G, T6b);
+			 ii[WS(rs, 3)] = FNMS(KP998026728, T8m, T8j);
+			 ri[WS(rs, 2)] = FMA(KP998026728, T78, T6T);
+			 ii[WS(rs, 2)] = FNMS(KP998026728, T8a, T87);
+			 {
+			      E T6Q, T6S, T6J, T6R, T6H, T6I;
+			      T6Q = FNMS(KP621716863, T6P, T6M);
+			      T6S = FMA(KP614372930, T6M, T6P);
+			      T6H = FNMS(KP249506682, T6G, T6b);
+			      T6I = FMA(KP994076283, T6F, T6q);
+			      T6J = FNMS(KP557913902, T6I, T6H);
+			      T6R = FMA(KP557913902, T6I, T6H);
+			      ri[WS(rs, 23)] = FNMS(KP943557151, T6Q, T6J);
+			      ri[WS(rs, 13)] = FMA(KP949179823, T6S, T6R);
+			      ri[WS(rs, 8)] = FMA(KP943557151, T6Q, T6J);
+			      ri[WS(rs, 18)] = FNMS(KP949179823, T6S, T6R);
+			 }
+			 {
+			      E T8s, T8u, T8p, T8t, T8n, T8o;
+			      T8s = FMA(KP621716863, T8r, T8q);
+			      T8u = FNMS(KP614372930, T8q, T8r);
+			      T8n = FMA(KP249506682, T8m, T8j);
+			      T8o = FNMS(KP994076283, T8l, T8k);
+			      T8p = FMA(KP557913902, T8o, T8n);
+			      T8t = FNMS(KP557913902, T8o, T8n);
+			      ii[WS(rs, 8)] = FNMS(KP943557151, T8s, T8p);
+			      ii[WS(rs, 18)] = FNMS(KP949179823, T8u, T8t);
+			      ii[WS(rs, 23)] = FMA(KP943557151, T8s, T8p);
+			      ii[WS(rs, 13)] = FMA(KP949179823, T8u, T8t);
+			 }
+			 {
+			      E T7i, T7k, T7b, T7j, T79, T7a;
+			      T7i = FMA(KP681693190, T7h, T7e);
+			      T7k = FNMS(KP560319534, T7e, T7h);
+			      T79 = FNMS(KP249506682, T78, T6T);
+			      T7a = FNMS(KP906616052, T77, T70);
+			      T7b = FNMS(KP557913902, T7a, T79);
+			      T7j = FMA(KP557913902, T7a, T79);
+			      ri[WS(rs, 22)] = FNMS(KP860541664, T7i, T7b);
+			      ri[WS(rs, 17)] = FMA(KP949179823, T7k, T7j);
+			      ri[WS(rs, 7)] = FMA(KP860541664, T7i, T7b);
+			      ri[WS(rs, 12)] = FNMS(KP949179823, T7k, T7j);
+			 }
+			 {
+			      E T8g, T8i, T8d, T8h, T8b, T8c;
+			      T8g = FMA(KP681693190, T8f, T8e);
+			      T8i = FNMS(KP560319534, T8e, T8f);
+			      T8b = FMA(KP249506682, T8a, T87);
+			      T8c = FNMS(KP906616052, T89, T88);
+			      T8d = FMA(KP557913902, T8c, T8b);
+			      T8h = FNMS(KP557913902, T8c, T8b);
+			      ii[WS(rs, 7)] = FMA(KP860541664, T8g, T8d);
+			      ii[WS(rs, 17)] = FMA(KP949179823, T8i, T8h);
+			      ii[WS(rs, 22)] = FNMS(KP860541664, T8g, T8d);
+			      ii[WS(rs, 12)] = FNMS(KP949179823, T8i, T8h);
+			 }
+		    }
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_CEXP, 0, 1 },
+     { TW_CEXP, 0, 3 },
+     { TW_CEXP, 0, 9 },
+     { TW_CEXP, 0, 24 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 25, "t2_25", twinstr, &GENUS, { 84, 78, 356, 0 }, 0, 0, 0 };
+
+void X(codelet_t2_25) (planner *p) {
+     X(kdft_dit_register) (p, t2_25, &desc);
+}
+#else
+
+/* Generated by: ../../../genfft/gen_twiddle.native -compact -variables 4 -pipeline-latency 4 -twiddle-log3 -precompute-twiddles -n 25 -name t2_25 -include dft/scalar/t.h */
+
+/*
+ * This function contains 440 FP additions, 340 FP multiplications,
+ * (or, 280 additions, 180 multiplications, 160 fused multiply/add),
+ * 149 stack variables, 20 constants, and 100 memory accesses
+ */
+#include "dft/scalar/t.h"
+
+static void t2_25(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DK(KP998026728, +0.998026728428271561952336806863450553336905220);
+     DK(KP062790519, +0.062790519529313376076178224565631133122484832);
+     DK(KP425779291, +0.425779291565072648862502445744251703979973042);
+     DK(KP904827052, +0.904827052466019527713668647932697593970413911);
+     DK(KP992114701, +0.992114701314477831049793042785778521453036709);
+     DK(KP125333233, +0.125333233564304245373118759816508793942918247);
+     DK(KP637423989, +0.637423989748689710176712811676016195434917298);
+     DK(KP770513242, +0.770513242775789230803009636396177847271667672);
+     DK(KP684547105, +0.684547105928688673732283357621209269889519233);
+     DK(KP728968627, +0.728968627421411523146730319055259111372571664);
+     DK(KP481753674, +0.481753674101715274987191502872129653528542010);
+     DK(KP876306680, +0.876306680043863587308115903922062583399064238);
+     DK(KP844327925, +0.844327925502015078548558063966681505381659241);
+     DK(KP535826794, +0.535826794978996618271308767867639978063575346);
+     DK(KP248689887, +0.248689887164854788242283746006447968417567406);
+     DK(KP968583161, +0.968583161128631119490168375464735813836012403);
+     DK(KP587785252, +0.587785252292473129168705954639072768597652438);
+     DK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     {
+	  INT m;
+	  for (m = mb, W = W + (mb * 8); m < me; m = m + 1, ri = ri + ms, ii = ii + ms, W = W + 8, MAKE_VOLATILE_STRIDE(50, rs)) {
+	       E T2, T5, T3, T6, T8, Td, T16, T14, Te, T9, T21, T23, Tx, TR, T1g;
+	       E TB, T1f, TV, T1Q, Tg, T1S, Tk, T18, T2s, T1c, T2q, Tn, To, Tp, Tr;
+	       E T28, T2x, TY, T2k, T2m, T2v, TG, TE, T10, T1h, T1E, T26, T1B, T1G, T1V;
+	       E T1X, T1z, T1j;
+	       {
+		    E Tw, TT, Tz, TQ, Tv, TU, TA, TP;
+		    {
+			 E T4, Tc, T7, Tb;
+			 T2 = W[0];
+			 T5 = W[1];
+			 T3 = W[2];
+			 T6 = W[3];
+			 T4 = T2 * T3;
+			 Tc = T5 * T3;
+			 T7 = T5 * T6;
+			 Tb = T2 * T6;
+			 T8 = T4 - T7;
+			 Td = Tb + Tc;
+			 T16 = Tb - Tc;
+			 T14 = T4 + T7;
+			 Te = W[5];
+			 Tw = T5 * Te;
+			 TT = T3 * Te;
+			 Tz = T2 * Te;
+			 TQ = T6 * Te;
+			 T9 = W[4];
+			 Tv = T2 * T9;
+			 TU = T6 * T9;
+			 TA = T5 * T9;
+			 TP = T3 * T9;
+		    }
+		    T21 = TP - TQ;
+		    T23 = TT + TU;
+		    {
+			 E T15, T17, Ta, Tf, T1a, T1b, Ti, Tj;
+			 Tx = Tv - Tw;
+			 TR = TP + TQ;
+			 T1g = Tz - TA;
+			 TB = Tz + TA;
+			 T1f = Tv + Tw;
+			 TV = TT - TU;
+			 T15 = T14 * T9;
+			 T17 = T16 * Te;
+			 T1Q = T15 + T17;
+			 Ta = T8 * T9;
+			 Tf = Td * Te;
+			 Tg = Ta + Tf;
+			 T1a = T14 * Te;
+			 T1b = T16 * T9;
+			 T1S = T1a - T1b;
+			 Ti = T8 * Te;
+			 Tj = Td * T9;
+			 Tk = Ti - Tj;
+			 T18 = T15 - T17;
+			 T2s = Ti + Tj;
+			 T1c = T1a + T1b;
+			 T2q = Ta - Tf;
+			 Tn = W[6];
+			 To = W[7];
+			 Tp = FMA(T8, Tn, Td * To);
+			 Tr = FNMS(Td, Tn, T8 * To);
+			 T28 = FNMS(T1S, Tn, T1Q * To);
+			 T2x = FNMS(TV, Tn, TR * To);
+			 TY = FMA(T3, Tn, T6 * To);
+			 T2k = FMA(T2, Tn, T5 * To);
+			 T2m = FNMS(T5, Tn, T2 * To);
+			 T2v = FMA(TR, Tn, TV * To);
+			 TG = FNMS(Te, Tn, T9 * To);
+			 TE = FMA(T9, Tn, Te * To);
+			 T10 = FNMS(T6, Tn, T3 * To);
+			 T1h = FMA(T1f, Tn, T1g * To);
+			 T1E = FMA(Tg, Tn, Tk * To);
+			 T26 = FMA(T1Q, Tn, T1S * To);
+			 T1B = FNMS(TB, Tn, Tx * To);
+			 T1G = FNMS(Tk, Tn, Tg * To);
+			 T1V = FMA(T14, Tn, T16 * To);
+			 T1X = FNMS(T16, Tn, T14 * To);
+			 T1z = FMA(Tx, Tn, TB * To);
+			 T1j = FNMS(T1g, Tn, T1f * To);
+		    }
+	       }
+	       {
+		    E T1, T6v, T2F, T6I, TK, T2G, T6u, T6J, T6N, T7c, T2O, T52, T2C, T6k, T48;
+		    E T5X, T4L, T5s, T4j, T5W, T4K, T5v, T1o, T6g, T30, T5M, T4A, T56, T3b, T5N;
+		    E T4B, T59, T1L, T6h, T3n, T5Q, T4D, T5g, T3y, T5P, T4E, T5d, T2d, T6j, T3L;
+		    E T5T, T4I, T5l, T3W, T5U, T4H, T5o;
+		    {
+			 E Tm, T2I, Tt, T2J, Tu, T6s, TD, T2L, TI, T2M, TJ, T6t;
+			 T1 = ri[0];
+			 T6v = ii[0];
+			 {
+			      E Th, Tl, Tq, Ts;
+			      Th = ri[WS(rs, 5)];
+			      Tl = ii[WS(rs, 5)];
+			      Tm = FMA(Tg, Th, Tk * Tl);
+			      T2I = FNMS(Tk, Th, Tg * Tl);
+			      Tq = ri[WS(rs, 20)];
+			      Ts = ii[WS(rs, 20)];
+			      Tt = FMA(Tp, Tq, Tr * Ts);
+			      T2J = FNMS(Tr, Tq, Tp * Ts);
+			 }
+			 Tu = Tm + Tt;
+			 T6s = T2I + T2J;
+			 {
+			      E Ty, TC, TF, TH;
+			      Ty = ri[WS(rs, 10)];
+			      TC = ii[WS(rs, 10)];
+			      TD = FMA(Tx, Ty, TB * TC);
+			      T2L = FNMS(TB, Ty, Tx * TC);
+			      TF = ri[WS(rs, 15)];
+			      TH = ii[WS(rs, 15)];
+			      TI = FMA(TE, TF, TG * TH);
+			      T2M = FNMS(TG, TF, TE * TH);
+			 }
+			 TJ = TD + TI;
+			 T6t = T2L + T2M;
+			 T2F = KP559016994 * (Tu - TJ);
+			 T6I = KP559016994 * (T6s - T6t);
+			 TK = Tu + TJ;
+			 T2G = FNMS(KP250000000, TK, T1);
+			 T6u = T6s + T6t;
+			 T6J = FNMS(KP250000000, T6u, T6v);
+			 {
+			      E T6L, T6M, T2K, T2N;
+			      T6L = Tm - Tt;
+			      T6M = TD - TI;
+			      T6N = FMA(KP951056516, T6L, KP587785252 * T6M);
+			      T7c = FNMS(KP587785252, T6L, KP951056516 * T6M);
+			      T2K = T2I - T2J;
+			      T2N = T2L - T2M;
+			      T2O = FMA(KP951056516, T2K, KP587785252 * T2N);
+			      T52 = FNMS(KP587785252, T2K, KP951056516 * T2N);
+			 }
+		    }
+		    {
+			 E T2g, T4c, T43, T46, T4h, T4g, T49, T4a, T4d, T2p, T2A, T2B, T2e, T2f;
+			 T2e = ri[WS(rs, 3)];
+			 T2f = ii[WS(rs, 3)];
+			 T2g = FMA(T3, T2e, T6 * T2f);
+			 T4c = FNMS(T6, T2e, T3 * T2f);
+			 {
+			      E T2j, T41, T2z, T45, T2o, T42, T2u, T44;
+			      {
+				   E T2h, T2i, T2w, T2y;
+				   T2h = ri[WS(rs, 8)];
+				   T2i = ii[WS(rs, 8)];
+				   T2j = FMA(T1f, T2h, T1g * T2i);
+				   T41 = FNMS(T1g, T2h, T1f * T2i);
+				   T2w = ri[WS(rs, 18)];
+				   T2y = ii[WS(rs, 18)];
+				   T2z = FMA(T2v, T2w, T2x * T2y);
+				   T45 = FNMS(T2x, T2w, T2v * T2y);
+			      }
+			      {
+				   E T2l, T2n, T2r, T2t;
+				   T2l = ri[WS(rs, 23)];
+				   T2n = ii[WS(rs, 23)];
+				   T2o = FMA(T2k, T2l, T2m * T2n);
+				   T42 = FNMS(T2m, T2l, T2k * T2n);
+				   T2r = ri[WS(rs, 13)];
+				   T2t = ii[WS(rs, 13)];
+				   T2u = FMA(T2q, T2r, T2s * T2t);
+				   T44 = FNMS(T2s, T2r, T2q * T2t);
+			      }
+			      T43 = T41 - T42;
+			      T46 = T44 - T45;
+			      T4h = T2u - T2z;
+			      T4g = T2j - T2o;
+			      T49 = T41 + T42;
+			      T4a = T44 + T45;
+			      T4d = T49 + T4a;
+			      T2p = T2j + T2o;
+			      T2A = T2u + T2z;
+			      T2B = T2p + T2A;
+			 }
+			 T2C = T2g + T2B;
+			 T6k = T4c + T4d;
+			 {
+			      E T47, T5r, T40, T5q, T3Y, T3Z;
+			      T47 = FMA(KP951056516, T43, KP587785252 * T46);
+			      T5r = FNMS(KP587785252, T43, KP951056516 * T46);
+			      T3Y = KP559016994 * (T2p - T2A);
+			      T3Z = FNMS(KP250000000, T2B, T2g);
+			      T40 = T3Y + T3Z;
+			      T5q = T3Z - T3Y;
+			      T48 = T40 + T47;
+			      T5X = T5q + T5r;
+			      T4L = T40 - T47;
+			      T5s = T5q - T5r;
+			 }
+			 {
+			      E T4i, T5t, T4f, T5u, T4b, T4e;
+			      T4i = FMA(KP951056516, T4g, KP587785252 * T4h);
+			      T5t = FNMS(KP587785252, T4g, KP951056516 * T4h);
+			      T4b = KP559016994 * (T49 - T4a);
+			      T4e = FNMS(KP250000000, T4d, T4c);
+			      T4f = T4b + T4e;
+			      T5u = T4e - T4b;
+			      T4j = T4f - T4i;
+			      T5W = T5u - T5t;
+			      T4K = T4i + T4f;
+			      T5v = T5t + T5u;
+			 }
+		    }
+		    {
+			 E TO, T34, T2V, T2Y, T39, T38, T31, T32, T35, T13, T1m, T1n, TM, TN;
+			 TM = ri[WS(rs, 1)];
+			 TN = ii[WS(rs, 1)];
+			 TO = FMA(T2, TM, T5 * TN);
+			 T34 = FNMS(T5, TM, T2 * TN);
+			 {
+			      E TX, T2T, T1l, T2X, T12, T2U, T1e, T2W;
+			      {
+				   E TS, TW, T1i, T1k;
+				   TS = ri[WS(rs, 6)];
+				   TW = ii[WS(rs, 6)];
+				   TX = FMA(TR, TS, TV * TW);
+				   T2T = FNMS(TV, TS, TR * TW);
+				   T1i = ri[WS(rs, 16)];
+				   T1k = ii[WS(rs, 16)];
+				   T1l = FMA(T1h, T1i, T1j * T1k);
+				   T2X = FNMS(T1j, T1i, T1h * T1k);
+			      }
+			      {
+				   E TZ, T11, T19, T1d;
+				   TZ = ri[WS(rs, 21)];
+				   T11 = ii[WS(rs, 21)];
+				   T12 = FMA(TY, TZ, T10 * T11);
+				   T2U = FNMS(T10, TZ, TY * T11);
+				   T19 = ri[WS(rs, 11)];
+				   T1d = ii[WS(rs, 11)];
+				   T1e = FMA(T18, T19, T1c * T1d);
+				   T2W = FNMS(T1c, T19, T18 * T1d);
+			      }
+			      T2V = T2T - T2U;
+			      T2Y = T2W - T2X;
+			      T39 = T1e - T1l;
+			      T38 = TX - T12;
+			      T31 = T2T + T2U;
+			      T32 = T2W + T2X;
+			      T35 = T31 + T32;
+			      T13 = TX + T12;
+			      T1m = T1e + T1l;
+			      T1n = T13 + T1m;
+			 }
+			 T1o = TO + T1n;
+			 T6g = T34 + T35;
+			 {
+			      E T2Z, T55, T2S, T54, T2Q, T2R;
+			      T2Z = FMA(KP951056516, T2V, KP587785252 * T2Y);
+			      T55 = FNMS(KP587785252, T2V, KP951056516 * T2Y);
+			      T2Q = KP559016994 * (T13 - T1m);
+			      T2R = FNMS(KP250000000, T1n, TO);
+			      T2S = T2Q + T2R;
+			      T54 = T2R - T2Q;
+			      T30 = T2S + T2Z;
+			      T5M = T54 + T55;
+			      T4A = T2S - T2Z;
+			      T56 = T54 - T55;
+			 }
+			 {
+			      E T3a, T57, T37, T58, T33, T36;
+			      T3a = FMA(KP951056516, T38, KP587785252 * T39);
+			      T57 = FNMS(KP587785252, T38, KP951056516 * T39);
+			      T33 = KP559016994 * (T31 - T32);
+			      T36 = FNMS(KP250000000, T35, T34);
+			      T37 = T33 + T36;
+			      T58 = T36 - T33;
+			      T3b = T37 - T3a;
+			      T5N = T58 - T57;
+			      T4B = T3a + T37;
+			      T59 = T57 + T58;
+			 }
+		    }
+		    {
+			 E T1r, T3r, T3i, T3l, T3w, T3v, T3o, T3p, T3s, T1y, T1J, T1K, T1p, T1q;
+			 T1p = ri[WS(rs, 4)];
+			 T1q = ii[WS(rs, 4)];
+			 T1r = FMA(T8, T1p, Td * T1q);
+			 T3r = FNMS(Td, T1p, T8 * T1q);
+			 {
+			      E T1u, T3g, T1I, T3k, T1x, T3h, T1D, T3j;
+			      {
+				   E T1s, T1t, T1F, T1H;
+				   T1s = ri[WS(rs, 9)];
+				   T1t = ii[WS(rs, 9)];
+				   T1u = FMA(T9, T1s, Te * T1t);
+				   T3g = FNMS(Te, T1s, T9 * T1t);
+				   T1F = ri[WS(rs, 19)];
+				   T1H = ii[WS(rs, 19)];
+				   T1I = FMA(T1E, T1F, T1G * T1H);
+				   T3k = FNMS(T1G, T1F, T1E * T1H);
+			      }
+			      {
+				   E T1v, T1w, T1A, T1C;
+				   T1v = ri[WS(rs, 24)];
+				   T1w = ii[WS(rs, 24)];
+				   T1x = FMA(Tn, T1v, To * T1w);
+				   T3h = FNMS(To, T1v, Tn * T1w);
+				   T1A = ri[WS(rs, 14)];
+				   T1C = ii[WS(rs, 14)];
+				   T1D = FMA(T1z, T1A, T1B * T1C);
+				   T3j = FNMS(T1B, T1A, T1z * T1C);
+			      }
+			      T3i = T3g - T3h;
+			      T3l = T3j - T3k;
+			      T3w = T1D - T1I;
+			      T3v = T1u - T1x;
+			      T3o = T3g + T3h;
+			      T3p = T3j + T3k;
+			      T3s = T3o + T3p;
+			      T1y = T1u + T1x;
+			      T1J = T1D + T1I;
+			      T1K = T1y + T1J;
+			 }
+			 T1L = T1r + T1K;
+			 T6h = T3r + T3s;
+			 {
+			      E T3m, T5f, T3f, T5e, T3d, T3e;
+			      T3m = FMA(KP951056516, T3i, KP587785252 * T3l);
+			      T5f = FNMS(KP587785252, T3i, KP951056516 * T3l);
+			      T3d = KP559016994 * (T1y - T1J);
+			      T3e = FNMS(KP250000000, T1K, T1r);
+			      T3f = T3d + T3e;
+			      T5e = T3e - T3d;
+			      T3n = T3f + T3m;
+			      T5Q = T5e + T5f;
+			      T4D = T3f - T3m;
+			      T5g = T5e - T5f;
+			 }
+			 {
+			      E T3x, T5b, T3u, T5c, T3q, T3t;
+			      T3x = FMA(KP951056516, T3v, KP587785252 * T3w);
+			      T5b = FNMS(KP587785252, T3v, KP951056516 * T3w);
+			      T3q = KP559016994 * (T3o - T3p);
+			      T3t = FNMS(KP250000000, T3s, T3r);
+			      T3u = T3q + T3t;
+			      T5c = T3t - T3q;
+			      T3y = T3u - T3x;
+			      T5P = T5c - T5b;
+			      T4E = T3x + T3u;
+			      T5d = T5b + T5c;
+			 }
+		    }
+		    {
+			 E T1P, T3P, T3G, T3J, T3U, T3T, T3M, T3N, T3Q, T20, T2b, T2c, T1N, T1O;
+			 T1N = ri[WS(rs, 2)];
+			 T1O = ii[WS(rs, 2)];
+			 T1P = FMA(T14, T1N, T16 * T1O);
+			 T3P = FNMS(T16, T1N, T14 * T1O);
+			 {
+			      E T1U, T3E, T2a, T3I, T1Z, T3F, T25, T3H;
+			      {
+				   E T1R, T1T, T27, T29;
+				   T1R = ri[WS(rs, 7)];
+				   T1T = ii[WS(rs, 7)];
+				   T1U = FMA(T1Q, T1R, T1S * T1T);
+				   T3E = FNMS(T1S, T1R, T1Q * T1T);
+				   T27 = ri[WS(rs, 17)];
+				   T29 = ii[WS(rs, 17)];
+				   T2a = FMA(T26, T27, T28 * T29);
+				   T3I = FNMS(T28, T27, T26 * T29);
+			      }
+			      {
+				   E T1W, T1Y, T22, T24;
+				   T1W = ri[WS(rs, 22)];
+				   T1Y = ii[WS(rs, 22)];
+				   T1Z = FMA(T1V, T1W, T1X * T1Y);
+				   T3F = FNMS(T1X, T1W, T1V * T1Y);
+				   T22 = ri[WS(rs, 12)];
+				   T24 = ii[WS(rs, 12)];
+				   T25 = FMA(T21, T22, T23 * T24);
+				   T3H = FNMS(T23, T22, T21 * T24);
+			      }
+			      T3G = T3E - T3F;
+			      T3J = T3H - T3I;
+			      T3U = T25 - T2a;
+			      T3T = T1U - T1Z;
+			      T3M = T3E + T3F;
+			      T3N = T3H + T3I;
+			      T3Q = T3M + T3N;
+			      T20 = T1U + T1Z;
+			      T2b = T25 + T2a;
+			      T2c = T20 + T2b;
+			 }
+			 T2d = T1P + T2c;
+			 T6j = T3P + T3Q;
+			 {
+			      E T3K, T5k, T3D, T5j, T3B, T3C;
+			      T3K = FMA(KP951056516, T3G, KP587785252 * T3J);
+			      T5k = FNMS(KP587785252, T3G, KP951056516 * T3J);
+			      T3B = KP559016994 * (T20 - T2b);
+			      T3C = FNMS(KP250000000, T2c, T1P);
+			      T3D = T3B + T3C;
+			      T5j = T3C - T3B;
+			      T3L = T3D + T3K;
+			      T5T = T5j + T5k;
+			      T4I = T3D - T3K;
+			      T5l = T5j - T5k;
+			 }
+			 {
+			      E T3V, T5m, T3S, T5n, T3O, T3R;
+			      T3V = FMA(KP951056516, T3T, KP587785252 * T3U);
+			      T5m = FNMS(KP587785252, T3T, KP951056516 * T3U);
+			      T3O = KP559016994 * (T3M - T3N);
+			      T3R = FNMS(KP250000000, T3Q, T3P);
+			      T3S = T3O + T3R;
+			      T5n = T3R - T3O;
+			      T3W = T3S - T3V;
+			      T5U = T5n - T5m;
+			      T4H = T3V + T3S;
+			      T5o = T5m + T5n;
+			 }
+		    }
+		    {
+			 E T6m, T6o, TL, T2E, T6d, T6e, T6n, T6f;
+			 {
+			      E T6i, T6l, T1M, T2D;
+			      T6i = T6g - T6h;
+			      T6l = T6j - T6k;
+			      T6m = FMA(KP951056516, T6i, KP587785252 * T6l);
+			      T6o = FNMS(KP587785252, T6i, KP951056516 * T6l);
+			      TL = T1 + TK;
+			      T1M = T1o + T1L;
+			      T2D = T2d + T2C;
+			      T2E = T1M + T2D;
+			      T6d = KP559016994 * (T1M - T2D);
+			      T6e = FNMS(KP250000000, T2E, TL);
+			 }
+			 ri[0] = TL + T2E;
+			 T6n = T6e - T6d;
+			 ri[WS(rs, 10)] = T6n - T6o;
+			 ri[WS(rs, 15)] = T6n + T6o;
+			 T6f = T6d + T6e;
+			 ri[WS(rs, 20)] = T6f - T6m;
+			 ri[WS(rs, 5)] = T6f + T6m;
+		    }
+		    {
+			 E T6C, T6D, T6w, T6r, T6x, T6y, T6E, T6z;
+			 {
+			      E T6A, T6B, T6p, T6q;
+			      T6A = T1o - T1L;
+			      T6B = T2d - T2C;
+			      T6C = FMA(KP951056516, T6A, KP587785252 * T6B);
+			      T6D = FNMS(KP587785252, T6A, KP951056516 * T6B);
+			      T6w = T6u + T6v;
+			      T6p = T6g + T6h;
+			      T6q = T6j + T6k;
+			      T6r = T6p + T6q;
+			      T6x = KP559016994 * (T6p - T6q);
+			      T6y = FNMS(KP250000000, T6r, T6w);
+			 }
+			 ii[0] = T6r + T6w;
+			 T6E = T6y - T6x;
+			 ii[WS(rs, 10)] = T6D + T6E;
+			 ii[WS(rs, 15)] = T6E - T6D;
+			 T6z = T6x + T6y;
+			 ii[WS(rs, 5)] = T6z - T6C;
+			 ii[WS(rs, 20)] = T6C + T6z;
+		    }
+		    {
+			 E T2P, T4z, T6O, T70, T4m, T6T, T4n, T6S, T4U, T71, T4X, T6Z, T4O, T75, T4P;
+			 E T74, T4s, T6P, T4v, T6H, T2H, T6K;
+			 T2H = T2F + T2G;
+			 T2P = T2H + T2O;
+			 T4z = T2H - T2O;
+			 T6K = T6I + T6J;
+			 T6O = T6K - T6N;
+			 T70 = T6N + T6K;
+			 {
+			      E T3c, T3z, T3A, T3X, T4k, T4l;
+			      T3c = FMA(KP968583161, T30, KP248689887 * T3b);
+			      T3z = FMA(KP535826794, T3n, KP844327925 * T3y);
+			      T3A = T3c + T3z;
+			      T3X = FMA(KP876306680, T3L, KP481753674 * T3W);
+			      T4k = FMA(KP728968627, T48, KP684547105 * T4j);
+			      T4l = T3X + T4k;
+			      T4m = T3A + T4l;
+			      T6T = T3X - T4k;
+			      T4n = KP559016994 * (T3A - T4l);
+			      T6S = T3c - T3z;
+			 }
+			 {
+			      E T4S, T4T, T6X, T4V, T4W, T6Y;
+			      T4S = FNMS(KP844327925, T4A, KP535826794 * T4B);
+			      T4T = FNMS(KP637423989, T4E, KP770513242 * T4D);
+			      T6X = T4S + T4T;
+			      T4V = FMA(KP125333233, T4L, KP992114701 * T4K);
+			      T4W = FMA(KP904827052, T4I, KP425779291 * T4H);
+			      T6Y = T4W + T4V;
+			      T4U = T4S - T4T;
+			      T71 = KP559016994 * (T6X + T6Y);
+			      T4X = T4V - T4W;
+			      T6Z = T6X - T6Y;
+			 }
+			 {
+			      E T4C, T4F, T4G, T4J, T4M, T4N;
+			      T4C = FMA(KP535826794, T4A, KP844327925 * T4B);
+			      T4F = FMA(KP637423989, T4D, KP770513242 * T4E);
+			      T4G = T4C - T4F;
+			      T4J = FNMS(KP425779291, T4I, KP904827052 * T4H);
+			      T4M = FNMS(KP992114701, T4L, KP125333233 * T4K);
+			      T4N = T4J + T4M;
+			      T4O = T4G + T4N;
+			      T75 = T4J - T4M;
+			      T4P = KP559016994 * (T4G - T4N);
+			      T74 = T4C + T4F;
+			 }
+			 {
+			      E T4q, T4r, T6F, T4t, T4u, T6G;
+			      T4q = FNMS(KP248689887, T30, KP968583161 * T3b);
+			      T4r = FNMS(KP844327925, T3n, KP535826794 * T3y);
+			      T6F = T4q + T4r;
+			      T4t = FNMS(KP481753674, T3L, KP876306680 * T3W);
+			      T4u = FNMS(KP684547105, T48, KP728968627 * T4j);
+			      T6G = T4t + T4u;
+			      T4s = T4q - T4r;
+			      T6P = KP559016994 * (T6F - T6G);
+			      T4v = T4t - T4u;
+			      T6H = T6F + T6G;
+			 }
+			 ri[WS(rs, 1)] = T2P + T4m;
+			 ii[WS(rs, 1)] = T6H + T6O;
+			 ri[WS(rs, 4)] = T4z + T4O;
+			 ii[WS(rs, 4)] = T6Z + T70;
+			 {
+			      E T4w, T4y, T4p, T4x, T4o;
+			      T4w = FMA(KP951056516, T4s, KP587785252 * T4v);
+			      T4y = FNMS(KP587785252, T4s, KP951056516 * T4v);
+			      T4o = FNMS(KP250000000, T4m, T2P);
+			      T4p = T4n + T4o;
+			      T4x = T4o - T4n;
+			      ri[WS(rs, 21)] = T4p - T4w;
+			      ri[WS(rs, 16)] = T4x + T4y;
+			      ri[WS(rs, 6)] = T4p + T4w;
+			      ri[WS(rs, 11)] = T4x - T4y;
+			 }
+			 {
+			      E T6U, T6V, T6R, T6W, T6Q;
+			      T6U = FMA(KP951056516, T6S, KP587785252 * T6T);
+			      T6V = FNMS(KP587785252, T6S, KP951056516 * T6T);
+			      T6Q = FNMS(KP250000000, T6H, T6O);
+			      T6R = T6P + T6Q;
+			      T6W = T6Q - T6P;
+			      ii[WS(rs, 6)] = T6R - T6U;
+			      ii[WS(rs, 16)] = T6W - T6V;
+			      ii[WS(rs, 21)] = T6U + T6R;
+			      ii[WS(rs, 11)] = T6V + T6W;
+			 }
+			 {
+			      E T4Y, T50, T4R, T4Z, T4Q;
+			      T4Y = FMA(KP951056516, T4U, KP587785252 * T4X);
+			      T50 = FNMS(KP587785252, T4U, KP951056516 * T4X);
+			      T4Q = FNMS(KP250000000, T4O, T4z);
+			      T4R = T4P + T4Q;
+			      T4Z = T4Q - T4P;
+			      ri[WS(rs, 24)] = T4R - T4Y;
+			      ri[WS(rs, 19)] = T4Z + T50;
+			      ri[WS(rs, 9)] = T4R + T4Y;
+			      ri[WS(rs, 14)] = T4Z - T50;
+			 }
+			 {
+			      E T76, T77, T73, T78, T72;
+			      T76 = FMA(KP951056516, T74, KP587785252 * T75);
+			      T77 = FNMS(KP587785252, T74, KP951056516 * T75);
+			      T72 = FNMS(KP250000000, T6Z, T70);
+			      T73 = T71 + T72;
+			      T78 = T72 - T71;
+			      ii[WS(rs, 9)] = T73 - T76;
+			      ii[WS(rs, 19)] = T78 - T77;
+			      ii[WS(rs, 24)] = T76 + T73;
+			      ii[WS(rs, 14)] = T77 + T78;
+			 }
+		    }
+		    {
+			 E T53, T5L, T7e, T7q, T5y, T7j, T5z, T7i, T66, T7r, T69, T7p, T60, T7v, T61;
+			 E T7u, T5E, T7f, T5H, T7b, T51, T7d;
+			 T51 = T2G - T2F;
+			 T53 = T51 - T52;
+			 T5L = T51 + T52;
+			 T7d = T6J - T6I;
+			 T7e = T7c + T7d;
+			 T7q = T7d - T7c;
+			 {
+			      E T5a, T5h, T5i, T5p, T5w, T5x;
+			      T5a = FMA(KP876306680, T56, KP481753674 * T59);
+			      T5h = FNMS(KP425779291, T5g, KP904827052 * T5d);
+			      T5i = T5a + T5h;
+			      T5p = FMA(KP535826794, T5l, KP844327925 * T5o);
+			      T5w = FMA(KP062790519, T5s, KP998026728 * T5v);
+			      T5x = T5p + T5w;
+			      T5y = T5i + T5x;
+			      T7j = T5p - T5w;
+			      T5z = KP559016994 * (T5i - T5x);
+			      T7i = T5a - T5h;
+			 }
+			 {
+			      E T64, T65, T7n, T67, T68, T7o;
+			      T64 = FNMS(KP684547105, T5M, KP728968627 * T5N);
+			      T65 = FMA(KP125333233, T5Q, KP992114701 * T5P);
+			      T7n = T64 - T65;
+			      T67 = FNMS(KP998026728, T5T, KP062790519 * T5U);
+			      T68 = FMA(KP770513242, T5X, KP637423989 * T5W);
+			      T7o = T67 - T68;
+			      T66 = T64 + T65;
+			      T7r = KP559016994 * (T7n - T7o);
+			      T69 = T67 + T68;
+			      T7p = T7n + T7o;
+			 }
+			 {
+			      E T5O, T5R, T5S, T5V, T5Y, T5Z;
+			      T5O = FMA(KP728968627, T5M, KP684547105 * T5N);
+			      T5R = FNMS(KP992114701, T5Q, KP125333233 * T5P);
+			      T5S = T5O + T5R;
+			      T5V = FMA(KP062790519, T5T, KP998026728 * T5U);
+			      T5Y = FNMS(KP637423989, T5X, KP770513242 * T5W);
+			      T5Z = T5V + T5Y;
+			      T60 = T5S + T5Z;
+			      T7v = T5V - T5Y;
+			      T61 = KP559016994 * (T5S - T5Z);
+			      T7u = T5O - T5R;
+			 }
+			 {
+			      E T5C, T5D, T79, T5F, T5G, T7a;
+			      T5C = FNMS(KP481753674, T56, KP876306680 * T59);
+			      T5D = FMA(KP904827052, T5g, KP425779291 * T5d);
+			      T79 = T5C - T5D;
+			      T5F = FNMS(KP844327925, T5l, KP535826794 * T5o);
+			      T5G = FNMS(KP998026728, T5s, KP062790519 * T5v);
+			      T7a = T5F + T5G;
+			      T5E = T5C + T5D;
+			      T7f = KP559016994 * (T79 - T7a);
+			      T5H = T5F - T5G;
+			      T7b = T79 + T7a;
+			 }
+			 ri[WS(rs, 2)] = T53 + T5y;
+			 ii[WS(rs, 2)] = T7b + T7e;
+			 ri[WS(rs, 3)] = T5L + T60;
+			 ii[WS(rs, 3)] = T7p + T7q;
+			 {
+			      E T5I, T5K, T5B, T5J, T5A;
+			      T5I = FMA(KP951056516, T5E, KP587785252 * T5H);
+			      T5K = FNMS(KP587785252, T5E, KP951056516 * T5H);
+			      T5A = FNMS(KP250000000, T5y, T53);
+			      T5B = T5z + T5A;
+			      T5J = T5A - T5z;
+			      ri[WS(rs, 22)] = T5B - T5I;
+			      ri[WS(rs, 17)] = T5J + T5K;
+			      ri[WS(rs, 7)] = T5B + T5I;
+			      ri[WS(rs, 12)] = T5J - T5K;
+			 }
+			 {
+			      E T7k, T7l, T7h, T7m, T7g;
+			      T7k = FMA(KP951056516, T7i, KP587785252 * T7j);
+			      T7l = FNMS(KP587785252, T7i, KP951056516 * T7j);
+			      T7g = FNMS(KP250000000, T7b, T7e);
+			      T7h = T7f + T7g;
+			      T7m = T7g - T7f;
+			      ii[WS(rs, 7)] = T7h - T7k;
+			      ii[WS(rs, 17)] = T7m - T7l;
+			      ii[WS(rs, 22)] = T7k + T7h;
+			      ii[WS(rs, 12)] = T7l + T7m;
+			 }
+			 {
+			      E T6a, T6c, T63, T6b, T62;
+			      T6a = FMA(KP951056516, T66, KP587785252 * T69);
+			      T6c = FNMS(KP587785252, T66, KP951056516 * T69);
+			      T62 = FNMS(KP250000000, T60, T5L);
+			      T63 = T61 + T62;
+			      T6b = T62 - T61;
+			      ri[WS(rs, 23)] = T63 - T6a;
+			      ri[WS(rs, 18)] = T6b + T6c;
+			      ri[WS(rs, 8)] = T63 + T6a;
+			      ri[WS(rs, 13)] = T6b - T6c;
+			 }
+			 {
+			      E T7w, T7x, T7t, T7y, T7s;
+			      T7w = FMA(KP951056516, T7u, KP587785252 * T7v);
+			      T7x = FNMS(KP587785252, T7u, KP951056516 * T7v);
+			      T7s = FNMS(KP250000000, T7p, T7q);
+			      T7t = T7r + T7s;
+			      T7y = T7s - T7r;
+			      ii[WS(rs, 8)] = T7t - T7w;
+			      ii[WS(rs, 18)] = T7y - T7x;
+			      ii[WS(rs, 23)] = T7w + T7t;
+			      ii[WS(rs, 13)] = T7x + T7y;
+			 }
+		    }
+	       }
+	  }
+     }
+}
+
+static const tw_instr twinstr[] = {
+     { TW_CEXP, 0, 1 },
+     { TW_CEXP, 0, 3 },
+     { TW_CEXP, 0, 9 },
+     { TW_CEXP, 0, 24 },
+     { TW_NEXT, 1, 0 }
+};
+
+static const ct_desc desc = { 25, "t2_25", twinstr, &GENUS, { 280, 180, 160, 0 }, 0, 0, 0 };
+
+void X(codelet_t2_25) (planner *p) {
+     X(kdft_dit_register) (p, t2_25, &desc);
+}
+#endif
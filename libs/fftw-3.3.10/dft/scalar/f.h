@@ -0,0 +1 @@
+#include "dft/scalar/t.h"  /* same stuff, no need to duplicate */
@@ -0,0 +1,860 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:45:17 EDT 2021 */
+
+#include "dft/codelet-dft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_notw_c.native -fma -simd -compact -variables 4 -pipeline-latency 8 -sign 1 -n 32 -name n2bv_32 -with-ostride 2 -include dft/simd/n2b.h -store-multiple 2 */
+
+/*
+ * This function contains 186 FP additions, 98 FP multiplications,
+ * (or, 88 additions, 0 multiplications, 98 fused multiply/add),
+ * 72 stack variables, 7 constants, and 80 memory accesses
+ */
+#include "dft/simd/n2b.h"
+
+static void n2bv_32(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP198912367, +0.198912367379658006911597622644676228597850501);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP668178637, +0.668178637919298919997757686523080761552472251);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  const R *xi;
+	  R *xo;
+	  xi = ii;
+	  xo = io;
+	  for (i = v; i > 0; i = i - VL, xi = xi + (VL * ivs), xo = xo + (VL * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T1T, T1W, T2K, T2x, T16, T1A, Tb, T1p, TT, T1v, TY, T1w, T27, T2a, T2b;
+	       V T2H, T2O, TC, T1s, TH, T1t, T20, T23, T24, T2E, T2N, T2g, T2j, Tq, T1B;
+	       V T19, T1q, T2A, T2L;
+	       {
+		    V T3, T1R, T14, T1S, T6, T1U, T9, T1V, T15, Ta;
+		    {
+			 V T1, T2, T12, T13;
+			 T1 = LD(&(xi[0]), ivs, &(xi[0]));
+			 T2 = LD(&(xi[WS(is, 16)]), ivs, &(xi[0]));
+			 T3 = VSUB(T1, T2);
+			 T1R = VADD(T1, T2);
+			 T12 = LD(&(xi[WS(is, 8)]), ivs, &(xi[0]));
+			 T13 = LD(&(xi[WS(is, 24)]), ivs, &(xi[0]));
+			 T14 = VSUB(T12, T13);
+			 T1S = VADD(T12, T13);
+		    }
+		    {
+			 V T4, T5, T7, T8;
+			 T4 = LD(&(xi[WS(is, 4)]), ivs, &(xi[0]));
+			 T5 = LD(&(xi[WS(is, 20)]), ivs, &(xi[0]));
+			 T6 = VSUB(T4, T5);
+			 T1U = VADD(T4, T5);
+			 T7 = LD(&(xi[WS(is, 28)]), ivs, &(xi[0]));
+			 T8 = LD(&(xi[WS(is, 12)]), ivs, &(xi[0]));
+			 T9 = VSUB(T7, T8);
+			 T1V = VADD(T7, T8);
+		    }
+		    T1T = VADD(T1R, T1S);
+		    T1W = VADD(T1U, T1V);
+		    T2K = VSUB(T1U, T1V);
+		    T2x = VSUB(T1R, T1S);
+		    T15 = VSUB(T6, T9);
+		    T16 = VFMA(LDK(KP707106781), T15, T14);
+		    T1A = VFNMS(LDK(KP707106781), T15, T14);
+		    Ta = VADD(T6, T9);
+		    Tb = VFMA(LDK(KP707106781), Ta, T3);
+		    T1p = VFNMS(LDK(KP707106781), Ta, T3);
+	       }
+	       {
+		    V TL, T25, TW, T26, TO, T28, TR, T29;
+		    {
+			 V TJ, TK, TU, TV;
+			 TJ = LD(&(xi[WS(is, 31)]), ivs, &(xi[WS(is, 1)]));
+			 TK = LD(&(xi[WS(is, 15)]), ivs, &(xi[WS(is, 1)]));
+			 TL = VSUB(TJ, TK);
+			 T25 = VADD(TJ, TK);
+			 TU = LD(&(xi[WS(is, 23)]), ivs, &(xi[WS(is, 1)]));
+			 TV = LD(&(xi[WS(is, 7)]), ivs, &(xi[WS(is, 1)]));
+			 TW = VSUB(TU, TV);
+			 T26 = VADD(TV, TU);
+		    }
+		    {
+			 V TM, TN, TP, TQ;
+			 TM = LD(&(xi[WS(is, 3)]), ivs, &(xi[WS(is, 1)]));
+			 TN = LD(&(xi[WS(is, 19)]), ivs, &(xi[WS(is, 1)]));
+			 TO = VSUB(TM, TN);
+			 T28 = VADD(TM, TN);
+			 TP = LD(&(xi[WS(is, 27)]), ivs, &(xi[WS(is, 1)]));
+			 TQ = LD(&(xi[WS(is, 11)]), ivs, &(xi[WS(is, 1)]));
+			 TR = VSUB(TP, TQ);
+			 T29 = VADD(TP, TQ);
+		    }
+		    {
+			 V TS, TX, T2F, T2G;
+			 TS = VADD(TO, TR);
+			 TT = VFMA(LDK(KP707106781), TS, TL);
+			 T1v = VFNMS(LDK(KP707106781), TS, TL);
+			 TX = VSUB(TR, TO);
+			 TY = VFMA(LDK(KP707106781), TX, TW);
+			 T1w = VFNMS(LDK(KP707106781), TX, TW);
+			 T27 = VADD(T25, T26);
+			 T2a = VADD(T28, T29);
+			 T2b = VSUB(T27, T2a);
+			 T2F = VSUB(T25, T26);
+			 T2G = VSUB(T29, T28);
+			 T2H = VFNMS(LDK(KP414213562), T2G, T2F);
+			 T2O = VFMA(LDK(KP414213562), T2F, T2G);
+		    }
+	       }
+	       {
+		    V Tu, T1Y, TF, T1Z, Tx, T21, TA, T22;
+		    {
+			 V Ts, Tt, TD, TE;
+			 Ts = LD(&(xi[WS(is, 1)]), ivs, &(xi[WS(is, 1)]));
+			 Tt = LD(&(xi[WS(is, 17)]), ivs, &(xi[WS(is, 1)]));
+			 Tu = VSUB(Ts, Tt);
+			 T1Y = VADD(Ts, Tt);
+			 TD = LD(&(xi[WS(is, 9)]), ivs, &(xi[WS(is, 1)]));
+			 TE = LD(&(xi[WS(is, 25)]), ivs, &(xi[WS(is, 1)]));
+			 TF = VSUB(TD, TE);
+			 T1Z = VADD(TD, TE);
+		    }
+		    {
+			 V Tv, Tw, Ty, Tz;
+			 Tv = LD(&(xi[WS(is, 5)]), ivs, &(xi[WS(is, 1)]));
+			 Tw = LD(&(xi[WS(is, 21)]), ivs, &(xi[WS(is, 1)]));
+			 Tx = VSUB(Tv, Tw);
+			 T21 = VADD(Tv, Tw);
+			 Ty = LD(&(xi[WS(is, 29)]), ivs, &(xi[WS(is, 1)]));
+			 Tz = LD(&(xi[WS(is, 13)]), ivs, &(xi[WS(is, 1)]));
+			 TA = VSUB(Ty, Tz);
+			 T22 = VADD(Ty, Tz);
+		    }
+		    {
+			 V TB, TG, T2C, T2D;
+			 TB = VADD(Tx, TA);
+			 TC = VFMA(LDK(KP707106781), TB, Tu);
+			 T1s = VFNMS(LDK(KP707106781), TB, Tu);
+			 TG = VSUB(Tx, TA);
+			 TH = VFMA(LDK(KP707106781), TG, TF);
+			 T1t = VFNMS(LDK(KP707106781), TG, TF);
+			 T20 = VADD(T1Y, T1Z);
+			 T23 = VADD(T21, T22);
+			 T24 = VSUB(T20, T23);
+			 T2C = VSUB(T1Y, T1Z);
+			 T2D = VSUB(T21, T22);
+			 T2E = VFNMS(LDK(KP414213562), T2D, T2C);
+			 T2N = VFMA(LDK(KP414213562), T2C, T2D);
+		    }
+	       }
+	       {
+		    V Te, T2e, To, T2i, Th, T2f, Tl, T2h, Ti, Tp;
+		    {
+			 V Tc, Td, Tm, Tn;
+			 Tc = LD(&(xi[WS(is, 2)]), ivs, &(xi[0]));
+			 Td = LD(&(xi[WS(is, 18)]), ivs, &(xi[0]));
+			 Te = VSUB(Tc, Td);
+			 T2e = VADD(Tc, Td);
+			 Tm = LD(&(xi[WS(is, 22)]), ivs, &(xi[0]));
+			 Tn = LD(&(xi[WS(is, 6)]), ivs, &(xi[0]));
+			 To = VSUB(Tm, Tn);
+			 T2i = VADD(Tn, Tm);
+		    }
+		    {
+			 V Tf, Tg, Tj, Tk;
+			 Tf = LD(&(xi[WS(is, 10)]), ivs, &(xi[0]));
+			 Tg = LD(&(xi[WS(is, 26)]), ivs, &(xi[0]));
+			 Th = VSUB(Tf, Tg);
+			 T2f = VADD(Tf, Tg);
+			 Tj = LD(&(xi[WS(is, 30)]), ivs, &(xi[0]));
+			 Tk = LD(&(xi[WS(is, 14)]), ivs, &(xi[0]));
+			 Tl = VSUB(Tj, Tk);
+			 T2h = VADD(Tj, Tk);
+		    }
+		    T2g = VADD(T2e, T2f);
+		    T2j = VADD(T2h, T2i);
+		    Ti = VFNMS(LDK(KP414213562), Th, Te);
+		    Tp = VFNMS(LDK(KP414213562), To, Tl);
+		    Tq = VADD(Ti, Tp);
+		    T1B = VSUB(Ti, Tp);
+		    {
+			 V T17, T18, T2y, T2z;
+			 T17 = VFMA(LDK(KP414213562), Te, Th);
+			 T18 = VFMA(LDK(KP414213562), Tl, To);
+			 T19 = VSUB(T17, T18);
+			 T1q = VADD(T17, T18);
+			 T2y = VSUB(T2e, T2f);
+			 T2z = VSUB(T2h, T2i);
+			 T2A = VADD(T2y, T2z);
+			 T2L = VSUB(T2y, T2z);
+		    }
+	       }
+	       {
+		    V T31, T32, T33, T34, T35, T36, T37, T38, T39, T3a, T3b, T3c;
+		    {
+			 V T2d, T2n, T2m, T2o;
+			 {
+			      V T1X, T2c, T2k, T2l;
+			      T1X = VSUB(T1T, T1W);
+			      T2c = VADD(T24, T2b);
+			      T2d = VFNMS(LDK(KP707106781), T2c, T1X);
+			      T2n = VFMA(LDK(KP707106781), T2c, T1X);
+			      T2k = VSUB(T2g, T2j);
+			      T2l = VSUB(T24, T2b);
+			      T2m = VFNMS(LDK(KP707106781), T2l, T2k);
+			      T2o = VFMA(LDK(KP707106781), T2l, T2k);
+			 }
+			 T31 = VFNMSI(T2m, T2d);
+			 STM2(&(xo[24]), T31, ovs, &(xo[0]));
+			 T32 = VFNMSI(T2o, T2n);
+			 STM2(&(xo[56]), T32, ovs, &(xo[0]));
+			 T33 = VFMAI(T2m, T2d);
+			 STM2(&(xo[40]), T33, ovs, &(xo[0]));
+			 T34 = VFMAI(T2o, T2n);
+			 STM2(&(xo[8]), T34, ovs, &(xo[0]));
+		    }
+		    {
+			 V T2r, T2v, T2u, T2w;
+			 {
+			      V T2p, T2q, T2s, T2t;
+			      T2p = VADD(T1T, T1W);
+			      T2q = VADD(T2g, T2j);
+			      T2r = VSUB(T2p, T2q);
+			      T2v = VADD(T2p, T2q);
+			      T2s = VADD(T20, T23);
+			      T2t = VADD(T27, T2a);
+			      T2u = VSUB(T2s, T2t);
+			      T2w = VADD(T2s, T2t);
+			 }
+			 T35 = VFNMSI(T2u, T2r);
+			 STM2(&(xo[48]), T35, ovs, &(xo[0]));
+			 T36 = VADD(T2v, T2w);
+			 STM2(&(xo[0]), T36, ovs, &(xo[0]));
+			 T37 = VFMAI(T2u, T2r);
+			 STM2(&(xo[16]), T37, ovs, &(xo[0]));
+			 T38 = VSUB(T2v, T2w);
+			 STM2(&(xo[32]), T38, ovs, &(xo[0]));
+		    }
+		    {
+			 V T2V, T2Z, T2Y, T30;
+			 {
+			      V T2T, T2U, T2W, T2X;
+			      T2T = VFNMS(LDK(KP707106781), T2A, T2x);
+			      T2U = VADD(T2N, T2O);
+			      T2V = VFNMS(LDK(KP923879532), T2U, T2T);
+			      T2Z = VFMA(LDK(KP923879532), T2U, T2T);
+			      T2W = VFNMS(LDK(KP707106781), T2L, T2K);
+			      T2X = VSUB(T2E, T2H);
+			      T2Y = VFMA(LDK(KP923879532), T2X, T2W);
+			      T30 = VFNMS(LDK(KP923879532), T2X, T2W);
+			 }
+			 T39 = VFMAI(T2Y, T2V);
+			 STM2(&(xo[20]), T39, ovs, &(xo[0]));
+			 T3a = VFMAI(T30, T2Z);
+			 STM2(&(xo[52]), T3a, ovs, &(xo[0]));
+			 T3b = VFNMSI(T2Y, T2V);
+			 STM2(&(xo[44]), T3b, ovs, &(xo[0]));
+			 T3c = VFNMSI(T30, T2Z);
+			 STM2(&(xo[12]), T3c, ovs, &(xo[0]));
+		    }
+		    {
+			 V T3d, T3e, T3f, T3g;
+			 {
+			      V T2J, T2R, T2Q, T2S;
+			      {
+				   V T2B, T2I, T2M, T2P;
+				   T2B = VFMA(LDK(KP707106781), T2A, T2x);
+				   T2I = VADD(T2E, T2H);
+				   T2J = VFNMS(LDK(KP923879532), T2I, T2B);
+				   T2R = VFMA(LDK(KP923879532), T2I, T2B);
+				   T2M = VFMA(LDK(KP707106781), T2L, T2K);
+				   T2P = VSUB(T2N, T2O);
+				   T2Q = VFNMS(LDK(KP923879532), T2P, T2M);
+				   T2S = VFMA(LDK(KP923879532), T2P, T2M);
+			      }
+			      T3d = VFNMSI(T2Q, T2J);
+			      STM2(&(xo[28]), T3d, ovs, &(xo[0]));
+			      T3e = VFMAI(T2S, T2R);
+			      STM2(&(xo[4]), T3e, ovs, &(xo[0]));
+			      T3f = VFMAI(T2Q, T2J);
+			      STM2(&(xo[36]), T3f, ovs, &(xo[0]));
+			      T3g = VFNMSI(T2S, T2R);
+			      STM2(&(xo[60]), T3g, ovs, &(xo[0]));
+			 }
+			 {
+			      V T1r, T1C, T1M, T1J, T1F, T1K, T1y, T1N;
+			      T1r = VFMA(LDK(KP923879532), T1q, T1p);
+			      T1C = VFNMS(LDK(KP923879532), T1B, T1A);
+			      T1M = VFMA(LDK(KP923879532), T1B, T1A);
+			      T1J = VFNMS(LDK(KP923879532), T1q, T1p);
+			      {
+				   V T1D, T1E, T1u, T1x;
+				   T1D = VFNMS(LDK(KP668178637), T1s, T1t);
+				   T1E = VFNMS(LDK(KP668178637), T1v, T1w);
+				   T1F = VSUB(T1D, T1E);
+				   T1K = VADD(T1D, T1E);
+				   T1u = VFMA(LDK(KP668178637), T1t, T1s);
+				   T1x = VFMA(LDK(KP668178637), T1w, T1v);
+				   T1y = VADD(T1u, T1x);
+				   T1N = VSUB(T1u, T1x);
+			      }
+			      {
+				   V T1z, T1G, T3h, T3i;
+				   T1z = VFNMS(LDK(KP831469612), T1y, T1r);
+				   T1G = VFNMS(LDK(KP831469612), T1F, T1C);
+				   T3h = VFNMSI(T1G, T1z);
+				   STM2(&(xo[38]), T3h, ovs, &(xo[2]));
+				   STN2(&(xo[36]), T3f, T3h, ovs);
+				   T3i = VFMAI(T1G, T1z);
+				   STM2(&(xo[26]), T3i, ovs, &(xo[2]));
+				   STN2(&(xo[24]), T31, T3i, ovs);
+			      }
+			      {
+				   V T1P, T1Q, T3j, T3k;
+				   T1P = VFNMS(LDK(KP831469612), T1K, T1J);
+				   T1Q = VFMA(LDK(KP831469612), T1N, T1M);
+				   T3j = VFMAI(T1Q, T1P);
+				   STM2(&(xo[10]), T3j, ovs, &(xo[2]));
+				   STN2(&(xo[8]), T34, T3j, ovs);
+				   T3k = VFNMSI(T1Q, T1P);
+				   STM2(&(xo[54]), T3k, ovs, &(xo[2]));
+				   STN2(&(xo[52]), T3a, T3k, ovs);
+			      }
+			      {
+				   V T1H, T1I, T3l, T3m;
+				   T1H = VFMA(LDK(KP831469612), T1y, T1r);
+				   T1I = VFMA(LDK(KP831469612), T1F, T1C);
+				   T3l = VFNMSI(T1I, T1H);
+				   STM2(&(xo[6]), T3l, ovs, &(xo[2]));
+				   STN2(&(xo[4]), T3e, T3l, ovs);
+				   T3m = VFMAI(T1I, T1H);
+				   STM2(&(xo[58]), T3m, ovs, &(xo[2]));
+				   STN2(&(xo[56]), T32, T3m, ovs);
+			      }
+			      {
+				   V T1L, T1O, T3n, T3o;
+				   T1L = VFMA(LDK(KP831469612), T1K, T1J);
+				   T1O = VFNMS(LDK(KP831469612), T1N, T1M);
+				   T3n = VFNMSI(T1O, T1L);
+				   STM2(&(xo[22]), T3n, ovs, &(xo[2]));
+				   STN2(&(xo[20]), T39, T3n, ovs);
+				   T3o = VFMAI(T1O, T1L);
+				   STM2(&(xo[42]), T3o, ovs, &(xo[2]));
+				   STN2(&(xo[40]), T33, T3o, ovs);
+			      }
+			 }
+			 {
+			      V Tr, T1a, T1k, T1h, T1d, T1i, T10, T1l;
+			      Tr = VFMA(LDK(KP923879532), Tq, Tb);
+			      T1a = VFMA(LDK(KP923879532), T19, T16);
+			      T1k = VFNMS(LDK(KP923879532), T19, T16);
+			      T1h = VFNMS(LDK(KP923879532), Tq, Tb);
+			      {
+				   V T1b, T1c, TI, TZ;
+				   T1b = VFMA(LDK(KP198912367), TC, TH);
+				   T1c = VFMA(LDK(KP198912367), TT, TY);
+				   T1d = VSUB(T1b, T1c);
+				   T1i = VADD(T1b, T1c);
+				   TI = VFNMS(LDK(KP198912367), TH, TC);
+				   TZ = VFNMS(LDK(KP198912367), TY, TT);
+				   T10 = VADD(TI, TZ);
+				   T1l = VSUB(TI, TZ);
+			      }
+			      {
+				   V T11, T1e, T3p, T3q;
+				   T11 = VFNMS(LDK(KP980785280), T10, Tr);
+				   T1e = VFNMS(LDK(KP980785280), T1d, T1a);
+				   T3p = VFNMSI(T1e, T11);
+				   STM2(&(xo[30]), T3p, ovs, &(xo[2]));
+				   STN2(&(xo[28]), T3d, T3p, ovs);
+				   T3q = VFMAI(T1e, T11);
+				   STM2(&(xo[34]), T3q, ovs, &(xo[2]));
+				   STN2(&(xo[32]), T38, T3q, ovs);
+			      }
+			      {
+				   V T1n, T1o, T3r, T3s;
+				   T1n = VFMA(LDK(KP980785280), T1i, T1h);
+				   T1o = VFNMS(LDK(KP980785280), T1l, T1k);
+				   T3r = VFNMSI(T1o, T1n);
+				   STM2(&(xo[14]), T3r, ovs, &(xo[2]));
+				   STN2(&(xo[12]), T3c, T3r, ovs);
+				   T3s = VFMAI(T1o, T1n);
+				   STM2(&(xo[50]), T3s, ovs, &(xo[2]));
+				   STN2(&(xo[48]), T35, T3s, ovs);
+			      }
+			      {
+				   V T1f, T1g, T3t, T3u;
+				   T1f = VFMA(LDK(KP980785280), T10, Tr);
+				   T1g = VFMA(LDK(KP980785280), T1d, T1a);
+				   T3t = VFNMSI(T1g, T1f);
+				   STM2(&(xo[62]), T3t, ovs, &(xo[2]));
+				   STN2(&(xo[60]), T3g, T3t, ovs);
+				   T3u = VFMAI(T1g, T1f);
+				   STM2(&(xo[2]), T3u, ovs, &(xo[2]));
+				   STN2(&(xo[0]), T36, T3u, ovs);
+			      }
+			      {
+				   V T1j, T1m, T3v, T3w;
+				   T1j = VFNMS(LDK(KP980785280), T1i, T1h);
+				   T1m = VFMA(LDK(KP980785280), T1l, T1k);
+				   T3v = VFMAI(T1m, T1j);
+				   STM2(&(xo[18]), T3v, ovs, &(xo[2]));
+				   STN2(&(xo[16]), T37, T3v, ovs);
+				   T3w = VFNMSI(T1m, T1j);
+				   STM2(&(xo[46]), T3w, ovs, &(xo[2]));
+				   STN2(&(xo[44]), T3b, T3w, ovs);
+			      }
+			 }
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kdft_desc desc = { 32, XSIMD_STRING("n2bv_32"), { 88, 0, 98, 0 }, &GENUS, 0, 2, 0, 0 };
+
+void XSIMD(codelet_n2bv_32) (planner *p) { X(kdft_register) (p, n2bv_32, &desc);
+}
+
+#else
+
+/* Generated by: ../../../genfft/gen_notw_c.native -simd -compact -variables 4 -pipeline-latency 8 -sign 1 -n 32 -name n2bv_32 -with-ostride 2 -include dft/simd/n2b.h -store-multiple 2 */
+
+/*
+ * This function contains 186 FP additions, 42 FP multiplications,
+ * (or, 170 additions, 26 multiplications, 16 fused multiply/add),
+ * 72 stack variables, 7 constants, and 80 memory accesses
+ */
+#include "dft/simd/n2b.h"
+
+static void n2bv_32(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  const R *xi;
+	  R *xo;
+	  xi = ii;
+	  xo = io;
+	  for (i = v; i > 0; i = i - VL, xi = xi + (VL * ivs), xo = xo + (VL * ovs), MAKE_VOLATILE_STRIDE(64, is), MAKE_VOLATILE_STRIDE(64, os)) {
+	       V T2f, T2k, T2N, T2M, T19, T1B, Tb, T1p, TT, T1v, TY, T1w, T2E, T2F, T2G;
+	       V T24, T2o, TC, T1s, TH, T1t, T2B, T2C, T2D, T1X, T2n, T2I, T2J, Tq, T1A;
+	       V T14, T1q, T2c, T2l;
+	       {
+		    V T3, T2i, T18, T2j, T6, T2d, T9, T2e, T15, Ta;
+		    {
+			 V T1, T2, T16, T17;
+			 T1 = LD(&(xi[0]), ivs, &(xi[0]));
+			 T2 = LD(&(xi[WS(is, 16)]), ivs, &(xi[0]));
+			 T3 = VSUB(T1, T2);
+			 T2i = VADD(T1, T2);
+			 T16 = LD(&(xi[WS(is, 8)]), ivs, &(xi[0]));
+			 T17 = LD(&(xi[WS(is, 24)]), ivs, &(xi[0]));
+			 T18 = VSUB(T16, T17);
+			 T2j = VADD(T16, T17);
+		    }
+		    {
+			 V T4, T5, T7, T8;
+			 T4 = LD(&(xi[WS(is, 4)]), ivs, &(xi[0]));
+			 T5 = LD(&(xi[WS(is, 20)]), ivs, &(xi[0]));
+			 T6 = VSUB(T4, T5);
+			 T2d = VADD(T4, T5);
+			 T7 = LD(&(xi[WS(is, 28)]), ivs, &(xi[0]));
+			 T8 = LD(&(xi[WS(is, 12)]), ivs, &(xi[0]));
+			 T9 = VSUB(T7, T8);
+			 T2e = VADD(T7, T8);
+		    }
+		    T2f = VSUB(T2d, T2e);
+		    T2k = VSUB(T2i, T2j);
+		    T2N = VADD(T2d, T2e);
+		    T2M = VADD(T2i, T2j);
+		    T15 = VMUL(LDK(KP707106781), VSUB(T6, T9));
+		    T19 = VSUB(T15, T18);
+		    T1B = VADD(T18, T15);
+		    Ta = VMUL(LDK(KP707106781), VADD(T6, T9));
+		    Tb = VSUB(T3, Ta);
+		    T1p = VADD(T3, Ta);
+	       }
+	       {
+		    V TL, T21, TW, T1Y, TO, T22, TS, T1Z;
+		    {
+			 V TJ, TK, TU, TV;
+			 TJ = LD(&(xi[WS(is, 3)]), ivs, &(xi[WS(is, 1)]));
+			 TK = LD(&(xi[WS(is, 19)]), ivs, &(xi[WS(is, 1)]));
+			 TL = VSUB(TJ, TK);
+			 T21 = VADD(TJ, TK);
+			 TU = LD(&(xi[WS(is, 31)]), ivs, &(xi[WS(is, 1)]));
+			 TV = LD(&(xi[WS(is, 15)]), ivs, &(xi[WS(is, 1)]));
+			 TW = VSUB(TU, TV);
+			 T1Y = VADD(TU, TV);
+		    }
+		    {
+			 V TM, TN, TQ, TR;
+			 TM = LD(&(xi[WS(is, 27)]), ivs, &(xi[WS(is, 1)]));
+			 TN = LD(&(xi[WS(is, 11)]), ivs, &(xi[WS(is, 1)]));
+			 TO = VSUB(TM, TN);
+			 T22 = VADD(TM, TN);
+			 TQ = LD(&(xi[WS(is, 7)]), ivs, &(xi[WS(is, 1)]));
+			 TR = LD(&(xi[WS(is, 23)]), ivs, &(xi[WS(is, 1)]));
+			 TS = VSUB(TQ, TR);
+			 T1Z = VADD(TQ, TR);
+		    }
+		    {
+			 V TP, TX, T20, T23;
+			 TP = VMUL(LDK(KP707106781), VSUB(TL, TO));
+			 TT = VSUB(TP, TS);
+			 T1v = VADD(TS, TP);
+			 TX = VMUL(LDK(KP707106781), VADD(TL, TO));
+			 TY = VSUB(TW, TX);
+			 T1w = VADD(TW, TX);
+			 T2E = VADD(T1Y, T1Z);
+			 T2F = VADD(T21, T22);
+			 T2G = VSUB(T2E, T2F);
+			 T20 = VSUB(T1Y, T1Z);
+			 T23 = VSUB(T21, T22);
+			 T24 = VFMA(LDK(KP923879532), T20, VMUL(LDK(KP382683432), T23));
+			 T2o = VFNMS(LDK(KP382683432), T20, VMUL(LDK(KP923879532), T23));
+		    }
+	       }
+	       {
+		    V Tu, T1U, TF, T1R, Tx, T1V, TB, T1S;
+		    {
+			 V Ts, Tt, TD, TE;
+			 Ts = LD(&(xi[WS(is, 5)]), ivs, &(xi[WS(is, 1)]));
+			 Tt = LD(&(xi[WS(is, 21)]), ivs, &(xi[WS(is, 1)]));
+			 Tu = VSUB(Ts, Tt);
+			 T1U = VADD(Ts, Tt);
+			 TD = LD(&(xi[WS(is, 1)]), ivs, &(xi[WS(is, 1)]));
+			 TE = LD(&(xi[WS(is, 17)]), ivs, &(xi[WS(is, 1)]));
+			 TF = VSUB(TD, TE);
+			 T1R = VADD(TD, TE);
+		    }
+		    {
+			 V Tv, Tw, Tz, TA;
+			 Tv = LD(&(xi[WS(is, 29)]), ivs, &(xi[WS(is, 1)]));
+			 Tw = LD(&(xi[WS(is, 13)]), ivs, &(xi[WS(is, 1)]));
+			 Tx = VSUB(Tv, Tw);
+			 T1V = VADD(Tv, Tw);
+			 Tz = LD(&(xi[WS(is, 9)]), ivs, &(xi[WS(is, 1)]));
+			 TA = LD(&(xi[WS(is, 25)]), ivs, &(xi[WS(is, 1)]));
+			 TB = VSUB(Tz, TA);
+			 T1S = VADD(Tz, TA);
+		    }
+		    {
+			 V Ty, TG, T1T, T1W;
+			 Ty = VMUL(LDK(KP707106781), VSUB(Tu, Tx));
+			 TC = VSUB(Ty, TB);
+			 T1s = VADD(TB, Ty);
+			 TG = VMUL(LDK(KP707106781), VADD(Tu, Tx));
+			 TH = VSUB(TF, TG);
+			 T1t = VADD(TF, TG);
+			 T2B = VADD(T1R, T1S);
+			 T2C = VADD(T1U, T1V);
+			 T2D = VSUB(T2B, T2C);
+			 T1T = VSUB(T1R, T1S);
+			 T1W = VSUB(T1U, T1V);
+			 T1X = VFNMS(LDK(KP382683432), T1W, VMUL(LDK(KP923879532), T1T));
+			 T2n = VFMA(LDK(KP382683432), T1T, VMUL(LDK(KP923879532), T1W));
+		    }
+	       }
+	       {
+		    V Te, T26, To, T29, Th, T27, Tl, T2a, Ti, Tp;
+		    {
+			 V Tc, Td, Tm, Tn;
+			 Tc = LD(&(xi[WS(is, 2)]), ivs, &(xi[0]));
+			 Td = LD(&(xi[WS(is, 18)]), ivs, &(xi[0]));
+			 Te = VSUB(Tc, Td);
+			 T26 = VADD(Tc, Td);
+			 Tm = LD(&(xi[WS(is, 30)]), ivs, &(xi[0]));
+			 Tn = LD(&(xi[WS(is, 14)]), ivs, &(xi[0]));
+			 To = VSUB(Tm, Tn);
+			 T29 = VADD(Tm, Tn);
+		    }
+		    {
+			 V Tf, Tg, Tj, Tk;
+			 Tf = LD(&(xi[WS(is, 10)]), ivs, &(xi[0]));
+			 Tg = LD(&(xi[WS(is, 26)]), ivs, &(xi[0]));
+			 Th = VSUB(Tf, Tg);
+			 T27 = VADD(Tf, Tg);
+			 Tj = LD(&(xi[WS(is, 6)]), ivs, &(xi[0]));
+			 Tk = LD(&(xi[WS(is, 22)]), ivs, &(xi[0]));
+			 Tl = VSUB(Tj, Tk);
+			 T2a = VADD(Tj, Tk);
+		    }
+		    T2I = VADD(T26, T27);
+		    T2J = VADD(T29, T2a);
+		    Ti = VFMA(LDK(KP382683432), Te, VMUL(LDK(KP923879532), Th));
+		    Tp = VFNMS(LDK(KP382683432), To, VMUL(LDK(KP923879532), Tl));
+		    Tq = VSUB(Ti, Tp);
+		    T1A = VADD(Ti, Tp);
+		    {
+			 V T12, T13, T28, T2b;
+			 T12 = VFNMS(LDK(KP382683432), Th, VMUL(LDK(KP923879532), Te));
+			 T13 = VFMA(LDK(KP923879532), To, VMUL(LDK(KP382683432), Tl));
+			 T14 = VSUB(T12, T13);
+			 T1q = VADD(T12, T13);
+			 T28 = VSUB(T26, T27);
+			 T2b = VSUB(T29, T2a);
+			 T2c = VMUL(LDK(KP707106781), VSUB(T28, T2b));
+			 T2l = VMUL(LDK(KP707106781), VADD(T28, T2b));
+		    }
+	       }
+	       {
+		    V T31, T32, T33, T34, T35, T36, T37, T38, T39, T3a, T3b, T3c;
+		    {
+			 V T2L, T2R, T2Q, T2S;
+			 {
+			      V T2H, T2K, T2O, T2P;
+			      T2H = VMUL(LDK(KP707106781), VSUB(T2D, T2G));
+			      T2K = VSUB(T2I, T2J);
+			      T2L = VBYI(VSUB(T2H, T2K));
+			      T2R = VBYI(VADD(T2K, T2H));
+			      T2O = VSUB(T2M, T2N);
+			      T2P = VMUL(LDK(KP707106781), VADD(T2D, T2G));
+			      T2Q = VSUB(T2O, T2P);
+			      T2S = VADD(T2O, T2P);
+			 }
+			 T31 = VADD(T2L, T2Q);
+			 STM2(&(xo[24]), T31, ovs, &(xo[0]));
+			 T32 = VSUB(T2S, T2R);
+			 STM2(&(xo[56]), T32, ovs, &(xo[0]));
+			 T33 = VSUB(T2Q, T2L);
+			 STM2(&(xo[40]), T33, ovs, &(xo[0]));
+			 T34 = VADD(T2R, T2S);
+			 STM2(&(xo[8]), T34, ovs, &(xo[0]));
+		    }
+		    {
+			 V T2h, T2r, T2q, T2s;
+			 {
+			      V T25, T2g, T2m, T2p;
+			      T25 = VSUB(T1X, T24);
+			      T2g = VSUB(T2c, T2f);
+			      T2h = VBYI(VSUB(T25, T2g));
+			      T2r = VBYI(VADD(T2g, T25));
+			      T2m = VSUB(T2k, T2l);
+			      T2p = VSUB(T2n, T2o);
+			      T2q = VSUB(T2m, T2p);
+			      T2s = VADD(T2m, T2p);
+			 }
+			 T35 = VADD(T2h, T2q);
+			 STM2(&(xo[20]), T35, ovs, &(xo[0]));
+			 T36 = VSUB(T2s, T2r);
+			 STM2(&(xo[52]), T36, ovs, &(xo[0]));
+			 T37 = VSUB(T2q, T2h);
+			 STM2(&(xo[44]), T37, ovs, &(xo[0]));
+			 T38 = VADD(T2r, T2s);
+			 STM2(&(xo[12]), T38, ovs, &(xo[0]));
+		    }
+		    {
+			 V T2V, T2Z, T2Y, T30;
+			 {
+			      V T2T, T2U, T2W, T2X;
+			      T2T = VADD(T2M, T2N);
+			      T2U = VADD(T2I, T2J);
+			      T2V = VSUB(T2T, T2U);
+			      T2Z = VADD(T2T, T2U);
+			      T2W = VADD(T2B, T2C);
+			      T2X = VADD(T2E, T2F);
+			      T2Y = VBYI(VSUB(T2W, T2X));
+			      T30 = VADD(T2W, T2X);
+			 }
+			 T39 = VSUB(T2V, T2Y);
+			 STM2(&(xo[48]), T39, ovs, &(xo[0]));
+			 T3a = VADD(T2Z, T30);
+			 STM2(&(xo[0]), T3a, ovs, &(xo[0]));
+			 T3b = VADD(T2V, T2Y);
+			 STM2(&(xo[16]), T3b, ovs, &(xo[0]));
+			 T3c = VSUB(T2Z, T30);
+			 STM2(&(xo[32]), T3c, ovs, &(xo[0]));
+		    }
+		    {
+			 V T3d, T3e, T3f, T3g;
+			 {
+			      V T2v, T2z, T2y, T2A;
+			      {
+				   V T2t, T2u, T2w, T2x;
+				   T2t = VADD(T2k, T2l);
+				   T2u = VADD(T1X, T24);
+				   T2v = VADD(T2t, T2u);
+				   T2z = VSUB(T2t, T2u);
+				   T2w = VADD(T2f, T2c);
+				   T2x = VADD(T2n, T2o);
+				   T2y = VBYI(VADD(T2w, T2x));
+				   T2A = VBYI(VSUB(T2x, T2w));
+			      }
+			      T3d = VSUB(T2v, T2y);
+			      STM2(&(xo[60]), T3d, ovs, &(xo[0]));
+			      T3e = VADD(T2z, T2A);
+			      STM2(&(xo[28]), T3e, ovs, &(xo[0]));
+			      T3f = VADD(T2v, T2y);
+			      STM2(&(xo[4]), T3f, ovs, &(xo[0]));
+			      T3g = VSUB(T2z, T2A);
+			      STM2(&(xo[36]), T3g, ovs, &(xo[0]));
+			 }
+			 {
+			      V T1r, T1C, T1M, T1K, T1F, T1N, T1y, T1J;
+			      T1r = VSUB(T1p, T1q);
+			      T1C = VSUB(T1A, T1B);
+			      T1M = VADD(T1p, T1q);
+			      T1K = VADD(T1B, T1A);
+			      {
+				   V T1D, T1E, T1u, T1x;
+				   T1D = VFNMS(LDK(KP195090322), T1s, VMUL(LDK(KP980785280), T1t));
+				   T1E = VFMA(LDK(KP195090322), T1v, VMUL(LDK(KP980785280), T1w));
+				   T1F = VSUB(T1D, T1E);
+				   T1N = VADD(T1D, T1E);
+				   T1u = VFMA(LDK(KP980785280), T1s, VMUL(LDK(KP195090322), T1t));
+				   T1x = VFNMS(LDK(KP195090322), T1w, VMUL(LDK(KP980785280), T1v));
+				   T1y = VSUB(T1u, T1x);
+				   T1J = VADD(T1u, T1x);
+			      }
+			      {
+				   V T1z, T1G, T3h, T3i;
+				   T1z = VADD(T1r, T1y);
+				   T1G = VBYI(VADD(T1C, T1F));
+				   T3h = VSUB(T1z, T1G);
+				   STM2(&(xo[50]), T3h, ovs, &(xo[2]));
+				   STN2(&(xo[48]), T39, T3h, ovs);
+				   T3i = VADD(T1z, T1G);
+				   STM2(&(xo[14]), T3i, ovs, &(xo[2]));
+				   STN2(&(xo[12]), T38, T3i, ovs);
+			      }
+			      {
+				   V T1P, T1Q, T3j, T3k;
+				   T1P = VBYI(VADD(T1K, T1J));
+				   T1Q = VADD(T1M, T1N);
+				   T3j = VADD(T1P, T1Q);
+				   STM2(&(xo[2]), T3j, ovs, &(xo[2]));
+				   STN2(&(xo[0]), T3a, T3j, ovs);
+				   T3k = VSUB(T1Q, T1P);
+				   STM2(&(xo[62]), T3k, ovs, &(xo[2]));
+				   STN2(&(xo[60]), T3d, T3k, ovs);
+			      }
+			      {
+				   V T1H, T1I, T3l, T3m;
+				   T1H = VSUB(T1r, T1y);
+				   T1I = VBYI(VSUB(T1F, T1C));
+				   T3l = VSUB(T1H, T1I);
+				   STM2(&(xo[46]), T3l, ovs, &(xo[2]));
+				   STN2(&(xo[44]), T37, T3l, ovs);
+				   T3m = VADD(T1H, T1I);
+				   STM2(&(xo[18]), T3m, ovs, &(xo[2]));
+				   STN2(&(xo[16]), T3b, T3m, ovs);
+			      }
+			      {
+				   V T1L, T1O, T3n, T3o;
+				   T1L = VBYI(VSUB(T1J, T1K));
+				   T1O = VSUB(T1M, T1N);
+				   T3n = VADD(T1L, T1O);
+				   STM2(&(xo[30]), T3n, ovs, &(xo[2]));
+				   STN2(&(xo[28]), T3e, T3n, ovs);
+				   T3o = VSUB(T1O, T1L);
+				   STM2(&(xo[34]), T3o, ovs, &(xo[2]));
+				   STN2(&(xo[32]), T3c, T3o, ovs);
+			      }
+			 }
+			 {
+			      V Tr, T1a, T1k, T1i, T1d, T1l, T10, T1h;
+			      Tr = VSUB(Tb, Tq);
+			      T1a = VSUB(T14, T19);
+			      T1k = VADD(Tb, Tq);
+			      T1i = VADD(T19, T14);
+			      {
+				   V T1b, T1c, TI, TZ;
+				   T1b = VFNMS(LDK(KP555570233), TC, VMUL(LDK(KP831469612), TH));
+				   T1c = VFMA(LDK(KP555570233), TT, VMUL(LDK(KP831469612), TY));
+				   T1d = VSUB(T1b, T1c);
+				   T1l = VADD(T1b, T1c);
+				   TI = VFMA(LDK(KP831469612), TC, VMUL(LDK(KP555570233), TH));
+				   TZ = VFNMS(LDK(KP555570233), TY, VMUL(LDK(KP831469612), TT));
+				   T10 = VSUB(TI, TZ);
+				   T1h = VADD(TI, TZ);
+			      }
+			      {
+				   V T11, T1e, T3p, T3q;
+				   T11 = VADD(Tr, T10);
+				   T1e = VBYI(VADD(T1a, T1d));
+				   T3p = VSUB(T11, T1e);
+				   STM2(&(xo[54]), T3p, ovs, &(xo[2]));
+				   STN2(&(xo[52]), T36, T3p, ovs);
+				   T3q = VADD(T11, T1e);
+				   STM2(&(xo[10]), T3q, ovs, &(xo[2]));
+				   STN2(&(xo[8]), T34, T3q, ovs);
+			      }
+			      {
+				   V T1n, T1o, T3r, T3s;
+				   T1n = VBYI(VADD(T1i, T1h));
+				   T1o = VADD(T1k, T1l);
+				   T3r = VADD(T1n, T1o);
+				   STM2(&(xo[6]), T3r, ovs, &(xo[2]));
+				   STN2(&(xo[4]), T3f, T3r, ovs);
+				   T3s = VSUB(T1o, T1n);
+				   STM2(&(xo[58]), T3s, ovs, &(xo[2]));
+				   STN2(&(xo[56]), T32, T3s, ovs);
+			      }
+			      {
+				   V T1f, T1g, T3t, T3u;
+				   T1f = VSUB(Tr, T10);
+				   T1g = VBYI(VSUB(T1d, T1a));
+				   T3t = VSUB(T1f, T1g);
+				   STM2(&(xo[42]), T3t, ovs, &(xo[2]));
+				   STN2(&(xo[40]), T33, T3t, ovs);
+				   T3u = VADD(T1f, T1g);
+				   STM2(&(xo[22]), T3u, ovs, &(xo[2]));
+				   STN2(&(xo[20]), T35, T3u, ovs);
+			      }
+			      {
+				   V T1j, T1m, T3v, T3w;
+				   T1j = VBYI(VSUB(T1h, T1i));
+				   T1m = VSUB(T1k, T1l);
+				   T3v = VADD(T1j, T1m);
+				   STM2(&(xo[26]), T3v, ovs, &(xo[2]));
+				   STN2(&(xo[24]), T31, T3v, ovs);
+				   T3w = VSUB(T1m, T1j);
+				   STM2(&(xo[38]), T3w, ovs, &(xo[2]));
+				   STN2(&(xo[36]), T3g, T3w, ovs);
+			      }
+			 }
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kdft_desc desc = { 32, XSIMD_STRING("n2bv_32"), { 170, 26, 16, 0 }, &GENUS, 0, 2, 0, 0 };
+
+void XSIMD(codelet_n2bv_32) (planner *p) { X(kdft_register) (p, n2bv_32, &desc);
+}
+
+#endif
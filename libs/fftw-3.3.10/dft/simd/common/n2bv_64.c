@@ -0,0 +1,1880 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:45:18 EDT 2021 */
+
+#include "dft/codelet-dft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_notw_c.native -fma -simd -compact -variables 4 -pipeline-latency 8 -sign 1 -n 64 -name n2bv_64 -with-ostride 2 -include dft/simd/n2b.h -store-multiple 2 */
+
+/*
+ * This function contains 456 FP additions, 258 FP multiplications,
+ * (or, 198 additions, 0 multiplications, 258 fused multiply/add),
+ * 120 stack variables, 15 constants, and 160 memory accesses
+ */
+#include "dft/simd/n2b.h"
+
+static void n2bv_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP820678790, +0.820678790828660330972281985331011598767386482);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP534511135, +0.534511135950791641089685961295362908582039528);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP098491403, +0.098491403357164253077197521291327432293052451);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP303346683, +0.303346683607342391675883946941299872384187453);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP198912367, +0.198912367379658006911597622644676228597850501);
+     DVK(KP668178637, +0.668178637919298919997757686523080761552472251);
+     DVK(KP414213562, +0.414213562373095048801688724209698078569671875);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  const R *xi;
+	  R *xo;
+	  xi = ii;
+	  xo = io;
+	  for (i = v; i > 0; i = i - VL, xi = xi + (VL * ivs), xo = xo + (VL * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T7, T26, T47, T69, T5k, T6A, T2V, T3z, Tm, T27, T5n, T6a, T2Y, T3M, T4e;
+	       V T6B, TC, T29, T6e, T6D, T3i, T3A, T4o, T5p, TR, T2a, T6h, T6E, T3l, T3B;
+	       V T4x, T5q, T1N, T2x, T6t, T71, T6w, T72, T1W, T2y, T39, T3H, T57, T5N, T5e;
+	       V T5O, T3c, T3I, T1g, T2u, T6m, T6Y, T6p, T6Z, T1p, T2v, T32, T3E, T4M, T5K;
+	       V T4T, T5L, T35, T3F;
+	       {
+		    V T3, T43, T25, T45, T6, T5i, T22, T44;
+		    {
+			 V T1, T2, T23, T24;
+			 T1 = LD(&(xi[0]), ivs, &(xi[0]));
+			 T2 = LD(&(xi[WS(is, 32)]), ivs, &(xi[0]));
+			 T3 = VADD(T1, T2);
+			 T43 = VSUB(T1, T2);
+			 T23 = LD(&(xi[WS(is, 56)]), ivs, &(xi[0]));
+			 T24 = LD(&(xi[WS(is, 24)]), ivs, &(xi[0]));
+			 T25 = VADD(T23, T24);
+			 T45 = VSUB(T23, T24);
+		    }
+		    {
+			 V T4, T5, T20, T21;
+			 T4 = LD(&(xi[WS(is, 16)]), ivs, &(xi[0]));
+			 T5 = LD(&(xi[WS(is, 48)]), ivs, &(xi[0]));
+			 T6 = VADD(T4, T5);
+			 T5i = VSUB(T4, T5);
+			 T20 = LD(&(xi[WS(is, 8)]), ivs, &(xi[0]));
+			 T21 = LD(&(xi[WS(is, 40)]), ivs, &(xi[0]));
+			 T22 = VADD(T20, T21);
+			 T44 = VSUB(T20, T21);
+		    }
+		    T7 = VSUB(T3, T6);
+		    T26 = VSUB(T22, T25);
+		    {
+			 V T46, T5j, T2T, T2U;
+			 T46 = VADD(T44, T45);
+			 T47 = VFMA(LDK(KP707106781), T46, T43);
+			 T69 = VFNMS(LDK(KP707106781), T46, T43);
+			 T5j = VSUB(T44, T45);
+			 T5k = VFMA(LDK(KP707106781), T5j, T5i);
+			 T6A = VFNMS(LDK(KP707106781), T5j, T5i);
+			 T2T = VADD(T3, T6);
+			 T2U = VADD(T22, T25);
+			 T2V = VADD(T2T, T2U);
+			 T3z = VSUB(T2T, T2U);
+		    }
+	       }
+	       {
+		    V Ta, T48, Tk, T4c, Td, T49, Th, T4b;
+		    {
+			 V T8, T9, Ti, Tj;
+			 T8 = LD(&(xi[WS(is, 4)]), ivs, &(xi[0]));
+			 T9 = LD(&(xi[WS(is, 36)]), ivs, &(xi[0]));
+			 Ta = VADD(T8, T9);
+			 T48 = VSUB(T8, T9);
+			 Ti = LD(&(xi[WS(is, 12)]), ivs, &(xi[0]));
+			 Tj = LD(&(xi[WS(is, 44)]), ivs, &(xi[0]));
+			 Tk = VADD(Ti, Tj);
+			 T4c = VSUB(Tj, Ti);
+		    }
+		    {
+			 V Tb, Tc, Tf, Tg;
+			 Tb = LD(&(xi[WS(is, 20)]), ivs, &(xi[0]));
+			 Tc = LD(&(xi[WS(is, 52)]), ivs, &(xi[0]));
+			 Td = VADD(Tb, Tc);
+			 T49 = VSUB(Tb, Tc);
+			 Tf = LD(&(xi[WS(is, 60)]), ivs, &(xi[0]));
+			 Tg = LD(&(xi[WS(is, 28)]), ivs, &(xi[0]));
+			 Th = VADD(Tf, Tg);
+			 T4b = VSUB(Tf, Tg);
+		    }
+		    {
+			 V Te, Tl, T5l, T5m;
+			 Te = VSUB(Ta, Td);
+			 Tl = VSUB(Th, Tk);
+			 Tm = VADD(Te, Tl);
+			 T27 = VSUB(Te, Tl);
+			 T5l = VFMA(LDK(KP414213562), T48, T49);
+			 T5m = VFMA(LDK(KP414213562), T4b, T4c);
+			 T5n = VSUB(T5l, T5m);
+			 T6a = VADD(T5l, T5m);
+		    }
+		    {
+			 V T2W, T2X, T4a, T4d;
+			 T2W = VADD(Ta, Td);
+			 T2X = VADD(Th, Tk);
+			 T2Y = VADD(T2W, T2X);
+			 T3M = VSUB(T2W, T2X);
+			 T4a = VFNMS(LDK(KP414213562), T49, T48);
+			 T4d = VFNMS(LDK(KP414213562), T4c, T4b);
+			 T4e = VADD(T4a, T4d);
+			 T6B = VSUB(T4a, T4d);
+		    }
+	       }
+	       {
+		    V Tq, T4g, Tt, T4l, Tx, T4m, TA, T4j;
+		    {
+			 V To, Tp, Tr, Ts;
+			 To = LD(&(xi[WS(is, 2)]), ivs, &(xi[0]));
+			 Tp = LD(&(xi[WS(is, 34)]), ivs, &(xi[0]));
+			 Tq = VADD(To, Tp);
+			 T4g = VSUB(To, Tp);
+			 Tr = LD(&(xi[WS(is, 18)]), ivs, &(xi[0]));
+			 Ts = LD(&(xi[WS(is, 50)]), ivs, &(xi[0]));
+			 Tt = VADD(Tr, Ts);
+			 T4l = VSUB(Tr, Ts);
+			 {
+			      V Tv, Tw, T4h, Ty, Tz, T4i;
+			      Tv = LD(&(xi[WS(is, 10)]), ivs, &(xi[0]));
+			      Tw = LD(&(xi[WS(is, 42)]), ivs, &(xi[0]));
+			      T4h = VSUB(Tv, Tw);
+			      Ty = LD(&(xi[WS(is, 58)]), ivs, &(xi[0]));
+			      Tz = LD(&(xi[WS(is, 26)]), ivs, &(xi[0]));
+			      T4i = VSUB(Ty, Tz);
+			      Tx = VADD(Tv, Tw);
+			      T4m = VSUB(T4h, T4i);
+			      TA = VADD(Ty, Tz);
+			      T4j = VADD(T4h, T4i);
+			 }
+		    }
+		    {
+			 V Tu, TB, T6c, T6d;
+			 Tu = VSUB(Tq, Tt);
+			 TB = VSUB(Tx, TA);
+			 TC = VFNMS(LDK(KP414213562), TB, Tu);
+			 T29 = VFMA(LDK(KP414213562), Tu, TB);
+			 T6c = VFNMS(LDK(KP707106781), T4m, T4l);
+			 T6d = VFNMS(LDK(KP707106781), T4j, T4g);
+			 T6e = VFNMS(LDK(KP668178637), T6d, T6c);
+			 T6D = VFMA(LDK(KP668178637), T6c, T6d);
+		    }
+		    {
+			 V T3g, T3h, T4k, T4n;
+			 T3g = VADD(Tq, Tt);
+			 T3h = VADD(Tx, TA);
+			 T3i = VADD(T3g, T3h);
+			 T3A = VSUB(T3g, T3h);
+			 T4k = VFMA(LDK(KP707106781), T4j, T4g);
+			 T4n = VFMA(LDK(KP707106781), T4m, T4l);
+			 T4o = VFNMS(LDK(KP198912367), T4n, T4k);
+			 T5p = VFMA(LDK(KP198912367), T4k, T4n);
+		    }
+	       }
+	       {
+		    V TF, T4p, TI, T4u, TM, T4v, TP, T4s;
+		    {
+			 V TD, TE, TG, TH;
+			 TD = LD(&(xi[WS(is, 62)]), ivs, &(xi[0]));
+			 TE = LD(&(xi[WS(is, 30)]), ivs, &(xi[0]));
+			 TF = VADD(TD, TE);
+			 T4p = VSUB(TD, TE);
+			 TG = LD(&(xi[WS(is, 14)]), ivs, &(xi[0]));
+			 TH = LD(&(xi[WS(is, 46)]), ivs, &(xi[0]));
+			 TI = VADD(TG, TH);
+			 T4u = VSUB(TH, TG);
+			 {
+			      V TK, TL, T4r, TN, TO, T4q;
+			      TK = LD(&(xi[WS(is, 54)]), ivs, &(xi[0]));
+			      TL = LD(&(xi[WS(is, 22)]), ivs, &(xi[0]));
+			      T4r = VSUB(TK, TL);
+			      TN = LD(&(xi[WS(is, 6)]), ivs, &(xi[0]));
+			      TO = LD(&(xi[WS(is, 38)]), ivs, &(xi[0]));
+			      T4q = VSUB(TN, TO);
+			      TM = VADD(TK, TL);
+			      T4v = VSUB(T4r, T4q);
+			      TP = VADD(TN, TO);
+			      T4s = VADD(T4q, T4r);
+			 }
+		    }
+		    {
+			 V TJ, TQ, T6f, T6g;
+			 TJ = VSUB(TF, TI);
+			 TQ = VSUB(TM, TP);
+			 TR = VFNMS(LDK(KP414213562), TQ, TJ);
+			 T2a = VFMA(LDK(KP414213562), TJ, TQ);
+			 T6f = VFNMS(LDK(KP707106781), T4v, T4u);
+			 T6g = VFNMS(LDK(KP707106781), T4s, T4p);
+			 T6h = VFNMS(LDK(KP668178637), T6g, T6f);
+			 T6E = VFMA(LDK(KP668178637), T6f, T6g);
+		    }
+		    {
+			 V T3j, T3k, T4t, T4w;
+			 T3j = VADD(TF, TI);
+			 T3k = VADD(TP, TM);
+			 T3l = VADD(T3j, T3k);
+			 T3B = VSUB(T3j, T3k);
+			 T4t = VFMA(LDK(KP707106781), T4s, T4p);
+			 T4w = VFMA(LDK(KP707106781), T4v, T4u);
+			 T4x = VFNMS(LDK(KP198912367), T4w, T4t);
+			 T5q = VFMA(LDK(KP198912367), T4t, T4w);
+		    }
+	       }
+	       {
+		    V T1t, T4V, T1w, T58, T1Q, T59, T1T, T4Y, T1A, T1D, T1E, T5b, T52, T1H, T1K;
+		    V T1L, T5c, T55;
+		    {
+			 V T1r, T1s, T1u, T1v;
+			 T1r = LD(&(xi[WS(is, 63)]), ivs, &(xi[WS(is, 1)]));
+			 T1s = LD(&(xi[WS(is, 31)]), ivs, &(xi[WS(is, 1)]));
+			 T1t = VADD(T1r, T1s);
+			 T4V = VSUB(T1r, T1s);
+			 T1u = LD(&(xi[WS(is, 15)]), ivs, &(xi[WS(is, 1)]));
+			 T1v = LD(&(xi[WS(is, 47)]), ivs, &(xi[WS(is, 1)]));
+			 T1w = VADD(T1u, T1v);
+			 T58 = VSUB(T1v, T1u);
+		    }
+		    {
+			 V T1O, T1P, T4X, T1R, T1S, T4W;
+			 T1O = LD(&(xi[WS(is, 55)]), ivs, &(xi[WS(is, 1)]));
+			 T1P = LD(&(xi[WS(is, 23)]), ivs, &(xi[WS(is, 1)]));
+			 T4X = VSUB(T1O, T1P);
+			 T1R = LD(&(xi[WS(is, 7)]), ivs, &(xi[WS(is, 1)]));
+			 T1S = LD(&(xi[WS(is, 39)]), ivs, &(xi[WS(is, 1)]));
+			 T4W = VSUB(T1R, T1S);
+			 T1Q = VADD(T1O, T1P);
+			 T59 = VSUB(T4X, T4W);
+			 T1T = VADD(T1R, T1S);
+			 T4Y = VADD(T4W, T4X);
+		    }
+		    {
+			 V T50, T51, T53, T54;
+			 {
+			      V T1y, T1z, T1B, T1C;
+			      T1y = LD(&(xi[WS(is, 3)]), ivs, &(xi[WS(is, 1)]));
+			      T1z = LD(&(xi[WS(is, 35)]), ivs, &(xi[WS(is, 1)]));
+			      T1A = VADD(T1y, T1z);
+			      T50 = VSUB(T1y, T1z);
+			      T1B = LD(&(xi[WS(is, 19)]), ivs, &(xi[WS(is, 1)]));
+			      T1C = LD(&(xi[WS(is, 51)]), ivs, &(xi[WS(is, 1)]));
+			      T1D = VADD(T1B, T1C);
+			      T51 = VSUB(T1C, T1B);
+			 }
+			 T1E = VSUB(T1A, T1D);
+			 T5b = VFNMS(LDK(KP414213562), T50, T51);
+			 T52 = VFMA(LDK(KP414213562), T51, T50);
+			 {
+			      V T1F, T1G, T1I, T1J;
+			      T1F = LD(&(xi[WS(is, 59)]), ivs, &(xi[WS(is, 1)]));
+			      T1G = LD(&(xi[WS(is, 27)]), ivs, &(xi[WS(is, 1)]));
+			      T1H = VADD(T1F, T1G);
+			      T53 = VSUB(T1F, T1G);
+			      T1I = LD(&(xi[WS(is, 11)]), ivs, &(xi[WS(is, 1)]));
+			      T1J = LD(&(xi[WS(is, 43)]), ivs, &(xi[WS(is, 1)]));
+			      T1K = VADD(T1I, T1J);
+			      T54 = VSUB(T1J, T1I);
+			 }
+			 T1L = VSUB(T1H, T1K);
+			 T5c = VFMA(LDK(KP414213562), T53, T54);
+			 T55 = VFNMS(LDK(KP414213562), T54, T53);
+		    }
+		    {
+			 V T1x, T1M, T6r, T6s;
+			 T1x = VSUB(T1t, T1w);
+			 T1M = VADD(T1E, T1L);
+			 T1N = VFMA(LDK(KP707106781), T1M, T1x);
+			 T2x = VFNMS(LDK(KP707106781), T1M, T1x);
+			 T6r = VFNMS(LDK(KP707106781), T4Y, T4V);
+			 T6s = VSUB(T5c, T5b);
+			 T6t = VFNMS(LDK(KP923879532), T6s, T6r);
+			 T71 = VFMA(LDK(KP923879532), T6s, T6r);
+		    }
+		    {
+			 V T6u, T6v, T1U, T1V;
+			 T6u = VFNMS(LDK(KP707106781), T59, T58);
+			 T6v = VSUB(T55, T52);
+			 T6w = VFMA(LDK(KP923879532), T6v, T6u);
+			 T72 = VFNMS(LDK(KP923879532), T6v, T6u);
+			 T1U = VSUB(T1Q, T1T);
+			 T1V = VSUB(T1L, T1E);
+			 T1W = VFMA(LDK(KP707106781), T1V, T1U);
+			 T2y = VFNMS(LDK(KP707106781), T1V, T1U);
+		    }
+		    {
+			 V T37, T38, T4Z, T56;
+			 T37 = VADD(T1t, T1w);
+			 T38 = VADD(T1T, T1Q);
+			 T39 = VADD(T37, T38);
+			 T3H = VSUB(T37, T38);
+			 T4Z = VFMA(LDK(KP707106781), T4Y, T4V);
+			 T56 = VADD(T52, T55);
+			 T57 = VFMA(LDK(KP923879532), T56, T4Z);
+			 T5N = VFNMS(LDK(KP923879532), T56, T4Z);
+		    }
+		    {
+			 V T5a, T5d, T3a, T3b;
+			 T5a = VFMA(LDK(KP707106781), T59, T58);
+			 T5d = VADD(T5b, T5c);
+			 T5e = VFMA(LDK(KP923879532), T5d, T5a);
+			 T5O = VFNMS(LDK(KP923879532), T5d, T5a);
+			 T3a = VADD(T1A, T1D);
+			 T3b = VADD(T1H, T1K);
+			 T3c = VADD(T3a, T3b);
+			 T3I = VSUB(T3b, T3a);
+		    }
+	       }
+	       {
+		    V TW, T4A, TZ, T4N, T1j, T4O, T1m, T4D, T13, T16, T17, T4Q, T4H, T1a, T1d;
+		    V T1e, T4R, T4K;
+		    {
+			 V TU, TV, TX, TY;
+			 TU = LD(&(xi[WS(is, 1)]), ivs, &(xi[WS(is, 1)]));
+			 TV = LD(&(xi[WS(is, 33)]), ivs, &(xi[WS(is, 1)]));
+			 TW = VADD(TU, TV);
+			 T4A = VSUB(TU, TV);
+			 TX = LD(&(xi[WS(is, 17)]), ivs, &(xi[WS(is, 1)]));
+			 TY = LD(&(xi[WS(is, 49)]), ivs, &(xi[WS(is, 1)]));
+			 TZ = VADD(TX, TY);
+			 T4N = VSUB(TX, TY);
+		    }
+		    {
+			 V T1h, T1i, T4B, T1k, T1l, T4C;
+			 T1h = LD(&(xi[WS(is, 9)]), ivs, &(xi[WS(is, 1)]));
+			 T1i = LD(&(xi[WS(is, 41)]), ivs, &(xi[WS(is, 1)]));
+			 T4B = VSUB(T1h, T1i);
+			 T1k = LD(&(xi[WS(is, 57)]), ivs, &(xi[WS(is, 1)]));
+			 T1l = LD(&(xi[WS(is, 25)]), ivs, &(xi[WS(is, 1)]));
+			 T4C = VSUB(T1k, T1l);
+			 T1j = VADD(T1h, T1i);
+			 T4O = VSUB(T4B, T4C);
+			 T1m = VADD(T1k, T1l);
+			 T4D = VADD(T4B, T4C);
+		    }
+		    {
+			 V T4F, T4G, T4I, T4J;
+			 {
+			      V T11, T12, T14, T15;
+			      T11 = LD(&(xi[WS(is, 5)]), ivs, &(xi[WS(is, 1)]));
+			      T12 = LD(&(xi[WS(is, 37)]), ivs, &(xi[WS(is, 1)]));
+			      T13 = VADD(T11, T12);
+			      T4F = VSUB(T11, T12);
+			      T14 = LD(&(xi[WS(is, 21)]), ivs, &(xi[WS(is, 1)]));
+			      T15 = LD(&(xi[WS(is, 53)]), ivs, &(xi[WS(is, 1)]));
+			      T16 = VADD(T14, T15);
+			      T4G = VSUB(T14, T15);
+			 }
+			 T17 = VSUB(T13, T16);
+			 T4Q = VFMA(LDK(KP414213562), T4F, T4G);
+			 T4H = VFNMS(LDK(KP414213562), T4G, T4F);
+			 {
+			      V T18, T19, T1b, T1c;
+			      T18 = LD(&(xi[WS(is, 61)]), ivs, &(xi[WS(is, 1)]));
+			      T19 = LD(&(xi[WS(is, 29)]), ivs, &(xi[WS(is, 1)]));
+			      T1a = VADD(T18, T19);
+			      T4I = VSUB(T18, T19);
+			      T1b = LD(&(xi[WS(is, 13)]), ivs, &(xi[WS(is, 1)]));
+			      T1c = LD(&(xi[WS(is, 45)]), ivs, &(xi[WS(is, 1)]));
+			      T1d = VADD(T1b, T1c);
+			      T4J = VSUB(T1b, T1c);
+			 }
+			 T1e = VSUB(T1a, T1d);
+			 T4R = VFNMS(LDK(KP414213562), T4I, T4J);
+			 T4K = VFMA(LDK(KP414213562), T4J, T4I);
+		    }
+		    {
+			 V T10, T1f, T6k, T6l;
+			 T10 = VSUB(TW, TZ);
+			 T1f = VADD(T17, T1e);
+			 T1g = VFMA(LDK(KP707106781), T1f, T10);
+			 T2u = VFNMS(LDK(KP707106781), T1f, T10);
+			 T6k = VFNMS(LDK(KP707106781), T4D, T4A);
+			 T6l = VSUB(T4Q, T4R);
+			 T6m = VFNMS(LDK(KP923879532), T6l, T6k);
+			 T6Y = VFMA(LDK(KP923879532), T6l, T6k);
+		    }
+		    {
+			 V T6n, T6o, T1n, T1o;
+			 T6n = VFNMS(LDK(KP707106781), T4O, T4N);
+			 T6o = VSUB(T4H, T4K);
+			 T6p = VFMA(LDK(KP923879532), T6o, T6n);
+			 T6Z = VFNMS(LDK(KP923879532), T6o, T6n);
+			 T1n = VSUB(T1j, T1m);
+			 T1o = VSUB(T17, T1e);
+			 T1p = VFMA(LDK(KP707106781), T1o, T1n);
+			 T2v = VFNMS(LDK(KP707106781), T1o, T1n);
+		    }
+		    {
+			 V T30, T31, T4E, T4L;
+			 T30 = VADD(TW, TZ);
+			 T31 = VADD(T1j, T1m);
+			 T32 = VADD(T30, T31);
+			 T3E = VSUB(T30, T31);
+			 T4E = VFMA(LDK(KP707106781), T4D, T4A);
+			 T4L = VADD(T4H, T4K);
+			 T4M = VFMA(LDK(KP923879532), T4L, T4E);
+			 T5K = VFNMS(LDK(KP923879532), T4L, T4E);
+		    }
+		    {
+			 V T4P, T4S, T33, T34;
+			 T4P = VFMA(LDK(KP707106781), T4O, T4N);
+			 T4S = VADD(T4Q, T4R);
+			 T4T = VFMA(LDK(KP923879532), T4S, T4P);
+			 T5L = VFNMS(LDK(KP923879532), T4S, T4P);
+			 T33 = VADD(T13, T16);
+			 T34 = VADD(T1a, T1d);
+			 T35 = VADD(T33, T34);
+			 T3F = VSUB(T33, T34);
+		    }
+	       }
+	       {
+		    V T7n, T7o, T7p, T7q, T7r, T7s, T7t, T7u, T7w, T7y, T7A, T7B, T7D, T7G, T7H;
+		    V T7J;
+		    {
+			 V T3t, T3x, T3w, T3y;
+			 {
+			      V T3r, T3s, T3u, T3v;
+			      T3r = VADD(T2V, T2Y);
+			      T3s = VADD(T3i, T3l);
+			      T3t = VSUB(T3r, T3s);
+			      T3x = VADD(T3r, T3s);
+			      T3u = VADD(T32, T35);
+			      T3v = VADD(T39, T3c);
+			      T3w = VSUB(T3u, T3v);
+			      T3y = VADD(T3u, T3v);
+			 }
+			 T7n = VFNMSI(T3w, T3t);
+			 STM2(&(xo[96]), T7n, ovs, &(xo[0]));
+			 T7o = VADD(T3x, T3y);
+			 STM2(&(xo[0]), T7o, ovs, &(xo[0]));
+			 T7p = VFMAI(T3w, T3t);
+			 STM2(&(xo[32]), T7p, ovs, &(xo[0]));
+			 T7q = VSUB(T3x, T3y);
+			 STM2(&(xo[64]), T7q, ovs, &(xo[0]));
+		    }
+		    {
+			 V T2Z, T3m, T3e, T3n, T36, T3d;
+			 T2Z = VSUB(T2V, T2Y);
+			 T3m = VSUB(T3i, T3l);
+			 T36 = VSUB(T32, T35);
+			 T3d = VSUB(T39, T3c);
+			 T3e = VADD(T36, T3d);
+			 T3n = VSUB(T36, T3d);
+			 {
+			      V T3f, T3o, T3p, T3q;
+			      T3f = VFNMS(LDK(KP707106781), T3e, T2Z);
+			      T3o = VFNMS(LDK(KP707106781), T3n, T3m);
+			      T7r = VFNMSI(T3o, T3f);
+			      STM2(&(xo[48]), T7r, ovs, &(xo[0]));
+			      T7s = VFMAI(T3o, T3f);
+			      STM2(&(xo[80]), T7s, ovs, &(xo[0]));
+			      T3p = VFMA(LDK(KP707106781), T3e, T2Z);
+			      T3q = VFMA(LDK(KP707106781), T3n, T3m);
+			      T7t = VFMAI(T3q, T3p);
+			      STM2(&(xo[16]), T7t, ovs, &(xo[0]));
+			      T7u = VFNMSI(T3q, T3p);
+			      STM2(&(xo[112]), T7u, ovs, &(xo[0]));
+			 }
+		    }
+		    {
+			 V T7v, T7x, T7z, T7C;
+			 {
+			      V T3D, T3V, T3O, T3Y, T3K, T3Z, T3R, T3W, T3C, T3N;
+			      T3C = VADD(T3A, T3B);
+			      T3D = VFMA(LDK(KP707106781), T3C, T3z);
+			      T3V = VFNMS(LDK(KP707106781), T3C, T3z);
+			      T3N = VSUB(T3A, T3B);
+			      T3O = VFMA(LDK(KP707106781), T3N, T3M);
+			      T3Y = VFNMS(LDK(KP707106781), T3N, T3M);
+			      {
+				   V T3G, T3J, T3P, T3Q;
+				   T3G = VFNMS(LDK(KP414213562), T3F, T3E);
+				   T3J = VFNMS(LDK(KP414213562), T3I, T3H);
+				   T3K = VADD(T3G, T3J);
+				   T3Z = VSUB(T3G, T3J);
+				   T3P = VFMA(LDK(KP414213562), T3E, T3F);
+				   T3Q = VFMA(LDK(KP414213562), T3H, T3I);
+				   T3R = VSUB(T3P, T3Q);
+				   T3W = VADD(T3P, T3Q);
+			      }
+			      {
+				   V T3L, T3S, T41, T42;
+				   T3L = VFNMS(LDK(KP923879532), T3K, T3D);
+				   T3S = VFNMS(LDK(KP923879532), T3R, T3O);
+				   T7v = VFNMSI(T3S, T3L);
+				   STM2(&(xo[56]), T7v, ovs, &(xo[0]));
+				   T7w = VFMAI(T3S, T3L);
+				   STM2(&(xo[72]), T7w, ovs, &(xo[0]));
+				   T41 = VFMA(LDK(KP923879532), T3W, T3V);
+				   T42 = VFNMS(LDK(KP923879532), T3Z, T3Y);
+				   T7x = VFNMSI(T42, T41);
+				   STM2(&(xo[24]), T7x, ovs, &(xo[0]));
+				   T7y = VFMAI(T42, T41);
+				   STM2(&(xo[104]), T7y, ovs, &(xo[0]));
+			      }
+			      {
+				   V T3T, T3U, T3X, T40;
+				   T3T = VFMA(LDK(KP923879532), T3K, T3D);
+				   T3U = VFMA(LDK(KP923879532), T3R, T3O);
+				   T7z = VFNMSI(T3U, T3T);
+				   STM2(&(xo[120]), T7z, ovs, &(xo[0]));
+				   T7A = VFMAI(T3U, T3T);
+				   STM2(&(xo[8]), T7A, ovs, &(xo[0]));
+				   T3X = VFNMS(LDK(KP923879532), T3W, T3V);
+				   T40 = VFMA(LDK(KP923879532), T3Z, T3Y);
+				   T7B = VFMAI(T40, T3X);
+				   STM2(&(xo[40]), T7B, ovs, &(xo[0]));
+				   T7C = VFNMSI(T40, T3X);
+				   STM2(&(xo[88]), T7C, ovs, &(xo[0]));
+			      }
+			 }
+			 {
+			      V T6X, T7f, T7b, T7g, T74, T7j, T78, T7i;
+			      {
+				   V T6V, T6W, T79, T7a;
+				   T6V = VFMA(LDK(KP923879532), T6a, T69);
+				   T6W = VADD(T6D, T6E);
+				   T6X = VFMA(LDK(KP831469612), T6W, T6V);
+				   T7f = VFNMS(LDK(KP831469612), T6W, T6V);
+				   T79 = VFNMS(LDK(KP303346683), T6Y, T6Z);
+				   T7a = VFNMS(LDK(KP303346683), T71, T72);
+				   T7b = VSUB(T79, T7a);
+				   T7g = VADD(T79, T7a);
+			      }
+			      {
+				   V T70, T73, T76, T77;
+				   T70 = VFMA(LDK(KP303346683), T6Z, T6Y);
+				   T73 = VFMA(LDK(KP303346683), T72, T71);
+				   T74 = VADD(T70, T73);
+				   T7j = VSUB(T70, T73);
+				   T76 = VFNMS(LDK(KP923879532), T6B, T6A);
+				   T77 = VSUB(T6e, T6h);
+				   T78 = VFMA(LDK(KP831469612), T77, T76);
+				   T7i = VFNMS(LDK(KP831469612), T77, T76);
+			      }
+			      {
+				   V T75, T7c, T7E, T7l, T7m, T7F;
+				   T75 = VFNMS(LDK(KP956940335), T74, T6X);
+				   T7c = VFNMS(LDK(KP956940335), T7b, T78);
+				   T7D = VFNMSI(T7c, T75);
+				   STM2(&(xo[70]), T7D, ovs, &(xo[2]));
+				   T7E = VFMAI(T7c, T75);
+				   STM2(&(xo[58]), T7E, ovs, &(xo[2]));
+				   STN2(&(xo[56]), T7v, T7E, ovs);
+				   T7l = VFNMS(LDK(KP956940335), T7g, T7f);
+				   T7m = VFMA(LDK(KP956940335), T7j, T7i);
+				   T7F = VFMAI(T7m, T7l);
+				   STM2(&(xo[26]), T7F, ovs, &(xo[2]));
+				   STN2(&(xo[24]), T7x, T7F, ovs);
+				   T7G = VFNMSI(T7m, T7l);
+				   STM2(&(xo[102]), T7G, ovs, &(xo[2]));
+			      }
+			      {
+				   V T7d, T7e, T7I, T7h, T7k, T7K;
+				   T7d = VFMA(LDK(KP956940335), T74, T6X);
+				   T7e = VFMA(LDK(KP956940335), T7b, T78);
+				   T7H = VFNMSI(T7e, T7d);
+				   STM2(&(xo[6]), T7H, ovs, &(xo[2]));
+				   T7I = VFMAI(T7e, T7d);
+				   STM2(&(xo[122]), T7I, ovs, &(xo[2]));
+				   STN2(&(xo[120]), T7z, T7I, ovs);
+				   T7h = VFMA(LDK(KP956940335), T7g, T7f);
+				   T7k = VFNMS(LDK(KP956940335), T7j, T7i);
+				   T7J = VFNMSI(T7k, T7h);
+				   STM2(&(xo[38]), T7J, ovs, &(xo[2]));
+				   T7K = VFMAI(T7k, T7h);
+				   STM2(&(xo[90]), T7K, ovs, &(xo[2]));
+				   STN2(&(xo[88]), T7C, T7K, ovs);
+			      }
+			 }
+		    }
+		    {
+			 V T7L, T7N, T7P, T7S;
+			 {
+			      V TT, T2j, T2f, T2k, T1Y, T2n, T2c, T2m;
+			      {
+				   V Tn, TS, T2d, T2e;
+				   Tn = VFMA(LDK(KP707106781), Tm, T7);
+				   TS = VADD(TC, TR);
+				   TT = VFMA(LDK(KP923879532), TS, Tn);
+				   T2j = VFNMS(LDK(KP923879532), TS, Tn);
+				   T2d = VFMA(LDK(KP198912367), T1g, T1p);
+				   T2e = VFMA(LDK(KP198912367), T1N, T1W);
+				   T2f = VSUB(T2d, T2e);
+				   T2k = VADD(T2d, T2e);
+			      }
+			      {
+				   V T1q, T1X, T28, T2b;
+				   T1q = VFNMS(LDK(KP198912367), T1p, T1g);
+				   T1X = VFNMS(LDK(KP198912367), T1W, T1N);
+				   T1Y = VADD(T1q, T1X);
+				   T2n = VSUB(T1q, T1X);
+				   T28 = VFMA(LDK(KP707106781), T27, T26);
+				   T2b = VSUB(T29, T2a);
+				   T2c = VFMA(LDK(KP923879532), T2b, T28);
+				   T2m = VFNMS(LDK(KP923879532), T2b, T28);
+			      }
+			      {
+				   V T1Z, T2g, T7M, T2p, T2q, T7O;
+				   T1Z = VFNMS(LDK(KP980785280), T1Y, TT);
+				   T2g = VFNMS(LDK(KP980785280), T2f, T2c);
+				   T7L = VFNMSI(T2g, T1Z);
+				   STM2(&(xo[60]), T7L, ovs, &(xo[0]));
+				   T7M = VFMAI(T2g, T1Z);
+				   STM2(&(xo[68]), T7M, ovs, &(xo[0]));
+				   STN2(&(xo[68]), T7M, T7D, ovs);
+				   T2p = VFMA(LDK(KP980785280), T2k, T2j);
+				   T2q = VFNMS(LDK(KP980785280), T2n, T2m);
+				   T7N = VFNMSI(T2q, T2p);
+				   STM2(&(xo[28]), T7N, ovs, &(xo[0]));
+				   T7O = VFMAI(T2q, T2p);
+				   STM2(&(xo[100]), T7O, ovs, &(xo[0]));
+				   STN2(&(xo[100]), T7O, T7G, ovs);
+			      }
+			      {
+				   V T2h, T2i, T7Q, T2l, T2o, T7R;
+				   T2h = VFMA(LDK(KP980785280), T1Y, TT);
+				   T2i = VFMA(LDK(KP980785280), T2f, T2c);
+				   T7P = VFNMSI(T2i, T2h);
+				   STM2(&(xo[124]), T7P, ovs, &(xo[0]));
+				   T7Q = VFMAI(T2i, T2h);
+				   STM2(&(xo[4]), T7Q, ovs, &(xo[0]));
+				   STN2(&(xo[4]), T7Q, T7H, ovs);
+				   T2l = VFNMS(LDK(KP980785280), T2k, T2j);
+				   T2o = VFMA(LDK(KP980785280), T2n, T2m);
+				   T7R = VFMAI(T2o, T2l);
+				   STM2(&(xo[36]), T7R, ovs, &(xo[0]));
+				   STN2(&(xo[36]), T7R, T7J, ovs);
+				   T7S = VFNMSI(T2o, T2l);
+				   STM2(&(xo[92]), T7S, ovs, &(xo[0]));
+			      }
+			 }
+			 {
+			      V T4z, T5z, T5v, T5A, T5g, T5D, T5s, T5C;
+			      {
+				   V T4f, T4y, T5t, T5u;
+				   T4f = VFMA(LDK(KP923879532), T4e, T47);
+				   T4y = VADD(T4o, T4x);
+				   T4z = VFMA(LDK(KP980785280), T4y, T4f);
+				   T5z = VFNMS(LDK(KP980785280), T4y, T4f);
+				   T5t = VFMA(LDK(KP098491403), T4M, T4T);
+				   T5u = VFMA(LDK(KP098491403), T57, T5e);
+				   T5v = VSUB(T5t, T5u);
+				   T5A = VADD(T5t, T5u);
+			      }
+			      {
+				   V T4U, T5f, T5o, T5r;
+				   T4U = VFNMS(LDK(KP098491403), T4T, T4M);
+				   T5f = VFNMS(LDK(KP098491403), T5e, T57);
+				   T5g = VADD(T4U, T5f);
+				   T5D = VSUB(T4U, T5f);
+				   T5o = VFMA(LDK(KP923879532), T5n, T5k);
+				   T5r = VSUB(T5p, T5q);
+				   T5s = VFMA(LDK(KP980785280), T5r, T5o);
+				   T5C = VFNMS(LDK(KP980785280), T5r, T5o);
+			      }
+			      {
+				   V T5h, T5w, T7T, T7U;
+				   T5h = VFNMS(LDK(KP995184726), T5g, T4z);
+				   T5w = VFNMS(LDK(KP995184726), T5v, T5s);
+				   T7T = VFNMSI(T5w, T5h);
+				   STM2(&(xo[62]), T7T, ovs, &(xo[2]));
+				   STN2(&(xo[60]), T7L, T7T, ovs);
+				   T7U = VFMAI(T5w, T5h);
+				   STM2(&(xo[66]), T7U, ovs, &(xo[2]));
+				   STN2(&(xo[64]), T7q, T7U, ovs);
+			      }
+			      {
+				   V T5F, T5G, T7V, T7W;
+				   T5F = VFMA(LDK(KP995184726), T5A, T5z);
+				   T5G = VFNMS(LDK(KP995184726), T5D, T5C);
+				   T7V = VFNMSI(T5G, T5F);
+				   STM2(&(xo[30]), T7V, ovs, &(xo[2]));
+				   STN2(&(xo[28]), T7N, T7V, ovs);
+				   T7W = VFMAI(T5G, T5F);
+				   STM2(&(xo[98]), T7W, ovs, &(xo[2]));
+				   STN2(&(xo[96]), T7n, T7W, ovs);
+			      }
+			      {
+				   V T5x, T5y, T7X, T7Y;
+				   T5x = VFMA(LDK(KP995184726), T5g, T4z);
+				   T5y = VFMA(LDK(KP995184726), T5v, T5s);
+				   T7X = VFNMSI(T5y, T5x);
+				   STM2(&(xo[126]), T7X, ovs, &(xo[2]));
+				   STN2(&(xo[124]), T7P, T7X, ovs);
+				   T7Y = VFMAI(T5y, T5x);
+				   STM2(&(xo[2]), T7Y, ovs, &(xo[2]));
+				   STN2(&(xo[0]), T7o, T7Y, ovs);
+			      }
+			      {
+				   V T5B, T5E, T7Z, T80;
+				   T5B = VFNMS(LDK(KP995184726), T5A, T5z);
+				   T5E = VFMA(LDK(KP995184726), T5D, T5C);
+				   T7Z = VFMAI(T5E, T5B);
+				   STM2(&(xo[34]), T7Z, ovs, &(xo[2]));
+				   STN2(&(xo[32]), T7p, T7Z, ovs);
+				   T80 = VFNMSI(T5E, T5B);
+				   STM2(&(xo[94]), T80, ovs, &(xo[2]));
+				   STN2(&(xo[92]), T7S, T80, ovs);
+			      }
+			 }
+		    }
+		    {
+			 V T81, T83, T85, T88;
+			 {
+			      V T6j, T6N, T6J, T6O, T6y, T6R, T6G, T6Q;
+			      {
+				   V T6b, T6i, T6H, T6I;
+				   T6b = VFNMS(LDK(KP923879532), T6a, T69);
+				   T6i = VADD(T6e, T6h);
+				   T6j = VFNMS(LDK(KP831469612), T6i, T6b);
+				   T6N = VFMA(LDK(KP831469612), T6i, T6b);
+				   T6H = VFMA(LDK(KP534511135), T6m, T6p);
+				   T6I = VFMA(LDK(KP534511135), T6t, T6w);
+				   T6J = VSUB(T6H, T6I);
+				   T6O = VADD(T6H, T6I);
+			      }
+			      {
+				   V T6q, T6x, T6C, T6F;
+				   T6q = VFNMS(LDK(KP534511135), T6p, T6m);
+				   T6x = VFNMS(LDK(KP534511135), T6w, T6t);
+				   T6y = VADD(T6q, T6x);
+				   T6R = VSUB(T6q, T6x);
+				   T6C = VFMA(LDK(KP923879532), T6B, T6A);
+				   T6F = VSUB(T6D, T6E);
+				   T6G = VFMA(LDK(KP831469612), T6F, T6C);
+				   T6Q = VFNMS(LDK(KP831469612), T6F, T6C);
+			      }
+			      {
+				   V T6z, T6K, T82, T6T, T6U, T84;
+				   T6z = VFNMS(LDK(KP881921264), T6y, T6j);
+				   T6K = VFNMS(LDK(KP881921264), T6J, T6G);
+				   T81 = VFNMSI(T6K, T6z);
+				   STM2(&(xo[54]), T81, ovs, &(xo[2]));
+				   T82 = VFMAI(T6K, T6z);
+				   STM2(&(xo[74]), T82, ovs, &(xo[2]));
+				   STN2(&(xo[72]), T7w, T82, ovs);
+				   T6T = VFMA(LDK(KP881921264), T6O, T6N);
+				   T6U = VFNMS(LDK(KP881921264), T6R, T6Q);
+				   T83 = VFNMSI(T6U, T6T);
+				   STM2(&(xo[22]), T83, ovs, &(xo[2]));
+				   T84 = VFMAI(T6U, T6T);
+				   STM2(&(xo[106]), T84, ovs, &(xo[2]));
+				   STN2(&(xo[104]), T7y, T84, ovs);
+			      }
+			      {
+				   V T6L, T6M, T86, T6P, T6S, T87;
+				   T6L = VFMA(LDK(KP881921264), T6y, T6j);
+				   T6M = VFMA(LDK(KP881921264), T6J, T6G);
+				   T85 = VFNMSI(T6M, T6L);
+				   STM2(&(xo[118]), T85, ovs, &(xo[2]));
+				   T86 = VFMAI(T6M, T6L);
+				   STM2(&(xo[10]), T86, ovs, &(xo[2]));
+				   STN2(&(xo[8]), T7A, T86, ovs);
+				   T6P = VFNMS(LDK(KP881921264), T6O, T6N);
+				   T6S = VFMA(LDK(KP881921264), T6R, T6Q);
+				   T87 = VFMAI(T6S, T6P);
+				   STM2(&(xo[42]), T87, ovs, &(xo[2]));
+				   STN2(&(xo[40]), T7B, T87, ovs);
+				   T88 = VFNMSI(T6S, T6P);
+				   STM2(&(xo[86]), T88, ovs, &(xo[2]));
+			      }
+			 }
+			 {
+			      V T89, T8c, T8d, T8f;
+			      {
+				   V T2t, T2L, T2H, T2M, T2A, T2P, T2E, T2O;
+				   {
+					V T2r, T2s, T2F, T2G;
+					T2r = VFNMS(LDK(KP707106781), Tm, T7);
+					T2s = VADD(T29, T2a);
+					T2t = VFMA(LDK(KP923879532), T2s, T2r);
+					T2L = VFNMS(LDK(KP923879532), T2s, T2r);
+					T2F = VFNMS(LDK(KP668178637), T2u, T2v);
+					T2G = VFNMS(LDK(KP668178637), T2x, T2y);
+					T2H = VSUB(T2F, T2G);
+					T2M = VADD(T2F, T2G);
+				   }
+				   {
+					V T2w, T2z, T2C, T2D;
+					T2w = VFMA(LDK(KP668178637), T2v, T2u);
+					T2z = VFMA(LDK(KP668178637), T2y, T2x);
+					T2A = VADD(T2w, T2z);
+					T2P = VSUB(T2w, T2z);
+					T2C = VFNMS(LDK(KP707106781), T27, T26);
+					T2D = VSUB(TC, TR);
+					T2E = VFNMS(LDK(KP923879532), T2D, T2C);
+					T2O = VFMA(LDK(KP923879532), T2D, T2C);
+				   }
+				   {
+					V T2B, T2I, T8a, T2R, T2S, T8b;
+					T2B = VFNMS(LDK(KP831469612), T2A, T2t);
+					T2I = VFNMS(LDK(KP831469612), T2H, T2E);
+					T89 = VFNMSI(T2I, T2B);
+					STM2(&(xo[76]), T89, ovs, &(xo[0]));
+					T8a = VFMAI(T2I, T2B);
+					STM2(&(xo[52]), T8a, ovs, &(xo[0]));
+					STN2(&(xo[52]), T8a, T81, ovs);
+					T2R = VFNMS(LDK(KP831469612), T2M, T2L);
+					T2S = VFMA(LDK(KP831469612), T2P, T2O);
+					T8b = VFMAI(T2S, T2R);
+					STM2(&(xo[20]), T8b, ovs, &(xo[0]));
+					STN2(&(xo[20]), T8b, T83, ovs);
+					T8c = VFNMSI(T2S, T2R);
+					STM2(&(xo[108]), T8c, ovs, &(xo[0]));
+				   }
+				   {
+					V T2J, T2K, T8e, T2N, T2Q, T8g;
+					T2J = VFMA(LDK(KP831469612), T2A, T2t);
+					T2K = VFMA(LDK(KP831469612), T2H, T2E);
+					T8d = VFNMSI(T2K, T2J);
+					STM2(&(xo[12]), T8d, ovs, &(xo[0]));
+					T8e = VFMAI(T2K, T2J);
+					STM2(&(xo[116]), T8e, ovs, &(xo[0]));
+					STN2(&(xo[116]), T8e, T85, ovs);
+					T2N = VFMA(LDK(KP831469612), T2M, T2L);
+					T2Q = VFNMS(LDK(KP831469612), T2P, T2O);
+					T8f = VFNMSI(T2Q, T2N);
+					STM2(&(xo[44]), T8f, ovs, &(xo[0]));
+					T8g = VFMAI(T2Q, T2N);
+					STM2(&(xo[84]), T8g, ovs, &(xo[0]));
+					STN2(&(xo[84]), T8g, T88, ovs);
+				   }
+			      }
+			      {
+				   V T5J, T61, T5X, T62, T5Q, T65, T5U, T64;
+				   {
+					V T5H, T5I, T5V, T5W;
+					T5H = VFNMS(LDK(KP923879532), T4e, T47);
+					T5I = VADD(T5p, T5q);
+					T5J = VFMA(LDK(KP980785280), T5I, T5H);
+					T61 = VFNMS(LDK(KP980785280), T5I, T5H);
+					T5V = VFNMS(LDK(KP820678790), T5K, T5L);
+					T5W = VFNMS(LDK(KP820678790), T5N, T5O);
+					T5X = VSUB(T5V, T5W);
+					T62 = VADD(T5V, T5W);
+				   }
+				   {
+					V T5M, T5P, T5S, T5T;
+					T5M = VFMA(LDK(KP820678790), T5L, T5K);
+					T5P = VFMA(LDK(KP820678790), T5O, T5N);
+					T5Q = VADD(T5M, T5P);
+					T65 = VSUB(T5M, T5P);
+					T5S = VFNMS(LDK(KP923879532), T5n, T5k);
+					T5T = VSUB(T4o, T4x);
+					T5U = VFNMS(LDK(KP980785280), T5T, T5S);
+					T64 = VFMA(LDK(KP980785280), T5T, T5S);
+				   }
+				   {
+					V T5R, T5Y, T8h, T8i;
+					T5R = VFNMS(LDK(KP773010453), T5Q, T5J);
+					T5Y = VFNMS(LDK(KP773010453), T5X, T5U);
+					T8h = VFNMSI(T5Y, T5R);
+					STM2(&(xo[78]), T8h, ovs, &(xo[2]));
+					STN2(&(xo[76]), T89, T8h, ovs);
+					T8i = VFMAI(T5Y, T5R);
+					STM2(&(xo[50]), T8i, ovs, &(xo[2]));
+					STN2(&(xo[48]), T7r, T8i, ovs);
+				   }
+				   {
+					V T67, T68, T8j, T8k;
+					T67 = VFNMS(LDK(KP773010453), T62, T61);
+					T68 = VFMA(LDK(KP773010453), T65, T64);
+					T8j = VFMAI(T68, T67);
+					STM2(&(xo[18]), T8j, ovs, &(xo[2]));
+					STN2(&(xo[16]), T7t, T8j, ovs);
+					T8k = VFNMSI(T68, T67);
+					STM2(&(xo[110]), T8k, ovs, &(xo[2]));
+					STN2(&(xo[108]), T8c, T8k, ovs);
+				   }
+				   {
+					V T5Z, T60, T8l, T8m;
+					T5Z = VFMA(LDK(KP773010453), T5Q, T5J);
+					T60 = VFMA(LDK(KP773010453), T5X, T5U);
+					T8l = VFNMSI(T60, T5Z);
+					STM2(&(xo[14]), T8l, ovs, &(xo[2]));
+					STN2(&(xo[12]), T8d, T8l, ovs);
+					T8m = VFMAI(T60, T5Z);
+					STM2(&(xo[114]), T8m, ovs, &(xo[2]));
+					STN2(&(xo[112]), T7u, T8m, ovs);
+				   }
+				   {
+					V T63, T66, T8n, T8o;
+					T63 = VFMA(LDK(KP773010453), T62, T61);
+					T66 = VFNMS(LDK(KP773010453), T65, T64);
+					T8n = VFNMSI(T66, T63);
+					STM2(&(xo[46]), T8n, ovs, &(xo[2]));
+					STN2(&(xo[44]), T8f, T8n, ovs);
+					T8o = VFMAI(T66, T63);
+					STM2(&(xo[82]), T8o, ovs, &(xo[2]));
+					STN2(&(xo[80]), T7s, T8o, ovs);
+				   }
+			      }
+			 }
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kdft_desc desc = { 64, XSIMD_STRING("n2bv_64"), { 198, 0, 258, 0 }, &GENUS, 0, 2, 0, 0 };
+
+void XSIMD(codelet_n2bv_64) (planner *p) { X(kdft_register) (p, n2bv_64, &desc);
+}
+
+#else
+
+/* Generated by: ../../../genfft/gen_notw_c.native -simd -compact -variables 4 -pipeline-latency 8 -sign 1 -n 64 -name n2bv_64 -with-ostride 2 -include dft/simd/n2b.h -store-multiple 2 */
+
+/*
+ * This function contains 456 FP additions, 124 FP multiplications,
+ * (or, 404 additions, 72 multiplications, 52 fused multiply/add),
+ * 128 stack variables, 15 constants, and 160 memory accesses
+ */
+#include "dft/simd/n2b.h"
+
+static void n2bv_64(const R *ri, const R *ii, R *ro, R *io, stride is, stride os, INT v, INT ivs, INT ovs)
+{
+     DVK(KP634393284, +0.634393284163645498215171613225493370675687095);
+     DVK(KP773010453, +0.773010453362736960810906609758469800971041293);
+     DVK(KP290284677, +0.290284677254462367636192375817395274691476278);
+     DVK(KP956940335, +0.956940335732208864935797886980269969482849206);
+     DVK(KP098017140, +0.098017140329560601994195563888641845861136673);
+     DVK(KP995184726, +0.995184726672196886244836953109479921575474869);
+     DVK(KP471396736, +0.471396736825997648556387625905254377657460319);
+     DVK(KP881921264, +0.881921264348355029712756863660388349508442621);
+     DVK(KP195090322, +0.195090322016128267848284868477022240927691618);
+     DVK(KP980785280, +0.980785280403230449126182236134239036973933731);
+     DVK(KP555570233, +0.555570233019602224742830813948532874374937191);
+     DVK(KP831469612, +0.831469612302545237078788377617905756738560812);
+     DVK(KP923879532, +0.923879532511286756128183189396788286822416626);
+     DVK(KP382683432, +0.382683432365089771728459984030398866761344562);
+     DVK(KP707106781, +0.707106781186547524400844362104849039284835938);
+     {
+	  INT i;
+	  const R *xi;
+	  R *xo;
+	  xi = ii;
+	  xo = io;
+	  for (i = v; i > 0; i = i - VL, xi = xi + (VL * ivs), xo = xo + (VL * ovs), MAKE_VOLATILE_STRIDE(128, is), MAKE_VOLATILE_STRIDE(128, os)) {
+	       V T4p, T5u, Tb, T3A, T2q, T3v, T6G, T78, Tq, T3w, T6B, T79, T2l, T3B, T4w;
+	       V T5r, TI, T2g, T6u, T74, T3q, T3D, T4E, T5o, TZ, T2h, T6x, T75, T3t, T3E;
+	       V T4L, T5p, T23, T2N, T6m, T70, T6p, T71, T2c, T2O, T3i, T3Y, T5f, T5R, T5k;
+	       V T5S, T3l, T3Z, T1s, T2K, T6f, T6X, T6i, T6Y, T1B, T2L, T3b, T3V, T4Y, T5O;
+	       V T53, T5P, T3e, T3W;
+	       {
+		    V T3, T4n, T2p, T4o, T6, T5s, T9, T5t;
+		    {
+			 V T1, T2, T2n, T2o;
+			 T1 = LD(&(xi[0]), ivs, &(xi[0]));
+			 T2 = LD(&(xi[WS(is, 32)]), ivs, &(xi[0]));
+			 T3 = VSUB(T1, T2);
+			 T4n = VADD(T1, T2);
+			 T2n = LD(&(xi[WS(is, 16)]), ivs, &(xi[0]));
+			 T2o = LD(&(xi[WS(is, 48)]), ivs, &(xi[0]));
+			 T2p = VSUB(T2n, T2o);
+			 T4o = VADD(T2n, T2o);
+		    }
+		    {
+			 V T4, T5, T7, T8;
+			 T4 = LD(&(xi[WS(is, 8)]), ivs, &(xi[0]));
+			 T5 = LD(&(xi[WS(is, 40)]), ivs, &(xi[0]));
+			 T6 = VSUB(T4, T5);
+			 T5s = VADD(T4, T5);
+			 T7 = LD(&(xi[WS(is, 56)]), ivs, &(xi[0]));
+			 T8 = LD(&(xi[WS(is, 24)]), ivs, &(xi[0]));
+			 T9 = VSUB(T7, T8);
+			 T5t = VADD(T7, T8);
+		    }
+		    T4p = VSUB(T4n, T4o);
+		    T5u = VSUB(T5s, T5t);
+		    {
+			 V Ta, T2m, T6E, T6F;
+			 Ta = VMUL(LDK(KP707106781), VADD(T6, T9));
+			 Tb = VSUB(T3, Ta);
+			 T3A = VADD(T3, Ta);
+			 T2m = VMUL(LDK(KP707106781), VSUB(T6, T9));
+			 T2q = VSUB(T2m, T2p);
+			 T3v = VADD(T2p, T2m);
+			 T6E = VADD(T4n, T4o);
+			 T6F = VADD(T5s, T5t);
+			 T6G = VSUB(T6E, T6F);
+			 T78 = VADD(T6E, T6F);
+		    }
+	       }
+	       {
+		    V Te, T4q, To, T4t, Th, T4r, Tl, T4u;
+		    {
+			 V Tc, Td, Tm, Tn;
+			 Tc = LD(&(xi[WS(is, 4)]), ivs, &(xi[0]));
+			 Td = LD(&(xi[WS(is, 36)]), ivs, &(xi[0]));
+			 Te = VSUB(Tc, Td);
+			 T4q = VADD(Tc, Td);
+			 Tm = LD(&(xi[WS(is, 60)]), ivs, &(xi[0]));
+			 Tn = LD(&(xi[WS(is, 28)]), ivs, &(xi[0]));
+			 To = VSUB(Tm, Tn);
+			 T4t = VADD(Tm, Tn);
+		    }
+		    {
+			 V Tf, Tg, Tj, Tk;
+			 Tf = LD(&(xi[WS(is, 20)]), ivs, &(xi[0]));
+			 Tg = LD(&(xi[WS(is, 52)]), ivs, &(xi[0]));
+			 Th = VSUB(Tf, Tg);
+			 T4r = VADD(Tf, Tg);
+			 Tj = LD(&(xi[WS(is, 12)]), ivs, &(xi[0]));
+			 Tk = LD(&(xi[WS(is, 44)]), ivs, &(xi[0]));
+			 Tl = VSUB(Tj, Tk);
+			 T4u = VADD(Tj, Tk);
+		    }
+		    {
+			 V Ti, Tp, T6z, T6A;
+			 Ti = VFMA(LDK(KP382683432), Te, VMUL(LDK(KP923879532), Th));
+			 Tp = VFNMS(LDK(KP382683432), To, VMUL(LDK(KP923879532), Tl));
+			 Tq = VSUB(Ti, Tp);
+			 T3w = VADD(Ti, Tp);
+			 T6z = VADD(T4q, T4r);
+			 T6A = VADD(T4t, T4u);
+			 T6B = VSUB(T6z, T6A);
+			 T79 = VADD(T6z, T6A);
+		    }
+		    {
+			 V T2j, T2k, T4s, T4v;
+			 T2j = VFNMS(LDK(KP382683432), Th, VMUL(LDK(KP923879532), Te));
+			 T2k = VFMA(LDK(KP923879532), To, VMUL(LDK(KP382683432), Tl));
+			 T2l = VSUB(T2j, T2k);
+			 T3B = VADD(T2j, T2k);
+			 T4s = VSUB(T4q, T4r);
+			 T4v = VSUB(T4t, T4u);
+			 T4w = VMUL(LDK(KP707106781), VADD(T4s, T4v));
+			 T5r = VMUL(LDK(KP707106781), VSUB(T4s, T4v));
+		    }
+	       }
+	       {
+		    V TB, T4z, TF, T4y, Ty, T4C, TG, T4B;
+		    {
+			 V Tz, TA, TD, TE;
+			 Tz = LD(&(xi[WS(is, 18)]), ivs, &(xi[0]));
+			 TA = LD(&(xi[WS(is, 50)]), ivs, &(xi[0]));
+			 TB = VSUB(Tz, TA);
+			 T4z = VADD(Tz, TA);
+			 TD = LD(&(xi[WS(is, 2)]), ivs, &(xi[0]));
+			 TE = LD(&(xi[WS(is, 34)]), ivs, &(xi[0]));
+			 TF = VSUB(TD, TE);
+			 T4y = VADD(TD, TE);
+			 {
+			      V Ts, Tt, Tu, Tv, Tw, Tx;
+			      Ts = LD(&(xi[WS(is, 10)]), ivs, &(xi[0]));
+			      Tt = LD(&(xi[WS(is, 42)]), ivs, &(xi[0]));
+			      Tu = VSUB(Ts, Tt);
+			      Tv = LD(&(xi[WS(is, 58)]), ivs, &(xi[0]));
+			      Tw = LD(&(xi[WS(is, 26)]), ivs, &(xi[0]));
+			      Tx = VSUB(Tv, Tw);
+			      Ty = VMUL(LDK(KP707106781), VSUB(Tu, Tx));
+			      T4C = VADD(Tv, Tw);
+			      TG = VMUL(LDK(KP707106781), VADD(Tu, Tx));
+			      T4B = VADD(Ts, Tt);
+			 }
+		    }
+		    {
+			 V TC, TH, T6s, T6t;
+			 TC = VSUB(Ty, TB);
+			 TH = VSUB(TF, TG);
+			 TI = VFMA(LDK(KP831469612), TC, VMUL(LDK(KP555570233), TH));
+			 T2g = VFNMS(LDK(KP555570233), TC, VMUL(LDK(KP831469612), TH));
+			 T6s = VADD(T4y, T4z);
+			 T6t = VADD(T4B, T4C);
+			 T6u = VSUB(T6s, T6t);
+			 T74 = VADD(T6s, T6t);
+		    }
+		    {
+			 V T3o, T3p, T4A, T4D;
+			 T3o = VADD(TB, Ty);
+			 T3p = VADD(TF, TG);
+			 T3q = VFMA(LDK(KP980785280), T3o, VMUL(LDK(KP195090322), T3p));
+			 T3D = VFNMS(LDK(KP195090322), T3o, VMUL(LDK(KP980785280), T3p));
+			 T4A = VSUB(T4y, T4z);
+			 T4D = VSUB(T4B, T4C);
+			 T4E = VFMA(LDK(KP382683432), T4A, VMUL(LDK(KP923879532), T4D));
+			 T5o = VFNMS(LDK(KP382683432), T4D, VMUL(LDK(KP923879532), T4A));
+		    }
+	       }
+	       {
+		    V TS, T4J, TW, T4I, TP, T4G, TX, T4F;
+		    {
+			 V TQ, TR, TU, TV;
+			 TQ = LD(&(xi[WS(is, 14)]), ivs, &(xi[0]));
+			 TR = LD(&(xi[WS(is, 46)]), ivs, &(xi[0]));
+			 TS = VSUB(TQ, TR);
+			 T4J = VADD(TQ, TR);
+			 TU = LD(&(xi[WS(is, 62)]), ivs, &(xi[0]));
+			 TV = LD(&(xi[WS(is, 30)]), ivs, &(xi[0]));
+			 TW = VSUB(TU, TV);
+			 T4I = VADD(TU, TV);
+			 {
+			      V TJ, TK, TL, TM, TN, TO;
+			      TJ = LD(&(xi[WS(is, 6)]), ivs, &(xi[0]));
+			      TK = LD(&(xi[WS(is, 38)]), ivs, &(xi[0]));
+			      TL = VSUB(TJ, TK);
+			      TM = LD(&(xi[WS(is, 54)]), ivs, &(xi[0]));
+			      TN = LD(&(xi[WS(is, 22)]), ivs, &(xi[0]));
+			      TO = VSUB(TM, TN);
+			      TP = VMUL(LDK(KP707106781), VSUB(TL, TO));
+			      T4G = VADD(TM, TN);
+			      TX = VMUL(LDK(KP707106781), VADD(TL, TO));
+			      T4F = VADD(TJ, TK);
+			 }
+		    }
+		    {
+			 V TT, TY, T6v, T6w;
+			 TT = VSUB(TP, TS);
+			 TY = VSUB(TW, TX);
+			 TZ = VFNMS(LDK(KP555570233), TY, VMUL(LDK(KP831469612), TT));
+			 T2h = VFMA(LDK(KP555570233), TT, VMUL(LDK(KP831469612), TY));
+			 T6v = VADD(T4I, T4J);
+			 T6w = VADD(T4F, T4G);
+			 T6x = VSUB(T6v, T6w);
+			 T75 = VADD(T6v, T6w);
+		    }
+		    {
+			 V T3r, T3s, T4H, T4K;
+			 T3r = VADD(TS, TP);
+			 T3s = VADD(TW, TX);
+			 T3t = VFNMS(LDK(KP195090322), T3s, VMUL(LDK(KP980785280), T3r));
+			 T3E = VFMA(LDK(KP195090322), T3r, VMUL(LDK(KP980785280), T3s));
+			 T4H = VSUB(T4F, T4G);
+			 T4K = VSUB(T4I, T4J);
+			 T4L = VFNMS(LDK(KP382683432), T4K, VMUL(LDK(KP923879532), T4H));
+			 T5p = VFMA(LDK(KP923879532), T4K, VMUL(LDK(KP382683432), T4H));
+		    }
+	       }
+	       {
+		    V T21, T5h, T26, T5g, T1Y, T5d, T27, T5c, T55, T56, T1J, T57, T29, T58, T59;
+		    V T1Q, T5a, T2a;
+		    {
+			 V T1Z, T20, T24, T25;
+			 T1Z = LD(&(xi[WS(is, 15)]), ivs, &(xi[WS(is, 1)]));
+			 T20 = LD(&(xi[WS(is, 47)]), ivs, &(xi[WS(is, 1)]));
+			 T21 = VSUB(T1Z, T20);
+			 T5h = VADD(T1Z, T20);
+			 T24 = LD(&(xi[WS(is, 63)]), ivs, &(xi[WS(is, 1)]));
+			 T25 = LD(&(xi[WS(is, 31)]), ivs, &(xi[WS(is, 1)]));
+			 T26 = VSUB(T24, T25);
+			 T5g = VADD(T24, T25);
+		    }
+		    {
+			 V T1S, T1T, T1U, T1V, T1W, T1X;
+			 T1S = LD(&(xi[WS(is, 7)]), ivs, &(xi[WS(is, 1)]));
+			 T1T = LD(&(xi[WS(is, 39)]), ivs, &(xi[WS(is, 1)]));
+			 T1U = VSUB(T1S, T1T);
+			 T1V = LD(&(xi[WS(is, 55)]), ivs, &(xi[WS(is, 1)]));
+			 T1W = LD(&(xi[WS(is, 23)]), ivs, &(xi[WS(is, 1)]));
+			 T1X = VSUB(T1V, T1W);
+			 T1Y = VMUL(LDK(KP707106781), VSUB(T1U, T1X));
+			 T5d = VADD(T1V, T1W);
+			 T27 = VMUL(LDK(KP707106781), VADD(T1U, T1X));
+			 T5c = VADD(T1S, T1T);
+		    }
+		    {
+			 V T1F, T1I, T1M, T1P;
+			 {
+			      V T1D, T1E, T1G, T1H;
+			      T1D = LD(&(xi[WS(is, 3)]), ivs, &(xi[WS(is, 1)]));
+			      T1E = LD(&(xi[WS(is, 35)]), ivs, &(xi[WS(is, 1)]));
+			      T1F = VSUB(T1D, T1E);
+			      T55 = VADD(T1D, T1E);
+			      T1G = LD(&(xi[WS(is, 19)]), ivs, &(xi[WS(is, 1)]));
+			      T1H = LD(&(xi[WS(is, 51)]), ivs, &(xi[WS(is, 1)]));
+			      T1I = VSUB(T1G, T1H);
+			      T56 = VADD(T1G, T1H);
+			 }
+			 T1J = VFNMS(LDK(KP382683432), T1I, VMUL(LDK(KP923879532), T1F));
+			 T57 = VSUB(T55, T56);
+			 T29 = VFMA(LDK(KP382683432), T1F, VMUL(LDK(KP923879532), T1I));
+			 {
+			      V T1K, T1L, T1N, T1O;
+			      T1K = LD(&(xi[WS(is, 59)]), ivs, &(xi[WS(is, 1)]));
+			      T1L = LD(&(xi[WS(is, 27)]), ivs, &(xi[WS(is, 1)]));
+			      T1M = VSUB(T1K, T1L);
+			      T58 = VADD(T1K, T1L);
+			      T1N = LD(&(xi[WS(is, 11)]), ivs, &(xi[WS(is, 1)]));
+			      T1O = LD(&(xi[WS(is, 43)]), ivs, &(xi[WS(is, 1)]));
+			      T1P = VSUB(T1N, T1O);
+			      T59 = VADD(T1N, T1O);
+			 }
+			 T1Q = VFMA(LDK(KP923879532), T1M, VMUL(LDK(KP382683432), T1P));
+			 T5a = VSUB(T58, T59);
+			 T2a = VFNMS(LDK(KP382683432), T1M, VMUL(LDK(KP923879532), T1P));
+		    }
+		    {
+			 V T1R, T22, T6k, T6l;
+			 T1R = VSUB(T1J, T1Q);
+			 T22 = VSUB(T1Y, T21);
+			 T23 = VSUB(T1R, T22);
+			 T2N = VADD(T22, T1R);
+			 T6k = VADD(T5g, T5h);
+			 T6l = VADD(T5c, T5d);
+			 T6m = VSUB(T6k, T6l);
+			 T70 = VADD(T6k, T6l);
+		    }
+		    {
+			 V T6n, T6o, T28, T2b;
+			 T6n = VADD(T55, T56);
+			 T6o = VADD(T58, T59);
+			 T6p = VSUB(T6n, T6o);
+			 T71 = VADD(T6n, T6o);
+			 T28 = VSUB(T26, T27);
+			 T2b = VSUB(T29, T2a);
+			 T2c = VSUB(T28, T2b);
+			 T2O = VADD(T28, T2b);
+		    }
+		    {
+			 V T3g, T3h, T5b, T5e;
+			 T3g = VADD(T26, T27);
+			 T3h = VADD(T1J, T1Q);
+			 T3i = VADD(T3g, T3h);
+			 T3Y = VSUB(T3g, T3h);
+			 T5b = VMUL(LDK(KP707106781), VSUB(T57, T5a));
+			 T5e = VSUB(T5c, T5d);
+			 T5f = VSUB(T5b, T5e);
+			 T5R = VADD(T5e, T5b);
+		    }
+		    {
+			 V T5i, T5j, T3j, T3k;
+			 T5i = VSUB(T5g, T5h);
+			 T5j = VMUL(LDK(KP707106781), VADD(T57, T5a));
+			 T5k = VSUB(T5i, T5j);
+			 T5S = VADD(T5i, T5j);
+			 T3j = VADD(T21, T1Y);
+			 T3k = VADD(T29, T2a);
+			 T3l = VADD(T3j, T3k);
+			 T3Z = VSUB(T3k, T3j);
+		    }
+	       }
+	       {
+		    V T1q, T50, T1v, T4Z, T1n, T4W, T1w, T4V, T4O, T4P, T18, T4Q, T1y, T4R, T4S;
+		    V T1f, T4T, T1z;
+		    {
+			 V T1o, T1p, T1t, T1u;
+			 T1o = LD(&(xi[WS(is, 17)]), ivs, &(xi[WS(is, 1)]));
+			 T1p = LD(&(xi[WS(is, 49)]), ivs, &(xi[WS(is, 1)]));
+			 T1q = VSUB(T1o, T1p);
+			 T50 = VADD(T1o, T1p);
+			 T1t = LD(&(xi[WS(is, 1)]), ivs, &(xi[WS(is, 1)]));
+			 T1u = LD(&(xi[WS(is, 33)]), ivs, &(xi[WS(is, 1)]));
+			 T1v = VSUB(T1t, T1u);
+			 T4Z = VADD(T1t, T1u);
+		    }
+		    {
+			 V T1h, T1i, T1j, T1k, T1l, T1m;
+			 T1h = LD(&(xi[WS(is, 9)]), ivs, &(xi[WS(is, 1)]));
+			 T1i = LD(&(xi[WS(is, 41)]), ivs, &(xi[WS(is, 1)]));
+			 T1j = VSUB(T1h, T1i);
+			 T1k = LD(&(xi[WS(is, 57)]), ivs, &(xi[WS(is, 1)]));
+			 T1l = LD(&(xi[WS(is, 25)]), ivs, &(xi[WS(is, 1)]));
+			 T1m = VSUB(T1k, T1l);
+			 T1n = VMUL(LDK(KP707106781), VSUB(T1j, T1m));
+			 T4W = VADD(T1k, T1l);
+			 T1w = VMUL(LDK(KP707106781), VADD(T1j, T1m));
+			 T4V = VADD(T1h, T1i);
+		    }
+		    {
+			 V T14, T17, T1b, T1e;
+			 {
+			      V T12, T13, T15, T16;
+			      T12 = LD(&(xi[WS(is, 5)]), ivs, &(xi[WS(is, 1)]));
+			      T13 = LD(&(xi[WS(is, 37)]), ivs, &(xi[WS(is, 1)]));
+			      T14 = VSUB(T12, T13);
+			      T4O = VADD(T12, T13);
+			      T15 = LD(&(xi[WS(is, 21)]), ivs, &(xi[WS(is, 1)]));
+			      T16 = LD(&(xi[WS(is, 53)]), ivs, &(xi[WS(is, 1)]));
+			      T17 = VSUB(T15, T16);
+			      T4P = VADD(T15, T16);
+			 }
+			 T18 = VFNMS(LDK(KP382683432), T17, VMUL(LDK(KP923879532), T14));
+			 T4Q = VSUB(T4O, T4P);
+			 T1y = VFMA(LDK(KP382683432), T14, VMUL(LDK(KP923879532), T17));
+			 {
+			      V T19, T1a, T1c, T1d;
+			      T19 = LD(&(xi[WS(is, 61)]), ivs, &(xi[WS(is, 1)]));
+			      T1a = LD(&(xi[WS(is, 29)]), ivs, &(xi[WS(is, 1)]));
+			      T1b = VSUB(T19, T1a);
+			      T4R = VADD(T19, T1a);
+			      T1c = LD(&(xi[WS(is, 13)]), ivs, &(xi[WS(is, 1)]));
+			      T1d = LD(&(xi[WS(is, 45)]), ivs, &(xi[WS(is, 1)]));
+			      T1e = VSUB(T1c, T1d);
+			      T4S = VADD(T1c, T1d);
+			 }
+			 T1f = VFMA(LDK(KP923879532), T1b, VMUL(LDK(KP382683432), T1e));
+			 T4T = VSUB(T4R, T4S);
+			 T1z = VFNMS(LDK(KP382683432), T1b, VMUL(LDK(KP923879532), T1e));
+		    }
+		    {
+			 V T1g, T1r, T6d, T6e;
+			 T1g = VSUB(T18, T1f);
+			 T1r = VSUB(T1n, T1q);
+			 T1s = VSUB(T1g, T1r);
+			 T2K = VADD(T1r, T1g);
+			 T6d = VADD(T4Z, T50);
+			 T6e = VADD(T4V, T4W);
+			 T6f = VSUB(T6d, T6e);
+			 T6X = VADD(T6d, T6e);
+		    }
+		    {
+			 V T6g, T6h, T1x, T1A;
+			 T6g = VADD(T4O, T4P);
+			 T6h = VADD(T4R, T4S);
+			 T6i = VSUB(T6g, T6h);
+			 T6Y = VADD(T6g, T6h);
+			 T1x = VSUB(T1v, T1w);
+			 T1A = VSUB(T1y, T1z);
+			 T1B = VSUB(T1x, T1A);
+			 T2L = VADD(T1x, T1A);
+		    }
+		    {
+			 V T39, T3a, T4U, T4X;
+			 T39 = VADD(T1v, T1w);
+			 T3a = VADD(T18, T1f);
+			 T3b = VADD(T39, T3a);
+			 T3V = VSUB(T39, T3a);
+			 T4U = VMUL(LDK(KP707106781), VSUB(T4Q, T4T));
+			 T4X = VSUB(T4V, T4W);
+			 T4Y = VSUB(T4U, T4X);
+			 T5O = VADD(T4X, T4U);
+		    }
+		    {
+			 V T51, T52, T3c, T3d;
+			 T51 = VSUB(T4Z, T50);
+			 T52 = VMUL(LDK(KP707106781), VADD(T4Q, T4T));
+			 T53 = VSUB(T51, T52);
+			 T5P = VADD(T51, T52);
+			 T3c = VADD(T1q, T1n);
+			 T3d = VADD(T1y, T1z);
+			 T3e = VADD(T3c, T3d);
+			 T3W = VSUB(T3d, T3c);
+		    }
+	       }
+	       {
+		    V T7n, T7o, T7p, T7q, T7r, T7s, T7t, T7u, T7v, T7w, T7x, T7y, T7z, T7A, T7B;
+		    V T7C, T7D, T7E, T7F, T7G, T7H, T7I, T7J, T7K;
+		    {
+			 V T7h, T7l, T7k, T7m;
+			 {
+			      V T7f, T7g, T7i, T7j;
+			      T7f = VADD(T78, T79);
+			      T7g = VADD(T74, T75);
+			      T7h = VSUB(T7f, T7g);
+			      T7l = VADD(T7f, T7g);
+			      T7i = VADD(T6X, T6Y);
+			      T7j = VADD(T70, T71);
+			      T7k = VBYI(VSUB(T7i, T7j));
+			      T7m = VADD(T7i, T7j);
+			 }
+			 T7n = VSUB(T7h, T7k);
+			 STM2(&(xo[96]), T7n, ovs, &(xo[0]));
+			 T7o = VADD(T7l, T7m);
+			 STM2(&(xo[0]), T7o, ovs, &(xo[0]));
+			 T7p = VADD(T7h, T7k);
+			 STM2(&(xo[32]), T7p, ovs, &(xo[0]));
+			 T7q = VSUB(T7l, T7m);
+			 STM2(&(xo[64]), T7q, ovs, &(xo[0]));
+		    }
+		    {
+			 V T76, T7a, T73, T7b, T6Z, T72;
+			 T76 = VSUB(T74, T75);
+			 T7a = VSUB(T78, T79);
+			 T6Z = VSUB(T6X, T6Y);
+			 T72 = VSUB(T70, T71);
+			 T73 = VMUL(LDK(KP707106781), VSUB(T6Z, T72));
+			 T7b = VMUL(LDK(KP707106781), VADD(T6Z, T72));
+			 {
+			      V T77, T7c, T7d, T7e;
+			      T77 = VBYI(VSUB(T73, T76));
+			      T7c = VSUB(T7a, T7b);
+			      T7r = VADD(T77, T7c);
+			      STM2(&(xo[48]), T7r, ovs, &(xo[0]));
+			      T7s = VSUB(T7c, T77);
+			      STM2(&(xo[80]), T7s, ovs, &(xo[0]));
+			      T7d = VBYI(VADD(T76, T73));
+			      T7e = VADD(T7a, T7b);
+			      T7t = VADD(T7d, T7e);
+			      STM2(&(xo[16]), T7t, ovs, &(xo[0]));
+			      T7u = VSUB(T7e, T7d);
+			      STM2(&(xo[112]), T7u, ovs, &(xo[0]));
+			 }
+		    }
+		    {
+			 V T6C, T6S, T6I, T6P, T6r, T6Q, T6L, T6T, T6y, T6H;
+			 T6y = VMUL(LDK(KP707106781), VSUB(T6u, T6x));
+			 T6C = VSUB(T6y, T6B);
+			 T6S = VADD(T6B, T6y);
+			 T6H = VMUL(LDK(KP707106781), VADD(T6u, T6x));
+			 T6I = VSUB(T6G, T6H);
+			 T6P = VADD(T6G, T6H);
+			 {
+			      V T6j, T6q, T6J, T6K;
+			      T6j = VFNMS(LDK(KP382683432), T6i, VMUL(LDK(KP923879532), T6f));
+			      T6q = VFMA(LDK(KP923879532), T6m, VMUL(LDK(KP382683432), T6p));
+			      T6r = VSUB(T6j, T6q);
+			      T6Q = VADD(T6j, T6q);
+			      T6J = VFMA(LDK(KP382683432), T6f, VMUL(LDK(KP923879532), T6i));
+			      T6K = VFNMS(LDK(KP382683432), T6m, VMUL(LDK(KP923879532), T6p));
+			      T6L = VSUB(T6J, T6K);
+			      T6T = VADD(T6J, T6K);
+			 }
+			 {
+			      V T6D, T6M, T6V, T6W;
+			      T6D = VBYI(VSUB(T6r, T6C));
+			      T6M = VSUB(T6I, T6L);
+			      T7v = VADD(T6D, T6M);
+			      STM2(&(xo[40]), T7v, ovs, &(xo[0]));
+			      T7w = VSUB(T6M, T6D);
+			      STM2(&(xo[88]), T7w, ovs, &(xo[0]));
+			      T6V = VSUB(T6P, T6Q);
+			      T6W = VBYI(VSUB(T6T, T6S));
+			      T7x = VSUB(T6V, T6W);
+			      STM2(&(xo[72]), T7x, ovs, &(xo[0]));
+			      T7y = VADD(T6V, T6W);
+			      STM2(&(xo[56]), T7y, ovs, &(xo[0]));
+			 }
+			 {
+			      V T6N, T6O, T6R, T6U;
+			      T6N = VBYI(VADD(T6C, T6r));
+			      T6O = VADD(T6I, T6L);
+			      T7z = VADD(T6N, T6O);
+			      STM2(&(xo[24]), T7z, ovs, &(xo[0]));
+			      T7A = VSUB(T6O, T6N);
+			      STM2(&(xo[104]), T7A, ovs, &(xo[0]));
+			      T6R = VADD(T6P, T6Q);
+			      T6U = VBYI(VADD(T6S, T6T));
+			      T7B = VSUB(T6R, T6U);
+			      STM2(&(xo[120]), T7B, ovs, &(xo[0]));
+			      T7C = VADD(T6R, T6U);
+			      STM2(&(xo[8]), T7C, ovs, &(xo[0]));
+			 }
+		    }
+		    {
+			 V T5N, T68, T61, T69, T5U, T65, T5Y, T66;
+			 {
+			      V T5L, T5M, T5Z, T60;
+			      T5L = VADD(T4p, T4w);
+			      T5M = VADD(T5o, T5p);
+			      T5N = VSUB(T5L, T5M);
+			      T68 = VADD(T5L, T5M);
+			      T5Z = VFNMS(LDK(KP195090322), T5O, VMUL(LDK(KP980785280), T5P));
+			      T60 = VFMA(LDK(KP195090322), T5R, VMUL(LDK(KP980785280), T5S));
+			      T61 = VSUB(T5Z, T60);
+			      T69 = VADD(T5Z, T60);
+			 }
+			 {
+			      V T5Q, T5T, T5W, T5X;
+			      T5Q = VFMA(LDK(KP980785280), T5O, VMUL(LDK(KP195090322), T5P));
+			      T5T = VFNMS(LDK(KP195090322), T5S, VMUL(LDK(KP980785280), T5R));
+			      T5U = VSUB(T5Q, T5T);
+			      T65 = VADD(T5Q, T5T);
+			      T5W = VADD(T4E, T4L);
+			      T5X = VADD(T5u, T5r);
+			      T5Y = VSUB(T5W, T5X);
+			      T66 = VADD(T5X, T5W);
+			 }
+			 {
+			      V T5V, T62, T6b, T6c;
+			      T5V = VADD(T5N, T5U);
+			      T62 = VBYI(VADD(T5Y, T61));
+			      T7D = VSUB(T5V, T62);
+			      STM2(&(xo[100]), T7D, ovs, &(xo[0]));
+			      T7E = VADD(T5V, T62);
+			      STM2(&(xo[28]), T7E, ovs, &(xo[0]));
+			      T6b = VBYI(VADD(T66, T65));
+			      T6c = VADD(T68, T69);
+			      T7F = VADD(T6b, T6c);
+			      STM2(&(xo[4]), T7F, ovs, &(xo[0]));
+			      T7G = VSUB(T6c, T6b);
+			      STM2(&(xo[124]), T7G, ovs, &(xo[0]));
+			 }
+			 {
+			      V T63, T64, T67, T6a;
+			      T63 = VSUB(T5N, T5U);
+			      T64 = VBYI(VSUB(T61, T5Y));
+			      T7H = VSUB(T63, T64);
+			      STM2(&(xo[92]), T7H, ovs, &(xo[0]));
+			      T7I = VADD(T63, T64);
+			      STM2(&(xo[36]), T7I, ovs, &(xo[0]));
+			      T67 = VBYI(VSUB(T65, T66));
+			      T6a = VSUB(T68, T69);
+			      T7J = VADD(T67, T6a);
+			      STM2(&(xo[60]), T7J, ovs, &(xo[0]));
+			      T7K = VSUB(T6a, T67);
+			      STM2(&(xo[68]), T7K, ovs, &(xo[0]));
+			 }
+		    }
+		    {
+			 V T7M, T7O, T7P, T7R;
+			 {
+			      V T11, T2C, T2v, T2D, T2e, T2z, T2s, T2A;
+			      {
+				   V Tr, T10, T2t, T2u;
+				   Tr = VSUB(Tb, Tq);
+				   T10 = VSUB(TI, TZ);
+				   T11 = VSUB(Tr, T10);
+				   T2C = VADD(Tr, T10);
+				   T2t = VFNMS(LDK(KP471396736), T1s, VMUL(LDK(KP881921264), T1B));
+				   T2u = VFMA(LDK(KP471396736), T23, VMUL(LDK(KP881921264), T2c));
+				   T2v = VSUB(T2t, T2u);
+				   T2D = VADD(T2t, T2u);
+			      }
+			      {
+				   V T1C, T2d, T2i, T2r;
+				   T1C = VFMA(LDK(KP881921264), T1s, VMUL(LDK(KP471396736), T1B));
+				   T2d = VFNMS(LDK(KP471396736), T2c, VMUL(LDK(KP881921264), T23));
+				   T2e = VSUB(T1C, T2d);
+				   T2z = VADD(T1C, T2d);
+				   T2i = VSUB(T2g, T2h);
+				   T2r = VSUB(T2l, T2q);
+				   T2s = VSUB(T2i, T2r);
+				   T2A = VADD(T2r, T2i);
+			      }
+			      {
+				   V T2f, T2w, T7L, T2F, T2G, T7N;
+				   T2f = VADD(T11, T2e);
+				   T2w = VBYI(VADD(T2s, T2v));
+				   T7L = VSUB(T2f, T2w);
+				   STM2(&(xo[106]), T7L, ovs, &(xo[2]));
+				   STN2(&(xo[104]), T7A, T7L, ovs);
+				   T7M = VADD(T2f, T2w);
+				   STM2(&(xo[22]), T7M, ovs, &(xo[2]));
+				   T2F = VBYI(VADD(T2A, T2z));
+				   T2G = VADD(T2C, T2D);
+				   T7N = VADD(T2F, T2G);
+				   STM2(&(xo[10]), T7N, ovs, &(xo[2]));
+				   STN2(&(xo[8]), T7C, T7N, ovs);
+				   T7O = VSUB(T2G, T2F);
+				   STM2(&(xo[118]), T7O, ovs, &(xo[2]));
+			      }
+			      {
+				   V T2x, T2y, T7Q, T2B, T2E, T7S;
+				   T2x = VSUB(T11, T2e);
+				   T2y = VBYI(VSUB(T2v, T2s));
+				   T7P = VSUB(T2x, T2y);
+				   STM2(&(xo[86]), T7P, ovs, &(xo[2]));
+				   T7Q = VADD(T2x, T2y);
+				   STM2(&(xo[42]), T7Q, ovs, &(xo[2]));
+				   STN2(&(xo[40]), T7v, T7Q, ovs);
+				   T2B = VBYI(VSUB(T2z, T2A));
+				   T2E = VSUB(T2C, T2D);
+				   T7R = VADD(T2B, T2E);
+				   STM2(&(xo[54]), T7R, ovs, &(xo[2]));
+				   T7S = VSUB(T2E, T2B);
+				   STM2(&(xo[74]), T7S, ovs, &(xo[2]));
+				   STN2(&(xo[72]), T7x, T7S, ovs);
+			      }
+			 }
+			 {
+			      V T3n, T3O, T3J, T3R, T3y, T3Q, T3G, T3N;
+			      {
+				   V T3f, T3m, T3H, T3I;
+				   T3f = VFNMS(LDK(KP098017140), T3e, VMUL(LDK(KP995184726), T3b));
+				   T3m = VFMA(LDK(KP995184726), T3i, VMUL(LDK(KP098017140), T3l));
+				   T3n = VSUB(T3f, T3m);
+				   T3O = VADD(T3f, T3m);
+				   T3H = VFMA(LDK(KP098017140), T3b, VMUL(LDK(KP995184726), T3e));
+				   T3I = VFNMS(LDK(KP098017140), T3i, VMUL(LDK(KP995184726), T3l));
+				   T3J = VSUB(T3H, T3I);
+				   T3R = VADD(T3H, T3I);
+			      }
+			      {
+				   V T3u, T3x, T3C, T3F;
+				   T3u = VADD(T3q, T3t);
+				   T3x = VADD(T3v, T3w);
+				   T3y = VSUB(T3u, T3x);
+				   T3Q = VADD(T3x, T3u);
+				   T3C = VADD(T3A, T3B);
+				   T3F = VADD(T3D, T3E);
+				   T3G = VSUB(T3C, T3F);
+				   T3N = VADD(T3C, T3F);
+			      }
+			      {
+				   V T3z, T3K, T7T, T7U;
+				   T3z = VBYI(VSUB(T3n, T3y));
+				   T3K = VSUB(T3G, T3J);
+				   T7T = VADD(T3z, T3K);
+				   STM2(&(xo[34]), T7T, ovs, &(xo[2]));
+				   STN2(&(xo[32]), T7p, T7T, ovs);
+				   T7U = VSUB(T3K, T3z);
+				   STM2(&(xo[94]), T7U, ovs, &(xo[2]));
+				   STN2(&(xo[92]), T7H, T7U, ovs);
+			      }
+			      {
+				   V T3T, T3U, T7V, T7W;
+				   T3T = VSUB(T3N, T3O);
+				   T3U = VBYI(VSUB(T3R, T3Q));
+				   T7V = VSUB(T3T, T3U);
+				   STM2(&(xo[66]), T7V, ovs, &(xo[2]));
+				   STN2(&(xo[64]), T7q, T7V, ovs);
+				   T7W = VADD(T3T, T3U);
+				   STM2(&(xo[62]), T7W, ovs, &(xo[2]));
+				   STN2(&(xo[60]), T7J, T7W, ovs);
+			      }
+			      {
+				   V T3L, T3M, T7X, T7Y;
+				   T3L = VBYI(VADD(T3y, T3n));
+				   T3M = VADD(T3G, T3J);
+				   T7X = VADD(T3L, T3M);
+				   STM2(&(xo[30]), T7X, ovs, &(xo[2]));
+				   STN2(&(xo[28]), T7E, T7X, ovs);
+				   T7Y = VSUB(T3M, T3L);
+				   STM2(&(xo[98]), T7Y, ovs, &(xo[2]));
+				   STN2(&(xo[96]), T7n, T7Y, ovs);
+			      }
+			      {
+				   V T3P, T3S, T7Z, T80;
+				   T3P = VADD(T3N, T3O);
+				   T3S = VBYI(VADD(T3Q, T3R));
+				   T7Z = VSUB(T3P, T3S);
+				   STM2(&(xo[126]), T7Z, ovs, &(xo[2]));
+				   STN2(&(xo[124]), T7G, T7Z, ovs);
+				   T80 = VADD(T3P, T3S);
+				   STM2(&(xo[2]), T80, ovs, &(xo[2]));
+				   STN2(&(xo[0]), T7o, T80, ovs);
+			      }
+			 }
+			 {
+			      V T81, T83, T86, T88;
+			      {
+				   V T4N, T5G, T5z, T5H, T5m, T5D, T5w, T5E;
+				   {
+					V T4x, T4M, T5x, T5y;
+					T4x = VSUB(T4p, T4w);
+					T4M = VSUB(T4E, T4L);
+					T4N = VSUB(T4x, T4M);
+					T5G = VADD(T4x, T4M);
+					T5x = VFNMS(LDK(KP555570233), T4Y, VMUL(LDK(KP831469612), T53));
+					T5y = VFMA(LDK(KP555570233), T5f, VMUL(LDK(KP831469612), T5k));
+					T5z = VSUB(T5x, T5y);
+					T5H = VADD(T5x, T5y);
+				   }
+				   {
+					V T54, T5l, T5q, T5v;
+					T54 = VFMA(LDK(KP831469612), T4Y, VMUL(LDK(KP555570233), T53));
+					T5l = VFNMS(LDK(KP555570233), T5k, VMUL(LDK(KP831469612), T5f));
+					T5m = VSUB(T54, T5l);
+					T5D = VADD(T54, T5l);
+					T5q = VSUB(T5o, T5p);
+					T5v = VSUB(T5r, T5u);
+					T5w = VSUB(T5q, T5v);
+					T5E = VADD(T5v, T5q);
+				   }
+				   {
+					V T5n, T5A, T82, T5J, T5K, T84;
+					T5n = VADD(T4N, T5m);
+					T5A = VBYI(VADD(T5w, T5z));
+					T81 = VSUB(T5n, T5A);
+					STM2(&(xo[108]), T81, ovs, &(xo[0]));
+					T82 = VADD(T5n, T5A);
+					STM2(&(xo[20]), T82, ovs, &(xo[0]));
+					STN2(&(xo[20]), T82, T7M, ovs);
+					T5J = VBYI(VADD(T5E, T5D));
+					T5K = VADD(T5G, T5H);
+					T83 = VADD(T5J, T5K);
+					STM2(&(xo[12]), T83, ovs, &(xo[0]));
+					T84 = VSUB(T5K, T5J);
+					STM2(&(xo[116]), T84, ovs, &(xo[0]));
+					STN2(&(xo[116]), T84, T7O, ovs);
+				   }
+				   {
+					V T5B, T5C, T85, T5F, T5I, T87;
+					T5B = VSUB(T4N, T5m);
+					T5C = VBYI(VSUB(T5z, T5w));
+					T85 = VSUB(T5B, T5C);
+					STM2(&(xo[84]), T85, ovs, &(xo[0]));
+					STN2(&(xo[84]), T85, T7P, ovs);
+					T86 = VADD(T5B, T5C);
+					STM2(&(xo[44]), T86, ovs, &(xo[0]));
+					T5F = VBYI(VSUB(T5D, T5E));
+					T5I = VSUB(T5G, T5H);
+					T87 = VADD(T5F, T5I);
+					STM2(&(xo[52]), T87, ovs, &(xo[0]));
+					STN2(&(xo[52]), T87, T7R, ovs);
+					T88 = VSUB(T5I, T5F);
+					STM2(&(xo[76]), T88, ovs, &(xo[0]));
+				   }
+			      }
+			      {
+				   V T2J, T34, T2X, T35, T2Q, T31, T2U, T32;
+				   {
+					V T2H, T2I, T2V, T2W;
+					T2H = VADD(Tb, Tq);
+					T2I = VADD(T2g, T2h);
+					T2J = VSUB(T2H, T2I);
+					T34 = VADD(T2H, T2I);
+					T2V = VFNMS(LDK(KP290284677), T2K, VMUL(LDK(KP956940335), T2L));
+					T2W = VFMA(LDK(KP290284677), T2N, VMUL(LDK(KP956940335), T2O));
+					T2X = VSUB(T2V, T2W);
+					T35 = VADD(T2V, T2W);
+				   }
+				   {
+					V T2M, T2P, T2S, T2T;
+					T2M = VFMA(LDK(KP956940335), T2K, VMUL(LDK(KP290284677), T2L));
+					T2P = VFNMS(LDK(KP290284677), T2O, VMUL(LDK(KP956940335), T2N));
+					T2Q = VSUB(T2M, T2P);
+					T31 = VADD(T2M, T2P);
+					T2S = VADD(TI, TZ);
+					T2T = VADD(T2q, T2l);
+					T2U = VSUB(T2S, T2T);
+					T32 = VADD(T2T, T2S);
+				   }
+				   {
+					V T2R, T2Y, T89, T8a;
+					T2R = VADD(T2J, T2Q);
+					T2Y = VBYI(VADD(T2U, T2X));
+					T89 = VSUB(T2R, T2Y);
+					STM2(&(xo[102]), T89, ovs, &(xo[2]));
+					STN2(&(xo[100]), T7D, T89, ovs);
+					T8a = VADD(T2R, T2Y);
+					STM2(&(xo[26]), T8a, ovs, &(xo[2]));
+					STN2(&(xo[24]), T7z, T8a, ovs);
+				   }
+				   {
+					V T37, T38, T8b, T8c;
+					T37 = VBYI(VADD(T32, T31));
+					T38 = VADD(T34, T35);
+					T8b = VADD(T37, T38);
+					STM2(&(xo[6]), T8b, ovs, &(xo[2]));
+					STN2(&(xo[4]), T7F, T8b, ovs);
+					T8c = VSUB(T38, T37);
+					STM2(&(xo[122]), T8c, ovs, &(xo[2]));
+					STN2(&(xo[120]), T7B, T8c, ovs);
+				   }
+				   {
+					V T2Z, T30, T8d, T8e;
+					T2Z = VSUB(T2J, T2Q);
+					T30 = VBYI(VSUB(T2X, T2U));
+					T8d = VSUB(T2Z, T30);
+					STM2(&(xo[90]), T8d, ovs, &(xo[2]));
+					STN2(&(xo[88]), T7w, T8d, ovs);
+					T8e = VADD(T2Z, T30);
+					STM2(&(xo[38]), T8e, ovs, &(xo[2]));
+					STN2(&(xo[36]), T7I, T8e, ovs);
+				   }
+				   {
+					V T33, T36, T8f, T8g;
+					T33 = VBYI(VSUB(T31, T32));
+					T36 = VSUB(T34, T35);
+					T8f = VADD(T33, T36);
+					STM2(&(xo[58]), T8f, ovs, &(xo[2]));
+					STN2(&(xo[56]), T7y, T8f, ovs);
+					T8g = VSUB(T36, T33);
+					STM2(&(xo[70]), T8g, ovs, &(xo[2]));
+					STN2(&(xo[68]), T7K, T8g, ovs);
+				   }
+			      }
+			      {
+				   V T41, T4g, T4b, T4j, T44, T4i, T48, T4f;
+				   {
+					V T3X, T40, T49, T4a;
+					T3X = VFNMS(LDK(KP634393284), T3W, VMUL(LDK(KP773010453), T3V));
+					T40 = VFMA(LDK(KP773010453), T3Y, VMUL(LDK(KP634393284), T3Z));
+					T41 = VSUB(T3X, T40);
+					T4g = VADD(T3X, T40);
+					T49 = VFMA(LDK(KP634393284), T3V, VMUL(LDK(KP773010453), T3W));
+					T4a = VFNMS(LDK(KP634393284), T3Y, VMUL(LDK(KP773010453), T3Z));
+					T4b = VSUB(T49, T4a);
+					T4j = VADD(T49, T4a);
+				   }
+				   {
+					V T42, T43, T46, T47;
+					T42 = VSUB(T3D, T3E);
+					T43 = VSUB(T3w, T3v);
+					T44 = VSUB(T42, T43);
+					T4i = VADD(T43, T42);
+					T46 = VSUB(T3A, T3B);
+					T47 = VSUB(T3q, T3t);
+					T48 = VSUB(T46, T47);
+					T4f = VADD(T46, T47);
+				   }
+				   {
+					V T45, T4c, T8h, T8i;
+					T45 = VBYI(VSUB(T41, T44));
+					T4c = VSUB(T48, T4b);
+					T8h = VADD(T45, T4c);
+					STM2(&(xo[46]), T8h, ovs, &(xo[2]));
+					STN2(&(xo[44]), T86, T8h, ovs);
+					T8i = VSUB(T4c, T45);
+					STM2(&(xo[82]), T8i, ovs, &(xo[2]));
+					STN2(&(xo[80]), T7s, T8i, ovs);
+				   }
+				   {
+					V T4l, T4m, T8j, T8k;
+					T4l = VSUB(T4f, T4g);
+					T4m = VBYI(VSUB(T4j, T4i));
+					T8j = VSUB(T4l, T4m);
+					STM2(&(xo[78]), T8j, ovs, &(xo[2]));
+					STN2(&(xo[76]), T88, T8j, ovs);
+					T8k = VADD(T4l, T4m);
+					STM2(&(xo[50]), T8k, ovs, &(xo[2]));
+					STN2(&(xo[48]), T7r, T8k, ovs);
+				   }
+				   {
+					V T4d, T4e, T8l, T8m;
+					T4d = VBYI(VADD(T44, T41));
+					T4e = VADD(T48, T4b);
+					T8l = VADD(T4d, T4e);
+					STM2(&(xo[18]), T8l, ovs, &(xo[2]));
+					STN2(&(xo[16]), T7t, T8l, ovs);
+					T8m = VSUB(T4e, T4d);
+					STM2(&(xo[110]), T8m, ovs, &(xo[2]));
+					STN2(&(xo[108]), T81, T8m, ovs);
+				   }
+				   {
+					V T4h, T4k, T8n, T8o;
+					T4h = VADD(T4f, T4g);
+					T4k = VBYI(VADD(T4i, T4j));
+					T8n = VSUB(T4h, T4k);
+					STM2(&(xo[114]), T8n, ovs, &(xo[2]));
+					STN2(&(xo[112]), T7u, T8n, ovs);
+					T8o = VADD(T4h, T4k);
+					STM2(&(xo[14]), T8o, ovs, &(xo[2]));
+					STN2(&(xo[12]), T83, T8o, ovs);
+				   }
+			      }
+			 }
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const kdft_desc desc = { 64, XSIMD_STRING("n2bv_64"), { 404, 72, 52, 0 }, &GENUS, 0, 2, 0, 0 };
+
+void XSIMD(codelet_n2bv_64) (planner *p) { X(kdft_register) (p, n2bv_64, &desc);
+}
+
+#endif
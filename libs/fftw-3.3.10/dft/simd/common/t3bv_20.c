@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:45:57 EDT 2021 */
+
+#include "dft/codelet-dft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_twiddle_c.native -fma -simd -compact -variables 4 -pipeline-latency 8 -twiddle-log3 -precompute-twiddles -no-generate-bytw -n 20 -name t3bv_20 -include dft/simd/t3b.h -sign 1 */
+
+/*
+ * This function contains 138 FP additions, 118 FP multiplications,
+ * (or, 92 additions, 72 multiplications, 46 fused multiply/add),
+ * 73 stack variables, 4 constants, and 40 memory accesses
+ */
+#include "dft/simd/t3b.h"
+
+static void t3bv_20(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DVK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     DVK(KP618033988, +0.618033988749894848204586834365638117720309180);
+     DVK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DVK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     {
+	  INT m;
+	  R *x;
+	  x = ii;
+	  for (m = mb, W = W + (mb * ((TWVL / VL) * 8)); m < me; m = m + VL, x = x + (VL * ms), W = W + (TWVL * 8), MAKE_VOLATILE_STRIDE(20, rs)) {
+	       V T2, T8, T9, TA, T3, Tc, T4, TV, T14, Tl, Tq, Tx, TQ, Td, Te;
+	       V T1d, Ti, Tt, T11;
+	       T2 = LDW(&(W[0]));
+	       T8 = LDW(&(W[TWVL * 2]));
+	       T9 = VZMUL(T2, T8);
+	       TA = VZMULJ(T2, T8);
+	       T3 = LDW(&(W[TWVL * 4]));
+	       Tc = VZMULJ(T9, T3);
+	       T4 = VZMUL(T2, T3);
+	       TV = VZMUL(T9, T3);
+	       T14 = VZMULJ(TA, T3);
+	       Tl = VZMULJ(T8, T3);
+	       Tq = VZMULJ(T2, T3);
+	       Tx = VZMUL(T8, T3);
+	       TQ = VZMUL(TA, T3);
+	       Td = LDW(&(W[TWVL * 6]));
+	       Te = VZMULJ(Tc, Td);
+	       T1d = VZMULJ(T9, Td);
+	       Ti = VZMULJ(T8, Td);
+	       Tt = VZMULJ(T2, Td);
+	       T11 = VZMULJ(TA, Td);
+	       {
+		    V T7, T1g, T1F, T23, TU, T1n, T1o, T18, Tp, TE, TF, T27, T28, T29, T1P;
+		    V T1S, T1T, T1h, T1i, T1j, T24, T25, T26, T1I, T1L, T1M, T1B, T1C;
+		    {
+			 V T1, T1f, T6, T1c, T1e, T5, T1b, T1D, T1E;
+			 T1 = LD(&(x[0]), ms, &(x[0]));
+			 T1e = LD(&(x[WS(rs, 15)]), ms, &(x[WS(rs, 1)]));
+			 T1f = VZMUL(T1d, T1e);
+			 T5 = LD(&(x[WS(rs, 10)]), ms, &(x[0]));
+			 T6 = VZMUL(T4, T5);
+			 T1b = LD(&(x[WS(rs, 5)]), ms, &(x[WS(rs, 1)]));
+			 T1c = VZMUL(Tc, T1b);
+			 T7 = VSUB(T1, T6);
+			 T1g = VSUB(T1c, T1f);
+			 T1D = VADD(T1, T6);
+			 T1E = VADD(T1c, T1f);
+			 T1F = VSUB(T1D, T1E);
+			 T23 = VADD(T1D, T1E);
+		    }
+		    {
+			 V Th, T1G, T10, T1O, T17, T1R, To, T1J, Tw, T1N, TN, T1H, TT, T1K, TD;
+			 V T1Q;
+			 {
+			      V Tb, Tg, Ta, Tf;
+			      Ta = LD(&(x[WS(rs, 4)]), ms, &(x[0]));
+			      Tb = VZMUL(T9, Ta);
+			      Tf = LD(&(x[WS(rs, 14)]), ms, &(x[0]));
+			      Tg = VZMUL(Te, Tf);
+			      Th = VSUB(Tb, Tg);
+			      T1G = VADD(Tb, Tg);
+			 }
+			 {
+			      V TX, TZ, TW, TY;
+			      TW = LD(&(x[WS(rs, 13)]), ms, &(x[WS(rs, 1)]));
+			      TX = VZMUL(TV, TW);
+			      TY = LD(&(x[WS(rs, 3)]), ms, &(x[WS(rs, 1)]));
+			      TZ = VZMUL(T8, TY);
+			      T10 = VSUB(TX, TZ);
+			      T1O = VADD(TX, TZ);
+			 }
+			 {
+			      V T13, T16, T12, T15;
+			      T12 = LD(&(x[WS(rs, 17)]), ms, &(x[WS(rs, 1)]));
+			      T13 = VZMUL(T11, T12);
+			      T15 = LD(&(x[WS(rs, 7)]), ms, &(x[WS(rs, 1)]));
+			      T16 = VZMUL(T14, T15);
+			      T17 = VSUB(T13, T16);
+			      T1R = VADD(T13, T16);
+			 }
+			 {
+			      V Tk, Tn, Tj, Tm;
+			      Tj = LD(&(x[WS(rs, 16)]), ms, &(x[0]));
+			      Tk = VZMUL(Ti, Tj);
+			      Tm = LD(&(x[WS(rs, 6)]), ms, &(x[0]));
+			      Tn = VZMUL(Tl, Tm);
+			      To = VSUB(Tk, Tn);
+			      T1J = VADD(Tk, Tn);
+			 }
+			 {
+			      V Ts, Tv, Tr, Tu;
+			      Tr = LD(&(x[WS(rs, 8)]), ms, &(x[0]));
+			      Ts = VZMUL(Tq, Tr);
+			      Tu = LD(&(x[WS(rs, 18)]), ms, &(x[0]));
+			      Tv = VZMUL(Tt, Tu);
+			      Tw = VSUB(Ts, Tv);
+			      T1N = VADD(Ts, Tv);
+			 }
+			 {
+			      V TK, TM, TJ, TL;
+			      TJ = LD(&(x[WS(rs, 9)]), ms, &(x[WS(rs, 1)]));
+			      TK = VZMUL(T3, TJ);
+			      TL = LD(&(x[WS(rs, 19)]), ms, &(x[WS(rs, 1)]));
+			      TM = VZMUL(Td, TL);
+			      TN = VSUB(TK, TM);
+			      T1H = VADD(TK, TM);
+			 }
+			 {
+			      V TP, TS, TO, TR;
+			      TO = LD(&(x[WS(rs, 1)]), ms, &(x[WS(rs, 1)]));
+			      TP = VZMUL(T2, TO);
+			      TR = LD(&(x[WS(rs, 11)]), ms, &(x[WS(rs, 1)]));
+			      TS = VZMUL(TQ, TR);
+			      TT = VSUB(TP, TS);
+			      T1K = VADD(TP, TS);
+			 }
+			 {
+			      V Tz, TC, Ty, TB;
+			      Ty = LD(&(x[WS(rs, 12)]), ms, &(x[0]));
+			      Tz = VZMUL(Tx, Ty);
+			      TB = LD(&(x[WS(rs, 2)]), ms, &(x[0]));
+			      TC = VZMUL(TA, TB);
+			      TD = VSUB(Tz, TC);
+			      T1Q = VADD(Tz, TC);
+			 }
+			 TU = VSUB(TN, TT);
+			 T1n = VSUB(Th, To);
+			 T1o = VSUB(Tw, TD);
+			 T18 = VSUB(T10, T17);
+			 Tp = VADD(Th, To);
+			 TE = VADD(Tw, TD);
+			 TF = VADD(Tp, TE);
+			 T27 = VADD(T1N, T1O);
+			 T28 = VADD(T1Q, T1R);
+			 T29 = VADD(T27, T28);
+			 T1P = VSUB(T1N, T1O);
+			 T1S = VSUB(T1Q, T1R);
+			 T1T = VADD(T1P, T1S);
+			 T1h = VADD(TN, TT);
+			 T1i = VADD(T10, T17);
+			 T1j = VADD(T1h, T1i);
+			 T24 = VADD(T1G, T1H);
+			 T25 = VADD(T1J, T1K);
+			 T26 = VADD(T24, T25);
+			 T1I = VSUB(T1G, T1H);
+			 T1L = VSUB(T1J, T1K);
+			 T1M = VADD(T1I, T1L);
+		    }
+		    T1B = VADD(T7, TF);
+		    T1C = VADD(T1g, T1j);
+		    ST(&(x[WS(rs, 15)]), VFNMSI(T1C, T1B), ms, &(x[WS(rs, 1)]));
+		    ST(&(x[WS(rs, 5)]), VFMAI(T1C, T1B), ms, &(x[WS(rs, 1)]));
+		    {
+			 V T2c, T2a, T2b, T2g, T2i, T2e, T2f, T2h, T2d;
+			 T2c = VSUB(T26, T29);
+			 T2a = VADD(T26, T29);
+			 T2b = VFNMS(LDK(KP250000000), T2a, T23);
+			 T2e = VSUB(T24, T25);
+			 T2f = VSUB(T27, T28);
+			 T2g = VMUL(LDK(KP951056516), VFMA(LDK(KP618033988), T2f, T2e));
+			 T2i = VMUL(LDK(KP951056516), VFNMS(LDK(KP618033988), T2e, T2f));
+			 ST(&(x[0]), VADD(T23, T2a), ms, &(x[0]));
+			 T2h = VFNMS(LDK(KP559016994), T2c, T2b);
+			 ST(&(x[WS(rs, 8)]), VFMAI(T2i, T2h), ms, &(x[0]));
+			 ST(&(x[WS(rs, 12)]), VFNMSI(T2i, T2h), ms, &(x[0]));
+			 T2d = VFMA(LDK(KP559016994), T2c, T2b);
+			 ST(&(x[WS(rs, 4)]), VFNMSI(T2g, T2d), ms, &(x[0]));
+			 ST(&(x[WS(rs, 16)]), VFMAI(T2g, T2d), ms, &(x[0]));
+		    }
+		    {
+			 V T1W, T1U, T1V, T20, T22, T1Y, T1Z, T21, T1X;
+			 T1W = VSUB(T1M, T1T);
+			 T1U = VADD(T1M, T1T);
+			 T1V = VFNMS(LDK(KP250000000), T1U, T1F);
+			 T1Y = VSUB(T1P, T1S);
+			 T1Z = VSUB(T1I, T1L);
+			 T20 = VMUL(LDK(KP951056516), VFNMS(LDK(KP618033988), T1Z, T1Y));
+			 T22 = VMUL(LDK(KP951056516), VFMA(LDK(KP618033988), T1Y, T1Z));
+			 ST(&(x[WS(rs, 10)]), VADD(T1F, T1U), ms, &(x[0]));
+			 T21 = VFMA(LDK(KP559016994), T1W, T1V);
+			 ST(&(x[WS(rs, 6)]), VFMAI(T22, T21), ms, &(x[0]));
+			 ST(&(x[WS(rs, 14)]), VFNMSI(T22, T21), ms, &(x[0]));
+			 T1X = VFNMS(LDK(KP559016994), T1W, T1V);
+			 ST(&(x[WS(rs, 2)]), VFNMSI(T20, T1X), ms, &(x[0]));
+			 ST(&(x[WS(rs, 18)]), VFMAI(T20, T1X), ms, &(x[0]));
+		    }
+		    {
+			 V T19, T1p, T1x, T1u, T1m, T1w, TI, T1t;
+			 T19 = VFMA(LDK(KP618033988), T18, TU);
+			 T1p = VFMA(LDK(KP618033988), T1o, T1n);
+			 T1x = VFNMS(LDK(KP618033988), T1n, T1o);
+			 T1u = VFNMS(LDK(KP618033988), TU, T18);
+			 {
+			      V T1k, T1l, TG, TH;
+			      T1k = VFNMS(LDK(KP250000000), T1j, T1g);
+			      T1l = VSUB(T1h, T1i);
+			      T1m = VFMA(LDK(KP559016994), T1l, T1k);
+			      T1w = VFNMS(LDK(KP559016994), T1l, T1k);
+			      TG = VFNMS(LDK(KP250000000), TF, T7);
+			      TH = VSUB(Tp, TE);
+			      TI = VFMA(LDK(KP559016994), TH, TG);
+			      T1t = VFNMS(LDK(KP559016994), TH, TG);
+			 }
+			 {
+			      V T1a, T1q, T1z, T1A;
+			      T1a = VFNMS(LDK(KP951056516), T19, TI);
+			      T1q = VFMA(LDK(KP951056516), T1p, T1m);
+			      ST(&(x[WS(rs, 19)]), VFNMSI(T1q, T1a), ms, &(x[WS(rs, 1)]));
+			      ST(&(x[WS(rs, 1)]), VFMAI(T1q, T1a), ms, &(x[WS(rs, 1)]));
+			      T1z = VFNMS(LDK(KP951056516), T1u, T1t);
+			      T1A = VFMA(LDK(KP951056516), T1x, T1w);
+			      ST(&(x[WS(rs, 7)]), VFNMSI(T1A, T1z), ms, &(x[WS(rs, 1)]));
+			      ST(&(x[WS(rs, 13)]), VFMAI(T1A, T1z), ms, &(x[WS(rs, 1)]));
+			 }
+			 {
+			      V T1r, T1s, T1v, T1y;
+			      T1r = VFMA(LDK(KP951056516), T19, TI);
+			      T1s = VFNMS(LDK(KP951056516), T1p, T1m);
+			      ST(&(x[WS(rs, 11)]), VFNMSI(T1s, T1r), ms, &(x[WS(rs, 1)]));
+			      ST(&(x[WS(rs, 9)]), VFMAI(T1s, T1r), ms, &(x[WS(rs, 1)]));
+			      T1v = VFMA(LDK(KP951056516), T1u, T1t);
+			      T1y = VFNMS(LDK(KP951056516), T1x, T1w);
+			      ST(&(x[WS(rs, 3)]), VFNMSI(T1y, T1v), ms, &(x[WS(rs, 1)]));
+			      ST(&(x[WS(rs, 17)]), VFMAI(T1y, T1v), ms, &(x[WS(rs, 1)]));
+			 }
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const tw_instr twinstr[] = {
+     VTW(0, 1),
+     VTW(0, 3),
+     VTW(0, 9),
+     VTW(0, 19),
+     { TW_NEXT, VL, 0 }
+};
+
+static const ct_desc desc = { 20, XSIMD_STRING("t3bv_20"), twinstr, &GENUS, { 92, 72, 46, 0 }, 0, 0, 0 };
+
+void XSIMD(codelet_t3bv_20) (planner *p) {
+     X(kdft_dit_register) (p, t3bv_20, &desc);
+}
+#else
+
+/* Generated by: ../../../genfft/gen_twiddle_c.native -simd -compact -variables 4 -pipeline-latency 8 -twiddle-log3 -precompute-twiddles -no-generate-bytw -n 20 -name t3bv_20 -include dft/simd/t3b.h -sign 1 */
+
+/*
+ * This function contains 138 FP additions, 92 FP multiplications,
+ * (or, 126 additions, 80 multiplications, 12 fused multiply/add),
+ * 73 stack variables, 4 constants, and 40 memory accesses
+ */
+#include "dft/simd/t3b.h"
+
+static void t3bv_20(R *ri, R *ii, const R *W, stride rs, INT mb, INT me, INT ms)
+{
+     DVK(KP587785252, +0.587785252292473129168705954639072768597652438);
+     DVK(KP951056516, +0.951056516295153572116439333379382143405698634);
+     DVK(KP250000000, +0.250000000000000000000000000000000000000000000);
+     DVK(KP559016994, +0.559016994374947424102293417182819058860154590);
+     {
+	  INT m;
+	  R *x;
+	  x = ii;
+	  for (m = mb, W = W + (mb * ((TWVL / VL) * 8)); m < me; m = m + VL, x = x + (VL * ms), W = W + (TWVL * 8), MAKE_VOLATILE_STRIDE(20, rs)) {
+	       V T2, T8, T9, TA, T3, Tc, T4, TV, T14, Tl, Tq, Tx, TQ, Td, Te;
+	       V T1g, Ti, Tt, T11;
+	       T2 = LDW(&(W[0]));
+	       T8 = LDW(&(W[TWVL * 2]));
+	       T9 = VZMUL(T2, T8);
+	       TA = VZMULJ(T2, T8);
+	       T3 = LDW(&(W[TWVL * 4]));
+	       Tc = VZMULJ(T9, T3);
+	       T4 = VZMUL(T2, T3);
+	       TV = VZMUL(T9, T3);
+	       T14 = VZMULJ(TA, T3);
+	       Tl = VZMULJ(T8, T3);
+	       Tq = VZMULJ(T2, T3);
+	       Tx = VZMUL(T8, T3);
+	       TQ = VZMUL(TA, T3);
+	       Td = LDW(&(W[TWVL * 6]));
+	       Te = VZMULJ(Tc, Td);
+	       T1g = VZMULJ(T9, Td);
+	       Ti = VZMULJ(T8, Td);
+	       Tt = VZMULJ(T2, Td);
+	       T11 = VZMULJ(TA, Td);
+	       {
+		    V T7, T1j, T1U, T2a, TU, T1n, T1o, T18, Tp, TE, TF, T26, T27, T28, T1M;
+		    V T1P, T1W, T1b, T1c, T1k, T23, T24, T25, T1F, T1I, T1V, T1B, T1C;
+		    {
+			 V T1, T1i, T6, T1f, T1h, T5, T1e, T1S, T1T;
+			 T1 = LD(&(x[0]), ms, &(x[0]));
+			 T1h = LD(&(x[WS(rs, 15)]), ms, &(x[WS(rs, 1)]));
+			 T1i = VZMUL(T1g, T1h);
+			 T5 = LD(&(x[WS(rs, 10)]), ms, &(x[0]));
+			 T6 = VZMUL(T4, T5);
+			 T1e = LD(&(x[WS(rs, 5)]), ms, &(x[WS(rs, 1)]));
+			 T1f = VZMUL(Tc, T1e);
+			 T7 = VSUB(T1, T6);
+			 T1j = VSUB(T1f, T1i);
+			 T1S = VADD(T1, T6);
+			 T1T = VADD(T1f, T1i);
+			 T1U = VSUB(T1S, T1T);
+			 T2a = VADD(T1S, T1T);
+		    }
+		    {
+			 V Th, T1D, T10, T1L, T17, T1O, To, T1G, Tw, T1K, TN, T1E, TT, T1H, TD;
+			 V T1N;
+			 {
+			      V Tb, Tg, Ta, Tf;
+			      Ta = LD(&(x[WS(rs, 4)]), ms, &(x[0]));
+			      Tb = VZMUL(T9, Ta);
+			      Tf = LD(&(x[WS(rs, 14)]), ms, &(x[0]));
+			      Tg = VZMUL(Te, Tf);
+			      Th = VSUB(Tb, Tg);
+			      T1D = VADD(Tb, Tg);
+			 }
+			 {
+			      V TX, TZ, TW, TY;
+			      TW = LD(&(x[WS(rs, 13)]), ms, &(x[WS(rs, 1)]));
+			      TX = VZMUL(TV, TW);
+			      TY = LD(&(x[WS(rs, 3)]), ms, &(x[WS(rs, 1)]));
+			      TZ = VZMUL(T8, TY);
+			      T10 = VSUB(TX, TZ);
+			      T1L = VADD(TX, TZ);
+			 }
+			 {
+			      V T13, T16, T12, T15;
+			      T12 = LD(&(x[WS(rs, 17)]), ms, &(x[WS(rs, 1)]));
+			      T13 = VZMUL(T11, T12);
+			      T15 = LD(&(x[WS(rs, 7)]), ms, &(x[WS(rs, 1)]));
+			      T16 = VZMUL(T14, T15);
+			      T17 = VSUB(T13, T16);
+			      T1O = VADD(T13, T16);
+			 }
+			 {
+			      V Tk, Tn, Tj, Tm;
+			      Tj = LD(&(x[WS(rs, 16)]), ms, &(x[0]));
+			      Tk = VZMUL(Ti, Tj);
+			      Tm = LD(&(x[WS(rs, 6)]), ms, &(x[0]));
+			      Tn = VZMUL(Tl, Tm);
+			      To = VSUB(Tk, Tn);
+			      T1G = VADD(Tk, Tn);
+			 }
+			 {
+			      V Ts, Tv, Tr, Tu;
+			      Tr = LD(&(x[WS(rs, 8)]), ms, &(x[0]));
+			      Ts = VZMUL(Tq, Tr);
+			      Tu = LD(&(x[WS(rs, 18)]), ms, &(x[0]));
+			      Tv = VZMUL(Tt, Tu);
+			      Tw = VSUB(Ts, Tv);
+			      T1K = VADD(Ts, Tv);
+			 }
+			 {
+			      V TK, TM, TJ, TL;
+			      TJ = LD(&(x[WS(rs, 9)]), ms, &(x[WS(rs, 1)]));
+			      TK = VZMUL(T3, TJ);
+			      TL = LD(&(x[WS(rs, 19)]), ms, &(x[WS(rs, 1)]));
+			      TM = VZMUL(Td, TL);
+			      TN = VSUB(TK, TM);
+			      T1E = VADD(TK, TM);
+			 }
+			 {
+			      V TP, TS, TO, TR;
+			      TO = LD(&(x[WS(rs, 1)]), ms, &(x[WS(rs, 1)]));
+			      TP = VZMUL(T2, TO);
+			      TR = LD(&(x[WS(rs, 11)]), ms, &(x[WS(rs, 1)]));
+			      TS = VZMUL(TQ, TR);
+			      TT = VSUB(TP, TS);
+			      T1H = VADD(TP, TS);
+			 }
+			 {
+			      V Tz, TC, Ty, TB;
+			      Ty = LD(&(x[WS(rs, 12)]), ms, &(x[0]));
+			      Tz = VZMUL(Tx, Ty);
+			      TB = LD(&(x[WS(rs, 2)]), ms, &(x[0]));
+			      TC = VZMUL(TA, TB);
+			      TD = VSUB(Tz, TC);
+			      T1N = VADD(Tz, TC);
+			 }
+			 TU = VSUB(TN, TT);
+			 T1n = VSUB(Th, To);
+			 T1o = VSUB(Tw, TD);
+			 T18 = VSUB(T10, T17);
+			 Tp = VADD(Th, To);
+			 TE = VADD(Tw, TD);
+			 TF = VADD(Tp, TE);
+			 T26 = VADD(T1K, T1L);
+			 T27 = VADD(T1N, T1O);
+			 T28 = VADD(T26, T27);
+			 T1M = VSUB(T1K, T1L);
+			 T1P = VSUB(T1N, T1O);
+			 T1W = VADD(T1M, T1P);
+			 T1b = VADD(TN, TT);
+			 T1c = VADD(T10, T17);
+			 T1k = VADD(T1b, T1c);
+			 T23 = VADD(T1D, T1E);
+			 T24 = VADD(T1G, T1H);
+			 T25 = VADD(T23, T24);
+			 T1F = VSUB(T1D, T1E);
+			 T1I = VSUB(T1G, T1H);
+			 T1V = VADD(T1F, T1I);
+		    }
+		    T1B = VADD(T7, TF);
+		    T1C = VBYI(VADD(T1j, T1k));
+		    ST(&(x[WS(rs, 15)]), VSUB(T1B, T1C), ms, &(x[WS(rs, 1)]));
+		    ST(&(x[WS(rs, 5)]), VADD(T1B, T1C), ms, &(x[WS(rs, 1)]));
+		    {
+			 V T29, T2b, T2c, T2g, T2i, T2e, T2f, T2h, T2d;
+			 T29 = VMUL(LDK(KP559016994), VSUB(T25, T28));
+			 T2b = VADD(T25, T28);
+			 T2c = VFNMS(LDK(KP250000000), T2b, T2a);
+			 T2e = VSUB(T23, T24);
+			 T2f = VSUB(T26, T27);
+			 T2g = VBYI(VFMA(LDK(KP951056516), T2e, VMUL(LDK(KP587785252), T2f)));
+			 T2i = VBYI(VFNMS(LDK(KP951056516), T2f, VMUL(LDK(KP587785252), T2e)));
+			 ST(&(x[0]), VADD(T2a, T2b), ms, &(x[0]));
+			 T2h = VSUB(T2c, T29);
+			 ST(&(x[WS(rs, 8)]), VSUB(T2h, T2i), ms, &(x[0]));
+			 ST(&(x[WS(rs, 12)]), VADD(T2i, T2h), ms, &(x[0]));
+			 T2d = VADD(T29, T2c);
+			 ST(&(x[WS(rs, 4)]), VSUB(T2d, T2g), ms, &(x[0]));
+			 ST(&(x[WS(rs, 16)]), VADD(T2g, T2d), ms, &(x[0]));
+		    }
+		    {
+			 V T1Z, T1X, T1Y, T1R, T21, T1J, T1Q, T22, T20;
+			 T1Z = VMUL(LDK(KP559016994), VSUB(T1V, T1W));
+			 T1X = VADD(T1V, T1W);
+			 T1Y = VFNMS(LDK(KP250000000), T1X, T1U);
+			 T1J = VSUB(T1F, T1I);
+			 T1Q = VSUB(T1M, T1P);
+			 T1R = VBYI(VFNMS(LDK(KP951056516), T1Q, VMUL(LDK(KP587785252), T1J)));
+			 T21 = VBYI(VFMA(LDK(KP951056516), T1J, VMUL(LDK(KP587785252), T1Q)));
+			 ST(&(x[WS(rs, 10)]), VADD(T1U, T1X), ms, &(x[0]));
+			 T22 = VADD(T1Z, T1Y);
+			 ST(&(x[WS(rs, 6)]), VADD(T21, T22), ms, &(x[0]));
+			 ST(&(x[WS(rs, 14)]), VSUB(T22, T21), ms, &(x[0]));
+			 T20 = VSUB(T1Y, T1Z);
+			 ST(&(x[WS(rs, 2)]), VADD(T1R, T20), ms, &(x[0]));
+			 ST(&(x[WS(rs, 18)]), VSUB(T20, T1R), ms, &(x[0]));
+		    }
+		    {
+			 V T19, T1p, T1w, T1u, T1m, T1x, TI, T1t;
+			 T19 = VFNMS(LDK(KP951056516), T18, VMUL(LDK(KP587785252), TU));
+			 T1p = VFNMS(LDK(KP951056516), T1o, VMUL(LDK(KP587785252), T1n));
+			 T1w = VFMA(LDK(KP951056516), T1n, VMUL(LDK(KP587785252), T1o));
+			 T1u = VFMA(LDK(KP951056516), TU, VMUL(LDK(KP587785252), T18));
+			 {
+			      V T1d, T1l, TG, TH;
+			      T1d = VMUL(LDK(KP559016994), VSUB(T1b, T1c));
+			      T1l = VFNMS(LDK(KP250000000), T1k, T1j);
+			      T1m = VSUB(T1d, T1l);
+			      T1x = VADD(T1d, T1l);
+			      TG = VFNMS(LDK(KP250000000), TF, T7);
+			      TH = VMUL(LDK(KP559016994), VSUB(Tp, TE));
+			      TI = VSUB(TG, TH);
+			      T1t = VADD(TH, TG);
+			 }
+			 {
+			      V T1a, T1q, T1z, T1A;
+			      T1a = VSUB(TI, T19);
+			      T1q = VBYI(VSUB(T1m, T1p));
+			      ST(&(x[WS(rs, 17)]), VSUB(T1a, T1q), ms, &(x[WS(rs, 1)]));
+			      ST(&(x[WS(rs, 3)]), VADD(T1a, T1q), ms, &(x[WS(rs, 1)]));
+			      T1z = VADD(T1t, T1u);
+			      T1A = VBYI(VSUB(T1x, T1w));
+			      ST(&(x[WS(rs, 11)]), VSUB(T1z, T1A), ms, &(x[WS(rs, 1)]));
+			      ST(&(x[WS(rs, 9)]), VADD(T1z, T1A), ms, &(x[WS(rs, 1)]));
+			 }
+			 {
+			      V T1r, T1s, T1v, T1y;
+			      T1r = VADD(TI, T19);
+			      T1s = VBYI(VADD(T1p, T1m));
+			      ST(&(x[WS(rs, 13)]), VSUB(T1r, T1s), ms, &(x[WS(rs, 1)]));
+			      ST(&(x[WS(rs, 7)]), VADD(T1r, T1s), ms, &(x[WS(rs, 1)]));
+			      T1v = VSUB(T1t, T1u);
+			      T1y = VBYI(VADD(T1w, T1x));
+			      ST(&(x[WS(rs, 19)]), VSUB(T1v, T1y), ms, &(x[WS(rs, 1)]));
+			      ST(&(x[WS(rs, 1)]), VADD(T1v, T1y), ms, &(x[WS(rs, 1)]));
+			 }
+		    }
+	       }
+	  }
+     }
+     VLEAVE();
+}
+
+static const tw_instr twinstr[] = {
+     VTW(0, 1),
+     VTW(0, 3),
+     VTW(0, 9),
+     VTW(0, 19),
+     { TW_NEXT, VL, 0 }
+};
+
+static const ct_desc desc = { 20, XSIMD_STRING("t3bv_20"), twinstr, &GENUS, { 126, 80, 12, 0 }, 0, 0, 0 };
+
+void XSIMD(codelet_t3bv_20) (planner *p) {
+     X(kdft_dit_register) (p, t3bv_20, &desc);
+}
+#endif
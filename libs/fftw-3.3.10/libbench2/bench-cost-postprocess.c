@@ -0,0 +1,8 @@
+/* not worth copyrighting */
+#include "libbench2/bench.h"
+
+/* default routine, can be overridden by user */
+double bench_cost_postprocess(double cost)
+{
+     return cost;
+}
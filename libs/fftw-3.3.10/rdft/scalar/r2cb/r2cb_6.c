@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Tue Sep 14 10:46:47 EDT 2021 */
+
+#include "rdft/codelet-rdft.h"
+
+#if defined(ARCH_PREFERS_FMA) || defined(ISA_EXTENSION_PREFERS_FMA)
+
+/* Generated by: ../../../genfft/gen_r2cb.native -fma -compact -variables 4 -pipeline-latency 4 -sign 1 -n 6 -name r2cb_6 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 14 FP additions, 6 FP multiplications,
+ * (or, 8 additions, 0 multiplications, 6 fused multiply/add),
+ * 17 stack variables, 2 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2cb.h"
+
+static void r2cb_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, R0 = R0 + ovs, R1 = R1 + ovs, Cr = Cr + ivs, Ci = Ci + ivs, MAKE_VOLATILE_STRIDE(24, rs), MAKE_VOLATILE_STRIDE(24, csr), MAKE_VOLATILE_STRIDE(24, csi)) {
+	       E T3, T7, Tc, Te, T6, T8, T1, T2, T9, Td;
+	       T1 = Cr[0];
+	       T2 = Cr[WS(csr, 3)];
+	       T3 = T1 + T2;
+	       T7 = T1 - T2;
+	       {
+		    E Ta, Tb, T4, T5;
+		    Ta = Ci[WS(csi, 2)];
+		    Tb = Ci[WS(csi, 1)];
+		    Tc = Ta - Tb;
+		    Te = Ta + Tb;
+		    T4 = Cr[WS(csr, 2)];
+		    T5 = Cr[WS(csr, 1)];
+		    T6 = T4 + T5;
+		    T8 = T5 - T4;
+	       }
+	       R0[0] = FMA(KP2_000000000, T6, T3);
+	       R1[WS(rs, 1)] = FNMS(KP2_000000000, T8, T7);
+	       T9 = T3 - T6;
+	       R0[WS(rs, 2)] = FNMS(KP1_732050807, Tc, T9);
+	       R0[WS(rs, 1)] = FMA(KP1_732050807, Tc, T9);
+	       Td = T7 + T8;
+	       R1[0] = FNMS(KP1_732050807, Te, Td);
+	       R1[WS(rs, 2)] = FMA(KP1_732050807, Te, Td);
+	  }
+     }
+}
+
+static const kr2c_desc desc = { 6, "r2cb_6", { 8, 0, 6, 0 }, &GENUS };
+
+void X(codelet_r2cb_6) (planner *p) { X(kr2c_register) (p, r2cb_6, &desc);
+}
+
+#else
+
+/* Generated by: ../../../genfft/gen_r2cb.native -compact -variables 4 -pipeline-latency 4 -sign 1 -n 6 -name r2cb_6 -include rdft/scalar/r2cb.h */
+
+/*
+ * This function contains 14 FP additions, 4 FP multiplications,
+ * (or, 12 additions, 2 multiplications, 2 fused multiply/add),
+ * 17 stack variables, 2 constants, and 12 memory accesses
+ */
+#include "rdft/scalar/r2cb.h"
+
+static void r2cb_6(R *R0, R *R1, R *Cr, R *Ci, stride rs, stride csr, stride csi, INT v, INT ivs, INT ovs)
+{
+     DK(KP2_000000000, +2.000000000000000000000000000000000000000000000);
+     DK(KP1_732050807, +1.732050807568877293527446341505872366942805254);
+     {
+	  INT i;
+	  for (i = v; i > 0; i = i - 1, R0 = R0 + ovs, R1 = R1 + ovs, Cr = Cr + ivs, Ci = Ci + ivs, MAKE_VOLATILE_STRIDE(24, rs), MAKE_VOLATILE_STRIDE(24, csr), MAKE_VOLATILE_STRIDE(24, csi)) {
+	       E T3, T7, Tc, Te, T6, T8, T1, T2, T9, Td;
+	       T1 = Cr[0];
+	       T2 = Cr[WS(csr, 3)];
+	       T3 = T1 - T2;
+	       T7 = T1 + T2;
+	       {
+		    E Ta, Tb, T4, T5;
+		    Ta = Ci[WS(csi, 2)];
+		    Tb = Ci[WS(csi, 1)];
+		    Tc = KP1_732050807 * (Ta - Tb);
+		    Te = KP1_732050807 * (Ta + Tb);
+		    T4 = Cr[WS(csr, 2)];
+		    T5 = Cr[WS(csr, 1)];
+		    T6 = T4 - T5;
+		    T8 = T4 + T5;
+	       }
+	       R1[WS(rs, 1)] = FMA(KP2_000000000, T6, T3);
+	       R0[0] = FMA(KP2_000000000, T8, T7);
+	       T9 = T7 - T8;
+	       R0[WS(rs, 2)] = T9 - Tc;
+	       R0[WS(rs, 1)] = T9 + Tc;
+	       Td = T3 - T6;
+	       R1[0] = Td - Te;
+	       R1[WS(rs, 2)] = Td + Te;
+	  }
+     }
+}
+
+static const kr2c_desc desc = { 6, "r2cb_6", { 12, 2, 2, 0 }, &GENUS };
+
+void X(codelet_r2cb_6) (planner *p) { X(kr2c_register) (p, r2cb_6, &desc);
+}
+
+#endif
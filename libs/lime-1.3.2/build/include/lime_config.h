@@ -0,0 +1,34 @@
+#ifndef LIME_CONFIG_H
+#define LIME_CONFIG_H
+
+
+/* Undef the unwanted from the environment -- eg the compiler command line */
+#undef PACKAGE
+#undef PACKAGE_BUGREPORT
+#undef PACKAGE_NAME
+#undef PACKAGE_STRING
+#undef PACKAGE_TARNAME
+#undef PACKAGE_VERSION
+#undef VERSION
+
+/* Include the stuff generated by autoconf */
+#include "lime_config_internal.h"
+
+/* Prefix everything with LIME_ */
+static const char* const LIME_PACKAGE = PACKAGE;
+static const char* const LIME_PACKAGE_BUGREPORT = PACKAGE_BUGREPORT;
+static const char* const LIME_PACKAGE_NAME = PACKAGE_NAME;
+static const char* const LIME_PACKAGE_STRING = PACKAGE_STRING;
+static const char* const LIME_PACKAGE_TARNAME = PACKAGE_TARNAME;
+static const char* const LIME_PACKAGE_VERSION = PACKAGE_VERSION;
+/* LIME_VERSION is already defined in lime_defs.h */
+
+/* Undef the unwanted */
+#undef PACKAGE
+#undef PACKAGE_BUGREPORT
+#undef PACKAGE_NAME
+#undef PACKAGE_STRING
+#undef PACKAGE_TARNAME
+#undef PACKAGE_VERSION
+#undef VERSION
+#endif
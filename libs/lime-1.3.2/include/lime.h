@@ -0,0 +1,10 @@
+#ifndef LIME_H
+#define LIME_H
+
+#include <lime_config.h>
+#include <dcap-overload.h>
+#include <lime_defs.h>
+#include <lime_header.h>
+#include <lime_writer.h>
+#include <lime_reader.h>
+#endif